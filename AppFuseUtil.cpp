@@ -16,9 +16,15 @@
 
 #include "AppFuseUtil.h"
 
+#include <stdio.h>
 #include <sys/mount.h>
 #include <utils/Errors.h>
 
+#include <chrono>
+#include <deque>
+#include <map>
+#include <mutex>
+
 #include <android-base/logging.h>
 #include <android-base/stringprintf.h>
 
@@ -33,6 +39,86 @@ namespace {
 
 static size_t kAppFuseMaxMountPointName = 32;
 
+// Document providers and the like open proxied files one session after another, and every
+// session needs a mount point. The FUSE connection itself can't outlive its session, but the
+// labeled directory can: those of finished sessions are kept for a while, so the next session
+// of the same uid renames one into place instead of creating and labeling a new one.
+static constexpr size_t kMaxIdleMountPointsPerUid = 4;
+static constexpr std::chrono::seconds kIdleMountPointTimeout(60);
+
+struct IdleMountPoint {
+    std::string path;
+    std::chrono::steady_clock::time_point since;
+};
+
+static std::mutex sIdleMountPointsLock;
+// Most recently released last
+static std::map<uid_t, std::deque<IdleMountPoint>> sIdleMountPoints;
+
+// Removes the directories that have been idle for too long. Needs sIdleMountPointsLock.
+static void ExpireIdleMountPoints() {
+    auto now = std::chrono::steady_clock::now();
+    for (auto it = sIdleMountPoints.begin(); it != sIdleMountPoints.end();) {
+        auto& idle = it->second;
+        while (!idle.empty() && now - idle.front().since >= kIdleMountPointTimeout) {
+            if (rmdir(idle.front().path.c_str()) != 0 && errno != ENOENT) {
+                PLOG(WARNING) << "Failed to remove idle mount point " << idle.front().path;
+            }
+            idle.pop_front();
+        }
+        it = idle.empty() ? sIdleMountPoints.erase(it) : std::next(it);
+    }
+}
+
+// Puts an idle mount point of uid at path, and returns whether there was one to use.
+static bool TakeIdleMountPoint(uid_t uid, const std::string& path) {
+    std::lock_guard<std::mutex> lock(sIdleMountPointsLock);
+    ExpireIdleMountPoints();
+    auto it = sIdleMountPoints.find(uid);
+    if (it == sIdleMountPoints.end()) return false;
+    auto& idle = it->second;
+
+    bool taken = false;
+    for (auto entry = idle.begin(); entry != idle.end(); ++entry) {
+        if (entry->path == path) {
+            idle.erase(entry);
+            taken = true;
+            break;
+        }
+    }
+    if (!taken) {
+        auto entry = std::move(idle.back());
+        idle.pop_back();
+        if (rename(entry.path.c_str(), path.c_str()) == 0) {
+            taken = true;
+        } else {
+            PLOG(WARNING) << "Failed to reuse " << entry.path << " as " << path;
+            rmdir(entry.path.c_str());
+        }
+    }
+    if (idle.empty()) sIdleMountPoints.erase(it);
+    return taken;
+}
+
+// Keeps the unmounted mount point at path for a later session of uid, or removes it.
+static android::status_t ReleaseMountPoint(uid_t uid, const std::string& path) {
+    std::lock_guard<std::mutex> lock(sIdleMountPointsLock);
+    ExpireIdleMountPoints();
+    auto& idle = sIdleMountPoints[uid];
+    for (const auto& entry : idle) {
+        if (entry.path == path) return android::OK;
+    }
+    if (idle.size() >= kMaxIdleMountPointsPerUid) {
+        if (rmdir(path.c_str()) != 0) {
+            PLOG(ERROR) << "Failed to remove the mount directory.";
+            return -errno;
+        }
+        return android::OK;
+    }
+    idle.push_back({path, std::chrono::steady_clock::now()});
+    return android::OK;
+}
+
 static android::status_t GetMountPath(uid_t uid, const std::string& name, std::string* path) {
     if (name.size() > kAppFuseMaxMountPointName) {
         LOG(ERROR) << "AppFuse mount name is too long.";
@@ -87,11 +173,7 @@ static android::status_t RunCommand(const std::string& command, uid_t uid, const
             PLOG(ERROR) << "Failed to unmount directory.";
             return -errno;
         }
-        if (rmdir(path.c_str()) != 0) {
-            PLOG(ERROR) << "Failed to remove the mount directory.";
-            return -errno;
-        }
-        return android::OK;
+        return ReleaseMountPoint(uid, path);
     } else {
         LOG(ERROR) << "Unknown appfuse command " << command;
         return -EPERM;
@@ -112,16 +194,19 @@ int MountAppFuse(uid_t uid, int mountId, android::base::unique_fd* device_fd) {
         return -1;
     }
 
-    // Forcibly remove the existing mount before we attempt to prepare the
-    // directory. If we have a dangling mount, then PrepareDir may fail if the
-    // indirection to FUSE doesn't work.
-    android::vold::ForceUnmount(path);
-
-    // Create directories.
-    const android::status_t result = android::vold::PrepareDir(path, 0700, 0, 0);
-    if (result != android::OK) {
-        PLOG(ERROR) << "Failed to prepare directory " << path;
-        return -1;
+    // An idle mount point was unmounted by UnmountAppFuse(), and is ready as it is.
+    if (!TakeIdleMountPoint(uid, path)) {
+        // Forcibly remove the existing mount before we attempt to prepare the
+        // directory. If we have a dangling mount, then PrepareDir may fail if the
+        // indirection to FUSE doesn't work.
+        android::vold::ForceUnmount(path);
+
+        // Create directories.
+        const android::status_t result = android::vold::PrepareDir(path, 0700, 0, 0);
+        if (result != android::OK) {
+            PLOG(ERROR) << "Failed to prepare directory " << path;
+            return -1;
+        }
     }
 
     // Open device FD.
@@ -15,24 +15,43 @@
  */
 
 #include "Benchmark.h"
-#include "BenchmarkGen.h"
+#include "BenchmarkTrace.h"
+#include "MetadataCrypt.h"
 #include "VolumeManager.h"
 
 #include <android-base/chrono_utils.h>
 #include <android-base/file.h>
 #include <android-base/logging.h>
+#include <android-base/parseint.h>
+#include <android-base/properties.h>
+#include <android-base/scopeguard.h>
+#include <android-base/stringprintf.h>
+#include <android-base/strings.h>
+#include <android-base/unique_fd.h>
 
 #include <cutils/iosched_policy.h>
 #include <private/android_filesystem_config.h>
 #include <wakelock/wakelock.h>
 
+#include <functional>
+#include <random>
 #include <thread>
 
+#include <dirent.h>
+#include <fcntl.h>
+#include <inttypes.h>
 #include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
 #include <sys/time.h>
 #include <unistd.h>
 
+using android::base::Basename;
+using android::base::GetBoolProperty;
 using android::base::ReadFileToString;
+using android::base::Realpath;
+using android::base::Split;
+using android::base::StringPrintf;
 using android::base::WriteStringToFile;
 
 namespace android {
@@ -44,9 +63,13 @@ static std::mutex kBenchmarkLock;
 
 static const char* kWakeLock = "Benchmark";
 
-// Reasonable cards are able to complete the create/run stages
-// in under 20 seconds.
-constexpr auto kTimeout = 20s;
+// Set to replay each trace one op at a time, like benchmarks did before traces were replayed
+// with their original concurrency, to compare against older results.
+static const char* kSerialReplayProp = "persist.vold.benchmark_serial_replay";
+
+// Comma-separated crypto sector sizes, such as "512,4096", that raw block runs also read the
+// partition under the volume through, to compare them before picking one in fstab.
+static const char* kCryptoSectorSizesProp = "persist.vold.benchmark_crypto_sector_sizes";
 
 // RAII class for boosting device performance during benchmarks.
 class PerformanceBoost {
@@ -86,11 +109,316 @@ class PerformanceBoost {
     }
 };
 
-static status_t benchmarkInternal(const std::string& rootPath,
+// Adds the latency percentiles of each kind of op replayed to extras, as "read_p99_us" and so
+// on, with the throughput of reads and writes over the whole run. They're also logged, one
+// line of key=value pairs per kind of op.
+static void reportStats(const BenchmarkTrace& trace, const std::string& prefix,
+                        const ReplayStats& stats, std::chrono::milliseconds elapsed,
+                        android::os::PersistableBundle* extras) {
+    static const std::pair<const char*, double> kPercentiles[] = {
+            {"p50", 0.5},
+            {"p90", 0.9},
+            {"p99", 0.99},
+            {"p999", 0.999},
+    };
+    auto put = [&](const std::string& key, int64_t value) {
+        extras->putLong(String16((prefix + key).c_str()), value);
+    };
+
+    for (int i = 0; i < ReplayStats::kKinds; i++) {
+        auto kind = static_cast<ReplayStats::Kind>(i);
+        const auto& latency = stats.latency[kind];
+        std::string name = ReplayStats::kindName(kind);
+        auto line = StringPrintf("trace=%s op=%s count=%" PRIu64, trace.name().c_str(),
+                                 name.c_str(), latency.count());
+
+        put(name + "_count", latency.count());
+        for (const auto& [label, fraction] : kPercentiles) {
+            uint64_t usecs = latency.percentile(fraction) / 1000;
+            put(name + "_" + label + "_us", usecs);
+            line += StringPrintf(" %s_us=%" PRIu64, label, usecs);
+        }
+        put(name + "_max_us", latency.max() / 1000);
+        line += StringPrintf(" max_us=%" PRIu64, latency.max() / 1000);
+
+        if (kind == ReplayStats::kReads || kind == ReplayStats::kWrites) {
+            uint64_t kbps = stats.bytes[kind] * 1000 / 1024 / std::max<int64_t>(elapsed.count(), 1);
+            put(name + "_kbps", kbps);
+            line += StringPrintf(" bytes=%" PRIu64 " kbps=%" PRIu64, stats.bytes[kind], kbps);
+        }
+        LOG(INFO) << "Benchmark stats: " << line;
+    }
+}
+
+// Replays one trace in the current directory. Results of the default trace go into extras under
+// the plain stage names, and those of any other trace are prefixed with its name.
+static status_t benchmarkTrace(const BenchmarkTrace& trace, const std::string& prefix,
+                               const BenchmarkOptions& options,
+                               const BenchmarkTrace::ReplayOptions& replay,
+                               const std::function<void(int)>& progress,
+                               android::os::PersistableBundle* extras) {
+    status_t res = 0;
+    auto key = [&](const char* stage) { return String16((prefix + stage).c_str()); };
+
+    extras->putString(key("ident"), String16(trace.ident().c_str()));
+
+    // Always create
+    {
+        android::base::Timer timer;
+        LOG(INFO) << "Creating " << trace.name();
+        res |= trace.create(
+                [&](int p) -> bool {
+                    progress(p);
+                    return (timer.duration() < options.timeBudget);
+                },
+                replay);
+        sync();
+        if (res == OK) extras->putLong(key("create"), timer.duration().count());
+    }
+
+    // Only drop when we haven't aborted
+    if (res == OK) {
+        android::base::Timer timer;
+        LOG(DEBUG) << "Before drop_caches";
+        if (!WriteStringToFile("3", "/proc/sys/vm/drop_caches")) {
+            PLOG(ERROR) << "Failed to drop_caches";
+            res = -1;
+        }
+        LOG(DEBUG) << "After drop_caches";
+        sync();
+        if (res == OK) extras->putLong(key("drop"), timer.duration().count());
+    }
+
+    // Only run when we haven't aborted
+    if (res == OK) {
+        android::base::Timer timer;
+        LOG(INFO) << "Running " << trace.name();
+        ReplayStats stats;
+        res |= trace.run(
+                [&](int p) -> bool {
+                    progress(p);
+                    return (timer.duration() < options.timeBudget);
+                },
+                replay, &stats);
+        auto elapsed = timer.duration();
+        sync();
+        if (res == OK) {
+            extras->putLong(key("run"), timer.duration().count());
+            reportStats(trace, prefix, stats, elapsed, extras);
+        }
+    }
+
+    // Always destroy
+    {
+        android::base::Timer timer;
+        LOG(INFO) << "Destroying " << trace.name();
+        res |= trace.destroy();
+        sync();
+        if (res == OK) extras->putLong(key("destroy"), timer.duration().count());
+    }
+
+    return res;
+}
+
+// The raw block mode only reads: the devices hold the mounted filesystem, so writing to them
+// at all would corrupt it.
+static constexpr uint64_t kSeqReadChunk = 1024 * 1024;
+static constexpr uint64_t kSeqReadBytes = 256 * 1024 * 1024;
+static constexpr uint64_t kRandReadChunk = 4096;
+static constexpr uint64_t kRandReads = 4096;
+// Deep enough for any real stack of device-mapper targets.
+static constexpr int kMaxBlockLayers = 8;
+
+// The block devices under the filesystem at path: the one it's mounted from first, then down
+// through each device-mapper target with a single device below it, such as the dm-default-key
+// or dm-crypt device set up by create_crypto_blk_dev(), to the partition underneath.
+static std::vector<std::pair<std::string, dev_t>> blockLayers(const std::string& path) {
+    std::vector<std::pair<std::string, dev_t>> layers;
+    struct stat sb;
+    if (stat(path.c_str(), &sb) != 0) {
+        PLOG(ERROR) << "Failed to stat " << path;
+        return layers;
+    }
+
+    std::string sysPath;
+    if (!Realpath(StringPrintf("/sys/dev/block/%u:%u", major(sb.st_dev), minor(sb.st_dev)),
+                  &sysPath)) {
+        LOG(ERROR) << path << " isn't on a block device";
+        return layers;
+    }
+    layers.emplace_back(Basename(sysPath), sb.st_dev);
+
+    while (layers.size() < kMaxBlockLayers) {
+        auto dir = std::unique_ptr<DIR, int (*)(DIR*)>(opendir((sysPath + "/slaves").c_str()),
+                                                       closedir);
+        if (!dir) break;
+        std::vector<std::string> slaves;
+        struct dirent* ent;
+        while ((ent = readdir(dir.get())) != nullptr) {
+            if (ent->d_name[0] != '.') slaves.push_back(ent->d_name);
+        }
+        // With several devices below, none of them sees all of the I/O.
+        if (slaves.size() != 1) break;
+
+        std::string dev;
+        unsigned int maj, min;
+        if (!Realpath(sysPath + "/slaves/" + slaves[0], &sysPath) ||
+            !ReadFileToString(sysPath + "/dev", &dev) ||
+            sscanf(dev.c_str(), "%u:%u", &maj, &min) != 2) {
+            break;
+        }
+        layers.emplace_back(slaves[0], makedev(maj, min));
+    }
+    return layers;
+}
+
+// Reads one block device with O_DIRECT, sequentially and then at random, and adds the results to
+// extras under "<prefix>seq_read_kbps", "<prefix>rand_read_iops" and so on.
+static status_t benchmarkBlockDevice(const std::string& name, dev_t dev,
+                                     const std::string& prefix, const BenchmarkOptions& options,
+                                     const std::function<bool(int)>& checkpoint,
+                                     android::os::PersistableBundle* extras) {
+    auto put = [&](const std::string& key, int64_t value) {
+        extras->putLong(String16((prefix + key).c_str()), value);
+    };
+    extras->putString(String16((prefix + "name").c_str()), String16(name.c_str()));
+
+    auto nodePath = StringPrintf("/dev/block/vold/bench:%u,%u", major(dev), minor(dev));
+    if (CreateDeviceNode(nodePath, dev) != OK) return -1;
+    auto nodeGuard = android::base::make_scope_guard([&] { DestroyDeviceNode(nodePath); });
+
+    android::base::unique_fd fd(
+            TEMP_FAILURE_RETRY(open(nodePath.c_str(), O_RDONLY | O_DIRECT | O_CLOEXEC)));
+    uint64_t size;
+    if (fd == -1 || GetBlockDevSize(fd, &size) != OK) {
+        PLOG(ERROR) << "Failed to open " << name;
+        return -1;
+    }
+    void* mem = nullptr;
+    if (posix_memalign(&mem, kRandReadChunk, kSeqReadChunk) != 0) return -ENOMEM;
+    std::unique_ptr<char, void (*)(void*)> buf(static_cast<char*>(mem), free);
+
+    LOG(INFO) << "Reading block device " << name;
+    uint64_t total = std::min<uint64_t>(kSeqReadBytes * options.scale, size);
+    total -= total % kSeqReadChunk;
+    android::base::Timer timer;
+    for (uint64_t offset = 0; offset < total; offset += kSeqReadChunk) {
+        if (offset % (16 * kSeqReadChunk) == 0 && !checkpoint((offset * 50) / total)) return -1;
+        if (TEMP_FAILURE_RETRY(pread(fd, buf.get(), kSeqReadChunk, offset)) < 0) {
+            PLOG(ERROR) << "Failed to read " << name;
+            return -1;
+        }
+    }
+    put("seq_read_kbps", total * 1000 / 1024 / std::max<int64_t>(timer.duration().count(), 1));
+
+    // A fixed seed reads the same blocks every run, so runs can be compared.
+    std::mt19937_64 random(size);
+    uint64_t blocks = size / kRandReadChunk;
+    uint64_t reads = std::max<uint64_t>(kRandReads * options.scale, 1);
+    LatencyHistogram latency;
+    timer = android::base::Timer();
+    for (uint64_t i = 0; i < reads && blocks > 0; i++) {
+        if (i % 256 == 0 && !checkpoint(50 + (i * 50) / reads)) return -1;
+        uint64_t offset = (random() % blocks) * kRandReadChunk;
+        auto start = std::chrono::steady_clock::now();
+        if (TEMP_FAILURE_RETRY(pread(fd, buf.get(), kRandReadChunk, offset)) < 0) {
+            PLOG(ERROR) << "Failed to read " << name;
+            return -1;
+        }
+        latency.record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::steady_clock::now() - start)
+                               .count());
+    }
+    put("rand_read_iops", latency.count() * 1000 / std::max<int64_t>(timer.duration().count(), 1));
+    put("rand_read_p50_us", latency.percentile(0.5) / 1000);
+    put("rand_read_p99_us", latency.percentile(0.99) / 1000);
+    return OK;
+}
+
+static std::vector<unsigned int> cryptoSectorSizes() {
+    std::vector<unsigned int> sizes;
+    for (const auto& part : Split(android::base::GetProperty(kCryptoSectorSizesProp, ""), ",")) {
+        unsigned int size;
+        if (part.empty()) continue;
+        if (!android::base::ParseUint(part, &size)) {
+            LOG(WARNING) << "Ignoring bad crypto sector size " << part;
+            continue;
+        }
+        sizes.push_back(size);
+    }
+    return sizes;
+}
+
+// Benchmarks each block device layer under the volume at path, as "block0_" for the one it's
+// mounted from, "block1_" for the one below, and so on. Comparing the layers shows what
+// encryption and any other device-mapper target costs. Then, for each size listed in
+// kCryptoSectorSizesProp, the bottom layer is read through a dm-default-key device with crypto
+// sectors of that size, as "crypto<size>_".
+static status_t benchmarkBlockDevices(const std::string& path, const BenchmarkOptions& options,
+                                      const std::function<void(int)>& progress,
+                                      android::os::PersistableBundle* extras) {
+    auto layers = blockLayers(path);
+    if (layers.empty()) return -1;
+    auto sectorSizes = cryptoSectorSizes();
+
+    size_t runs = layers.size() + sectorSizes.size();
+    status_t res = OK;
+    auto run = [&](size_t i, const std::string& name, dev_t dev, const std::string& prefix) {
+        android::base::Timer timer;
+        res = benchmarkBlockDevice(
+                name, dev, prefix, options,
+                [&](int p) -> bool {
+                    progress((i * 100 + p) / runs);
+                    return (timer.duration() < options.timeBudget);
+                },
+                extras);
+    };
+    for (size_t i = 0; i < layers.size() && res == OK; i++) {
+        run(i, layers[i].first, layers[i].second, StringPrintf("block%zu_", i));
+    }
+
+    const auto& bottom = layers.back();
+    auto bottomPath = StringPrintf("/dev/block/vold/bench:%u,%u", major(bottom.second),
+                                   minor(bottom.second));
+    for (size_t i = 0; i < sectorSizes.size() && res == OK; i++) {
+        auto dmName = StringPrintf("bench_crypto_%u", sectorSizes[i]);
+        if (CreateDeviceNode(bottomPath, bottom.second) != OK) return -1;
+        auto nodeGuard = android::base::make_scope_guard([&] { DestroyDeviceNode(bottomPath); });
+        dev_t dev;
+        if (!defaultkey_create_benchmark_device(dmName, bottomPath, sectorSizes[i], &dev)) {
+            return -1;
+        }
+        run(layers.size() + i, dmName, dev, StringPrintf("crypto%u_", sectorSizes[i]));
+        defaultkey_destroy_benchmark_device(dmName);
+    }
+    return res;
+}
+
+// Direct I/O silently failing on every replayed file would look like a very fast device, so
+// check up front that the filesystem takes it.
+static bool supportsDirectIo() {
+    static const char* kProbe = "direct_io_probe";
+    android::base::unique_fd fd(TEMP_FAILURE_RETRY(
+            open(kProbe, O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT | O_CLOEXEC, 0600)));
+    if (fd == -1) {
+        PLOG(ERROR) << "Direct I/O isn't supported here";
+        return false;
+    }
+    unlink(kProbe);
+    return true;
+}
+
+static status_t benchmarkInternal(const std::string& rootPath, const BenchmarkOptions& options,
                                   const android::sp<android::os::IVoldTaskListener>& listener,
                                   android::os::PersistableBundle* extras) {
     status_t res = 0;
 
+    auto traces = LoadBenchmarkTraces();
+    if (traces.empty()) {
+        LOG(ERROR) << "No benchmark traces found";
+        return -1;
+    }
+
     auto path = rootPath;
     path += "/misc";
     if (android::vold::PrepareDir(path, 01771, AID_SYSTEM, AID_MISC)) {
@@ -118,56 +446,40 @@ static status_t benchmarkInternal(const std::string& rootPath,
     sync();
 
     extras->putString(String16("path"), String16(path.c_str()));
-    extras->putString(String16("ident"), String16(BenchmarkIdent().c_str()));
 
-    // Always create
-    {
-        android::base::Timer timer;
-        LOG(INFO) << "Creating " << path;
-        res |= BenchmarkCreate([&](int progress) -> bool {
-            if (listener) {
-                listener->onStatus(progress, *extras);
-            }
-            return (timer.duration() < kTimeout);
-        });
-        sync();
-        if (res == OK) extras->putLong(String16("create"), timer.duration().count());
-    }
+    BenchmarkTrace::ReplayOptions replay;
+    replay.mode = GetBoolProperty(kSerialReplayProp, false) ? BenchmarkTrace::kSerial
+                                                            : BenchmarkTrace::kConcurrent;
+    replay.scale = options.scale;
+    replay.directIo = options.directIo;
+    extras->putString(String16("replay"),
+                      String16(replay.mode == BenchmarkTrace::kSerial ? "serial" : "concurrent"));
+    extras->putDouble(String16("scale"), options.scale);
+    extras->putLong(String16("time_budget"), options.timeBudget.count());
+    extras->putBoolean(String16("direct_io"), options.directIo);
+    extras->putBoolean(String16("raw_block"), options.rawBlock);
 
-    // Only drop when we haven't aborted
-    if (res == OK) {
-        android::base::Timer timer;
-        LOG(DEBUG) << "Before drop_caches";
-        if (!WriteStringToFile("3", "/proc/sys/vm/drop_caches")) {
-            PLOG(ERROR) << "Failed to drop_caches";
-            res = -1;
-        }
-        LOG(DEBUG) << "After drop_caches";
-        sync();
-        if (res == OK) extras->putLong(String16("drop"), timer.duration().count());
+    if (options.directIo && !supportsDirectIo()) {
+        res = -1;
     }
 
-    // Only run when we haven't aborted
-    if (res == OK) {
-        android::base::Timer timer;
-        LOG(INFO) << "Running " << path;
-        res |= BenchmarkRun([&](int progress) -> bool {
+    // Each trace, and the raw block devices, get an equal share of the overall progress, and
+    // the later ones are skipped once one of them has aborted.
+    size_t parts = traces.size() + (options.rawBlock ? 1 : 0);
+    auto progressFor = [&](size_t part) {
+        return [&, part](int p) {
             if (listener) {
-                listener->onStatus(progress, *extras);
+                listener->onStatus((part * 100 + p) / parts, *extras);
             }
-            return (timer.duration() < kTimeout);
-        });
-        sync();
-        if (res == OK) extras->putLong(String16("run"), timer.duration().count());
+        };
+    };
+    for (size_t i = 0; i < traces.size() && res == OK; i++) {
+        const auto& trace = *traces[i];
+        res |= benchmarkTrace(trace, i == 0 ? "" : trace.name() + "_", options, replay,
+                              progressFor(i), extras);
     }
-
-    // Always destroy
-    {
-        android::base::Timer timer;
-        LOG(INFO) << "Destroying " << path;
-        res |= BenchmarkDestroy();
-        sync();
-        if (res == OK) extras->putLong(String16("destroy"), timer.duration().count());
+    if (options.rawBlock && res == OK) {
+        res |= benchmarkBlockDevices(path, options, progressFor(traces.size()), extras);
     }
 
     if (chdir(orig_cwd) != 0) {
@@ -178,7 +490,7 @@ static status_t benchmarkInternal(const std::string& rootPath,
     return res;
 }
 
-void Benchmark(const std::string& path,
+void Benchmark(const std::string& path, const BenchmarkOptions& options,
                const android::sp<android::os::IVoldTaskListener>& listener) {
     std::lock_guard<std::mutex> lock(kBenchmarkLock);
     auto wl = android::wakelock::WakeLock::tryGet(kWakeLock);
@@ -189,7 +501,7 @@ void Benchmark(const std::string& path,
     PerformanceBoost boost;
     android::os::PersistableBundle extras;
 
-    status_t res = benchmarkInternal(path, listener, &extras);
+    status_t res = benchmarkInternal(path, options, listener, &extras);
     if (listener) {
         listener->onFinished(res, extras);
     }
@@ -19,13 +19,25 @@
 
 #include "android/os/IVoldTaskListener.h"
 
+#include <chrono>
 #include <string>
 
 namespace android {
 namespace vold {
 
+struct BenchmarkOptions {
+    /* Working set of the traces, as a multiple of the size of their files and I/Os */
+    double scale = 1.0;
+    /* How long each trace's create and run stages may take before the benchmark gives up */
+    std::chrono::milliseconds timeBudget = std::chrono::seconds(20);
+    /* Replay reads and writes with O_DIRECT, so they aren't served from the page cache */
+    bool directIo = false;
+    /* Also read straight from each block device layer under the volume */
+    bool rawBlock = false;
+};
+
 // clang-format off
-void Benchmark(const std::string& path,
+void Benchmark(const std::string& path, const BenchmarkOptions& options,
                const android::sp<android::os::IVoldTaskListener>& listener);
 // clang-format on
 
@@ -0,0 +1,536 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BenchmarkTrace.h"
+#include "Utils.h"
+
+#include <android-base/file.h>
+#include <android-base/logging.h>
+#include <android-base/stringprintf.h>
+#include <android-base/strings.h>
+#include <android-base/unique_fd.h>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+
+using android::base::StringPrintf;
+using android::base::unique_fd;
+using namespace std::chrono_literals;
+
+namespace android {
+namespace vold {
+
+static_assert(sizeof(BenchmarkTrace::Header) == 20, "trace header layout changed");
+static_assert(sizeof(BenchmarkTrace::Op) == 24, "trace op layout changed");
+
+static const char* kTraceDirs[] = {
+        "/system/etc/vold/benchmark",
+        "/data/misc/vold/benchmark_traces",
+};
+static const char* kTraceSuffix = ".vbt";
+static const char* kDefaultTrace = "app_launch";
+
+// Traces are a few hundred kB; anything far bigger isn't one.
+static constexpr size_t kMaxTraceBytes = 64 * 1024 * 1024;
+
+static std::string fileName(uint32_t index) {
+    return StringPrintf("file%u", index);
+}
+
+static uint64_t alignUp(uint64_t value) {
+    uint64_t align = BenchmarkTrace::kDirectIoAlignment;
+    return (value + align - 1) / align * align;
+}
+
+static int openFlags(uint8_t flags, const BenchmarkTrace::ReplayOptions& options) {
+    int res = O_LARGEFILE;
+    if (options.directIo && !(flags & BenchmarkTrace::kDirectory)) res |= O_DIRECT;
+    if (flags & BenchmarkTrace::kReadWrite) {
+        res |= O_RDWR;
+    } else if (flags & BenchmarkTrace::kWriteOnly) {
+        res |= O_WRONLY;
+    } else {
+        res |= O_RDONLY;
+    }
+    if (flags & BenchmarkTrace::kCreate) res |= O_CREAT;
+    if (flags & BenchmarkTrace::kExclusive) res |= O_EXCL;
+    if (flags & BenchmarkTrace::kTruncate) res |= O_TRUNC;
+    if (flags & BenchmarkTrace::kDirectory) res |= O_DIRECTORY;
+    if (flags & BenchmarkTrace::kCloseOnExec) res |= O_CLOEXEC;
+    return res;
+}
+
+std::unique_ptr<BenchmarkTrace> BenchmarkTrace::Load(const std::string& path) {
+    std::string data;
+    if (!android::base::ReadFileToString(path, &data)) {
+        PLOG(ERROR) << "Failed to read benchmark trace " << path;
+        return nullptr;
+    }
+
+    Header header;
+    if (data.size() > kMaxTraceBytes || data.size() < sizeof(header)) {
+        LOG(ERROR) << "Benchmark trace " << path << " has a bad size " << data.size();
+        return nullptr;
+    }
+    memcpy(&header, data.data(), sizeof(header));
+    if (memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        LOG(ERROR) << "Benchmark trace " << path << " has a bad magic";
+        return nullptr;
+    }
+    uint64_t expected = sizeof(header) + header.nameLength +
+                        uint64_t(header.fileCount) * sizeof(uint64_t) +
+                        uint64_t(header.opCount) * sizeof(Op);
+    if (data.size() != expected || header.nameLength == 0) {
+        LOG(ERROR) << "Benchmark trace " << path << " is truncated or malformed";
+        return nullptr;
+    }
+
+    std::unique_ptr<BenchmarkTrace> trace(new BenchmarkTrace());
+    const char* pos = data.data() + sizeof(header);
+    trace->name_.assign(pos, header.nameLength);
+    pos += header.nameLength;
+    trace->fileSizes_.resize(header.fileCount);
+    memcpy(trace->fileSizes_.data(), pos, header.fileCount * sizeof(uint64_t));
+    pos += header.fileCount * sizeof(uint64_t);
+    trace->ops_.resize(header.opCount);
+    memcpy(trace->ops_.data(), pos, header.opCount * sizeof(Op));
+    trace->handleCount_ = header.handleCount;
+    trace->threadCount_ = header.threadCount;
+
+    if (trace->name_.find('/') != std::string::npos) {
+        LOG(ERROR) << "Benchmark trace " << path << " has a bad name";
+        return nullptr;
+    }
+    // Each handle is first opened, and then only ever used by the thread that opened it, which
+    // concurrent replay relies on to share the descriptors between threads without locking.
+    std::vector<int> handleThreads(trace->handleCount_, -1);
+    for (const auto& op : trace->ops_) {
+        bool valid = op.code >= kOpen && op.code <= kFdatasync &&
+                     op.handle < trace->handleCount_ && op.thread < trace->threadCount_;
+        if (valid && handleThreads[op.handle] == -1 && op.code == kOpen) {
+            handleThreads[op.handle] = op.thread;
+        }
+        valid = valid && handleThreads[op.handle] == op.thread;
+        switch (op.code) {
+            case kOpen:
+                valid = valid && op.arg < header.fileCount;
+                break;
+            case kRead:
+            case kWrite:
+            case kPread:
+            case kPwrite:
+                valid = valid && op.length <= kMaxIoBytes && op.offset >= 0;
+                break;
+            case kLseek:
+                valid = valid && op.arg <= SEEK_END;
+                break;
+        }
+        if (!valid) {
+            LOG(ERROR) << "Benchmark trace " << path << " has a bad op " << int(op.code);
+            return nullptr;
+        }
+    }
+    return trace;
+}
+
+std::string BenchmarkTrace::ident() const {
+    int reads = 0, writes = 0, syncs = 0;
+    for (const auto& op : ops_) {
+        switch (op.code) {
+            case kRead:
+            case kPread:
+                reads++;
+                break;
+            case kWrite:
+            case kPwrite:
+                writes++;
+                break;
+            case kFsync:
+            case kFdatasync:
+                syncs++;
+                break;
+        }
+    }
+    return StringPrintf("r%d:w%d:s%d", reads, writes, syncs);
+}
+
+static status_t createFile(const std::string& name, uint64_t len) {
+    size_t chunk = std::min<uint64_t>(len, 65536);
+    std::string buf;
+
+    if (ReadRandomBytes(chunk, buf) != OK) {
+        LOG(ERROR) << "Failed to read random data";
+        return -EIO;
+    }
+    unique_fd out(TEMP_FAILURE_RETRY(
+            open(name.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644)));
+    if (out == -1) {
+        PLOG(ERROR) << "Failed to open " << name;
+        return -errno;
+    }
+
+    while (len > 0) {
+        ssize_t n = TEMP_FAILURE_RETRY(write(out, buf.data(), std::min<uint64_t>(len, chunk)));
+        if (n < 0) {
+            PLOG(ERROR) << "Failed to write";
+            return -errno;
+        }
+        len -= n;
+    }
+    return OK;
+}
+
+status_t BenchmarkTrace::create(const std::function<bool(int)>& checkpoint,
+                                const ReplayOptions& options) const {
+    status_t res = OK;
+    for (size_t i = 0; i < fileSizes_.size(); i++) {
+        if ((i + 1) % 12 == 0 && !checkpoint(((i + 1) * 50) / fileSizes_.size())) return -1;
+        uint64_t size = std::ceil(fileSizes_[i] * options.scale);
+        if (options.directIo) size = alignUp(size);
+        res |= createFile(fileName(i), size);
+    }
+    return res;
+}
+
+size_t LatencyHistogram::bucketFor(uint64_t nsecs) {
+    nsecs = std::min(nsecs, (uint64_t(1) << kMaxBits) - 1);
+    if (nsecs < (1 << kSubBucketBits)) return nsecs;
+    // Each power of two gets 1 << kSubBucketBits buckets, picked by the bits below its top one.
+    int bits = 63 - __builtin_clzll(nsecs);
+    int shift = bits - kSubBucketBits;
+    return ((shift + 1) << kSubBucketBits) + (nsecs >> shift) - (1 << kSubBucketBits);
+}
+
+uint64_t LatencyHistogram::bucketStart(size_t bucket) {
+    if (bucket < (1 << kSubBucketBits)) return bucket;
+    int shift = (bucket >> kSubBucketBits) - 1;
+    return uint64_t((bucket & ((1 << kSubBucketBits) - 1)) + (1 << kSubBucketBits)) << shift;
+}
+
+void LatencyHistogram::record(uint64_t nsecs) {
+    buckets_[bucketFor(nsecs)]++;
+    count_++;
+    max_ = std::max(max_, nsecs);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < kBuckets; i++) {
+        buckets_[i] += other.buckets_[i];
+    }
+    count_ += other.count_;
+    max_ = std::max(max_, other.max_);
+}
+
+uint64_t LatencyHistogram::percentile(double fraction) const {
+    if (count_ == 0) return 0;
+    uint64_t rank = std::max<uint64_t>(1, std::ceil(fraction * count_));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBuckets; i++) {
+        seen += buckets_[i];
+        if (seen >= rank) {
+            uint64_t end = (i + 1 < kBuckets) ? bucketStart(i + 1) - 1 : max_;
+            return std::min(end, max_);
+        }
+    }
+    return max_;
+}
+
+const char* ReplayStats::kindName(Kind kind) {
+    switch (kind) {
+        case kOpens:
+            return "open";
+        case kReads:
+            return "read";
+        case kWrites:
+            return "write";
+        case kSyncs:
+            return "sync";
+        default:
+            return "unknown";
+    }
+}
+
+void ReplayStats::merge(const ReplayStats& other) {
+    for (int i = 0; i < kKinds; i++) {
+        latency[i].merge(other.latency[i]);
+        bytes[i] += other.bytes[i];
+    }
+}
+
+// Buffers are always aligned for direct I/O.
+static std::unique_ptr<char, void (*)(void*)> allocBuffer(size_t bytes) {
+    void* buf = nullptr;
+    if (posix_memalign(&buf, BenchmarkTrace::kDirectIoAlignment, bytes) != 0) buf = nullptr;
+    return {static_cast<char*>(buf), free};
+}
+
+static uint32_t ioLength(const BenchmarkTrace::Op& op,
+                         const BenchmarkTrace::ReplayOptions& options) {
+    uint64_t res = std::ceil(op.length * options.scale);
+    if (options.directIo) res = alignUp(std::max<uint64_t>(res, 1));
+    return std::min<uint64_t>(res, BenchmarkTrace::kMaxIoBytes);
+}
+
+static int64_t ioOffset(const BenchmarkTrace::Op& op,
+                        const BenchmarkTrace::ReplayOptions& options) {
+    int64_t res = op.offset * options.scale;
+    if (options.directIo) res -= res % BenchmarkTrace::kDirectIoAlignment;
+    return res;
+}
+
+// O_DIRECT needs an aligned file position as well, so a read or write at the current position
+// is done at the aligned position below it, and then moves it on like read() and write() do.
+static ssize_t directReadWrite(int fd, char* buf, uint32_t length, bool write) {
+    off_t pos = lseek(fd, 0, SEEK_CUR);
+    if (pos == -1) return -1;
+    pos -= pos % BenchmarkTrace::kDirectIoAlignment;
+    ssize_t res = write ? TEMP_FAILURE_RETRY(pwrite(fd, buf, length, pos))
+                        : TEMP_FAILURE_RETRY(pread(fd, buf, length, pos));
+    if (res > 0) lseek(fd, pos + res, SEEK_SET);
+    return res;
+}
+
+// Results are ignored, like in the original workload: a failed open just makes the later calls
+// on that descriptor fail with EBADF.
+static void replayOp(const BenchmarkTrace::Op& op, const BenchmarkTrace::ReplayOptions& options,
+                     std::vector<unique_fd>& fds, char* buf, ReplayStats& stats) {
+    int fd = fds[op.handle].get();
+    uint32_t length = ioLength(op, options);
+    ssize_t res = 0;
+    ReplayStats::Kind kind = ReplayStats::kKinds;
+    auto start = std::chrono::steady_clock::now();
+    switch (op.code) {
+        case BenchmarkTrace::kOpen:
+            fds[op.handle].reset(TEMP_FAILURE_RETRY(
+                    open(fileName(op.arg).c_str(), openFlags(op.flags, options), op.length)));
+            kind = ReplayStats::kOpens;
+            break;
+        case BenchmarkTrace::kClose:
+            fds[op.handle].reset();
+            break;
+        case BenchmarkTrace::kRead:
+            res = options.directIo ? directReadWrite(fd, buf, length, false)
+                                   : TEMP_FAILURE_RETRY(read(fd, buf, length));
+            kind = ReplayStats::kReads;
+            break;
+        case BenchmarkTrace::kWrite:
+            res = options.directIo ? directReadWrite(fd, buf, length, true)
+                                   : TEMP_FAILURE_RETRY(write(fd, buf, length));
+            kind = ReplayStats::kWrites;
+            break;
+        case BenchmarkTrace::kPread:
+            res = TEMP_FAILURE_RETRY(pread(fd, buf, length, ioOffset(op, options)));
+            kind = ReplayStats::kReads;
+            break;
+        case BenchmarkTrace::kPwrite:
+            res = TEMP_FAILURE_RETRY(pwrite(fd, buf, length, ioOffset(op, options)));
+            kind = ReplayStats::kWrites;
+            break;
+        case BenchmarkTrace::kLseek:
+            TEMP_FAILURE_RETRY(lseek(fd, op.offset * options.scale, op.arg));
+            break;
+        case BenchmarkTrace::kFsync:
+            TEMP_FAILURE_RETRY(fsync(fd));
+            kind = ReplayStats::kSyncs;
+            break;
+        case BenchmarkTrace::kFdatasync:
+            TEMP_FAILURE_RETRY(fdatasync(fd));
+            kind = ReplayStats::kSyncs;
+            break;
+    }
+    if (kind != ReplayStats::kKinds) {
+        auto nsecs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - start);
+        stats.latency[kind].record(nsecs.count());
+        if (res > 0) stats.bytes[kind] += res;
+    }
+}
+
+status_t BenchmarkTrace::run(const std::function<bool(int)>& checkpoint,
+                             const ReplayOptions& options, ReplayStats* stats) const {
+    ReplayStats local;
+    status_t res = (options.mode == kConcurrent) ? runConcurrent(checkpoint, options, &local)
+                                                 : runSerial(checkpoint, options, &local);
+    if (stats) stats->merge(local);
+    return res;
+}
+
+status_t BenchmarkTrace::runSerial(const std::function<bool(int)>& checkpoint,
+                                   const ReplayOptions& options, ReplayStats* stats) const {
+    auto buf = allocBuffer(kMaxIoBytes);
+    if (!buf) return -ENOMEM;
+    std::vector<unique_fd> fds(handleCount_);
+    for (size_t i = 0; i < ops_.size(); i++) {
+        if ((i + 1) % 256 == 0 && !checkpoint(50 + ((i + 1) * 50) / ops_.size())) return -1;
+        replayOp(ops_[i], options, fds, buf.get(), *stats);
+    }
+    return OK;
+}
+
+/*
+ * Every traced thread is replayed on a thread of its own, in its original order. The only
+ * ordering kept between threads is that opening a file waits for whatever other threads did to
+ * that file before it in the trace, so that a file is written or created before it is read back.
+ */
+status_t BenchmarkTrace::runConcurrent(const std::function<bool(int)>& checkpoint,
+                                       const ReplayOptions& options, ReplayStats* stats) const {
+    static constexpr size_t kNone = SIZE_MAX;
+
+    std::vector<std::vector<size_t>> streams(threadCount_);
+    std::vector<uint32_t> streamBytes(threadCount_);
+    std::vector<size_t> deps(ops_.size(), kNone);
+    std::vector<bool> needed(ops_.size());
+    {
+        // The last op on each file, and the last one from any other thread than that one's.
+        struct LastOps {
+            size_t op = kNone;
+            uint16_t thread = 0;
+            size_t otherOp = kNone;
+        };
+        std::vector<LastOps> files(fileSizes_.size());
+        std::vector<uint32_t> handleFiles(handleCount_);
+        for (size_t i = 0; i < ops_.size(); i++) {
+            const Op& op = ops_[i];
+            streams[op.thread].push_back(i);
+            if (op.code != kOpen) {
+                streamBytes[op.thread] = std::max(streamBytes[op.thread], ioLength(op, options));
+            }
+            if (op.code == kOpen) handleFiles[op.handle] = op.arg;
+
+            LastOps& last = files[handleFiles[op.handle]];
+            if (op.code == kOpen) {
+                deps[i] = (last.thread != op.thread) ? last.op : last.otherOp;
+                if (deps[i] != kNone) needed[deps[i]] = true;
+            }
+            if (last.op != kNone && last.thread != op.thread) {
+                last.otherOp = last.op;
+            }
+            last.op = i;
+            last.thread = op.thread;
+        }
+    }
+
+    // Every handle belongs to a single thread, so the descriptors need no locking.
+    std::vector<unique_fd> fds(handleCount_);
+    std::mutex lock;
+    std::condition_variable cv;
+    std::vector<bool> done(ops_.size());
+    std::atomic<bool> aborted = false;
+    std::atomic<size_t> completed = 0;
+    size_t finished = 0;
+    // Each thread measures into its own, which are only added up once they're all done.
+    std::vector<ReplayStats> threadStats(streams.size());
+
+    // Sized for each thread's largest read or write, rather than kMaxIoBytes for each.
+    std::vector<std::unique_ptr<char, void (*)(void*)>> buffers;
+    for (uint32_t bytes : streamBytes) {
+        buffers.push_back(allocBuffer(std::max<uint32_t>(bytes, 1)));
+        if (!buffers.back()) return -ENOMEM;
+    }
+
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < streams.size(); t++) {
+        threads.emplace_back([&, t] {
+            char* buf = buffers[t].get();
+            for (size_t i : streams[t]) {
+                if (deps[i] != kNone) {
+                    std::unique_lock<std::mutex> guard(lock);
+                    cv.wait(guard, [&] { return aborted || done[deps[i]]; });
+                }
+                if (aborted) break;
+                replayOp(ops_[i], options, fds, buf, threadStats[t]);
+                completed++;
+                if (needed[i]) {
+                    std::lock_guard<std::mutex> guard(lock);
+                    done[i] = true;
+                    cv.notify_all();
+                }
+            }
+            std::lock_guard<std::mutex> guard(lock);
+            finished++;
+            cv.notify_all();
+        });
+    }
+
+    status_t res = OK;
+    std::unique_lock<std::mutex> guard(lock);
+    while (!cv.wait_for(guard, 250ms, [&] { return finished == threads.size(); })) {
+        guard.unlock();
+        bool proceed = checkpoint(50 + (completed * 50) / ops_.size());
+        guard.lock();
+        if (!proceed) {
+            aborted = true;
+            cv.notify_all();
+            res = -1;
+            break;
+        }
+    }
+    guard.unlock();
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& threadStat : threadStats) {
+        stats->merge(threadStat);
+    }
+    return res;
+}
+
+status_t BenchmarkTrace::destroy() const {
+    status_t res = OK;
+    for (size_t i = 0; i < fileSizes_.size(); i++) {
+        res |= unlink(fileName(i).c_str());
+    }
+    return res;
+}
+
+std::vector<std::unique_ptr<BenchmarkTrace>> LoadBenchmarkTraces() {
+    std::map<std::string, std::string> paths;
+    for (const char* dir : kTraceDirs) {
+        auto dirp = std::unique_ptr<DIR, int (*)(DIR*)>(opendir(dir), closedir);
+        if (!dirp) continue;
+        struct dirent* ent;
+        while ((ent = readdir(dirp.get())) != nullptr) {
+            std::string name(ent->d_name);
+            if (!android::base::EndsWith(name, kTraceSuffix)) continue;
+            paths[name] = StringPrintf("%s/%s", dir, ent->d_name);
+        }
+    }
+
+    std::vector<std::unique_ptr<BenchmarkTrace>> traces;
+    for (const auto& [name, path] : paths) {
+        auto trace = BenchmarkTrace::Load(path);
+        if (trace) traces.push_back(std::move(trace));
+    }
+    std::stable_partition(traces.begin(), traces.end(),
+                          [](const auto& trace) { return trace->name() == kDefaultTrace; });
+    return traces;
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_VOLD_BENCHMARK_TRACE_H
+#define ANDROID_VOLD_BENCHMARK_TRACE_H
+
+#include <utils/Errors.h>
+
+#include <stdint.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace android {
+namespace vold {
+
+/* Log-linear histogram of latencies in nanoseconds, accurate to 1/16th of each value */
+class LatencyHistogram {
+  public:
+    void record(uint64_t nsecs);
+    void merge(const LatencyHistogram& other);
+
+    uint64_t count() const { return count_; }
+    uint64_t max() const { return max_; }
+    /* Latency that the given fraction of the recorded ones didn't exceed, rounded up */
+    uint64_t percentile(double fraction) const;
+
+  private:
+    static constexpr int kSubBucketBits = 4;
+    /* Latencies from 2^kMaxBits ns (about 18 minutes) up all count as the largest bucket */
+    static constexpr int kMaxBits = 40;
+    static constexpr size_t kBuckets = (kMaxBits - kSubBucketBits + 1) << kSubBucketBits;
+
+    static size_t bucketFor(uint64_t nsecs);
+    static uint64_t bucketStart(size_t bucket);
+
+    uint64_t buckets_[kBuckets] = {};
+    uint64_t count_ = 0;
+    uint64_t max_ = 0;
+};
+
+/* What an op replay measured, by kind of op */
+struct ReplayStats {
+    enum Kind {
+        kOpens,
+        kReads,
+        kWrites,
+        kSyncs,
+        kKinds,
+    };
+    static const char* kindName(Kind kind);
+
+    LatencyHistogram latency[kKinds];
+    /* Bytes actually transferred */
+    uint64_t bytes[kKinds] = {};
+
+    void merge(const ReplayStats& other);
+};
+
+/*
+ * A storage workload captured with strace and converted by bench/benchgen.py, which
+ * Benchmark() replays against files it creates in the current directory.
+ *
+ * A trace file is little-endian and laid out as:
+ *   Header, followed by nameLength bytes of trace name
+ *   fileCount x uint64_t: size of each data file, replayed as "file<index>"
+ *   opCount x Op
+ */
+class BenchmarkTrace {
+  public:
+    static constexpr char kMagic[4] = {'V', 'B', 'T', '1'};
+    /* Largest read or write in a trace, which is also the size of the replay buffer */
+    static constexpr uint32_t kMaxIoBytes = 1024 * 1024;
+
+    /* Buffer, offset and length alignment of reads and writes with direct I/O */
+    static constexpr uint32_t kDirectIoAlignment = 4096;
+
+    enum ReplayMode {
+        /* One op at a time, in the order they were traced */
+        kSerial,
+        /* Each traced thread's ops on a thread of their own */
+        kConcurrent,
+    };
+
+    struct ReplayOptions {
+        ReplayMode mode = kConcurrent;
+        /*
+         * Multiplies the size of every data file, and the offset and length of every read and
+         * write, up to kMaxIoBytes each.
+         */
+        double scale = 1.0;
+        /* Opens data files with O_DIRECT, widening each read and write to aligned blocks */
+        bool directIo = false;
+    };
+
+    enum OpCode : uint8_t {
+        kOpen = 1,
+        kClose,
+        kRead,
+        kWrite,
+        kPread,
+        kPwrite,
+        kLseek,
+        kFsync,
+        kFdatasync,
+    };
+
+    /* Portable open(2) flags, so traces don't depend on the ABI they were captured on */
+    enum OpenFlag : uint8_t {
+        kWriteOnly = 1 << 0,
+        kReadWrite = 1 << 1,
+        kCreate = 1 << 2,
+        kExclusive = 1 << 3,
+        kTruncate = 1 << 4,
+        kDirectory = 1 << 5,
+        kCloseOnExec = 1 << 6,
+    };
+
+    struct Header {
+        char magic[4];
+        uint32_t fileCount;
+        uint32_t handleCount;
+        uint32_t opCount;
+        uint16_t threadCount;
+        uint16_t nameLength;
+    };
+
+    struct Op {
+        uint8_t code;
+        /* OpenFlag bits for kOpen */
+        uint8_t flags;
+        /* Index of the traced thread that issued it */
+        uint16_t thread;
+        /* Index of the file descriptor it acts on; kOpen assigns it */
+        uint32_t handle;
+        /* Byte count for reads and writes, or the creation mode for kOpen */
+        uint32_t length;
+        /* Index of the file for kOpen, or the whence for kLseek */
+        uint32_t arg;
+        /* File offset for kPread, kPwrite and kLseek */
+        int64_t offset;
+    };
+
+    /* Reads and validates the trace at path, returning nullptr if it is unusable */
+    static std::unique_ptr<BenchmarkTrace> Load(const std::string& path);
+
+    const std::string& name() const { return name_; }
+    /* Counts of reads, writes and syncs, like "r1572:w1001:s285" */
+    std::string ident() const;
+
+    /*
+     * Each stage reports progress through checkpoint, create from 0 to 50 and run from 50 to
+     * 100, and gives up as soon as it returns false.
+     */
+    status_t create(const std::function<bool(int)>& checkpoint,
+                    const ReplayOptions& options) const;
+    /* If stats is given, the opens, reads, writes and syncs replayed are measured into it */
+    status_t run(const std::function<bool(int)>& checkpoint, const ReplayOptions& options,
+                 ReplayStats* stats = nullptr) const;
+    status_t destroy() const;
+
+  private:
+    BenchmarkTrace() = default;
+
+    status_t runSerial(const std::function<bool(int)>& checkpoint, const ReplayOptions& options,
+                       ReplayStats* stats) const;
+    status_t runConcurrent(const std::function<bool(int)>& checkpoint,
+                           const ReplayOptions& options, ReplayStats* stats) const;
+
+    std::string name_;
+    std::vector<uint64_t> fileSizes_;
+    uint32_t handleCount_ = 0;
+    uint16_t threadCount_ = 0;
+    std::vector<Op> ops_;
+};
+
+/*
+ * Loads every trace from the system and data benchmark directories, with the default app launch
+ * trace first and the rest sorted by name. A trace in the data directory replaces a system one
+ * with the same name, so new workloads can be tried without updating vold.
+ */
+std::vector<std::unique_ptr<BenchmarkTrace>> LoadBenchmarkTraces();
+
+}  // namespace vold
+}  // namespace android
+
+#endif
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CallStats.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace android {
+namespace vold {
+
+namespace {
+
+std::mutex sRegistryLock;
+std::map<std::string, std::unique_ptr<CallStats>>& Registry() {
+    static auto registry = new std::map<std::string, std::unique_ptr<CallStats>>();
+    return *registry;
+}
+
+double Ms(uint64_t nsecs) {
+    return nsecs / 1e6;
+}
+
+}  // namespace
+
+CallStats* CallStats::Get(const std::string& name) {
+    std::lock_guard<std::mutex> lock(sRegistryLock);
+    auto& stats = Registry()[name];
+    if (!stats) stats.reset(new CallStats());
+    return stats.get();
+}
+
+void CallStats::Dump(int fd) {
+    std::vector<std::pair<std::string, Snapshot>> snapshots;
+    {
+        std::lock_guard<std::mutex> lock(sRegistryLock);
+        for (const auto& [name, stats] : Registry()) {
+            snapshots.emplace_back(name, stats->snapshot());
+        }
+    }
+    std::sort(snapshots.begin(), snapshots.end(), [](const auto& a, const auto& b) {
+        return a.second.totalNs > b.second.totalNs;
+    });
+
+    dprintf(fd, "Binder calls (p50/p90/p99/max ms):\n");
+    for (const auto& [name, s] : snapshots) {
+        if (s.calls == 0) continue;
+        dprintf(fd, "  %s: %" PRIu64 " calls in %.1f ms, %.1f/%.1f/%.1f/%.1f", name.c_str(),
+                s.calls, Ms(s.totalNs), Ms(s.p50Ns), Ms(s.p90Ns), Ms(s.p99Ns), Ms(s.maxNs));
+        if (s.lockWaits > 0) {
+            dprintf(fd, ", waited for a lock %" PRIu64 " times for %.1f ms, max %.1f", s.lockWaits,
+                    Ms(s.lockWaitNs), Ms(s.maxLockWaitNs));
+        }
+        dprintf(fd, "\n");
+    }
+}
+
+CallStats::Snapshot CallStats::snapshot() {
+    std::lock_guard<std::mutex> lock(mLock);
+    Snapshot s;
+    s.calls = mLatency.count();
+    s.totalNs = mTotalNs;
+    s.p50Ns = mLatency.percentile(0.5);
+    s.p90Ns = mLatency.percentile(0.9);
+    s.p99Ns = mLatency.percentile(0.99);
+    s.maxNs = mLatency.max();
+    s.lockWaits = mLockWaits;
+    s.lockWaitNs = mLockWaitNs;
+    s.maxLockWaitNs = mMaxLockWaitNs;
+    return s;
+}
+
+void CallStats::recordCall(std::chrono::nanoseconds latency) {
+    std::lock_guard<std::mutex> lock(mLock);
+    mLatency.record(latency.count());
+    mTotalNs += latency.count();
+}
+
+void CallStats::recordLockWait(std::chrono::nanoseconds wait) {
+    std::lock_guard<std::mutex> lock(mLock);
+    mLockWaits++;
+    mLockWaitNs += wait.count();
+    mMaxLockWaitNs = std::max<uint64_t>(mMaxLockWaitNs, wait.count());
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_VOLD_CALL_STATS_H
+#define ANDROID_VOLD_CALL_STATS_H
+
+#include "BenchmarkTrace.h"
+
+#include <stdint.h>
+
+#include <chrono>
+#include <mutex>
+#include <string>
+
+namespace android {
+namespace vold {
+
+/* How long the calls to one IVold method took, and how long they waited for vold's locks */
+class CallStats {
+  public:
+    /* The stats of the named method, created on first use and kept for the life of vold */
+    static CallStats* Get(const std::string& name);
+    /* Every method called so far, the ones that took the most time in total first */
+    static void Dump(int fd);
+
+    struct Snapshot {
+        uint64_t calls = 0;
+        uint64_t totalNs = 0;
+        uint64_t p50Ns = 0;
+        uint64_t p90Ns = 0;
+        uint64_t p99Ns = 0;
+        uint64_t maxNs = 0;
+        /* Only waits for a lock held by someone else count */
+        uint64_t lockWaits = 0;
+        uint64_t lockWaitNs = 0;
+        uint64_t maxLockWaitNs = 0;
+    };
+    Snapshot snapshot();
+
+    void recordCall(std::chrono::nanoseconds latency);
+    void recordLockWait(std::chrono::nanoseconds wait);
+
+  private:
+    CallStats() = default;
+
+    std::mutex mLock;
+    LatencyHistogram mLatency;
+    uint64_t mTotalNs = 0;
+    uint64_t mLockWaits = 0;
+    uint64_t mLockWaitNs = 0;
+    uint64_t mMaxLockWaitNs = 0;
+};
+
+/* Records the time until it goes out of scope as a call */
+class ScopedCallStats {
+  public:
+    explicit ScopedCallStats(CallStats* stats)
+        : mStats(stats), mStart(std::chrono::steady_clock::now()) {}
+    ~ScopedCallStats() { mStats->recordCall(std::chrono::steady_clock::now() - mStart); }
+
+  private:
+    CallStats* mStats;
+    std::chrono::steady_clock::time_point mStart;
+};
+
+}  // namespace vold
+}  // namespace android
+
+#endif
@@ -16,23 +16,32 @@
 
 #define LOG_TAG "Checkpoint"
 #include "Checkpoint.h"
+#include "CheckpointRelocations.h"
+#include "Crc32.h"
 #include "FsCrypt.h"
 #include "KeyStorage.h"
 #include "VoldUtil.h"
 #include "VolumeManager.h"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <list>
+#include <map>
 #include <memory>
 #include <string>
 #include <thread>
 #include <vector>
 
 #include <BootControlClient.h>
+#include <android-base/chrono_utils.h>
 #include <android-base/file.h>
 #include <android-base/logging.h>
 #include <android-base/parseint.h>
 #include <android-base/properties.h>
+#include <android-base/scopeguard.h>
 #include <android-base/unique_fd.h>
 #include <cutils/android_reboot.h>
 #include <fcntl.h>
@@ -42,6 +51,7 @@
 #include <sys/mount.h>
 #include <sys/stat.h>
 #include <sys/statvfs.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 using android::base::GetBoolProperty;
@@ -68,7 +78,29 @@ binder::Status error(int error, const std::string& msg) {
     return binder::Status::fromServiceSpecificError(error, String8(msg.c_str()));
 }
 
+// Timings and counts of the last checkpoint prepare, commit and restore; see
+// cp_getStats().
+std::mutex statsLock;
+std::map<std::string, int64_t> stats;
+
+void setStat(const std::string& name, int64_t value) {
+    std::lock_guard<std::mutex> lock(statsLock);
+    stats[name] = value;
+}
+
+void addStat(const std::string& name, int64_t value) {
+    std::lock_guard<std::mutex> lock(statsLock);
+    stats[name] += value;
+}
+
+int64_t elapsedMs(const android::base::Timer& timer) {
+    return timer.duration().count();
+}
+
 bool setBowState(std::string const& block_device, std::string const& state) {
+    android::base::Timer timer;
+    auto record = android::base::make_scope_guard(
+            [&] { addStat("bowState" + state + "Ms", elapsedMs(timer)); });
     std::string bow_device = fs_mgr_find_bow_device(block_device);
     if (bow_device.empty()) return false;
 
@@ -159,6 +191,11 @@ volatile bool needsCheckpointWasCalled = false;
 // Protects isCheckpointing, needsCheckpointWasCalled and code that makes decisions based on status
 // of isCheckpointing
 std::mutex isCheckpointingLock;
+
+// Wakes up the health daemons when the checkpoint is committed, so that they
+// stop instead of waiting out their current interval.
+std::mutex healthDaemonLock;
+std::condition_variable healthDaemonCv;
 }
 
 Status cp_commitChanges() {
@@ -172,9 +209,14 @@ Status cp_commitChanges() {
             << "NOT COMMITTING CHECKPOINT BECAUSE persist.vold.dont_commit_checkpoint IS 1";
         return Status::ok();
     }
+    android::base::Timer commit_timer;
+    auto record_commit = android::base::make_scope_guard(
+            [&] { setStat("commitMs", elapsedMs(commit_timer)); });
+    android::base::Timer mark_timer;
     auto module = BootControlClient::WaitForService();
     if (module) {
         auto cr = module->MarkBootSuccessful();
+        setStat("commitMarkBootMs", elapsedMs(mark_timer));
         if (!cr.success)
             return error(EINVAL, "Error marking booted successfully: " + std::string(cr.errMsg));
         LOG(INFO) << "Marked slot as booted successfully.";
@@ -204,8 +246,11 @@ Status cp_commitChanges() {
         if (fstab_rec->fs_mgr_flags.checkpoint_fs) {
             if (fstab_rec->fs_type == "f2fs") {
                 std::string options = mount_rec.fs_options + ",checkpoint=enable";
-                if (mount(mount_rec.blk_device.c_str(), mount_rec.mount_point.c_str(), "none",
-                          MS_REMOUNT | fstab_rec->flags, options.c_str())) {
+                android::base::Timer remount_timer;
+                int ret = mount(mount_rec.blk_device.c_str(), mount_rec.mount_point.c_str(),
+                                "none", MS_REMOUNT | fstab_rec->flags, options.c_str());
+                addStat("commitRemountMs", elapsedMs(remount_timer));
+                if (ret) {
                     return error(EINVAL, "Failed to remount");
                 }
             }
@@ -217,6 +262,10 @@ Status cp_commitChanges() {
     SetProperty("vold.checkpoint_committed", "1");
     LOG(INFO) << "Checkpoint has been committed.";
     isCheckpointing = false;
+    {
+        std::lock_guard<std::mutex> daemon_lock(healthDaemonLock);
+        healthDaemonCv.notify_all();
+    }
     if (!android::base::RemoveFileIfExists(kMetadataCPFile, &err_str))
         return error(err_str.c_str());
 
@@ -319,6 +368,23 @@ const uint64_t min_free_bytes_default = 100 * (1 << 20);  // 100 MiB
 const std::string kCommitOnFullProp = "ro.sys.cp_commit_on_full";
 const bool commit_on_full_default = true;
 
+// While space is plentiful the daemon checks less often than ro.sys.cp_msleeptime,
+// but at least this often.
+const uint32_t max_adaptive_msleeptime = 60000;  // 1 min
+// The rate at which free space is assumed to be able to shrink, unless a faster
+// one has been seen.
+const uint64_t min_fill_bytes_per_ms = (256 << 20) / 1000;  // 256 MiB/s
+
+// Returns how long to wait before checking free space again: the fastest that
+// free space has shrunk so far could then use up at most half of the room left
+// above |min_free_bytes|.  Never less than |msleeptime|, the configured interval.
+static uint32_t cp_nextSleepTime(uint64_t free_bytes, uint64_t min_free_bytes,
+                                 uint64_t fill_bytes_per_ms, uint32_t msleeptime) {
+    uint64_t headroom = free_bytes - min_free_bytes;
+    uint64_t wait = headroom / std::max(fill_bytes_per_ms, min_fill_bytes_per_ms) / 2;
+    return std::clamp<uint64_t>(wait, msleeptime, std::max(msleeptime, max_adaptive_msleeptime));
+}
+
 static void cp_healthDaemon(std::string mnt_pnt, std::string blk_device, bool is_fs_cp) {
     struct statvfs data;
     uint32_t msleeptime = GetUintProperty(kSleepTimeProp, msleeptime_default, max_msleeptime);
@@ -326,17 +392,23 @@ static void cp_healthDaemon(std::string mnt_pnt, std::string blk_device, bool is
         GetUintProperty(kMinFreeBytesProp, min_free_bytes_default, (uint64_t)-1);
     bool commit_on_full = GetBoolProperty(kCommitOnFullProp, commit_on_full_default);
 
-    struct timespec req;
-    req.tv_sec = msleeptime / 1000;
-    msleeptime %= 1000;
-    req.tv_nsec = msleeptime * 1000000;
+    // Free space has no change notifications, neither for filesystems nor for
+    // dm-bow, so it is polled; the interval adapts to how close it is to
+    // running out.
+    uint64_t fill_bytes_per_ms = 0;
+    uint64_t last_free_bytes = 0;
+    auto last_check = std::chrono::steady_clock::now();
+    bool first_check = true;
+    // The device stack under the mount doesn't change while checkpointing, so dm-bow is only
+    // looked up until it has been found.
+    std::string bow_device;
     while (isCheckpointing) {
         uint64_t free_bytes = 0;
         if (is_fs_cp) {
             statvfs(mnt_pnt.c_str(), &data);
             free_bytes = ((uint64_t) data.f_bavail) * data.f_frsize;
         } else {
-            std::string bow_device = fs_mgr_find_bow_device(blk_device);
+            if (bow_device.empty()) bow_device = fs_mgr_find_bow_device(blk_device);
             if (!bow_device.empty()) {
                 std::string content;
                 if (android::base::ReadFileToString(bow_device + "/bow/free", &content)) {
@@ -355,7 +427,23 @@ static void cp_healthDaemon(std::string mnt_pnt, std::string blk_device, bool is
                 break;
             }
         }
-        nanosleep(&req, NULL);
+
+        auto now = std::chrono::steady_clock::now();
+        uint64_t elapsed_ms = std::max<int64_t>(
+                1, std::chrono::duration_cast<std::chrono::milliseconds>(now - last_check).count());
+        if (!first_check && free_bytes < last_free_bytes) {
+            fill_bytes_per_ms =
+                    std::max(fill_bytes_per_ms, (last_free_bytes - free_bytes) / elapsed_ms);
+        }
+        first_check = false;
+        last_free_bytes = free_bytes;
+        last_check = now;
+
+        uint32_t sleep_ms =
+                cp_nextSleepTime(free_bytes, min_free_bytes, fill_bytes_per_ms, msleeptime);
+        std::unique_lock<std::mutex> lock(healthDaemonLock);
+        healthDaemonCv.wait_for(lock, std::chrono::milliseconds(sleep_ms),
+                                [] { return !isCheckpointing; });
     }
 }
 
@@ -396,6 +484,8 @@ Status cp_prepareCheckpoint() {
             nsecs_t time = systemTime(SYSTEM_TIME_BOOTTIME) - start;
             LOG(INFO) << "Trimmed " << range.len << " bytes on " << mount_rec.mount_point << " in "
                       << nanoseconds_to_milliseconds(time) << "ms for checkpoint";
+            addStat("prepareTrimMs", nanoseconds_to_milliseconds(time));
+            addStat("prepareTrimBytes", range.len);
 
             isBow &= setBowState(mount_rec.blk_device, "1");
         }
@@ -412,8 +502,6 @@ Status cp_prepareCheckpoint() {
 namespace {
 const int kSectorSize = 512;
 
-typedef uint64_t sector_t;
-
 struct log_entry {
     sector_t source;  // in sectors of size kSectorSize
     sector_t dest;    // in sectors of size kSectorSize
@@ -436,149 +524,135 @@ const int kMagic = 0x00574f42;
 // Partially restored MAGIC is WOB in ascii
 const int kPartialRestoreMagic = 0x00424f57;
 
-void crc32(const void* data, size_t n_bytes, uint32_t* crc) {
-    static uint32_t table[0x100] = {
-        0x00000000, 0x77073096, 0xEE0E612C, 0x990951BA, 0x076DC419, 0x706AF48F, 0xE963A535,
-        0x9E6495A3, 0x0EDB8832, 0x79DCB8A4, 0xE0D5E91E, 0x97D2D988, 0x09B64C2B, 0x7EB17CBD,
-        0xE7B82D07, 0x90BF1D91, 0x1DB71064, 0x6AB020F2, 0xF3B97148, 0x84BE41DE, 0x1ADAD47D,
-        0x6DDDE4EB, 0xF4D4B551, 0x83D385C7, 0x136C9856, 0x646BA8C0, 0xFD62F97A, 0x8A65C9EC,
-        0x14015C4F, 0x63066CD9, 0xFA0F3D63, 0x8D080DF5, 0x3B6E20C8, 0x4C69105E, 0xD56041E4,
-        0xA2677172, 0x3C03E4D1, 0x4B04D447, 0xD20D85FD, 0xA50AB56B, 0x35B5A8FA, 0x42B2986C,
-        0xDBBBC9D6, 0xACBCF940, 0x32D86CE3, 0x45DF5C75, 0xDCD60DCF, 0xABD13D59, 0x26D930AC,
-        0x51DE003A, 0xC8D75180, 0xBFD06116, 0x21B4F4B5, 0x56B3C423, 0xCFBA9599, 0xB8BDA50F,
-        0x2802B89E, 0x5F058808, 0xC60CD9B2, 0xB10BE924, 0x2F6F7C87, 0x58684C11, 0xC1611DAB,
-        0xB6662D3D,
-
-        0x76DC4190, 0x01DB7106, 0x98D220BC, 0xEFD5102A, 0x71B18589, 0x06B6B51F, 0x9FBFE4A5,
-        0xE8B8D433, 0x7807C9A2, 0x0F00F934, 0x9609A88E, 0xE10E9818, 0x7F6A0DBB, 0x086D3D2D,
-        0x91646C97, 0xE6635C01, 0x6B6B51F4, 0x1C6C6162, 0x856530D8, 0xF262004E, 0x6C0695ED,
-        0x1B01A57B, 0x8208F4C1, 0xF50FC457, 0x65B0D9C6, 0x12B7E950, 0x8BBEB8EA, 0xFCB9887C,
-        0x62DD1DDF, 0x15DA2D49, 0x8CD37CF3, 0xFBD44C65, 0x4DB26158, 0x3AB551CE, 0xA3BC0074,
-        0xD4BB30E2, 0x4ADFA541, 0x3DD895D7, 0xA4D1C46D, 0xD3D6F4FB, 0x4369E96A, 0x346ED9FC,
-        0xAD678846, 0xDA60B8D0, 0x44042D73, 0x33031DE5, 0xAA0A4C5F, 0xDD0D7CC9, 0x5005713C,
-        0x270241AA, 0xBE0B1010, 0xC90C2086, 0x5768B525, 0x206F85B3, 0xB966D409, 0xCE61E49F,
-        0x5EDEF90E, 0x29D9C998, 0xB0D09822, 0xC7D7A8B4, 0x59B33D17, 0x2EB40D81, 0xB7BD5C3B,
-        0xC0BA6CAD,
-
-        0xEDB88320, 0x9ABFB3B6, 0x03B6E20C, 0x74B1D29A, 0xEAD54739, 0x9DD277AF, 0x04DB2615,
-        0x73DC1683, 0xE3630B12, 0x94643B84, 0x0D6D6A3E, 0x7A6A5AA8, 0xE40ECF0B, 0x9309FF9D,
-        0x0A00AE27, 0x7D079EB1, 0xF00F9344, 0x8708A3D2, 0x1E01F268, 0x6906C2FE, 0xF762575D,
-        0x806567CB, 0x196C3671, 0x6E6B06E7, 0xFED41B76, 0x89D32BE0, 0x10DA7A5A, 0x67DD4ACC,
-        0xF9B9DF6F, 0x8EBEEFF9, 0x17B7BE43, 0x60B08ED5, 0xD6D6A3E8, 0xA1D1937E, 0x38D8C2C4,
-        0x4FDFF252, 0xD1BB67F1, 0xA6BC5767, 0x3FB506DD, 0x48B2364B, 0xD80D2BDA, 0xAF0A1B4C,
-        0x36034AF6, 0x41047A60, 0xDF60EFC3, 0xA867DF55, 0x316E8EEF, 0x4669BE79, 0xCB61B38C,
-        0xBC66831A, 0x256FD2A0, 0x5268E236, 0xCC0C7795, 0xBB0B4703, 0x220216B9, 0x5505262F,
-        0xC5BA3BBE, 0xB2BD0B28, 0x2BB45A92, 0x5CB36A04, 0xC2D7FFA7, 0xB5D0CF31, 0x2CD99E8B,
-        0x5BDEAE1D,
-
-        0x9B64C2B0, 0xEC63F226, 0x756AA39C, 0x026D930A, 0x9C0906A9, 0xEB0E363F, 0x72076785,
-        0x05005713, 0x95BF4A82, 0xE2B87A14, 0x7BB12BAE, 0x0CB61B38, 0x92D28E9B, 0xE5D5BE0D,
-        0x7CDCEFB7, 0x0BDBDF21, 0x86D3D2D4, 0xF1D4E242, 0x68DDB3F8, 0x1FDA836E, 0x81BE16CD,
-        0xF6B9265B, 0x6FB077E1, 0x18B74777, 0x88085AE6, 0xFF0F6A70, 0x66063BCA, 0x11010B5C,
-        0x8F659EFF, 0xF862AE69, 0x616BFFD3, 0x166CCF45, 0xA00AE278, 0xD70DD2EE, 0x4E048354,
-        0x3903B3C2, 0xA7672661, 0xD06016F7, 0x4969474D, 0x3E6E77DB, 0xAED16A4A, 0xD9D65ADC,
-        0x40DF0B66, 0x37D83BF0, 0xA9BCAE53, 0xDEBB9EC5, 0x47B2CF7F, 0x30B5FFE9, 0xBDBDF21C,
-        0xCABAC28A, 0x53B39330, 0x24B4A3A6, 0xBAD03605, 0xCDD70693, 0x54DE5729, 0x23D967BF,
-        0xB3667A2E, 0xC4614AB8, 0x5D681B02, 0x2A6F2B94, 0xB40BBE37, 0xC30C8EA1, 0x5A05DF1B,
-        0x2D02EF8D};
-
-    for (size_t i = 0; i < n_bytes; ++i) {
-        *crc ^= ((uint8_t*)data)[i];
-        *crc = table[(uint8_t)*crc] ^ *crc >> 8;
-    }
-}
-
-// A map of relocations.
-// The map must be initialized so that relocations[0] = 0
-// During restore, we replay the log records in reverse, copying from dest to
-// source
-// To validate, we must be able to read the 'dest' sectors as though they had
-// been copied but without actually copying. This map represents how the sectors
-// would have been moved. To read a sector s, find the index <= s and read
-// relocations[index] + s - index
-typedef std::map<sector_t, sector_t> Relocations;
-
-void relocate(Relocations& relocations, sector_t dest, sector_t source, int count) {
-    // Find first one we're equal to or greater than
-    auto s = --relocations.upper_bound(source);
-
-    // Take slice
-    Relocations slice;
-    slice[dest] = source - s->first + s->second;
-    ++s;
-
-    // Add rest of elements
-    for (; s != relocations.end() && s->first < source + count; ++s)
-        slice[dest - source + s->first] = s->second;
-
-    // Split range at end of dest
-    auto dest_end = --relocations.upper_bound(dest + count);
-    relocations[dest + count] = dest + count - dest_end->first + dest_end->second;
-
-    // Remove all elements in [dest, dest + count)
-    relocations.erase(relocations.lower_bound(dest), relocations.lower_bound(dest + count));
-
-    // Add new elements
-    relocations.insert(slice.begin(), slice.end());
-}
-
-// A map of sectors that have been written to.
-// The final entry must always be False.
-// When we restart the restore after an interruption, we must take care that
-// when we copy from dest to source, that the block we copy to was not
-// previously copied from.
-// i e. A->B C->A; If we replay this sequence, we end up copying C->B
-// We must save our partial result whenever we finish a page, or when we copy
-// to a location that was copied from earlier (our source is an earlier dest)
-typedef std::map<sector_t, bool> Used_Sectors;
-
-bool checkCollision(Used_Sectors& used_sectors, sector_t start, sector_t end) {
-    auto second_overlap = used_sectors.upper_bound(start);
-    auto first_overlap = --second_overlap;
-
-    if (first_overlap->second) {
-        return true;
-    } else if (second_overlap != used_sectors.end() && second_overlap->first < end) {
-        return true;
+// Up to this much of what validation reads is kept for the restore pass, which
+// reads the same data in the same order.
+const size_t kValidatedCacheBytes = 64 * 1024 * 1024;
+
+// What the validation pass read, in order, so that the restore pass can use it
+// instead of reading and checksumming it again.  Only a prefix of the reads is
+// kept, so that the restore pass can consume them in the same order.
+class ValidatedCache {
+  public:
+    void Add(std::vector<char> buffer) {
+        if (full_ || bytes_ + buffer.size() > kValidatedCacheBytes) {
+            full_ = true;
+            return;
+        }
+        bytes_ += buffer.size();
+        buffers_.push_back(std::move(buffer));
+    }
+    // Returns the next buffer if it was cached, or an empty one.
+    std::vector<char> Take() {
+        if (buffers_.empty()) return std::vector<char>();
+        std::vector<char> buffer = std::move(buffers_.front());
+        buffers_.pop_front();
+        return buffer;
     }
-    return false;
+    size_t size() const { return buffers_.size(); }
+
+  private:
+    std::deque<std::vector<char>> buffers_;
+    size_t bytes_ = 0;
+    bool full_ = false;
+};
+
+// Collects the writes of consecutive log entries that restore adjacent sectors
+// and issues them as a single pwritev().  Pending writes are issued before
+// anything that has to observe them: a read of an overlapping range, or a
+// durability point.
+class RestoreWriter {
+  public:
+    explicit RestoreWriter(int device_fd) : device_fd_(device_fd) {}
+
+    bool Write(off64_t offset, std::vector<char>&& buffer);
+    bool FlushOverlapping(off64_t offset, size_t size);
+    bool Flush();
+    // Flushes and then fsyncs the device.
+    bool Sync();
+
+  private:
+    static constexpr size_t kMaxBuffers = 64;
+    static constexpr size_t kMaxBytes = 1024 * 1024;
+
+    int device_fd_;
+    off64_t offset_ = 0;
+    size_t size_ = 0;
+    std::vector<std::vector<char>> buffers_;
+};
+
+bool RestoreWriter::Write(off64_t offset, std::vector<char>&& buffer) {
+    if (!buffers_.empty() && (offset != offset_ + static_cast<off64_t>(size_) ||
+                              buffers_.size() == kMaxBuffers || size_ + buffer.size() > kMaxBytes)) {
+        if (!Flush()) return false;
+    }
+    if (buffers_.empty()) offset_ = offset;
+    size_ += buffer.size();
+    buffers_.push_back(std::move(buffer));
+    return true;
 }
 
-void markUsed(Used_Sectors& used_sectors, sector_t start, sector_t end) {
-    auto start_pos = used_sectors.insert_or_assign(start, true).first;
-    auto end_pos = used_sectors.insert_or_assign(end, false).first;
+bool RestoreWriter::FlushOverlapping(off64_t offset, size_t size) {
+    if (buffers_.empty() || offset >= offset_ + static_cast<off64_t>(size_) ||
+        offset + static_cast<off64_t>(size) <= offset_)
+        return true;
+    return Flush();
+}
 
-    if (start_pos == used_sectors.begin() || !std::prev(start_pos)->second) {
-        start_pos++;
-    }
-    if (std::next(end_pos) != used_sectors.end() && !std::next(end_pos)->second) {
-        end_pos++;
+bool RestoreWriter::Flush() {
+    std::vector<iovec> iov;
+    for (auto& buffer : buffers_) iov.push_back({buffer.data(), buffer.size()});
+
+    off64_t offset = offset_;
+    for (size_t i = 0; i < iov.size();) {
+        ssize_t written = TEMP_FAILURE_RETRY(pwritev64(device_fd_, &iov[i], iov.size() - i, offset));
+        if (written <= 0) {
+            PLOG(ERROR) << "Failed to write " << size_ << " bytes at offset " << offset_;
+            return false;
+        }
+        offset += written;
+        for (; i < iov.size() && static_cast<size_t>(written) >= iov[i].iov_len; i++)
+            written -= iov[i].iov_len;
+        if (i < iov.size()) {
+            iov[i].iov_base = static_cast<char*>(iov[i].iov_base) + written;
+            iov[i].iov_len -= written;
+        }
     }
-    if (start_pos->first < end_pos->first) {
-        used_sectors.erase(start_pos, end_pos);
+    buffers_.clear();
+    size_ = 0;
+    return true;
+}
+
+bool RestoreWriter::Sync() {
+    if (!Flush()) return false;
+    if (fsync(device_fd_) != 0) {
+        PLOG(ERROR) << "Failed to fsync";
+        return false;
     }
+    return true;
 }
 
 // Restores the given log_entry's data from dest -> source
 // If that entry is a log sector, set the magic to kPartialRestoreMagic and flush.
-void restoreSector(int device_fd, Used_Sectors& used_sectors, std::vector<char>& ls_buffer,
-                   log_entry* le, std::vector<char>& buffer) {
+bool restoreSector(int device_fd, RestoreWriter& writer, UsedSectors& used_sectors,
+                   std::vector<char>& ls_buffer, log_entry* le, std::vector<char>&& buffer) {
     log_sector_v1_0& ls = *reinterpret_cast<log_sector_v1_0*>(&ls_buffer[0]);
     uint32_t index = le - ((log_entry*)&ls_buffer[ls.header_size]);
     int count = (le->size - 1) / kSectorSize + 1;
 
-    if (checkCollision(used_sectors, le->source, le->source + count)) {
-        fsync(device_fd);
-        lseek64(device_fd, 0, SEEK_SET);
+    if (used_sectors.Collides(le->source, le->source + count)) {
+        if (!writer.Sync()) return false;
         ls.count = index + 1;
         ls.magic = kPartialRestoreMagic;
-        write(device_fd, &ls_buffer[0], ls.block_size);
-        fsync(device_fd);
-        used_sectors.clear();
-        used_sectors[0] = false;
+        if (pwrite64(device_fd, &ls_buffer[0], ls.block_size, 0) !=
+            static_cast<ssize_t>(ls.block_size)) {
+            PLOG(ERROR) << "Failed to write partial restore log sector";
+            return false;
+        }
+        if (!writer.Sync()) return false;
+        used_sectors.Clear();
     }
 
-    markUsed(used_sectors, le->dest, le->dest + count);
+    used_sectors.MarkUsed(le->dest, le->dest + count);
 
     if (index == 0 && ls.sequence != 0) {
         log_sector_v1_0* next = reinterpret_cast<log_sector_v1_0*>(&buffer[0]);
@@ -587,12 +661,18 @@ void restoreSector(int device_fd, Used_Sectors& used_sectors, std::vector<char>&
         }
     }
 
-    lseek64(device_fd, le->source * kSectorSize, SEEK_SET);
-    write(device_fd, &buffer[0], le->size);
+    if (!writer.Write(le->source * kSectorSize, std::move(buffer))) return false;
 
     if (index == 0) {
-        fsync(device_fd);
+        return writer.Sync();
     }
+    return true;
+}
+
+// Reads exactly |size| bytes at |offset|.
+bool readFully(int device_fd, char* buffer, size_t size, off64_t offset) {
+    return TEMP_FAILURE_RETRY(pread64(device_fd, buffer, size, offset)) ==
+           static_cast<ssize_t>(size);
 }
 
 // Read from the device
@@ -600,28 +680,30 @@ void restoreSector(int device_fd, Used_Sectors& used_sectors, std::vector<char>&
 // returns the amount asked for or an empty buffer on error. Partial reads are considered a failure
 std::vector<char> relocatedRead(int device_fd, Relocations const& relocations, bool validating,
                                 sector_t sector, uint32_t size, uint32_t block_size) {
+    std::vector<char> buffer(size);
     if (!validating) {
-        std::vector<char> buffer(size);
-        off64_t offset = sector * kSectorSize;
-        if (lseek64(device_fd, offset, SEEK_SET) != offset) {
-            return std::vector<char>();
-        }
-        if (read(device_fd, &buffer[0], size) != static_cast<ssize_t>(size)) {
+        if (!readFully(device_fd, &buffer[0], size, sector * kSectorSize)) {
             return std::vector<char>();
         }
         return buffer;
     }
 
-    std::vector<char> buffer(size);
+    // Each block is read from where its first sector was relocated to.  Blocks
+    // that ended up next to each other are read together.
+    uint32_t run_start = 0;
+    off64_t run_offset = 0;
     for (uint32_t i = 0; i < size; i += block_size, sector += block_size / kSectorSize) {
-        auto relocation = --relocations.upper_bound(sector);
-        off64_t offset = (sector + relocation->second - relocation->first) * kSectorSize;
-        if (lseek64(device_fd, offset, SEEK_SET) != offset) {
-            return std::vector<char>();
-        }
-        if (read(device_fd, &buffer[i], block_size) != static_cast<ssize_t>(block_size)) {
-            return std::vector<char>();
+        off64_t offset = relocations.Lookup(sector) * kSectorSize;
+        if (i > 0 && offset != run_offset + (i - run_start)) {
+            if (!readFully(device_fd, &buffer[run_start], i - run_start, run_offset)) {
+                return std::vector<char>();
+            }
+            run_start = i;
         }
+        if (i == run_start) run_offset = offset;
+    }
+    if (!readFully(device_fd, &buffer[run_start], size - run_start, run_offset)) {
+        return std::vector<char>();
     }
 
     return buffer;
@@ -633,15 +715,32 @@ Status cp_restoreCheckpoint(const std::string& blockDevice, int restore_limit) {
     bool validating = true;
     std::string action = "Validating";
     int restore_count = 0;
+    ValidatedCache validated;
 
     for (;;) {
         Relocations relocations;
-        relocations[0] = 0;
+        UsedSectors used_sectors;
         Status status = Status::ok();
 
+        // Stats are recorded as e.g. "restoreValidateMs" once the kind of pass is
+        // known.
+        std::string stat_prefix;
+        int64_t log_sectors = 0;
+        int64_t entries = 0;
+        int64_t log_read_ms = 0;
+        android::base::Timer pass_timer;
+        auto record_pass = android::base::make_scope_guard([&] {
+            if (stat_prefix.empty()) return;
+            setStat(stat_prefix + "Ms", elapsedMs(pass_timer));
+            setStat(stat_prefix + "LogReadMs", log_read_ms);
+            setStat(stat_prefix + "LogSectors", log_sectors);
+            setStat(stat_prefix + "Entries", entries);
+        });
+
         LOG(INFO) << action << " checkpoint on " << blockDevice;
         base::unique_fd device_fd(open(blockDevice.c_str(), O_RDWR | O_CLOEXEC));
         if (device_fd < 0) return error("Cannot open " + blockDevice);
+        RestoreWriter writer(device_fd);
 
         log_sector_v1_0 original_ls;
         if (read(device_fd, reinterpret_cast<char*>(&original_ls), sizeof(original_ls)) !=
@@ -658,20 +757,31 @@ Status cp_restoreCheckpoint(const std::string& blockDevice, int restore_limit) {
         if (original_ls.block_size < sizeof(log_sector_v1_0)) {
             return error(EINVAL, "Block size is invalid");
         }
+        stat_prefix = validating ? "restoreValidate" : "restoreRestore";
 
         LOG(INFO) << action << " " << original_ls.sequence << " log sectors";
 
         for (int sequence = original_ls.sequence; sequence >= 0 && status.isOk(); sequence--) {
-            auto ls_buffer = relocatedRead(device_fd, relocations, validating, 0,
-                                           original_ls.block_size, original_ls.block_size);
+            std::vector<char> ls_buffer;
+            if (!validating) ls_buffer = validated.Take();
+            if (ls_buffer.empty()) {
+                if (!writer.FlushOverlapping(0, original_ls.block_size)) {
+                    status = error(EIO, "Failed to write restored sectors");
+                    break;
+                }
+                android::base::Timer read_timer;
+                ls_buffer = relocatedRead(device_fd, relocations, validating, 0,
+                                          original_ls.block_size, original_ls.block_size);
+                log_read_ms += elapsedMs(read_timer);
+                if (validating) validated.Add(ls_buffer);
+            }
             if (ls_buffer.size() != original_ls.block_size) {
                 status = error(EINVAL, "Failed to read log sector");
                 break;
             }
             log_sector_v1_0& ls = *reinterpret_cast<log_sector_v1_0*>(&ls_buffer[0]);
 
-            Used_Sectors used_sectors;
-            used_sectors[0] = false;
+            used_sectors.Clear();
 
             if (ls.magic != kMagic && (ls.magic != kPartialRestoreMagic || validating)) {
                 status = error(EINVAL, "No magic");
@@ -698,9 +808,11 @@ Status cp_restoreCheckpoint(const std::string& blockDevice, int restore_limit) {
                 break;
             }
             LOG(INFO) << action << " from log sector " << ls.sequence;
+            log_sectors++;
             for (log_entry* le =
                      reinterpret_cast<log_entry*>(&ls_buffer[ls.header_size]) + ls.count - 1;
                  le >= reinterpret_cast<log_entry*>(&ls_buffer[ls.header_size]); --le) {
+                entries++;
                 // This is very noisy - limit to DEBUG only
                 LOG(VERBOSE) << action << " " << le->size << " bytes from sector " << le->dest
                              << " to " << le->source << " with checksum " << std::hex
@@ -710,26 +822,44 @@ Status cp_restoreCheckpoint(const std::string& blockDevice, int restore_limit) {
                     status = error(EINVAL, "log entry is invalid");
                     break;
                 }
-                auto buffer = relocatedRead(device_fd, relocations, validating, le->dest, le->size,
-                                            ls.block_size);
-                if (buffer.size() != le->size) {
-                    status = error(EINVAL, "Failed to read sector");
-                    break;
-                }
-                uint32_t checksum = le->source / (ls.block_size / kSectorSize);
-                for (size_t i = 0; i < le->size; i += ls.block_size) {
-                    crc32(&buffer[i], ls.block_size, &checksum);
-                }
+                // Data that validation read has already been checksummed.
+                std::vector<char> buffer;
+                if (!validating) buffer = validated.Take();
+                if (buffer.empty()) {
+                    if (!writer.FlushOverlapping(le->dest * kSectorSize, le->size)) {
+                        status = error(EIO, "Failed to write restored sectors");
+                        break;
+                    }
+                    buffer = relocatedRead(device_fd, relocations, validating, le->dest, le->size,
+                                           ls.block_size);
+                    if (buffer.size() != le->size) {
+                        status = error(EINVAL, "Failed to read sector");
+                        break;
+                    }
+                    uint32_t checksum = le->source / (ls.block_size / kSectorSize);
+                    for (size_t i = 0; i < le->size; i += ls.block_size) {
+                        crc32(&buffer[i], ls.block_size, &checksum);
+                    }
 
-                if (le->checksum && checksum != le->checksum) {
-                    status = error(EINVAL, "Checksums don't match");
+                    if (le->checksum && checksum != le->checksum) {
+                        status = error(EINVAL, "Checksums don't match");
+                        break;
+                    }
+                }
+                if (buffer.size() != le->size) {
+                    status = error(EINVAL, "Cached sector has the wrong size");
                     break;
                 }
 
                 if (validating) {
-                    relocate(relocations, le->source, le->dest, (le->size - 1) / kSectorSize + 1);
+                    relocations.Relocate(le->source, le->dest, (le->size - 1) / kSectorSize + 1);
+                    validated.Add(std::move(buffer));
                 } else {
-                    restoreSector(device_fd, used_sectors, ls_buffer, le, buffer);
+                    if (!restoreSector(device_fd, writer, used_sectors, ls_buffer, le,
+                                       std::move(buffer))) {
+                        status = error(EIO, "Failed to restore sector");
+                        break;
+                    }
                     restore_count++;
                     if (restore_limit && restore_count >= restore_limit) {
                         status = error(EAGAIN, "Hit the test limit");
@@ -739,6 +869,10 @@ Status cp_restoreCheckpoint(const std::string& blockDevice, int restore_limit) {
             }
         }
 
+        if (!writer.Flush() && status.isOk()) {
+            status = error(EIO, "Failed to write restored sectors");
+        }
+
         if (!status.isOk()) {
             if (!validating) {
                 LOG(ERROR) << "Checkpoint restore failed even though checkpoint validation passed";
@@ -764,6 +898,7 @@ Status cp_restoreCheckpoint(const std::string& blockDevice, int restore_limit) {
 
         if (!validating) break;
 
+        LOG(INFO) << "Restoring with " << validated.size() << " validated reads cached";
         validating = false;
         action = "Restoring";
     }
@@ -800,5 +935,10 @@ void cp_resetCheckpoint() {
     needsCheckpointWasCalled = false;
 }
 
+std::map<std::string, int64_t> cp_getStats() {
+    std::lock_guard<std::mutex> lock(statsLock);
+    return stats;
+}
+
 }  // namespace vold
 }  // namespace android
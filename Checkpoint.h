@@ -18,6 +18,7 @@
 #define _CHECKPOINT_H
 
 #include <binder/Status.h>
+#include <map>
 #include <string>
 
 namespace android {
@@ -48,6 +49,10 @@ android::binder::Status cp_restoreCheckpoint(const std::string& mountPoint, int
 android::binder::Status cp_markBootAttempt();
 
 void cp_resetCheckpoint();
+
+// Returns the timings (in ms) and counts recorded by the last checkpoint
+// prepare, commit and restore in this boot.
+std::map<std::string, int64_t> cp_getStats();
 }  // namespace vold
 }  // namespace android
 
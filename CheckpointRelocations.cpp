@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CheckpointRelocations.h"
+
+#include <iterator>
+
+namespace android {
+namespace vold {
+
+Relocations::Relocations() : map_(&pool_) {
+    map_[0] = 0;
+}
+
+void Relocations::Relocate(sector_t dest, sector_t source, int count) {
+    // Find first one we're equal to or greater than
+    auto s = std::prev(map_.upper_bound(source));
+
+    // Take slice
+    slice_.clear();
+    slice_.emplace_back(dest, source - s->first + s->second);
+    ++s;
+
+    // Add rest of elements
+    for (; s != map_.end() && s->first < source + count; ++s)
+        slice_.emplace_back(dest - source + s->first, s->second);
+
+    // Split range at end of dest
+    auto dest_end = std::prev(map_.upper_bound(dest + count));
+    map_[dest + count] = dest + count - dest_end->first + dest_end->second;
+
+    // Remove all elements in [dest, dest + count)
+    auto next = map_.erase(map_.lower_bound(dest), map_.lower_bound(dest + count));
+
+    // Add new elements.  They are sorted and all go right before |next|.
+    for (const auto& [index, target] : slice_) map_.emplace_hint(next, index, target);
+}
+
+sector_t Relocations::Lookup(sector_t sector) const {
+    auto relocation = std::prev(map_.upper_bound(sector));
+    return sector + relocation->second - relocation->first;
+}
+
+UsedSectors::UsedSectors() : map_(&pool_) {
+    map_[0] = false;
+}
+
+bool UsedSectors::Collides(sector_t start, sector_t end) const {
+    auto second_overlap = map_.upper_bound(start);
+    auto first_overlap = std::prev(second_overlap);
+
+    if (first_overlap->second) {
+        return true;
+    } else if (second_overlap != map_.end() && second_overlap->first < end) {
+        return true;
+    }
+    return false;
+}
+
+void UsedSectors::MarkUsed(sector_t start, sector_t end) {
+    auto start_pos = map_.insert_or_assign(start, true).first;
+    auto end_pos = map_.insert_or_assign(end, false).first;
+
+    if (start_pos == map_.begin() || !std::prev(start_pos)->second) {
+        start_pos++;
+    }
+    if (std::next(end_pos) != map_.end() && !std::next(end_pos)->second) {
+        end_pos++;
+    }
+    if (start_pos->first < end_pos->first) {
+        map_.erase(start_pos, end_pos);
+    }
+}
+
+void UsedSectors::Clear() {
+    map_.clear();
+    map_[0] = false;
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _CHECKPOINT_RELOCATIONS_H
+#define _CHECKPOINT_RELOCATIONS_H
+
+#include <stdint.h>
+
+#include <map>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace android {
+namespace vold {
+
+typedef uint64_t sector_t;
+
+// A map of relocations.
+// During restore, we replay the log records in reverse, copying from dest to
+// source
+// To validate, we must be able to read the 'dest' sectors as though they had
+// been copied but without actually copying. This map represents how the sectors
+// would have been moved.
+//
+// The map is a set of breakpoints: to read a sector s, find the breakpoint
+// index <= s and read map[index] + s - index.  Its nodes come from a pool that
+// is reused as breakpoints come and go, since a restore does tens of thousands
+// of relocations.
+class Relocations {
+  public:
+    Relocations();
+    Relocations(const Relocations&) = delete;
+    Relocations& operator=(const Relocations&) = delete;
+
+    // Records that [dest, dest + count) now holds what [source, source + count)
+    // held.
+    void Relocate(sector_t dest, sector_t source, int count);
+    // Returns where the data of |sector| currently is.
+    sector_t Lookup(sector_t sector) const;
+
+  private:
+    std::pmr::unsynchronized_pool_resource pool_;
+    std::pmr::map<sector_t, sector_t> map_;
+    // Scratch space for Relocate(), kept to avoid reallocating it every time.
+    std::vector<std::pair<sector_t, sector_t>> slice_;
+};
+
+// A map of sectors that have been written to.
+// When we restart the restore after an interruption, we must take care that
+// when we copy from dest to source, that the block we copy to was not
+// previously copied from.
+// i e. A->B C->A; If we replay this sequence, we end up copying C->B
+// We must save our partial result whenever we finish a page, or when we copy
+// to a location that was copied from earlier (our source is an earlier dest)
+//
+// Like Relocations, this is a set of breakpoints marking where used and unused
+// ranges start.  The final breakpoint is always unused.
+class UsedSectors {
+  public:
+    UsedSectors();
+    UsedSectors(const UsedSectors&) = delete;
+    UsedSectors& operator=(const UsedSectors&) = delete;
+
+    // Returns whether any sector in [start, end) is used.
+    bool Collides(sector_t start, sector_t end) const;
+    void MarkUsed(sector_t start, sector_t end);
+    // Marks every sector as unused again.
+    void Clear();
+
+  private:
+    std::pmr::unsynchronized_pool_resource pool_;
+    std::pmr::map<sector_t, bool> map_;
+};
+
+}  // namespace vold
+}  // namespace android
+
+#endif
@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Crc32.h"
+
+#include <array>
+
+#include <string.h>
+
+#if defined(__aarch64__)
+#include <arm_acle.h>
+#include <asm/hwcap.h>
+#include <sys/auxv.h>
+#elif defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+namespace android {
+namespace vold {
+
+namespace {
+
+constexpr uint32_t kPolynomial = 0xEDB88320;
+
+// kTables[0] is the classic byte-at-a-time table.  kTables[k][b] is the CRC of
+// byte b followed by k zero bytes, which lets slicing-by-8 process 8 bytes with
+// 8 independent lookups.
+constexpr std::array<std::array<uint32_t, 256>, 8> MakeTables() {
+    std::array<std::array<uint32_t, 256>, 8> tables{};
+    for (uint32_t b = 0; b < 256; b++) {
+        uint32_t crc = b;
+        for (int i = 0; i < 8; i++) crc = (crc >> 1) ^ ((crc & 1) ? kPolynomial : 0);
+        tables[0][b] = crc;
+    }
+    for (uint32_t b = 0; b < 256; b++) {
+        for (int k = 1; k < 8; k++) {
+            uint32_t prev = tables[k - 1][b];
+            tables[k][b] = (prev >> 8) ^ tables[0][prev & 0xff];
+        }
+    }
+    return tables;
+}
+
+constexpr auto kTables = MakeTables();
+
+#if defined(__aarch64__)
+
+__attribute__((target("crc"))) void Crc32Armv8(const uint8_t* p, size_t n, uint32_t* crc) {
+    uint32_t c = *crc;
+    for (; n > 0 && (reinterpret_cast<uintptr_t>(p) & 7) != 0; n--) c = __crc32b(c, *p++);
+    for (; n >= 8; n -= 8, p += 8) {
+        uint64_t word;
+        memcpy(&word, p, sizeof(word));
+        c = __crc32d(c, word);
+    }
+    for (; n > 0; n--) c = __crc32b(c, *p++);
+    *crc = c;
+}
+
+bool HaveHwCrc() {
+    static const bool have = getauxval(AT_HWCAP) & HWCAP_CRC32;
+    return have;
+}
+
+#elif defined(__x86_64__)
+
+__attribute__((target("pclmul,sse4.1"))) inline __m128i Load(const uint8_t* p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+// Multiplies both halves of |x| by the folding constants in |k| and adds the
+// result to |next|.
+__attribute__((target("pclmul,sse4.1"))) inline __m128i Fold(__m128i x, __m128i k, __m128i next) {
+    __m128i lo = _mm_clmulepi64_si128(x, k, 0x00);
+    __m128i hi = _mm_clmulepi64_si128(x, k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(hi, lo), next);
+}
+
+// Folds 64 bytes at a time with carry-less multiplication, then reduces to 32
+// bits with Barrett reduction.  See "Fast CRC Computation for Generic
+// Polynomials Using PCLMULQDQ Instruction" (Intel, 2009); the constants are the
+// bit-reflected ones for this polynomial.  Requires |n| >= 64 and a multiple
+// of 16.
+__attribute__((target("pclmul,sse4.1"))) uint32_t Crc32PclmulBlocks(const uint8_t* p, size_t n,
+                                                                     uint32_t crc) {
+    alignas(16) static const uint64_t k1k2[] = {0x0154442bd4, 0x01c6e41596};
+    alignas(16) static const uint64_t k3k4[] = {0x01751997d0, 0x00ccaa009e};
+    alignas(16) static const uint64_t k5k0[] = {0x0163cd6124, 0x0000000000};
+    alignas(16) static const uint64_t poly[] = {0x01db710641, 0x01f7011641};
+
+    __m128i x1 = _mm_xor_si128(Load(p), _mm_cvtsi32_si128(crc));
+    __m128i x2 = Load(p + 16);
+    __m128i x3 = Load(p + 32);
+    __m128i x4 = Load(p + 48);
+    p += 64;
+    n -= 64;
+
+    __m128i k = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+    for (; n >= 64; n -= 64, p += 64) {
+        x1 = Fold(x1, k, Load(p));
+        x2 = Fold(x2, k, Load(p + 16));
+        x3 = Fold(x3, k, Load(p + 32));
+        x4 = Fold(x4, k, Load(p + 48));
+    }
+
+    // Fold the four lanes into one, then any remaining 16-byte blocks into it.
+    k = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+    x1 = Fold(x1, k, x2);
+    x1 = Fold(x1, k, x3);
+    x1 = Fold(x1, k, x4);
+    for (; n >= 16; n -= 16, p += 16) x1 = Fold(x1, k, Load(p));
+
+    // 128 bits to 64 bits.
+    __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    __m128i x = _mm_xor_si128(_mm_srli_si128(x1, 8), _mm_clmulepi64_si128(x1, k, 0x10));
+    k = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+    x = _mm_xor_si128(_mm_srli_si128(x, 4), _mm_clmulepi64_si128(_mm_and_si128(x, mask32), k, 0x00));
+
+    // Barrett reduction to 32 bits.
+    k = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+    __m128i t = _mm_clmulepi64_si128(_mm_and_si128(x, mask32), k, 0x10);
+    t = _mm_clmulepi64_si128(_mm_and_si128(t, mask32), k, 0x00);
+    return _mm_extract_epi32(_mm_xor_si128(x, t), 1);
+}
+
+bool HaveHwCrc() {
+    static const bool have = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+    return have;
+}
+
+#endif
+
+}  // namespace
+
+void crc32_bytewise(const void* data, size_t n_bytes, uint32_t* crc) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    uint32_t c = *crc;
+    for (size_t i = 0; i < n_bytes; ++i) c = kTables[0][(c ^ p[i]) & 0xff] ^ c >> 8;
+    *crc = c;
+}
+
+void crc32_slice8(const void* data, size_t n_bytes, uint32_t* crc) {
+    static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "slicing-by-8 assumes little-endian");
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    uint32_t c = *crc;
+    for (; n_bytes >= 8; n_bytes -= 8, p += 8) {
+        uint32_t lo, hi;
+        memcpy(&lo, p, sizeof(lo));
+        memcpy(&hi, p + 4, sizeof(hi));
+        lo ^= c;
+        c = kTables[7][lo & 0xff] ^ kTables[6][(lo >> 8) & 0xff] ^ kTables[5][(lo >> 16) & 0xff] ^
+            kTables[4][lo >> 24] ^ kTables[3][hi & 0xff] ^ kTables[2][(hi >> 8) & 0xff] ^
+            kTables[1][(hi >> 16) & 0xff] ^ kTables[0][hi >> 24];
+    }
+    *crc = c;
+    crc32_bytewise(p, n_bytes, crc);
+}
+
+bool crc32_hw(const void* data, size_t n_bytes, uint32_t* crc) {
+#if defined(__aarch64__)
+    if (!HaveHwCrc()) return false;
+    Crc32Armv8(static_cast<const uint8_t*>(data), n_bytes, crc);
+    return true;
+#elif defined(__x86_64__)
+    if (!HaveHwCrc()) return false;
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    size_t blocks = n_bytes < 64 ? 0 : n_bytes & ~static_cast<size_t>(15);
+    if (blocks > 0) *crc = Crc32PclmulBlocks(p, blocks, *crc);
+    crc32_slice8(p + blocks, n_bytes - blocks, crc);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void crc32(const void* data, size_t n_bytes, uint32_t* crc) {
+    if (!crc32_hw(data, n_bytes, crc)) crc32_slice8(data, n_bytes, crc);
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,42 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_VOLD_CRC32_H
+#define ANDROID_VOLD_CRC32_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace android {
+namespace vold {
+
+/*
+ * Updates |*crc| with the CRC-32 (IEEE 802.3 polynomial, bit-reflected) of
+ * |data|, without pre- or post-inversion.  This is the checksum that dm-bow
+ * uses for its log.  Uses the CRC instructions of the CPU when it has them.
+ */
+void crc32(const void* data, size_t n_bytes, uint32_t* crc);
+
+/* The individual implementations behind crc32(), for tests and benchmarks */
+void crc32_bytewise(const void* data, size_t n_bytes, uint32_t* crc);
+void crc32_slice8(const void* data, size_t n_bytes, uint32_t* crc);
+/* Returns false, without touching |*crc|, if the CPU lacks CRC instructions */
+bool crc32_hw(const void* data, size_t n_bytes, uint32_t* crc);
+
+}  // namespace vold
+}  // namespace android
+
+#endif
@@ -16,17 +16,43 @@
 
 #include "EncryptInplace.h"
 
+#include "Utils.h"
+
 #include <ext4_utils/ext4.h>
 #include <ext4_utils/ext4_utils.h>
 #include <f2fs_sparseblock.h>
 #include <fcntl.h>
+#include <inttypes.h>
+#include <liburing.h>
+#include <openssl/sha.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <vector>
 
+#include <android-base/file.h>
 #include <android-base/logging.h>
+#include <android-base/parseint.h>
+#include <android-base/properties.h>
+#include <android-base/stringprintf.h>
+#include <android-base/strings.h>
 #include <android-base/unique_fd.h>
 
+using android::base::StringPrintf;
+using android::vold::FsyncParentDirectory;
+using android::vold::StrToHex;
+using android::vold::writeStringToFile;
+
 enum EncryptInPlaceError {
     kSuccess,
     kFailed,
@@ -38,36 +64,449 @@ static uint64_t round_up(uint64_t val, size_t amount) {
     return val;
 }
 
+// Collects the statistics reported by get_encrypt_inplace_stats().  Updated by
+// the encryption and I/O threads, and read from binder threads.
+class EncryptStatsTracker {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    static const size_t kLatencyBuckets = 20;  // up to ~0.5s, then open-ended
+
+    void Start(uint64_t bytes_total);
+    void Finish();
+    // |copied| is false for data that an interrupted attempt already encrypted,
+    // which counts towards completion but not towards throughput.
+    void AddBytes(uint64_t bytes, bool copied);
+    void RecordRead(Clock::duration latency) { Record(&read_hist_, latency); }
+    void RecordWrite(Clock::duration latency) { Record(&write_hist_, latency); }
+    void Get(EncryptInplaceStats* stats);
+
+  private:
+    // The throughput is recomputed once per interval, smoothed over intervals.
+    static constexpr std::chrono::seconds kRateInterval{1};
+    static constexpr double kRateSmoothing = 0.3;
+
+    void Record(std::vector<uint64_t>* hist, Clock::duration latency);
+
+    std::mutex mutex_;
+    bool active_ = false;
+    uint64_t bytes_done_ = 0;
+    uint64_t bytes_total_ = 0;
+    uint64_t bytes_copied_ = 0;
+    Clock::time_point start_;
+    Clock::time_point end_;
+    Clock::time_point rate_time_;
+    uint64_t rate_bytes_ = 0;
+    double bytes_per_sec_ = 0;
+    std::vector<uint64_t> read_hist_;
+    std::vector<uint64_t> write_hist_;
+};
+
+static EncryptStatsTracker sStats;
+
+void EncryptStatsTracker::Start(uint64_t bytes_total) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    active_ = true;
+    bytes_done_ = 0;
+    bytes_total_ = bytes_total;
+    bytes_copied_ = 0;
+    start_ = rate_time_ = Clock::now();
+    rate_bytes_ = 0;
+    bytes_per_sec_ = 0;
+    read_hist_.assign(kLatencyBuckets, 0);
+    write_hist_.assign(kLatencyBuckets, 0);
+}
+
+void EncryptStatsTracker::Finish() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!active_) return;
+    active_ = false;
+    end_ = Clock::now();
+}
+
+void EncryptStatsTracker::AddBytes(uint64_t bytes, bool copied) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bytes_done_ += bytes;
+    if (!copied) return;
+    bytes_copied_ += bytes;
+
+    auto now = Clock::now();
+    auto interval = now - rate_time_;
+    if (interval < kRateInterval) return;
+    double seconds = std::chrono::duration<double>(interval).count();
+    double rate = (bytes_copied_ - rate_bytes_) / seconds;
+    bytes_per_sec_ =
+            bytes_per_sec_ == 0 ? rate : kRateSmoothing * rate + (1 - kRateSmoothing) * bytes_per_sec_;
+    rate_time_ = now;
+    rate_bytes_ = bytes_copied_;
+}
+
+void EncryptStatsTracker::Record(std::vector<uint64_t>* hist, Clock::duration latency) {
+    uint64_t us = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    size_t bucket = us == 0 ? 0 : 63 - __builtin_clzll(us);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (hist->empty()) return;
+    (*hist)[std::min(bucket, kLatencyBuckets - 1)]++;
+}
+
+void EncryptStatsTracker::Get(EncryptInplaceStats* stats) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats->active = active_;
+    stats->bytes_done = bytes_done_;
+    stats->bytes_total = bytes_total_;
+    auto end = active_ ? Clock::now() : end_;
+    stats->elapsed_ms =
+            std::chrono::duration_cast<std::chrono::milliseconds>(end - start_).count();
+    stats->mb_per_sec = active_ ? bytes_per_sec_ / 1000000 : 0;
+    stats->eta_seconds = -1;
+    if (!active_) {
+        stats->eta_seconds = 0;
+    } else if (bytes_per_sec_ > 0 && bytes_total_ >= bytes_done_) {
+        stats->eta_seconds = (bytes_total_ - bytes_done_) / bytes_per_sec_;
+    }
+    stats->read_latency_hist = read_hist_;
+    stats->write_latency_hist = write_hist_;
+}
+
+// Copies chunks from the real device to the crypto device with several chunks
+// in flight at once, so that reading chunk N+1 overlaps with writing chunk N.
+// io_uring is used when the kernel (and SELinux policy) allow it; otherwise a
+// writer thread consumes the chunks that the calling thread has read.
+//
+// Completions are reported through the |on_done| callback, which is always
+// invoked on the thread calling Queue() or Drain().
+class EncryptPipeline {
+  public:
+    using DoneCallback = std::function<void(uint64_t offset, size_t len)>;
+
+    ~EncryptPipeline();
+
+    void Init(int realfd, int cryptofd, size_t chunk_size, DoneCallback on_done);
+    // Queues |len| bytes at |offset| to be read from the real device and
+    // written to the crypto device.  May block until there is a free slot.
+    bool Queue(uint64_t offset, size_t len);
+    // Waits until everything queued so far has been written.
+    bool Drain();
+
+  private:
+    // Number of chunks that may be in flight at the same time.
+    static const size_t kDepth = 4;
+
+    struct Slot {
+        uint64_t offset;
+        size_t len;
+        // When the slot's last I/O was started, for the latency histograms.
+        EncryptStatsTracker::Clock::time_point start;
+    };
+
+    uint8_t* SlotBuffer(size_t slot) { return &buffer_[slot * chunk_size_]; }
+
+    bool InitUring();
+    bool QueueUring(size_t slot);
+    bool ReapUring();
+
+    bool QueueThreaded(size_t slot);
+    void WriterLoop();
+    bool ReapThreaded(bool wait);
+
+    int realfd_ = -1;
+    int cryptofd_ = -1;
+    size_t chunk_size_ = 0;
+    DoneCallback on_done_;
+
+    std::vector<uint8_t> buffer_;
+    Slot slots_[kDepth];
+    std::vector<size_t> free_slots_;
+    bool failed_ = false;
+
+    // io_uring mode
+    bool use_uring_ = false;
+    struct io_uring ring_;
+    size_t uring_in_flight_ = 0;
+
+    // Threaded mode.  |mutex_| protects everything below it.
+    std::thread writer_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<size_t> ready_;
+    std::deque<size_t> written_;
+    bool writer_failed_ = false;
+    bool stopping_ = false;
+};
+
+EncryptPipeline::~EncryptPipeline() {
+    if (use_uring_) {
+        // Never leave the kernel using a buffer that is about to be freed.
+        struct io_uring_cqe* cqe;
+        while (uring_in_flight_ > 0 && io_uring_wait_cqe(&ring_, &cqe) == 0) {
+            io_uring_cqe_seen(&ring_, cqe);
+            uring_in_flight_--;
+        }
+        io_uring_queue_exit(&ring_);
+    }
+    if (writer_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        writer_.join();
+    }
+}
+
+void EncryptPipeline::Init(int realfd, int cryptofd, size_t chunk_size, DoneCallback on_done) {
+    realfd_ = realfd;
+    cryptofd_ = cryptofd;
+    chunk_size_ = chunk_size;
+    on_done_ = std::move(on_done);
+
+    buffer_.resize(kDepth * chunk_size_);
+    for (size_t i = 0; i < kDepth; i++) free_slots_.push_back(kDepth - 1 - i);
+
+    use_uring_ = InitUring();
+    if (!use_uring_) writer_ = std::thread(&EncryptPipeline::WriterLoop, this);
+    LOG(DEBUG) << "In-place encryption pipeline uses "
+               << (use_uring_ ? "io_uring" : "a writer thread") << " with " << kDepth
+               << " chunks of " << chunk_size_ << " bytes in flight";
+}
+
+bool EncryptPipeline::Queue(uint64_t offset, size_t len) {
+    if (failed_) return false;
+    while (free_slots_.empty()) {
+        if (!(use_uring_ ? ReapUring() : ReapThreaded(true))) return false;
+    }
+    size_t slot = free_slots_.back();
+    free_slots_.pop_back();
+    slots_[slot] = {offset, len, {}};
+    return use_uring_ ? QueueUring(slot) : QueueThreaded(slot);
+}
+
+bool EncryptPipeline::Drain() {
+    while (!failed_ && free_slots_.size() < kDepth) {
+        if (!(use_uring_ ? ReapUring() : ReapThreaded(true))) return false;
+    }
+    return !failed_;
+}
+
+bool EncryptPipeline::InitUring() {
+    // Each slot needs a read and a linked write.
+    int ret = io_uring_queue_init(2 * kDepth, &ring_, 0);
+    if (ret < 0) {
+        errno = -ret;
+        PLOG(DEBUG) << "io_uring unavailable, falling back to threaded in-place encryption";
+        return false;
+    }
+    return true;
+}
+
+// The read and the write of a slot are linked, so the kernel starts the
+// write only once the read has completed successfully.  A failed or short
+// read cancels the write.
+bool EncryptPipeline::QueueUring(size_t slot) {
+    struct io_uring_sqe* rd = io_uring_get_sqe(&ring_);
+    struct io_uring_sqe* wr = io_uring_get_sqe(&ring_);
+    if (rd == nullptr || wr == nullptr) {
+        LOG(ERROR) << "io_uring submission queue unexpectedly full";
+        failed_ = true;
+        return false;
+    }
+    const Slot& s = slots_[slot];
+    io_uring_prep_read(rd, realfd_, SlotBuffer(slot), s.len, s.offset);
+    rd->flags |= IOSQE_IO_LINK;
+    io_uring_sqe_set_data(rd, reinterpret_cast<void*>(slot * 2));
+    io_uring_prep_write(wr, cryptofd_, SlotBuffer(slot), s.len, s.offset);
+    io_uring_sqe_set_data(wr, reinterpret_cast<void*>(slot * 2 + 1));
+
+    slots_[slot].start = EncryptStatsTracker::Clock::now();
+    int ret = io_uring_submit(&ring_);
+    if (ret != 2) {
+        errno = ret < 0 ? -ret : EIO;
+        PLOG(ERROR) << "Failed to submit in-place encryption I/O";
+        failed_ = true;
+        return false;
+    }
+    uring_in_flight_ += 2;
+    return true;
+}
+
+// Waits for one completion.  Only a completed write frees up its slot.
+//
+// Latencies are measured up to the time a completion is reaped, so they are
+// upper bounds; as the write starts right when the read completes, the read's
+// completion time is also when the write is taken to have started.
+bool EncryptPipeline::ReapUring() {
+    struct io_uring_cqe* cqe;
+    int ret = io_uring_wait_cqe(&ring_, &cqe);
+    if (ret < 0) {
+        errno = -ret;
+        PLOG(ERROR) << "Failed to wait for in-place encryption I/O";
+        failed_ = true;
+        return false;
+    }
+    uintptr_t data = reinterpret_cast<uintptr_t>(io_uring_cqe_get_data(cqe));
+    int res = cqe->res;
+    io_uring_cqe_seen(&ring_, cqe);
+    uring_in_flight_--;
+
+    size_t slot = data / 2;
+    bool is_write = data % 2;
+    Slot& s = slots_[slot];
+    if (res < 0 || static_cast<size_t>(res) != s.len) {
+        // The write linked to a failed read completes with -ECANCELED; the read
+        // has already been reported.
+        if (res != -ECANCELED) {
+            errno = res < 0 ? -res : EIO;
+            PLOG(ERROR) << "Error " << (is_write ? "writing crypto_blkdev" : "reading real_blkdev")
+                        << " at offset " << s.offset << " for inplace encrypt";
+        }
+        failed_ = true;
+        return false;
+    }
+    auto now = EncryptStatsTracker::Clock::now();
+    if (is_write) {
+        sStats.RecordWrite(now - s.start);
+        on_done_(s.offset, s.len);
+        free_slots_.push_back(slot);
+    } else {
+        sStats.RecordRead(now - s.start);
+        s.start = now;
+    }
+    return true;
+}
+
+bool EncryptPipeline::QueueThreaded(size_t slot) {
+    ssize_t bytes = slots_[slot].len;
+    auto start = EncryptStatsTracker::Clock::now();
+    if (pread64(realfd_, SlotBuffer(slot), bytes, slots_[slot].offset) != bytes) {
+        PLOG(ERROR) << "Error reading real_blkdev for inplace encrypt";
+        failed_ = true;
+        return false;
+    }
+    sStats.RecordRead(EncryptStatsTracker::Clock::now() - start);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ready_.push_back(slot);
+    }
+    cv_.notify_all();
+    // Report whatever the writer has finished in the meantime, without waiting.
+    return ReapThreaded(false);
+}
+
+void EncryptPipeline::WriterLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this] { return stopping_ || !ready_.empty(); });
+        if (ready_.empty()) return;
+        size_t slot = ready_.front();
+        ready_.pop_front();
+        lock.unlock();
+
+        ssize_t bytes = slots_[slot].len;
+        auto start = EncryptStatsTracker::Clock::now();
+        bool ok = pwrite64(cryptofd_, SlotBuffer(slot), bytes, slots_[slot].offset) == bytes;
+        if (!ok) PLOG(ERROR) << "Error writing crypto_blkdev for inplace encrypt";
+        sStats.RecordWrite(EncryptStatsTracker::Clock::now() - start);
+
+        lock.lock();
+        if (!ok) writer_failed_ = true;
+        written_.push_back(slot);
+        cv_.notify_all();
+    }
+}
+
+bool EncryptPipeline::ReapThreaded(bool wait) {
+    std::deque<size_t> written;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (wait) cv_.wait(lock, [this] { return !written_.empty(); });
+        written.swap(written_);
+        if (writer_failed_) failed_ = true;
+    }
+    for (size_t slot : written) {
+        if (!failed_) on_done_(slots_[slot].offset, slots_[slot].len);
+        free_slots_.push_back(slot);
+    }
+    return !failed_;
+}
+
 class InPlaceEncrypter {
   public:
     bool EncryptInPlace(const std::string& crypto_blkdev, const std::string& real_blkdev,
-                        uint64_t nr_sec);
-    bool ProcessUsedBlock(uint64_t block_num);
+                        uint64_t nr_sec, const std::string& progress_path);
+    bool ProcessUsedExtent(uint64_t first_block, uint64_t num_blocks);
+
+    // A run of used blocks.
+    struct Extent {
+        uint64_t first_block;
+        uint64_t num_blocks;
+    };
 
   private:
     // aligned 32K writes tends to make flash happy.
-    // SD card association recommends it.
+    // SD card association recommends it.  This is the minimum chunk size; on
+    // devices whose queue accepts larger requests the chunk grows up to
+    // kMaxIOBufferSize, see ChooseIOSize().
     static const size_t kIOBufferSize = 32768;
+    static const size_t kMaxIOBufferSize = 1024 * 1024;
 
     // Avoid spamming the logs.  Print the "Encrypting blocks" log message once
     // every 10000 blocks (which is usually every 40 MB or so), and once at the end.
     static const int kLogInterval = 10000;
 
+    // When resumable, data is encrypted in windows of about this many bytes,
+    // with the progress file updated before each window is written.
+    static const uint64_t kResumeWindowSize = 64 * 1024 * 1024;
+
+    // Bytes of SHA-256 kept per block in the progress file.  That is plenty to
+    // tell a block's plaintext from its ciphertext.
+    static const size_t kBlockHashSize = 8;
+
+    // A range of the device that was (or is about to be) encrypted, along with
+    // the hex-encoded, truncated SHA-256 of the plaintext of each of its
+    // blocks.  A write can be torn by a power loss, so a chunk of an
+    // interrupted window may be partly encrypted; the hashes tell which of its
+    // blocks are.
+    struct Chunk {
+        uint64_t offset;
+        uint64_t len;
+        std::string hashes;
+    };
+
     std::string DescribeFilesystem();
-    void InitFs(const std::string& fs_type, uint64_t blocks_to_encrypt, uint64_t total_blocks,
+    size_t ChooseIOSize(unsigned int block_size);
+    bool InitFs(const std::string& fs_type, uint64_t blocks_to_encrypt, uint64_t total_blocks,
                 unsigned int block_size);
-    void UpdateProgress(size_t blocks, bool done);
+    void UpdateProgress(size_t blocks, bool done, bool copied = true);
     bool EncryptPendingData();
     bool DoEncryptInPlace();
 
+    // Resume support
+    bool ReadProgress(bool* final_pass, std::vector<Chunk>* pending);
+    bool WriteProgress();
+    bool HashBlocks(int fd, const Chunk& chunk, std::string* hashes);
+    bool ClassifyChunk(const Chunk& chunk, std::vector<Chunk>* encrypted,
+                       std::vector<Chunk>* plaintext);
+    bool IsAlreadyEncrypted(uint64_t block_num);
+    uint64_t ClassifyRun(uint64_t first_block, uint64_t num_blocks, bool* deferred,
+                         bool* encrypted);
+    bool ReadPlaintext(void* buf, size_t len, uint64_t offset);
+    bool FlushWindow();
+    bool EncryptDeferredBlocks();
+    bool ResumeFinalPass(const std::vector<Chunk>& pending);
+
     // ext4 methods
     bool ReadExt4BlockBitmap(uint32_t group, uint8_t* buf);
+    bool ReadExt4BlockBitmaps(std::vector<uint8_t>* bitmaps);
+    std::vector<Extent> ScanExt4Groups(const std::vector<uint8_t>& bitmaps, uint32_t first_group,
+                                       uint32_t end_group);
     uint64_t FirstBlockInGroup(uint32_t group);
     uint32_t NumBlocksInGroup(uint32_t group);
     uint32_t NumBaseMetaBlocksInGroup(uint64_t group);
     EncryptInPlaceError EncryptInPlaceExt4();
 
     // f2fs methods
+    bool ScanF2fsBlocks(struct f2fs_info* fs_info, uint64_t first_block, uint64_t end_block,
+                        std::vector<Extent>* extents);
     EncryptInPlaceError EncryptInPlaceF2fs();
 
     std::string real_blkdev_;
@@ -82,9 +521,29 @@ class InPlaceEncrypter {
     uint64_t blocks_to_encrypt_;
     unsigned int block_size_;
 
-    std::vector<uint8_t> io_buffer_;
+    std::unique_ptr<EncryptPipeline> pipeline_;
+    size_t io_size_;
     uint64_t first_pending_block_;
     size_t blocks_pending_;
+
+    // Set when progress is persisted, which makes an interrupted encryption
+    // resumable.  The filesystem metadata that is needed to find the used
+    // blocks, [defer_begin_block_, defer_end_block_), is then left in
+    // plaintext until everything else has been encrypted.
+    std::string progress_path_;
+    android::base::unique_fd cryptoreadfd_;
+    uint64_t defer_begin_block_ = 0;
+    uint64_t defer_end_block_ = 0;
+    bool final_pass_ = false;
+    // Outside the deferred blocks, everything below this offset is encrypted.
+    uint64_t watermark_ = 0;
+    // Parts of an interrupted window that turned out to be encrypted already.
+    std::vector<Chunk> encrypted_chunks_;
+    // The filesystem type an interrupted attempt found, which must match.
+    std::optional<std::string> resumed_fs_type_;
+    std::vector<Chunk> window_;
+    uint64_t window_bytes_ = 0;
+    std::vector<uint8_t> hash_buffer_;
 };
 
 std::string InPlaceEncrypter::DescribeFilesystem() {
@@ -94,26 +553,81 @@ std::string InPlaceEncrypter::DescribeFilesystem() {
         return fs_type_ + " filesystem on " + real_blkdev_;
 }
 
+// Reads an unsigned integer queue attribute of the block device |dev|.  The
+// device may be a partition, in which case the queue is the parent disk's.
+static bool ReadQueueAttribute(dev_t dev, const std::string& attr, uint64_t* value) {
+    std::string base = StringPrintf("/sys/dev/block/%u:%u", major(dev), minor(dev));
+    for (const auto& dir : {base + "/queue/", base + "/../queue/"}) {
+        std::string contents;
+        if (android::base::ReadFileToString(dir + attr, &contents)) {
+            return android::base::ParseUint(android::base::Trim(contents), value);
+        }
+    }
+    return false;
+}
+
+// Picks the size of each I/O chunk.  ro.vold.inplace_encrypt_io_kb overrides
+// the policy; otherwise the largest request the queue of the real device
+// takes without splitting is used, clamped to [kIOBufferSize, kMaxIOBufferSize]
+// and then rounded down to a multiple of optimal_io_size when the device
+// reports one.  The result is always a multiple of the block size.
+size_t InPlaceEncrypter::ChooseIOSize(unsigned int block_size) {
+    uint64_t size = android::base::GetUintProperty<uint64_t>("ro.vold.inplace_encrypt_io_kb", 0) *
+                    1024;
+    uint64_t unit = block_size;
+    if (size == 0) {
+        size = kIOBufferSize;
+        struct stat sb;
+        uint64_t max_sectors_kb = 0, optimal_io_size = 0;
+        if (fstat(realfd_, &sb) == 0 && S_ISBLK(sb.st_mode) &&
+            ReadQueueAttribute(sb.st_rdev, "max_sectors_kb", &max_sectors_kb)) {
+            size = std::clamp<uint64_t>(max_sectors_kb * 1024, kIOBufferSize, kMaxIOBufferSize);
+            if (ReadQueueAttribute(sb.st_rdev, "optimal_io_size", &optimal_io_size) &&
+                optimal_io_size > 0 && optimal_io_size <= size &&
+                optimal_io_size % block_size == 0) {
+                unit = optimal_io_size;
+            }
+        }
+    }
+    size = std::clamp<uint64_t>(size, block_size, kMaxIOBufferSize);
+    return size - size % unit;
+}
+
 // Finishes initializing the encrypter, now that the filesystem details are known.
-void InPlaceEncrypter::InitFs(const std::string& fs_type, uint64_t blocks_to_encrypt,
+bool InPlaceEncrypter::InitFs(const std::string& fs_type, uint64_t blocks_to_encrypt,
                               uint64_t total_blocks, unsigned int block_size) {
+    if (resumed_fs_type_ && *resumed_fs_type_ != fs_type) {
+        LOG(ERROR) << "Can't resume encryption of " << real_blkdev_ << ": it was started on a "
+                   << (resumed_fs_type_->empty() ? "raw device" : *resumed_fs_type_)
+                   << ", but found " << (fs_type.empty() ? "no filesystem" : fs_type);
+        return false;
+    }
     fs_type_ = fs_type;
     blocks_done_ = 0;
     blocks_to_encrypt_ = blocks_to_encrypt;
     block_size_ = block_size;
 
-    // Allocate the I/O buffer.  kIOBufferSize should always be a multiple of
-    // the filesystem block size, but round it up just in case.
-    io_buffer_.resize(round_up(kIOBufferSize, block_size));
+    // Set up the I/O pipeline.
+    io_size_ = ChooseIOSize(block_size);
+    pipeline_ = std::make_unique<EncryptPipeline>();
+    pipeline_->Init(realfd_, cryptofd_, io_size_, [this](uint64_t offset, size_t len) {
+        UpdateProgress(len / block_size_, false);
+    });
+    sStats.Start(blocks_to_encrypt * block_size);
     first_pending_block_ = 0;
     blocks_pending_ = 0;
 
-    LOG(INFO) << "Encrypting " << DescribeFilesystem() << " in-place via " << crypto_blkdev_;
+    LOG(INFO) << "Encrypting " << DescribeFilesystem() << " in-place via " << crypto_blkdev_
+              << " in chunks of up to " << io_size_ << " bytes";
     LOG(INFO) << blocks_to_encrypt << " blocks (" << (blocks_to_encrypt * block_size) / 1000000
               << " MB) of " << total_blocks << " blocks are in-use";
+    return true;
 }
 
-void InPlaceEncrypter::UpdateProgress(size_t blocks, bool done) {
+// |copied| is false for blocks that an interrupted attempt already encrypted.
+void InPlaceEncrypter::UpdateProgress(size_t blocks, bool done, bool copied) {
+    sStats.AddBytes((uint64_t)blocks * block_size_, copied);
+
     // A log message already got printed for blocks_done_ if one was due, so the
     // next message will be due at the *next* block rounded up to kLogInterval.
     uint64_t blocks_next_msg = round_up(blocks_done_ + 1, kLogInterval);
@@ -130,53 +644,399 @@ void InPlaceEncrypter::UpdateProgress(size_t blocks, bool done) {
         LOG(DEBUG) << "Encrypted " << blocks_next_msg << " of " << blocks_to_encrypt_ << " blocks";
 }
 
+// Hands the pending blocks to the I/O pipeline, or to the current window when
+// resumable.  Progress is updated once the pipeline reports that the data has
+// been written to the crypto device.
 bool InPlaceEncrypter::EncryptPendingData() {
     if (blocks_pending_ == 0) return true;
 
-    ssize_t bytes = blocks_pending_ * block_size_;
+    size_t bytes = blocks_pending_ * block_size_;
     uint64_t offset = first_pending_block_ * block_size_;
+    blocks_pending_ = 0;
 
-    if (pread64(realfd_, &io_buffer_[0], bytes, offset) != bytes) {
-        PLOG(ERROR) << "Error reading real_blkdev " << real_blkdev_ << " for inplace encrypt";
+    if (!progress_path_.empty()) {
+        window_.push_back({offset, bytes, ""});
+        window_bytes_ += bytes;
+        if (!final_pass_ && window_bytes_ >= kResumeWindowSize) return FlushWindow();
+        return true;
+    }
+
+    if (!pipeline_->Queue(offset, bytes)) {
+        LOG(ERROR) << "Failed to encrypt " << bytes << " bytes at offset " << offset << " of "
+                   << real_blkdev_ << " via " << crypto_blkdev_;
         return false;
     }
+    return true;
+}
+
+// Encrypts the current window.  The plaintext hashes of its blocks are
+// persisted first, so that after an interruption each block can be checked to
+// see whether it already made it to disk: encrypting a block twice would
+// destroy it.  The window only moves on once the crypto device is synced.
+bool InPlaceEncrypter::FlushWindow() {
+    if (window_.empty()) return true;
+
+    for (auto& chunk : window_) {
+        if (!HashBlocks(realfd_, chunk, &chunk.hashes)) return false;
+    }
+    if (!WriteProgress()) return false;
 
-    if (pwrite64(cryptofd_, &io_buffer_[0], bytes, offset) != bytes) {
-        PLOG(ERROR) << "Error writing crypto_blkdev " << crypto_blkdev_ << " for inplace encrypt";
+    for (const auto& chunk : window_) {
+        if (!pipeline_->Queue(chunk.offset, chunk.len)) {
+            LOG(ERROR) << "Failed to encrypt " << chunk.len << " bytes at offset " << chunk.offset
+                       << " of " << real_blkdev_ << " via " << crypto_blkdev_;
+            return false;
+        }
+    }
+    if (!pipeline_->Drain()) return false;
+    if (fsync(cryptofd_) != 0) {
+        PLOG(ERROR) << "Error syncing " << crypto_blkdev_;
         return false;
     }
+    if (!final_pass_) watermark_ = window_.back().offset + window_.back().len;
+    window_.clear();
+    window_bytes_ = 0;
+    return true;
+}
 
-    UpdateProgress(blocks_pending_, false);
+bool InPlaceEncrypter::HashBlocks(int fd, const Chunk& chunk, std::string* hashes) {
+    if (chunk.len > kMaxIOBufferSize || chunk.len % block_size_ != 0) {
+        LOG(ERROR) << "Unexpected chunk size " << chunk.len;
+        return false;
+    }
+    if (hash_buffer_.size() < chunk.len) hash_buffer_.resize(chunk.len);
+    if (pread64(fd, &hash_buffer_[0], chunk.len, chunk.offset) != (ssize_t)chunk.len) {
+        PLOG(ERROR) << "Failed to read " << chunk.len << " bytes at offset " << chunk.offset
+                    << " for hashing";
+        return false;
+    }
+    std::string digests;
+    digests.reserve(chunk.len / block_size_ * kBlockHashSize);
+    for (uint64_t pos = 0; pos < chunk.len; pos += block_size_) {
+        uint8_t digest[SHA256_DIGEST_LENGTH];
+        SHA256(&hash_buffer_[pos], block_size_, digest);
+        digests.append(reinterpret_cast<const char*>(digest), kBlockHashSize);
+    }
+    return StrToHex(digests, *hashes) == android::OK;
+}
 
-    blocks_pending_ = 0;
+// Splits |chunk| from an interrupted window into the runs of blocks that have
+// been encrypted, where the crypto device decrypts to the plaintext, and those
+// that haven't, where the real device still holds it.  Anything else means
+// the data can't be trusted.
+bool InPlaceEncrypter::ClassifyChunk(const Chunk& chunk, std::vector<Chunk>* encrypted,
+                                     std::vector<Chunk>* plaintext) {
+    std::string real_hashes, crypto_hashes;
+    if (!HashBlocks(realfd_, chunk, &real_hashes)) return false;
+    if (real_hashes == chunk.hashes) {
+        plaintext->push_back(chunk);
+        return true;
+    }
+    if (!HashBlocks(cryptoreadfd_, chunk, &crypto_hashes)) return false;
+
+    const size_t hex_size = kBlockHashSize * 2;
+    std::vector<Chunk>* last = nullptr;
+    for (uint64_t pos = 0; pos < chunk.len; pos += block_size_) {
+        size_t i = pos / block_size_ * hex_size;
+        std::vector<Chunk>* runs;
+        if (real_hashes.compare(i, hex_size, chunk.hashes, i, hex_size) == 0) {
+            runs = plaintext;
+        } else if (crypto_hashes.compare(i, hex_size, chunk.hashes, i, hex_size) == 0) {
+            runs = encrypted;
+        } else {
+            LOG(ERROR) << "Neither " << real_blkdev_ << " nor " << crypto_blkdev_
+                       << " hold the expected data at offset " << chunk.offset + pos;
+            return false;
+        }
+        if (runs == last) {
+            runs->back().len += block_size_;
+            runs->back().hashes.append(chunk.hashes, i, hex_size);
+        } else {
+            runs->push_back({chunk.offset + pos, block_size_, chunk.hashes.substr(i, hex_size)});
+        }
+        last = runs;
+    }
+    if (!encrypted->empty() && !plaintext->empty()) {
+        LOG(WARNING) << "Chunk at offset " << chunk.offset << " of " << real_blkdev_
+                     << " was partly encrypted";
+    }
     return true;
 }
 
-bool InPlaceEncrypter::ProcessUsedBlock(uint64_t block_num) {
-    // Flush if the amount of pending data has reached the I/O buffer size, if
-    // there's a gap between the pending blocks and the next block (due to
-    // block(s) not being used by the filesystem and thus not needing
-    // encryption), or if the next block will be aligned to the I/O buffer size.
-    if (blocks_pending_ * block_size_ == io_buffer_.size() ||
-        block_num != first_pending_block_ + blocks_pending_ ||
-        (block_num * block_size_) % io_buffer_.size() == 0) {
-        if (!EncryptPendingData()) return false;
-        first_pending_block_ = block_num;
+bool InPlaceEncrypter::IsAlreadyEncrypted(uint64_t block_num) {
+    if (progress_path_.empty() || final_pass_) return false;
+    if (block_num >= defer_begin_block_ && block_num < defer_end_block_) return false;
+    uint64_t offset = block_num * block_size_;
+    if (offset < watermark_) return true;
+    for (const auto& chunk : encrypted_chunks_) {
+        if (offset >= chunk.offset && offset < chunk.offset + chunk.len) return true;
+    }
+    return false;
+}
+
+// Reads filesystem metadata, which comes from the crypto device once the
+// block holding it has been encrypted.
+bool InPlaceEncrypter::ReadPlaintext(void* buf, size_t len, uint64_t offset) {
+    int fd = IsAlreadyEncrypted(offset / block_size_) ? cryptoreadfd_.get() : realfd_.get();
+    return pread64(fd, buf, len, offset) == (ssize_t)len;
+}
+
+// Encrypts the filesystem metadata that was left in plaintext so far.  The
+// whole range goes into a single window, so that an interruption from here on
+// can be finished from the progress file alone.
+bool InPlaceEncrypter::EncryptDeferredBlocks() {
+    if (progress_path_.empty() || defer_begin_block_ == defer_end_block_) return true;
+    if (!EncryptPendingData() || !FlushWindow()) return false;
+
+    final_pass_ = true;
+    if (!ProcessUsedExtent(defer_begin_block_, defer_end_block_ - defer_begin_block_)) return false;
+    return EncryptPendingData() && FlushWindow();
+}
+
+// Finishes an encryption that was interrupted while encrypting the deferred
+// filesystem metadata.  The filesystem can't be read any more, but the
+// progress file lists everything that is left.
+bool InPlaceEncrypter::ResumeFinalPass(const std::vector<Chunk>& pending) {
+    uint64_t blocks = 0;
+    for (const auto& chunk : pending) blocks += chunk.len / block_size_;
+    if (!InitFs(fs_type_, blocks, blocks, block_size_)) return false;
+
+    final_pass_ = true;
+    for (const auto& chunk : pending) {
+        std::vector<Chunk> encrypted;
+        if (!ClassifyChunk(chunk, &encrypted, &window_)) return false;
+        for (const auto& run : encrypted) UpdateProgress(run.len / block_size_, false, false);
+    }
+    return FlushWindow();
+}
+
+// The progress file looks like this:
+//
+//   <real_blkdev> <nr_sec> <fs_type or -> <block_size>
+//   <main|final> <watermark>
+//   <offset> <len> <hashes>      (one line per chunk of the current window)
+//
+// where <hashes> holds the first kBlockHashSize bytes of the SHA-256 of each
+// block of the chunk, in hex.
+bool InPlaceEncrypter::WriteProgress() {
+    std::string contents = StringPrintf("%s %" PRIu64 " %s %u\n%s %" PRIu64 "\n",
+                                        real_blkdev_.c_str(), nr_sec_,
+                                        fs_type_.empty() ? "-" : fs_type_.c_str(), block_size_,
+                                        final_pass_ ? "final" : "main", watermark_);
+    for (const auto& chunk : window_) {
+        contents += StringPrintf("%" PRIu64 " %" PRIu64 " %s\n", chunk.offset, chunk.len,
+                                 chunk.hashes.c_str());
+    }
+    std::string tmp_path = progress_path_ + ".tmp";
+    if (!writeStringToFile(contents, tmp_path)) return false;
+    if (rename(tmp_path.c_str(), progress_path_.c_str()) != 0) {
+        PLOG(ERROR) << "Failed to rename " << tmp_path << " to " << progress_path_;
+        return false;
+    }
+    return FsyncParentDirectory(progress_path_);
+}
+
+// Loads the state of an interrupted encryption of this device, if any.
+// Returns false only if the progress file is present but unusable.
+bool InPlaceEncrypter::ReadProgress(bool* final_pass, std::vector<Chunk>* pending) {
+    *final_pass = false;
+    std::string contents;
+    if (!android::base::ReadFileToString(progress_path_, &contents)) {
+        if (errno == ENOENT) return true;
+        PLOG(ERROR) << "Failed to read " << progress_path_;
+        return false;
+    }
+    auto lines = android::base::Split(contents, "\n");
+    if (lines.size() < 2) {
+        LOG(ERROR) << "Malformed " << progress_path_;
+        return false;
+    }
+    auto header = android::base::Split(lines[0], " ");
+    auto state = android::base::Split(lines[1], " ");
+    uint64_t nr_sec;
+    if (header.size() != 4 || state.size() != 2 || !android::base::ParseUint(header[1], &nr_sec) ||
+        !android::base::ParseUint(header[3], &block_size_) ||
+        !android::base::ParseUint(state[1], &watermark_)) {
+        LOG(ERROR) << "Malformed " << progress_path_;
+        return false;
+    }
+    if (header[0] != real_blkdev_ || nr_sec != nr_sec_) {
+        LOG(ERROR) << progress_path_ << " describes " << header[0] << " with " << nr_sec
+                   << " sectors, not " << real_blkdev_;
+        return false;
+    }
+    fs_type_ = header[2] == "-" ? "" : header[2];
+    *final_pass = state[0] == "final";
+    for (size_t i = 2; i < lines.size(); i++) {
+        if (lines[i].empty()) continue;
+        auto fields = android::base::Split(lines[i], " ");
+        Chunk chunk;
+        if (fields.size() != 3 || !android::base::ParseUint(fields[0], &chunk.offset) ||
+            !android::base::ParseUint(fields[1], &chunk.len) || block_size_ == 0 ||
+            chunk.len % block_size_ != 0 ||
+            fields[2].size() != chunk.len / block_size_ * kBlockHashSize * 2) {
+            LOG(ERROR) << "Malformed " << progress_path_;
+            return false;
+        }
+        chunk.hashes = fields[2];
+        pending->push_back(chunk);
+    }
+    LOG(INFO) << "Resuming in-place encryption of " << real_blkdev_ << " at offset "
+              << watermark_ << (*final_pass ? " (metadata)" : "") << " with " << pending->size()
+              << " chunks to check";
+    return true;
+}
+
+// Returns how many of the |num_blocks| blocks starting at |first_block| share
+// the state of the first one: deferred to the final pass, already encrypted
+// by an interrupted attempt, or neither.
+uint64_t InPlaceEncrypter::ClassifyRun(uint64_t first_block, uint64_t num_blocks, bool* deferred,
+                                       bool* encrypted) {
+    *deferred = false;
+    *encrypted = false;
+    if (progress_path_.empty()) return num_blocks;
+
+    uint64_t end = first_block + num_blocks;
+    if (!final_pass_) {
+        if (first_block >= defer_begin_block_ && first_block < defer_end_block_) {
+            *deferred = true;
+            return std::min(end, defer_end_block_) - first_block;
+        }
+        if (first_block < defer_begin_block_) end = std::min(end, defer_begin_block_);
+    }
+    *encrypted = IsAlreadyEncrypted(first_block);
+    if (final_pass_) return end - first_block;
+
+    // Stop at the next block where IsAlreadyEncrypted() may change its answer.
+    uint64_t watermark_block = watermark_ / block_size_;
+    if (first_block < watermark_block) end = std::min(end, watermark_block);
+    for (const auto& chunk : encrypted_chunks_) {
+        uint64_t chunk_first = chunk.offset / block_size_;
+        uint64_t chunk_end = (chunk.offset + chunk.len) / block_size_;
+        if (first_block < chunk_first) end = std::min(end, chunk_first);
+        if (first_block >= chunk_first && first_block < chunk_end) end = std::min(end, chunk_end);
+    }
+    return end - first_block;
+}
+
+bool InPlaceEncrypter::ProcessUsedExtent(uint64_t first_block, uint64_t num_blocks) {
+    uint64_t io_blocks = io_size_ / block_size_;
+    while (num_blocks > 0) {
+        bool deferred, encrypted;
+        uint64_t run = ClassifyRun(first_block, num_blocks, &deferred, &encrypted);
+        if (deferred || encrypted) {
+            // Deferred blocks are encrypted last by EncryptDeferredBlocks();
+            // already encrypted ones were done by an earlier, interrupted attempt.
+            if (encrypted) UpdateProgress(run, false, false);
+            first_block += run;
+            num_blocks -= run;
+            continue;
+        }
+        while (run > 0) {
+            // Flush if the amount of pending data has reached the I/O chunk
+            // size, if there's a gap between the pending blocks and the next
+            // block (due to block(s) not being used by the filesystem and thus
+            // not needing encryption), or if the next block will be aligned to
+            // the I/O chunk size.
+            if (blocks_pending_ == io_blocks ||
+                first_block != first_pending_block_ + blocks_pending_ ||
+                first_block % io_blocks == 0) {
+                if (!EncryptPendingData()) return false;
+                first_pending_block_ = first_block;
+            }
+            uint64_t n = std::min(run, io_blocks - first_block % io_blocks);
+            blocks_pending_ += n;
+            first_block += n;
+            num_blocks -= n;
+            run -= n;
+        }
     }
-    blocks_pending_++;
     return true;
 }
 
+// Appends the runs of set bits among the first |num_bits| bits of |bitmap| to
+// |extents|, as blocks counted from |base|.  The bitmap is scanned 64 bits at a
+// time, so it must be readable up to the next multiple of 8 bytes.
+static void AppendBitmapExtents(const uint8_t* bitmap, uint32_t num_bits, uint64_t base,
+                                std::vector<InPlaceEncrypter::Extent>* extents) {
+    static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__,
+                  "ext4 bitmaps are scanned as little-endian words");
+    // Returns the first bit at or after |pos| that is set (or clear), or
+    // |num_bits| if there is none.
+    auto find_next = [&](uint32_t pos, bool set) -> uint32_t {
+        while (pos < num_bits) {
+            uint64_t word;
+            memcpy(&word, bitmap + (pos / 64) * 8, sizeof(word));
+            if (!set) word = ~word;
+            word &= ~0ULL << (pos % 64);
+            if (word != 0) return std::min(num_bits, (pos & ~63u) + __builtin_ctzll(word));
+            pos = (pos & ~63u) + 64;
+        }
+        return num_bits;
+    };
+    for (uint32_t pos = find_next(0, true); pos < num_bits;) {
+        uint32_t end = find_next(pos, false);
+        extents->push_back({base + pos, end - pos});
+        pos = find_next(end, true);
+    }
+}
+
 // Reads the block bitmap for block group |group| into |buf|.
 bool InPlaceEncrypter::ReadExt4BlockBitmap(uint32_t group, uint8_t* buf) {
     uint64_t offset = (uint64_t)aux_info.bg_desc[group].bg_block_bitmap * info.block_size;
-    if (pread64(realfd_, buf, info.block_size, offset) != (ssize_t)info.block_size) {
+    if (!ReadPlaintext(buf, info.block_size, offset)) {
         PLOG(ERROR) << "Failed to read block bitmap for block group " << group;
         return false;
     }
     return true;
 }
 
+// Reads the block bitmaps of all block groups into |bitmaps|, one block per
+// group.  They have to be read before anything is encrypted, since with
+// flex_bg a group's bitmap can live in an earlier group.  Groups with an
+// uninitialized block bitmap are skipped.
+bool InPlaceEncrypter::ReadExt4BlockBitmaps(std::vector<uint8_t>* bitmaps) {
+    bitmaps->assign((uint64_t)aux_info.groups * info.block_size, 0);
+
+    uint32_t num_threads = std::clamp<uint32_t>(std::thread::hardware_concurrency(), 1, 8);
+    num_threads = std::min(num_threads, aux_info.groups);
+    std::vector<std::thread> threads;
+    std::vector<char> ok(num_threads, true);
+    for (uint32_t t = 0; t < num_threads; t++) {
+        threads.emplace_back([this, bitmaps, t, num_threads, &ok] {
+            for (uint32_t group = t; group < aux_info.groups; group += num_threads) {
+                if (aux_info.bg_desc[group].bg_flags & EXT4_BG_BLOCK_UNINIT) continue;
+                if (!ReadExt4BlockBitmap(group,
+                                         &(*bitmaps)[(uint64_t)group * info.block_size])) {
+                    ok[t] = false;
+                    return;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    return std::all_of(ok.begin(), ok.end(), [](char b) { return b; });
+}
+
+// Returns the used blocks of block groups [first_group, end_group).
+std::vector<InPlaceEncrypter::Extent> InPlaceEncrypter::ScanExt4Groups(
+        const std::vector<uint8_t>& bitmaps, uint32_t first_group, uint32_t end_group) {
+    std::vector<Extent> extents;
+    for (uint32_t group = first_group; group < end_group; group++) {
+        uint64_t first_block_num = FirstBlockInGroup(group);
+        if (aux_info.bg_desc[group].bg_flags & EXT4_BG_BLOCK_UNINIT) {
+            uint32_t block_count = NumBaseMetaBlocksInGroup(group);
+            if (block_count != 0) extents.push_back({first_block_num, block_count});
+            continue;
+        }
+        // blocks_per_group is a multiple of 8 and fits in one block, so the
+        // word-sized reads never go past the end of |bitmaps|.
+        AppendBitmapExtents(&bitmaps[(uint64_t)group * info.block_size], NumBlocksInGroup(group),
+                            first_block_num, &extents);
+    }
+    return extents;
+}
+
 uint64_t InPlaceEncrypter::FirstBlockInGroup(uint32_t group) {
     return aux_info.first_data_block + (group * (uint64_t)info.blocks_per_group);
 }
@@ -210,39 +1070,108 @@ EncryptInPlaceError InPlaceEncrypter::EncryptInPlaceExt4() {
                     (NumBlocksInGroup(group) - aux_info.bg_desc[group].bg_free_blocks_count);
     }
 
-    InitFs("ext4", blocks_to_encrypt, aux_info.len_blocks, info.block_size);
+    if (!InitFs("ext4", blocks_to_encrypt, aux_info.len_blocks, info.block_size)) return kFailed;
+    // read_ext() needs the superblock and the group descriptors.
+    defer_begin_block_ = aux_info.first_data_block;
+    defer_end_block_ = aux_info.first_data_block + 1 + aux_info.bg_desc_blocks;
 
-    // Encrypt each block group.
-    std::vector<uint8_t> block_bitmap(info.block_size);
-    for (uint32_t group = 0; group < aux_info.groups; group++) {
-        if (!ReadExt4BlockBitmap(group, &block_bitmap[0])) return kFailed;
-
-        uint64_t first_block_num = FirstBlockInGroup(group);
-        bool uninit = (aux_info.bg_desc[group].bg_flags & EXT4_BG_BLOCK_UNINIT);
-        uint32_t block_count = uninit ? NumBaseMetaBlocksInGroup(group) : NumBlocksInGroup(group);
+    std::vector<uint8_t> block_bitmaps;
+    if (!ReadExt4BlockBitmaps(&block_bitmaps)) return kFailed;
 
-        // Encrypt each used block in the block group.
-        for (uint32_t i = 0; i < block_count; i++) {
-            if (uninit || bitmap_get_bit(&block_bitmap[0], i))
-                ProcessUsedBlock(first_block_num + i);
+    // Encrypt the used blocks, a batch of block groups at a time.  The next
+    // batch's bitmaps are scanned while the current one is being encrypted.
+    static const uint32_t kGroupsPerBatch = 64;
+    auto scan = [&](uint32_t first_group) {
+        return std::async(std::launch::async, &InPlaceEncrypter::ScanExt4Groups, this,
+                          std::cref(block_bitmaps), first_group,
+                          std::min(first_group + kGroupsPerBatch, aux_info.groups));
+    };
+    auto next = scan(0);
+    for (uint32_t group = 0; group < aux_info.groups; group += kGroupsPerBatch) {
+        std::vector<Extent> extents = next.get();
+        if (group + kGroupsPerBatch < aux_info.groups) next = scan(group + kGroupsPerBatch);
+        for (const auto& extent : extents) {
+            if (!ProcessUsedExtent(extent.first_block, extent.num_blocks)) return kFailed;
         }
     }
     return kSuccess;
 }
 
-static int encrypt_f2fs_block(uint64_t block_num, void* _encrypter) {
-    InPlaceEncrypter* encrypter = reinterpret_cast<InPlaceEncrypter*>(_encrypter);
-    if (!encrypter->ProcessUsedBlock(block_num)) return -1;
+// Gathers the used blocks run_on_used_blocks() calls back with into extents.
+// The walk can only be stopped by failing it, which is done at |end_block|.
+struct F2fsExtentCollector {
+    uint64_t end_block;
+    std::vector<InPlaceEncrypter::Extent>* extents;
+    bool reached_end;
+};
+
+static int collect_f2fs_block(uint64_t block_num, void* data) {
+    auto* collector = static_cast<F2fsExtentCollector*>(data);
+    if (block_num >= collector->end_block) {
+        collector->reached_end = true;
+        return -1;
+    }
+    auto* extents = collector->extents;
+    if (!extents->empty() &&
+        extents->back().first_block + extents->back().num_blocks == block_num) {
+        extents->back().num_blocks++;
+    } else {
+        extents->push_back({block_num, 1});
+    }
     return 0;
 }
 
+// Returns the used blocks of [first_block, end_block) in |extents|, from the SIT
+// that generate_f2fs_info() has already read into memory.
+bool InPlaceEncrypter::ScanF2fsBlocks(struct f2fs_info* fs_info, uint64_t first_block,
+                                      uint64_t end_block, std::vector<Extent>* extents) {
+    F2fsExtentCollector collector = {end_block, extents, false};
+    return run_on_used_blocks(first_block, fs_info, collect_f2fs_block, &collector) == 0 ||
+           collector.reached_end;
+}
+
 EncryptInPlaceError InPlaceEncrypter::EncryptInPlaceF2fs() {
     std::unique_ptr<struct f2fs_info, void (*)(struct f2fs_info*)> fs_info(
             generate_f2fs_info(realfd_), free_f2fs_info);
     if (!fs_info) return kFilesystemNotFound;
 
-    InitFs("f2fs", get_num_blocks_used(fs_info.get()), fs_info->total_blocks, fs_info->block_size);
-    if (run_on_used_blocks(0, fs_info.get(), encrypt_f2fs_block, this) != 0) return kFailed;
+    if (!InitFs("f2fs", get_num_blocks_used(fs_info.get()), fs_info->total_blocks,
+                fs_info->block_size))
+        return kFailed;
+    // generate_f2fs_info() needs everything before the main area.
+    defer_begin_block_ = 0;
+    defer_end_block_ = fs_info->main_blkaddr;
+
+    // Encrypt the used blocks as extents, a batch of segments at a time.  The
+    // next batch is scanned while the current one is being encrypted.
+    static const uint64_t kSegmentsPerBatch = 1024;
+    uint64_t batch_blocks = kSegmentsPerBatch * fs_info->blocks_per_segment;
+    uint64_t total_blocks = fs_info->total_blocks;
+    auto scan = [&](uint64_t first_block) {
+        // The first batch also has everything before the main area.
+        uint64_t end_block = std::min(
+                total_blocks, std::max(first_block, fs_info->main_blkaddr) + batch_blocks);
+        return std::async(std::launch::async, [this, &fs_info, first_block, end_block] {
+            std::optional<std::vector<Extent>> extents(std::in_place);
+            if (!ScanF2fsBlocks(fs_info.get(), first_block, end_block, &*extents)) {
+                extents.reset();
+            }
+            return std::make_pair(end_block, std::move(extents));
+        });
+    };
+    auto next = scan(0);
+    while (true) {
+        auto [end_block, extents] = next.get();
+        if (!extents) {
+            LOG(ERROR) << "Failed to find the used blocks of the f2fs filesystem";
+            return kFailed;
+        }
+        if (end_block < total_blocks) next = scan(end_block);
+        for (const auto& extent : *extents) {
+            if (!ProcessUsedExtent(extent.first_block, extent.num_blocks)) return kFailed;
+        }
+        if (end_block >= total_blocks) break;
+    }
     return kSuccess;
 }
 
@@ -257,18 +1186,17 @@ bool InPlaceEncrypter::DoEncryptInPlace() {
 
     LOG(WARNING) << "No recognized filesystem found on " << real_blkdev_
                  << ".  Falling back to encrypting the full block device.";
-    InitFs("", nr_sec_, nr_sec_, 512);
-    for (uint64_t i = 0; i < nr_sec_; i++) {
-        if (!ProcessUsedBlock(i)) return false;
-    }
-    return true;
+    if (!InitFs("", nr_sec_, nr_sec_, 512)) return false;
+    return ProcessUsedExtent(0, nr_sec_);
 }
 
 bool InPlaceEncrypter::EncryptInPlace(const std::string& crypto_blkdev,
-                                      const std::string& real_blkdev, uint64_t nr_sec) {
+                                      const std::string& real_blkdev, uint64_t nr_sec,
+                                      const std::string& progress_path) {
     real_blkdev_ = real_blkdev;
     crypto_blkdev_ = crypto_blkdev;
     nr_sec_ = nr_sec;
+    progress_path_ = progress_path;
 
     realfd_.reset(open64(real_blkdev.c_str(), O_RDONLY | O_CLOEXEC));
     if (realfd_ < 0) {
@@ -282,9 +1210,40 @@ bool InPlaceEncrypter::EncryptInPlace(const std::string& crypto_blkdev,
         return false;
     }
 
-    bool success = DoEncryptInPlace();
+    bool success = true;
+    bool resumed_final_pass = false;
+    if (!progress_path_.empty()) {
+        cryptoreadfd_.reset(open64(crypto_blkdev.c_str(), O_RDONLY | O_CLOEXEC));
+        if (cryptoreadfd_ < 0) {
+            PLOG(ERROR) << "Error opening crypto_blkdev " << crypto_blkdev << " for reading";
+            return false;
+        }
+        bool final_pass;
+        std::vector<Chunk> pending;
+        if (!ReadProgress(&final_pass, &pending)) return false;
+        if (final_pass) {
+            success = ResumeFinalPass(pending);
+            resumed_final_pass = true;
+        } else if (!pending.empty() || watermark_ > 0) {
+            resumed_fs_type_ = fs_type_;
+            for (const auto& chunk : pending) {
+                std::vector<Chunk> plaintext;
+                if (!ClassifyChunk(chunk, &encrypted_chunks_, &plaintext)) return false;
+            }
+        }
+    }
+
+    if (!resumed_final_pass) {
+        success = DoEncryptInPlace();
+
+        if (success) success &= EncryptPendingData();
 
-    if (success) success &= EncryptPendingData();
+        if (success) success &= EncryptDeferredBlocks();
+
+        if (success && !progress_path_.empty()) success &= FlushWindow();
+    }
+
+    if (success) success &= pipeline_->Drain();
 
     if (success && fsync(cryptofd_) != 0) {
         PLOG(ERROR) << "Error syncing " << crypto_blkdev_;
@@ -295,6 +1254,9 @@ bool InPlaceEncrypter::EncryptInPlace(const std::string& crypto_blkdev,
         LOG(ERROR) << "In-place encryption of " << DescribeFilesystem() << " failed";
         return false;
     }
+    if (!progress_path_.empty() && unlink(progress_path_.c_str()) != 0 && errno != ENOENT) {
+        PLOG(WARNING) << "Failed to remove " << progress_path_;
+    }
     if (blocks_done_ != blocks_to_encrypt_) {
         LOG(WARNING) << "blocks_to_encrypt (" << blocks_to_encrypt_
                      << ") was incorrect; we actually encrypted " << blocks_done_
@@ -314,11 +1276,21 @@ bool InPlaceEncrypter::EncryptInPlace(const std::string& crypto_blkdev,
 // device backed by |real_blkdev|.  The size to encrypt is |nr_sec| 512-byte
 // sectors; however, if a filesystem is detected, then its size will be used
 // instead, and only the in-use blocks of the filesystem will be encrypted.
+//
+// If |progress_path| is not empty, progress is persisted there so that an
+// interrupted encryption can be resumed by calling this again with the same
+// arguments.  The file is removed once encryption has finished.
 bool encrypt_inplace(const std::string& crypto_blkdev, const std::string& real_blkdev,
-                     uint64_t nr_sec) {
+                     uint64_t nr_sec, const std::string& progress_path) {
     LOG(DEBUG) << "encrypt_inplace(" << crypto_blkdev << ", " << real_blkdev << ", " << nr_sec
-               << ")";
+               << ", " << progress_path << ")";
 
     InPlaceEncrypter encrypter;
-    return encrypter.EncryptInPlace(crypto_blkdev, real_blkdev, nr_sec);
+    bool success = encrypter.EncryptInPlace(crypto_blkdev, real_blkdev, nr_sec, progress_path);
+    sStats.Finish();
+    return success;
+}
+
+void get_encrypt_inplace_stats(EncryptInplaceStats* stats) {
+    sStats.Get(stats);
 }
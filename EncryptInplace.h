@@ -19,8 +19,29 @@
 
 #include <stdint.h>
 #include <string>
+#include <vector>
 
 bool encrypt_inplace(const std::string& crypto_blkdev, const std::string& real_blkdev,
-                     uint64_t nr_sec);
+                     uint64_t nr_sec, const std::string& progress_path = "");
+
+// Progress of the in-place encryption that is running, or of the last one that
+// ran since vold started.
+struct EncryptInplaceStats {
+    bool active = false;
+    uint64_t bytes_done = 0;
+    uint64_t bytes_total = 0;
+    uint64_t elapsed_ms = 0;
+    // Throughput over roughly the last few seconds, and the time remaining at
+    // that rate (-1 if unknown).
+    double mb_per_sec = 0;
+    int64_t eta_seconds = -1;
+    // Latencies of reads from the real device and of writes to the crypto
+    // device.  Bucket i counts I/Os that took [2^i, 2^(i+1)) microseconds; the
+    // first bucket also counts faster ones and the last bucket slower ones.
+    std::vector<uint64_t> read_latency_hist;
+    std::vector<uint64_t> write_latency_hist;
+};
+
+void get_encrypt_inplace_stats(EncryptInplaceStats* stats);
 
 #endif
@@ -88,6 +88,52 @@ std::unique_ptr<struct fiemap> PathFiemap(const std::string& path, uint32_t exte
     return fiemap;
 }
 
+bool PathExtents(const std::string& path, std::vector<struct fiemap_extent>* extents) {
+    constexpr uint32_t kExtentsPerCall = 64;
+
+    extents->clear();
+    android::base::unique_fd fd(TEMP_FAILURE_RETRY(open(path.c_str(), O_RDONLY | O_CLOEXEC, 0)));
+    if (fd == -1) {
+        if (errno == ENOENT) {
+            PLOG(DEBUG) << "Unable to open " << path;
+        } else {
+            PLOG(ERROR) << "Unable to open " << path;
+        }
+        return false;
+    }
+    auto fiemap = alloc_fiemap(kExtentsPerCall);
+    while (true) {
+        if (ioctl(fd.get(), FS_IOC_FIEMAP, fiemap.get()) != 0) {
+            PLOG(ERROR) << "Unable to FIEMAP " << path;
+            return false;
+        }
+        auto mapped = fiemap->fm_mapped_extents;
+        if (mapped > kExtentsPerCall) {
+            LOG(ERROR) << "Extent count " << mapped << " out of bounds in " << path;
+            return false;
+        }
+        if (mapped == 0) break;
+        extents->insert(extents->end(), fiemap->fm_extents, fiemap->fm_extents + mapped);
+
+        const auto& last = fiemap->fm_extents[mapped - 1];
+        if (last.fe_flags & FIEMAP_EXTENT_LAST) break;
+        // Carry on after the last extent; it always has a length, so this makes progress
+        auto next = last.fe_logical + last.fe_length;
+        if (last.fe_length == 0 || next <= fiemap->fm_start) {
+            LOG(ERROR) << "FIEMAP made no progress at " << next << " in " << path;
+            return false;
+        }
+        fiemap->fm_start = next;
+        fiemap->fm_length = UINT64_MAX - next;
+        fiemap->fm_mapped_extents = 0;
+    }
+    if (extents->empty()) {
+        LOG(ERROR) << "No extents in " << path;
+        return false;
+    }
+    return true;
+}
+
 }  // namespace vold
 }  // namespace android
 
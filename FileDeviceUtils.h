@@ -18,7 +18,9 @@
 #define ANDROID_VOLD_FILEDEVICEUTILS_H
 
 #include <linux/fiemap.h>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace android {
 namespace vold {
@@ -29,6 +31,9 @@ std::string BlockDeviceForPath(const std::string& path);
 // Read the file's FIEMAP
 std::unique_ptr<struct fiemap> PathFiemap(const std::string& path, uint32_t extent_count);
 
+// Read all of the file's extents, however many there are, with as many FIEMAP calls as it takes
+bool PathExtents(const std::string& path, std::vector<struct fiemap_extent>* extents);
+
 }  // namespace vold
 }  // namespace android
 
@@ -0,0 +1,1080 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FileTree.h"
+
+#include <android-base/file.h>
+#include <android-base/logging.h>
+#include <android-base/stringprintf.h>
+#include <android-base/unique_fd.h>
+#include <selinux/label.h>
+#include <selinux/selinux.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <linux/fs.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <sys/xattr.h>
+#include <unistd.h>
+
+using android::base::StringPrintf;
+using android::base::unique_fd;
+
+namespace android {
+namespace vold {
+
+namespace {
+
+constexpr size_t kMaxWorkers = 4;
+// Granularity of copy_file_range() calls, and so of progress reports within a large file.
+constexpr size_t kCopyChunkBytes = 8 * 1024 * 1024;
+constexpr size_t kFallbackBufferBytes = 256 * 1024;
+constexpr const char* kSelinuxXattr = "security.selinux";
+// Where restorecon records the digest of the file_contexts entries it labeled a tree with.
+constexpr const char* kSehashXattr = "security.sehash";
+// How much copied data may be waiting for a syncfs() before it is committed to the manifest.
+constexpr size_t kManifestCommitFiles = 1024;
+constexpr uint64_t kManifestCommitBytes = 256 * 1024 * 1024;
+
+// Never waits for a remote filesystem to refresh attributes; local ones are always current.
+bool statxAt(int dfd, const char* name, unsigned int mask, struct statx* stx) {
+    return statx(dfd, name, AT_SYMLINK_NOFOLLOW | AT_STATX_DONT_SYNC, mask, stx) == 0;
+}
+
+size_t workerCount() {
+    return std::clamp<size_t>(std::thread::hardware_concurrency(), 1, kMaxWorkers);
+}
+
+// Hands directories out to a fixed set of threads. Handlers may queue more work; run()
+// returns once the queue is empty and every worker is idle, or as soon as a handler fails.
+template <typename Task>
+class TreeWorkQueue {
+  public:
+    using Handler = std::function<bool(Task&&)>;
+
+    void push(Task task) {
+        std::lock_guard<std::mutex> lock(mLock);
+        mTasks.push_back(std::move(task));
+        mCv.notify_one();
+    }
+
+    bool run(const Handler& handler) {
+        std::vector<std::thread> workers;
+        for (size_t i = 0; i < workerCount(); i++) {
+            workers.emplace_back([this, &handler] { work(handler); });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        return !mFailed;
+    }
+
+  private:
+    void work(const Handler& handler) {
+        std::unique_lock<std::mutex> lock(mLock);
+        while (true) {
+            mCv.wait(lock, [this] { return mFailed || !mTasks.empty() || mActive == 0; });
+            if (mFailed || mTasks.empty()) break;
+
+            // Newest first, so the walk stays roughly depth-first and the queue stays small.
+            Task task = std::move(mTasks.back());
+            mTasks.pop_back();
+            mActive++;
+            lock.unlock();
+            bool ok = handler(std::move(task));
+            lock.lock();
+            mActive--;
+            if (!ok) mFailed = true;
+            if (mFailed || (mTasks.empty() && mActive == 0)) mCv.notify_all();
+        }
+    }
+
+    std::mutex mLock;
+    std::condition_variable mCv;
+    std::deque<Task> mTasks;
+    size_t mActive = 0;
+    bool mFailed = false;
+};
+
+struct CopyTask {
+    std::string from;
+    std::string to;
+};
+
+class TreeCopier {
+  public:
+    TreeCopier(const TreeProgressCallback& progress, CopyManifest* manifest,
+               const TreeThrottleCallback& throttle)
+        : mProgress(progress), mManifest(manifest), mThrottle(throttle) {}
+
+    bool copy(const std::string& fromPath, const std::string& toPath) {
+        mRoot = fromPath;
+        if (mManifest) {
+            mSyncFd.reset(TEMP_FAILURE_RETRY(
+                    open(toPath.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC)));
+            if (mSyncFd == -1) {
+                PLOG(ERROR) << "Failed to open " << toPath;
+                return false;
+            }
+        }
+
+        TreeWorkQueue<CopyTask> queue;
+        queue.push({fromPath, toPath});
+        bool ok = queue.run([&](CopyTask&& task) { return copyDir(task, queue); });
+        // Whatever was fully copied before a failure is still worth keeping for the retry.
+        if (mManifest && !mManifest->Commit(mSyncFd)) ok = false;
+        if (!ok) {
+            return false;
+        }
+        // Directory metadata goes last, once nothing more will be created inside them.
+        for (auto it = mDirs.rbegin(); it != mDirs.rend(); ++it) {
+            if (!copyDirMetadata(*it)) return false;
+        }
+        return true;
+    }
+
+  private:
+    struct DirEntry {
+        std::string from;
+        std::string to;
+        struct stat st;
+    };
+
+    bool copyDir(const CopyTask& task, TreeWorkQueue<CopyTask>& queue) {
+        throttle(0);
+        auto dirp = std::unique_ptr<DIR, int (*)(DIR*)>(opendir(task.from.c_str()), closedir);
+        if (!dirp) {
+            PLOG(ERROR) << "Failed to open " << task.from;
+            return false;
+        }
+        struct dirent* ent;
+        while ((ent = readdir(dirp.get())) != nullptr) {
+            if (!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, "..")) continue;
+
+            std::string from = task.from + "/" + ent->d_name;
+            std::string to = task.to + "/" + ent->d_name;
+            struct stat st;
+            if (fstatat(dirfd(dirp.get()), ent->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0) {
+                PLOG(ERROR) << "Failed to stat " << from;
+                return false;
+            }
+
+            bool ok;
+            switch (st.st_mode & S_IFMT) {
+                case S_IFDIR:
+                    ok = makeDir(from, to, st);
+                    if (ok) queue.push({from, to});
+                    break;
+                case S_IFREG:
+                    ok = copyFile(from, to, st);
+                    break;
+                case S_IFLNK:
+                    ok = copySymlink(from, to, st);
+                    break;
+                default:
+                    ok = copySpecial(from, to, st);
+                    break;
+            }
+            if (!ok) return false;
+        }
+        return true;
+    }
+
+    bool makeDir(const std::string& from, const std::string& to, const struct stat& st) {
+        if (mkdir(to.c_str(), 0700) != 0 && errno != EEXIST) {
+            PLOG(ERROR) << "Failed to create " << to;
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(mDirsLock);
+        mDirs.push_back({from, to, st});
+        return true;
+    }
+
+    bool copyFile(const std::string& from, const std::string& to, const struct stat& st) {
+        unique_fd in(TEMP_FAILURE_RETRY(open(from.c_str(), O_RDONLY | O_NOFOLLOW | O_CLOEXEC)));
+        if (in == -1) {
+            PLOG(ERROR) << "Failed to open " << from;
+            return false;
+        }
+
+        std::string relPath = from.substr(mRoot.size() + 1);
+        CopyManifest::FileKey key = {(uint64_t)st.st_size,
+                                     st.st_mtim.tv_sec * 1000000000LL + st.st_mtim.tv_nsec, 0};
+        if (mManifest) {
+            if (ioctl(in.get(), FS_IOC_GETVERSION, &key.generation) != 0) key.generation = 0;
+            struct stat target;
+            if (mManifest->IsCopied(relPath, key) && lstat(to.c_str(), &target) == 0 &&
+                S_ISREG(target.st_mode) && target.st_size == st.st_size) {
+                addProgress(st.st_size, 1);
+                return true;
+            }
+        }
+
+        unique_fd out(TEMP_FAILURE_RETRY(
+                open(to.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_NOFOLLOW | O_CLOEXEC, 0600)));
+        if (out == -1) {
+            PLOG(ERROR) << "Failed to create " << to;
+            return false;
+        }
+
+        if (ioctl(out.get(), FICLONE, in.get()) == 0) {
+            addProgress(st.st_size, 0);
+        } else if (!copyData(in, out, from)) {
+            return false;
+        }
+        if (!copyMetadata(in, out, to, st)) return false;
+        if (mManifest) mManifest->RecordCopied(relPath, key, st.st_size, mSyncFd);
+        addProgress(0, 1);
+        return true;
+    }
+
+    // On a resumed copy the entry may already be there from the previous attempt.
+    static bool replaceExisting(const std::string& to, const std::function<int()>& create) {
+        if (create() == 0) return true;
+        if (errno != EEXIST || unlink(to.c_str()) != 0) return false;
+        return create() == 0;
+    }
+
+    bool copyData(int in, int out, const std::string& from) {
+        bool use_copy_file_range = true;
+        std::unique_ptr<char[]> buf;
+        while (true) {
+            ssize_t n;
+            if (use_copy_file_range) {
+                n = copy_file_range(in, nullptr, out, nullptr, kCopyChunkBytes, 0);
+                if (n == -1 && (errno == EXDEV || errno == EINVAL || errno == ENOSYS ||
+                                errno == EOPNOTSUPP)) {
+                    use_copy_file_range = false;
+                    continue;
+                }
+            } else {
+                if (!buf) buf.reset(new char[kFallbackBufferBytes]);
+                n = TEMP_FAILURE_RETRY(read(in, buf.get(), kFallbackBufferBytes));
+                if (n > 0 && !android::base::WriteFully(out, buf.get(), n)) {
+                    n = -1;
+                }
+            }
+            if (n == -1) {
+                PLOG(ERROR) << "Failed to copy " << from;
+                return false;
+            }
+            if (n == 0) return true;
+            addProgress(n, 0);
+            throttle(n);
+        }
+    }
+
+    static void copyXattrs(int in, int out, const std::string& to) {
+        ssize_t size = flistxattr(in, nullptr, 0);
+        if (size <= 0) return;
+        std::vector<char> names(size);
+        size = flistxattr(in, names.data(), names.size());
+        if (size <= 0) return;
+
+        for (const char* name = names.data(); name < names.data() + size;
+             name += strlen(name) + 1) {
+            if (!strcmp(name, kSelinuxXattr)) continue;
+            ssize_t len = fgetxattr(in, name, nullptr, 0);
+            if (len < 0) continue;
+            std::vector<char> value(len);
+            len = fgetxattr(in, name, value.data(), value.size());
+            if (len < 0 || fsetxattr(out, name, value.data(), len, 0) != 0) {
+                PLOG(WARNING) << "Failed to copy xattr " << name << " to " << to;
+            }
+        }
+    }
+
+    static bool copyMetadata(int in, int out, const std::string& to, const struct stat& st) {
+        // chown first, since it clears any setuid/setgid bits set by fchmod.
+        if (fchown(out, st.st_uid, st.st_gid) != 0 || fchmod(out, st.st_mode & 07777) != 0) {
+            PLOG(ERROR) << "Failed to set owner and mode of " << to;
+            return false;
+        }
+        copyXattrs(in, out, to);
+        const struct timespec times[2] = {st.st_atim, st.st_mtim};
+        if (futimens(out, times) != 0) {
+            PLOG(ERROR) << "Failed to set timestamps of " << to;
+            return false;
+        }
+        return true;
+    }
+
+    static bool copyPathMetadata(const std::string& to, const struct stat& st) {
+        if (lchown(to.c_str(), st.st_uid, st.st_gid) != 0) {
+            PLOG(ERROR) << "Failed to set owner of " << to;
+            return false;
+        }
+        if (!S_ISLNK(st.st_mode) && chmod(to.c_str(), st.st_mode & 07777) != 0) {
+            PLOG(ERROR) << "Failed to set mode of " << to;
+            return false;
+        }
+        const struct timespec times[2] = {st.st_atim, st.st_mtim};
+        if (utimensat(AT_FDCWD, to.c_str(), times, AT_SYMLINK_NOFOLLOW) != 0) {
+            PLOG(ERROR) << "Failed to set timestamps of " << to;
+            return false;
+        }
+        return true;
+    }
+
+    bool copySymlink(const std::string& from, const std::string& to, const struct stat& st) {
+        std::string target;
+        if (!android::base::Readlink(from, &target)) {
+            PLOG(ERROR) << "Failed to read link " << from;
+            return false;
+        }
+        if (!replaceExisting(to, [&] { return symlink(target.c_str(), to.c_str()); })) {
+            PLOG(ERROR) << "Failed to create link " << to;
+            return false;
+        }
+        if (!copyPathMetadata(to, st)) return false;
+        addProgress(0, 1);
+        return true;
+    }
+
+    bool copySpecial(const std::string& from, const std::string& to, const struct stat& st) {
+        if (!replaceExisting(to, [&] { return mknod(to.c_str(), st.st_mode, st.st_rdev); })) {
+            PLOG(ERROR) << "Failed to create node " << to << " for " << from;
+            return false;
+        }
+        if (!copyPathMetadata(to, st)) return false;
+        addProgress(0, 1);
+        return true;
+    }
+
+    static bool copyDirMetadata(const DirEntry& dir) {
+        unique_fd in(TEMP_FAILURE_RETRY(
+                open(dir.from.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC)));
+        unique_fd out(TEMP_FAILURE_RETRY(
+                open(dir.to.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC)));
+        if (in == -1 || out == -1) {
+            PLOG(ERROR) << "Failed to open " << dir.from << " or " << dir.to;
+            return false;
+        }
+        return copyMetadata(in, out, dir.to, dir.st);
+    }
+
+    void throttle(uint64_t bytes) {
+        if (mThrottle) mThrottle(bytes);
+    }
+
+    void addProgress(uint64_t bytes, uint64_t files) {
+        std::lock_guard<std::mutex> lock(mProgressLock);
+        mBytes += bytes;
+        mFiles += files;
+        if (mProgress) mProgress(mBytes, mFiles);
+    }
+
+    const TreeProgressCallback& mProgress;
+    CopyManifest* mManifest;
+    const TreeThrottleCallback& mThrottle;
+    std::string mRoot;
+    unique_fd mSyncFd;
+    std::mutex mProgressLock;
+    uint64_t mBytes = 0;
+    uint64_t mFiles = 0;
+
+    std::mutex mDirsLock;
+    std::vector<DirEntry> mDirs;
+};
+
+struct RemoveTask {
+    std::string path;
+    dev_t dev;
+    ino_t ino;
+};
+
+class TreeRemover {
+  public:
+    TreeRemover(const TreeProgressCallback& progress, const TreeThrottleCallback& throttle)
+        : mProgress(progress), mThrottle(throttle) {}
+
+    status_t remove(const std::string& path, bool removeRoot) {
+        struct stat st;
+        if (lstat(path.c_str(), &st) != 0) {
+            if (errno == ENOENT) return OK;
+            PLOG(ERROR) << "Failed to stat " << path;
+            return -errno;
+        }
+        if (!S_ISDIR(st.st_mode)) {
+            LOG(ERROR) << path << " is not a directory";
+            return -ENOTDIR;
+        }
+
+        unique_fd root(TEMP_FAILURE_RETRY(
+                open(path.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC)));
+        mRootDev = st.st_dev;
+        mRootMount = root == -1 ? 0 : mountId(root);
+
+        // Phase 1 unlinks every non-directory in parallel, remembering the subdirectories of
+        // each directory visited. Tasks carry paths rather than open fds so that fd usage stays
+        // bounded by the number of workers no matter how wide the tree is.
+        TreeWorkQueue<RemoveTask> queue;
+        queue.push({path, st.st_dev, st.st_ino});
+        queue.run([&](RemoveTask&& task) {
+            removeFiles(task, queue);
+            return true;
+        });
+
+        // Phase 2 removes the now file-free directories, children before their parents.
+        for (auto it = mDirs.rbegin(); it != mDirs.rend(); ++it) {
+            removeDirs(*it);
+        }
+        if (removeRoot && TEMP_FAILURE_RETRY(rmdir(path.c_str())) != 0 && errno != ENOENT) {
+            PLOG(ERROR) << "Failed to rmdir " << path;
+            setError(-errno);
+        }
+        return mError;
+    }
+
+  private:
+    struct DirRecord {
+        RemoveTask dir;
+        std::vector<std::string> subdirs;
+    };
+
+    // Opens a directory and makes sure it is still the one that was seen while walking its
+    // parent, so that a directory swapped for a symlink can't redirect the removal.
+    unique_fd openVerified(const RemoveTask& task) {
+        unique_fd fd(TEMP_FAILURE_RETRY(
+                open(task.path.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC)));
+        if (fd == -1) {
+            PLOG(ERROR) << "Failed to open " << task.path;
+            setError(-errno);
+            return fd;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_dev != task.dev || st.st_ino != task.ino) {
+            LOG(ERROR) << task.path << " changed while it was being removed";
+            setError(-EBUSY);
+            fd.reset();
+            return fd;
+        }
+        // Never reach into something mounted below the tree, such as a stale bind mount, even
+        // one of the same filesystem.
+        if (st.st_dev != mRootDev || mountId(fd) != mRootMount) {
+            LOG(ERROR) << "Not removing " << task.path << ", which is on another mount";
+            setError(-EXDEV);
+            fd.reset();
+        }
+        return fd;
+    }
+
+    // The mount a directory is on, or 0 if the kernel can't tell (before Linux 5.8).
+    static uint64_t mountId(int fd) {
+        struct statx stx;
+        if (statx(fd, "", AT_EMPTY_PATH, STATX_MNT_ID, &stx) != 0 ||
+            !(stx.stx_mask & STATX_MNT_ID)) {
+            return 0;
+        }
+        return stx.stx_mnt_id;
+    }
+
+    void removeFiles(const RemoveTask& task, TreeWorkQueue<RemoveTask>& queue) {
+        if (mThrottle) mThrottle(0);
+        unique_fd fd = openVerified(task);
+        if (fd == -1) return;
+        std::unique_ptr<DIR, int (*)(DIR*)> dirp(android::base::Fdopendir(std::move(fd)),
+                                                 closedir);
+        if (!dirp) {
+            PLOG(ERROR) << "Failed to fdopendir " << task.path;
+            setError(-errno);
+            return;
+        }
+
+        int dfd = dirfd(dirp.get());
+        DirRecord record = {task, {}};
+        std::vector<RemoveTask> subtasks;
+        uint64_t bytes = 0, files = 0;
+        struct dirent* ent;
+        while ((ent = readdir(dirp.get())) != nullptr) {
+            if (!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, "..")) continue;
+
+            struct stat st;
+            bool need_stat = ent->d_type == DT_DIR || ent->d_type == DT_UNKNOWN || mProgress;
+            if (need_stat && fstatat(dfd, ent->d_name, &st, AT_SYMLINK_NOFOLLOW) != 0) {
+                if (errno == ENOENT) continue;
+                PLOG(ERROR) << "Failed to stat " << task.path << "/" << ent->d_name;
+                setError(-errno);
+                continue;
+            }
+            if (need_stat ? S_ISDIR(st.st_mode) : ent->d_type == DT_DIR) {
+                record.subdirs.push_back(ent->d_name);
+                subtasks.push_back({task.path + "/" + ent->d_name, st.st_dev, st.st_ino});
+                continue;
+            }
+            if (unlinkat(dfd, ent->d_name, 0) != 0 && errno != ENOENT) {
+                PLOG(ERROR) << "Failed to unlink " << task.path << "/" << ent->d_name;
+                setError(-errno);
+                continue;
+            }
+            if (need_stat) bytes += st.st_blocks * 512;
+            files++;
+        }
+
+        addProgress(bytes, files);
+        if (record.subdirs.empty()) return;
+
+        // Recorded before any subdirectory is handed out, so that every record comes after the
+        // record of its parent and phase 2 can simply walk them backwards.
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            mDirs.push_back(std::move(record));
+        }
+        for (auto& subtask : subtasks) {
+            queue.push(std::move(subtask));
+        }
+    }
+
+    void removeDirs(const DirRecord& record) {
+        unique_fd fd = openVerified(record.dir);
+        if (fd == -1) return;
+        for (const auto& name : record.subdirs) {
+            if (unlinkat(fd, name.c_str(), AT_REMOVEDIR) != 0 && errno != ENOENT) {
+                PLOG(ERROR) << "Failed to rmdir " << record.dir.path << "/" << name;
+                setError(-errno);
+            }
+        }
+        addProgress(0, record.subdirs.size());
+    }
+
+    void setError(status_t error) {
+        std::lock_guard<std::mutex> lock(mLock);
+        mError = error;
+    }
+
+    void addProgress(uint64_t bytes, uint64_t files) {
+        if (!mProgress || (bytes == 0 && files == 0)) return;
+        std::lock_guard<std::mutex> lock(mLock);
+        mBytes += bytes;
+        mFiles += files;
+        mProgress(mBytes, mFiles);
+    }
+
+    const TreeProgressCallback& mProgress;
+    const TreeThrottleCallback& mThrottle;
+    dev_t mRootDev = 0;
+    uint64_t mRootMount = 0;
+    std::mutex mLock;
+    std::vector<DirRecord> mDirs;
+    status_t mError = OK;
+    uint64_t mBytes = 0;
+    uint64_t mFiles = 0;
+};
+
+class TreePruner {
+  public:
+    status_t prune(const std::string& fromPath, const std::string& toPath) {
+        TreeWorkQueue<CopyTask> queue;
+        queue.push({fromPath, toPath});
+        queue.run([&](CopyTask&& task) {
+            pruneDir(task, queue);
+            return true;
+        });
+        LOG(DEBUG) << "Pruned " << mPruned << " entries from " << toPath;
+        return mError;
+    }
+
+  private:
+    void pruneDir(const CopyTask& task, TreeWorkQueue<CopyTask>& queue) {
+        unique_fd from(TEMP_FAILURE_RETRY(
+                open(task.from.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC)));
+        if (from == -1) {
+            PLOG(ERROR) << "Failed to open " << task.from;
+            setError(-errno);
+            return;
+        }
+        auto dirp = std::unique_ptr<DIR, int (*)(DIR*)>(opendir(task.to.c_str()), closedir);
+        if (!dirp) {
+            PLOG(ERROR) << "Failed to open " << task.to;
+            setError(-errno);
+            return;
+        }
+        int dfd = dirfd(dirp.get());
+        struct dirent* ent;
+        while ((ent = readdir(dirp.get())) != nullptr) {
+            if (!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, "..")) continue;
+
+            std::string to = task.to + "/" + ent->d_name;
+            struct stat target, source;
+            if (fstatat(dfd, ent->d_name, &target, AT_SYMLINK_NOFOLLOW) != 0) {
+                PLOG(ERROR) << "Failed to stat " << to;
+                setError(-errno);
+                continue;
+            }
+            if (fstatat(from, ent->d_name, &source, AT_SYMLINK_NOFOLLOW) == 0) {
+                if ((source.st_mode & S_IFMT) == (target.st_mode & S_IFMT)) {
+                    if (S_ISDIR(target.st_mode)) queue.push({task.from + "/" + ent->d_name, to});
+                    continue;
+                }
+            } else if (errno != ENOENT) {
+                PLOG(ERROR) << "Failed to stat " << task.from << "/" << ent->d_name;
+                setError(-errno);
+                continue;
+            }
+
+            // Gone from the source, or replaced there by something of another type
+            status_t res = OK;
+            if (S_ISDIR(target.st_mode)) {
+                res = RemoveTree(to, true);
+            } else if (unlinkat(dfd, ent->d_name, 0) != 0 && errno != ENOENT) {
+                PLOG(ERROR) << "Failed to unlink " << to;
+                res = -errno;
+            }
+            if (res != OK) {
+                setError(res);
+                continue;
+            }
+            mPruned++;
+        }
+    }
+
+    void setError(status_t error) {
+        std::lock_guard<std::mutex> lock(mLock);
+        mError = error;
+    }
+
+    std::atomic<uint64_t> mPruned = 0;
+    std::mutex mLock;
+    status_t mError = OK;
+};
+
+class TreeScanner {
+  public:
+    status_t scan(const std::string& path, TreeUsage* usage) {
+        TreeWorkQueue<std::string> queue;
+        queue.push(path);
+        queue.run([&](std::string&& dir) {
+            scanDir(dir, queue);
+            return true;
+        });
+        *usage = mUsage;
+        return mError;
+    }
+
+  private:
+    void scanDir(const std::string& path, TreeWorkQueue<std::string>& queue) {
+        auto dirp = std::unique_ptr<DIR, int (*)(DIR*)>(opendir(path.c_str()), closedir);
+        if (!dirp) {
+            PLOG(ERROR) << "Failed to open " << path;
+            setError(-errno);
+            return;
+        }
+
+        int dfd = dirfd(dirp.get());
+        TreeUsage usage;
+        struct dirent* ent;
+        while ((ent = readdir(dirp.get())) != nullptr) {
+            if (!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, "..")) continue;
+
+            // Only regular files contribute bytes, so anything else known from the dirent
+            // alone doesn't need a stat.
+            mode_t type;
+            struct statx stx = {};
+            if (ent->d_type == DT_REG || ent->d_type == DT_UNKNOWN) {
+                if (!statxAt(dfd, ent->d_name, STATX_TYPE | STATX_SIZE, &stx)) {
+                    if (errno == ENOENT) continue;
+                    PLOG(ERROR) << "Failed to stat " << path << "/" << ent->d_name;
+                    setError(-errno);
+                    continue;
+                }
+                type = stx.stx_mode & S_IFMT;
+            } else {
+                type = ent->d_type == DT_DIR ? S_IFDIR : 0;
+            }
+
+            if (type == S_IFDIR) {
+                usage.dirs++;
+                queue.push(path + "/" + ent->d_name);
+                continue;
+            }
+            if (type == S_IFREG) usage.bytes += stx.stx_size;
+            usage.files++;
+        }
+
+        std::lock_guard<std::mutex> lock(mLock);
+        mUsage.bytes += usage.bytes;
+        mUsage.files += usage.files;
+        mUsage.dirs += usage.dirs;
+    }
+
+    void setError(status_t error) {
+        std::lock_guard<std::mutex> lock(mLock);
+        mError = error;
+    }
+
+    std::mutex mLock;
+    TreeUsage mUsage;
+    status_t mError = OK;
+};
+
+class TreeSizer {
+  public:
+    uint64_t size(const std::string& path) {
+        unique_fd fd(TEMP_FAILURE_RETRY(open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC)));
+        if (fd == -1) {
+            PLOG(WARNING) << "Failed to open " << path;
+            return -1;
+        }
+        fd.reset();
+
+        mRoot = path;
+        TreeWorkQueue<std::string> queue;
+        queue.push(path);
+        queue.run([&](std::string&& dir) {
+            sizeDir(dir, queue);
+            return true;
+        });
+        return mBytes;
+    }
+
+  private:
+    static uint64_t allocatedBytes(const struct statx& stx) {
+        uint64_t bytes = stx.stx_blocks * 512;
+        uint64_t blksize = stx.stx_blksize;
+        if (blksize) bytes = (bytes + blksize - 1) & ~(blksize - 1);
+        return bytes;
+    }
+
+    void sizeDir(const std::string& path, TreeWorkQueue<std::string>& queue) {
+        // Like du, the root may be a symlink to the tree but nothing below it is followed.
+        int flags = O_RDONLY | O_DIRECTORY | O_CLOEXEC | (path == mRoot ? 0 : O_NOFOLLOW);
+        unique_fd fd(TEMP_FAILURE_RETRY(open(path.c_str(), flags)));
+        struct statx self;
+        if (fd == -1 ||
+            statx(fd, "", AT_EMPTY_PATH | AT_STATX_DONT_SYNC, STATX_BLOCKS, &self) != 0) {
+            return;
+        }
+
+        std::unique_ptr<DIR, int (*)(DIR*)> dirp(android::base::Fdopendir(std::move(fd)),
+                                                 closedir);
+        if (!dirp) return;
+        int dfd = dirfd(dirp.get());
+        uint64_t ownBytes = allocatedBytes(self);
+        struct dirent* ent;
+        while ((ent = readdir(dirp.get())) != nullptr) {
+            if (!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, "..")) continue;
+
+            // A subdirectory's own size is counted when it is visited.
+            if (ent->d_type == DT_DIR) {
+                queue.push(path + "/" + ent->d_name);
+                continue;
+            }
+            struct statx stx;
+            if (!statxAt(dfd, ent->d_name, STATX_TYPE | STATX_BLOCKS, &stx)) continue;
+            if (S_ISDIR(stx.stx_mode)) {
+                queue.push(path + "/" + ent->d_name);
+            } else {
+                ownBytes += allocatedBytes(stx);
+            }
+        }
+        addBytes(ownBytes);
+    }
+
+    void addBytes(uint64_t bytes) {
+        std::lock_guard<std::mutex> lock(mLock);
+        mBytes += bytes;
+    }
+
+    std::string mRoot;
+    std::mutex mLock;
+    uint64_t mBytes = 0;
+};
+
+struct RelabelTask {
+    std::string path;
+    dev_t dev;
+};
+
+class TreeRelabeler {
+  public:
+    explicit TreeRelabeler(struct selabel_handle* handle) : mHandle(handle) {}
+
+    status_t relabel(const std::vector<std::string>& roots) {
+        TreeWorkQueue<RelabelTask> queue;
+        for (const auto& root : roots) {
+            struct statx stx;
+            if (!statxAt(AT_FDCWD, root.c_str(), STATX_TYPE, &stx)) {
+                if (errno == ENOENT) continue;
+                PLOG(ERROR) << "Failed to stat " << root;
+                return -errno;
+            }
+            relabelEntry(root, stx.stx_mode);
+            if (S_ISDIR(stx.stx_mode)) {
+                queue.push({root, makedev(stx.stx_dev_major, stx.stx_dev_minor)});
+            }
+        }
+        queue.run([&](RelabelTask&& task) {
+            relabelDir(task, queue);
+            return error() != -EACCES;
+        });
+        if (error() != OK) return error();
+
+        // Only now is every directory's subtree labeled as its digest will claim.
+        for (const auto& [path, digest] : mDigests) {
+            if (setxattr(path.c_str(), kSehashXattr, digest.data(), digest.size(), 0) != 0) {
+                PLOG(WARNING) << "Failed to record restorecon digest of " << path;
+            }
+        }
+        LOG(INFO) << "Relabeled " << mRelabeled << " of " << mChecked << " entries, skipped "
+                  << mSkipped << " up to date directories";
+        return OK;
+    }
+
+  private:
+    void relabelDir(const RelabelTask& task, TreeWorkQueue<RelabelTask>& queue) {
+        uint8_t* calculated = nullptr;
+        uint8_t* recorded = nullptr;
+        size_t length = 0;
+        bool upToDate = selabel_get_digests_all_partial_matches(mHandle, task.path.c_str(),
+                                                                &calculated, &recorded, &length);
+        if (!upToDate && calculated != nullptr) {
+            std::lock_guard<std::mutex> lock(mLock);
+            mDigests.emplace_back(task.path, std::vector<uint8_t>(calculated, calculated + length));
+        }
+        free(calculated);
+        free(recorded);
+        if (upToDate) {
+            mSkipped++;
+            return;
+        }
+
+        auto dirp = std::unique_ptr<DIR, int (*)(DIR*)>(opendir(task.path.c_str()), closedir);
+        if (!dirp) {
+            if (errno == ENOENT) return;
+            PLOG(ERROR) << "Failed to open " << task.path;
+            setError(-errno);
+            return;
+        }
+
+        int dfd = dirfd(dirp.get());
+        struct dirent* ent;
+        while ((ent = readdir(dirp.get())) != nullptr) {
+            if (!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, "..")) continue;
+            std::string path = task.path + "/" + ent->d_name;
+
+            // The lookup only needs the type, which is in the dirent unless it's a directory
+            // that may be a mount point.
+            struct statx stx = {};
+            mode_t mode = DTTOIF(ent->d_type);
+            if (ent->d_type == DT_DIR || ent->d_type == DT_UNKNOWN) {
+                if (!statxAt(dfd, ent->d_name, STATX_TYPE, &stx)) {
+                    if (errno == ENOENT) continue;
+                    PLOG(ERROR) << "Failed to stat " << path;
+                    setError(-errno);
+                    continue;
+                }
+                mode = stx.stx_mode & S_IFMT;
+            }
+
+            if (S_ISDIR(mode) && makedev(stx.stx_dev_major, stx.stx_dev_minor) != task.dev) {
+                continue;
+            }
+            if (!relabelEntry(path, mode)) return;
+            if (S_ISDIR(mode)) queue.push({std::move(path), task.dev});
+        }
+    }
+
+    // Returns false if relabeling should stop altogether.
+    bool relabelEntry(const std::string& path, mode_t mode) {
+        mChecked++;
+        char* wanted = nullptr;
+        if (selabel_lookup(mHandle, &wanted, path.c_str(), mode) != 0) {
+            // Nothing in file_contexts applies, which restorecon leaves alone too.
+            if (errno != ENOENT) PLOG(WARNING) << "Failed to look up label of " << path;
+            return true;
+        }
+        std::unique_ptr<char, void (*)(char*)> wantedCon(wanted, freecon);
+
+        char* current = nullptr;
+        if (lgetfilecon(path.c_str(), &current) >= 0) {
+            std::unique_ptr<char, void (*)(char*)> currentCon(current, freecon);
+            if (!strcmp(current, wanted)) return true;
+        }
+
+        if (lsetfilecon(path.c_str(), wanted) != 0) {
+            if (errno == ENOENT) return true;
+            PLOG(ERROR) << "Failed to relabel " << path << " to " << wanted;
+            setError(-errno);
+            return errno != EACCES;
+        }
+        mRelabeled++;
+        return true;
+    }
+
+    status_t error() {
+        std::lock_guard<std::mutex> lock(mLock);
+        return mError;
+    }
+
+    void setError(status_t error) {
+        std::lock_guard<std::mutex> lock(mLock);
+        // A permission error is what the caller acts on, so it isn't overwritten.
+        if (mError != -EACCES) mError = error;
+    }
+
+    struct selabel_handle* const mHandle;
+    std::atomic<uint64_t> mChecked = 0;
+    std::atomic<uint64_t> mRelabeled = 0;
+    std::atomic<uint64_t> mSkipped = 0;
+
+    std::mutex mLock;
+    std::vector<std::pair<std::string, std::vector<uint8_t>>> mDigests;
+    status_t mError = OK;
+};
+
+}  // namespace
+
+bool CopyManifest::Open(const std::string& path, const std::string& id) {
+    mPath = path;
+    mResumed = false;
+    mCopiedBytes = 0;
+    mCopied.clear();
+
+    // One "<size> <mtime_ns> <generation> <path>" line per file, after an "<id>" header line.
+    std::string contents;
+    if (android::base::ReadFileToString(path, &contents)) {
+        size_t eol = contents.find('\n');
+        if (eol != std::string::npos && contents.compare(0, eol, id) == 0) {
+            mResumed = true;
+            size_t pos = eol + 1;
+            while ((eol = contents.find('\n', pos)) != std::string::npos) {
+                char relPath[PATH_MAX];
+                FileKey key;
+                std::string line = contents.substr(pos, eol - pos);
+                if (sscanf(line.c_str(), "%" SCNu64 " %" SCNd64 " %" SCNu32 " %4095[^\n]",
+                           &key.size, &key.mtime_ns, &key.generation, relPath) == 4) {
+                    mCopied[relPath] = key;
+                }
+                pos = eol + 1;
+            }
+        }
+    }
+
+    int flags = O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC | (mResumed ? 0 : O_TRUNC);
+    mFd.reset(TEMP_FAILURE_RETRY(open(path.c_str(), flags, 0600)));
+    if (mFd == -1) {
+        PLOG(ERROR) << "Failed to open " << path;
+        return false;
+    }
+    if (!mResumed && !android::base::WriteStringToFd(id + "\n", mFd)) {
+        PLOG(ERROR) << "Failed to write " << path;
+        return false;
+    }
+    for (const auto& [relPath, key] : mCopied) {
+        mCopiedBytes += key.size;
+    }
+    if (mResumed) {
+        LOG(INFO) << "Resuming copy with " << mCopied.size() << " files already done";
+    }
+    return true;
+}
+
+void CopyManifest::Remove() {
+    mFd.reset();
+    if (unlink(mPath.c_str()) != 0 && errno != ENOENT) {
+        PLOG(WARNING) << "Failed to remove " << mPath;
+    }
+}
+
+bool CopyManifest::IsCopied(const std::string& relPath, const FileKey& key) {
+    std::lock_guard<std::mutex> lock(mLock);
+    auto it = mCopied.find(relPath);
+    return it != mCopied.end() && it->second == key;
+}
+
+void CopyManifest::RecordCopied(const std::string& relPath, const FileKey& key, uint64_t bytes,
+                                int syncFd) {
+    // Names that can't be represented on one line are simply copied again on a retry.
+    if (relPath.find('\n') != std::string::npos) return;
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mPending += StringPrintf("%" PRIu64 " %" PRId64 " %" PRIu32 " %s\n", key.size,
+                                 key.mtime_ns, key.generation, relPath.c_str());
+        mPendingFiles++;
+        mPendingBytes += bytes;
+        if (mPendingFiles < kManifestCommitFiles && mPendingBytes < kManifestCommitBytes) return;
+    }
+    Commit(syncFd);
+}
+
+bool CopyManifest::Commit(int syncFd) {
+    std::lock_guard<std::mutex> lock(mLock);
+    if (mPending.empty()) return true;
+    // The copied files must be durable before the manifest claims they are.
+    if (syncfs(syncFd) != 0) {
+        PLOG(ERROR) << "Failed to sync copy target";
+        return false;
+    }
+    if (!android::base::WriteStringToFd(mPending, mFd) || fdatasync(mFd) != 0) {
+        PLOG(ERROR) << "Failed to write " << mPath;
+        return false;
+    }
+    mPending.clear();
+    mPendingFiles = 0;
+    mPendingBytes = 0;
+    return true;
+}
+
+status_t CopyTreeContents(const std::string& fromPath, const std::string& toPath,
+                          const TreeProgressCallback& progress, CopyManifest* manifest,
+                          const TreeThrottleCallback& throttle) {
+    TreeCopier copier(progress, manifest, throttle);
+    return copier.copy(fromPath, toPath) ? OK : -1;
+}
+
+status_t PruneTreeContents(const std::string& fromPath, const std::string& toPath) {
+    TreePruner pruner;
+    return pruner.prune(fromPath, toPath);
+}
+
+status_t GetTreeUsage(const std::string& path, TreeUsage* usage) {
+    TreeScanner scanner;
+    return scanner.scan(path, usage);
+}
+
+uint64_t GetTreeAllocatedBytes(const std::string& path) {
+    TreeSizer sizer;
+    return sizer.size(path);
+}
+
+status_t RemoveTree(const std::string& path, bool removeRoot,
+                    const TreeProgressCallback& progress, const TreeThrottleCallback& throttle) {
+    TreeRemover remover(progress, throttle);
+    return remover.remove(path, removeRoot);
+}
+
+status_t RelabelTrees(const std::vector<std::string>& roots, struct selabel_handle* handle) {
+    TreeRelabeler relabeler(handle);
+    return relabeler.relabel(roots);
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,167 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_VOLD_FILE_TREE_H
+#define ANDROID_VOLD_FILE_TREE_H
+
+#include <android-base/unique_fd.h>
+#include <utils/Errors.h>
+
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct selabel_handle;
+
+namespace android {
+namespace vold {
+
+/*
+ * Receives the running totals of bytes and files processed so far. Calls are serialized, but
+ * may come from any of the worker threads.
+ */
+using TreeProgressCallback = std::function<void(uint64_t bytes, uint64_t files)>;
+
+/*
+ * Called on each worker thread as it works through a tree, with the bytes of data it just moved
+ * (possibly zero). It may block to slow the operation down, and may change the I/O priority of
+ * the calling thread.
+ */
+using TreeThrottleCallback = std::function<void(uint64_t bytes)>;
+
+/*
+ * Durable record of the files an interrupted CopyTreeContents() already finished, so that a
+ * retry of the same copy can skip them. A file is only recorded after its data and metadata
+ * have been synced to the target, and is skipped later only if its size, mtime and inode
+ * generation on the source are still the same.
+ */
+class CopyManifest {
+  public:
+    struct FileKey {
+        uint64_t size;
+        int64_t mtime_ns;
+        uint32_t generation;
+
+        bool operator==(const FileKey& other) const {
+            return size == other.size && mtime_ns == other.mtime_ns &&
+                   generation == other.generation;
+        }
+    };
+
+    /*
+     * Loads the manifest at path if it was written for the same id, otherwise starts a new
+     * one. Returns false if the manifest can't be written.
+     */
+    bool Open(const std::string& path, const std::string& id);
+    /* Whether a manifest for this id already existed when it was opened */
+    bool resumed() const { return mResumed; }
+    /* Bytes of the files the manifest had as copied when it was opened */
+    uint64_t copiedBytes() const { return mCopiedBytes; }
+    /* Deletes the manifest once the copy it describes is no longer needed */
+    void Remove();
+
+    bool IsCopied(const std::string& relPath, const FileKey& key);
+    /* Queues relPath for recording; syncs the target and commits every so often */
+    void RecordCopied(const std::string& relPath, const FileKey& key, uint64_t bytes,
+                      int syncFd);
+    bool Commit(int syncFd);
+
+  private:
+    std::string mPath;
+    android::base::unique_fd mFd;
+    bool mResumed = false;
+    uint64_t mCopiedBytes = 0;
+
+    std::mutex mLock;
+    std::unordered_map<std::string, FileKey> mCopied;
+    std::string mPending;
+    size_t mPendingFiles = 0;
+    uint64_t mPendingBytes = 0;
+};
+
+/*
+ * Copies the contents of fromPath into the existing directory toPath using several worker
+ * threads, like "cp -p -R -P" of every entry in fromPath. Files are reflinked where the
+ * filesystem allows it and copied with copy_file_range() otherwise. Mode, ownership, xattrs
+ * (except SELinux labels, which follow the target's policy) and timestamps are preserved.
+ * With a manifest, files it lists as already copied are skipped and newly copied files are
+ * added to it. A throttle is called once per directory and after every chunk of file data.
+ */
+status_t CopyTreeContents(const std::string& fromPath, const std::string& toPath,
+                          const TreeProgressCallback& progress = nullptr,
+                          CopyManifest* manifest = nullptr,
+                          const TreeThrottleCallback& throttle = nullptr);
+
+/*
+ * Removes the entries below toPath that are missing at the same place below fromPath, or are
+ * there as something of another type, so that resuming an interrupted CopyTreeContents() into
+ * toPath doesn't bring back what was deleted from fromPath in the meantime. Keeps going after
+ * errors and returns the last one as a negative errno.
+ */
+status_t PruneTreeContents(const std::string& fromPath, const std::string& toPath);
+
+/* Totals for the entries below a directory, not counting the directory itself */
+struct TreeUsage {
+    /* Apparent size of the regular files, as CopyTreeContents() reports progress */
+    uint64_t bytes = 0;
+    /* Everything that isn't a directory */
+    uint64_t files = 0;
+    uint64_t dirs = 0;
+};
+
+/*
+ * Adds up the entries below the directory at path using several worker threads, without
+ * following symlinks. Keeps going after errors and returns the last one as a negative errno.
+ */
+status_t GetTreeUsage(const std::string& path, TreeUsage* usage);
+
+/*
+ * Returns the space allocated to the directory at path and everything below it, rounded up to
+ * whole filesystem blocks per entry, or (uint64_t)-1 if path can't be opened. Entries that fail
+ * to stat are skipped. The walk uses several worker threads and statx() with only the fields it
+ * needs.
+ */
+uint64_t GetTreeAllocatedBytes(const std::string& path);
+
+/*
+ * Removes everything below the directory at path, and path itself if removeRoot is set, using
+ * several worker threads. Symlinks are removed, never followed, and directories on another
+ * filesystem than path, such as mount points, are left alone and make the removal fail with
+ * -EXDEV. Keeps going after errors and returns the last one as a negative errno; a path that
+ * doesn't exist is not an error. With a progress callback, bytes are the allocated size of the
+ * removed files and files counts every removed entry, directories included. A throttle is
+ * called once per directory.
+ */
+status_t RemoveTree(const std::string& path, bool removeRoot,
+                    const TreeProgressCallback& progress = nullptr,
+                    const TreeThrottleCallback& throttle = nullptr);
+
+/*
+ * Restores the file_contexts labels of everything under roots, like a recursive restorecon
+ * that doesn't cross mount points, with the directories spread across workers sharing handle.
+ * A directory whose security.sehash digest still matches the file_contexts entries that apply
+ * under it is skipped with its whole subtree; the digests of the directories that were walked
+ * are updated once all of them are labeled. Returns -EACCES as soon as a label can't be
+ * changed for lack of permission.
+ */
+status_t RelabelTrees(const std::vector<std::string>& roots, struct selabel_handle* handle);
+
+}  // namespace vold
+}  // namespace android
+
+#endif
@@ -20,24 +20,31 @@
 #include "Keystore.h"
 #include "KeyStorage.h"
 #include "KeyUtil.h"
+#include "StorageTopology.h"
 #include "Utils.h"
 #include "VoldUtil.h"
 
 #include <algorithm>
+#include <atomic>
+#include <future>
 #include <map>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <signal.h>
 #include <sys/mount.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/wait.h>
 #include <unistd.h>
 
 #include <private/android_filesystem_config.h>
@@ -52,7 +59,6 @@
 
 #include <fscrypt/fscrypt.h>
 #include <keyutils.h>
-#include <libdm/dm.h>
 
 #include <android-base/file.h>
 #include <android-base/logging.h>
@@ -62,7 +68,6 @@
 #include <android-base/unique_fd.h>
 
 using android::base::Basename;
-using android::base::Realpath;
 using android::base::StartsWith;
 using android::base::StringPrintf;
 using android::fs_mgr::GetEntryForMountPoint;
@@ -79,7 +84,6 @@ using android::vold::SetQuotaInherit;
 using android::vold::SetQuotaProjectId;
 using android::vold::writeStringToFile;
 using namespace android::fscrypt;
-using namespace android::dm;
 
 namespace {
 
@@ -113,6 +117,9 @@ EncryptionPolicy s_device_policy;
 // Map user ids to encryption policies
 std::map<userid_t, EncryptionPolicy> s_de_policies;
 std::map<userid_t, EncryptionPolicy> s_ce_policies;
+// Held along with the crypt lock to change s_ce_policies, so that fscrypt_get_unlocked_users()
+// can read it with this lock alone
+std::mutex s_ce_policies_lock;
 
 // CE key fixation operations that have been deferred to checkpoint commit
 std::map<std::string, std::string> s_deferred_fixations;
@@ -228,20 +235,11 @@ static bool read_and_fixate_user_ce_key(userid_t user_id,
     return false;
 }
 
-static bool MightBeEmmcStorage(const std::string& blk_device) {
-    // Handle symlinks.
-    std::string real_path;
-    if (!Realpath(blk_device, &real_path)) {
-        real_path = blk_device;
-    }
-
-    // Handle logical volumes.
-    auto& dm = DeviceMapper::Instance();
-    for (;;) {
-        auto parent = dm.GetParentBlockDeviceByPath(real_path);
-        if (!parent.has_value()) break;
-        real_path = *parent;
-    }
+static bool MightBeEmmcStorage() {
+    auto topology = android::vold::GetDataTopology();
+    if (topology == nullptr) return false;
+    const std::string& blk_device = topology->chain.front();
+    const std::string& real_path = topology->chain.back();
 
     // Now we should have the "real" block device.
     LOG(DEBUG) << "MightBeEmmcStorage(): blk_device = " << blk_device
@@ -268,7 +266,7 @@ static bool init_data_file_encryption_options() {
         return false;
     }
     if ((s_data_options.flags & FSCRYPT_POLICY_FLAG_IV_INO_LBLK_32) &&
-        !MightBeEmmcStorage(entry->blk_device)) {
+        !MightBeEmmcStorage()) {
         LOG(ERROR) << "The emmc_optimized encryption flag is only allowed on eMMC storage.  Remove "
                       "this flag from the device's fstab";
         return false;
@@ -332,7 +330,10 @@ static bool read_and_install_user_ce_key(userid_t user_id,
     if (!read_and_fixate_user_ce_key(user_id, auth, &ce_key)) return false;
     EncryptionPolicy ce_policy;
     if (!install_storage_key(DATA_MNT_POINT, s_data_options, ce_key, &ce_policy)) return false;
-    s_ce_policies[user_id] = ce_policy;
+    {
+        std::lock_guard<std::mutex> lock(s_ce_policies_lock);
+        s_ce_policies[user_id] = ce_policy;
+    }
     LOG(DEBUG) << "Installed ce key for user " << user_id;
     return true;
 }
@@ -408,7 +409,10 @@ static bool create_ce_key(userid_t user_id, bool ephemeral) {
     }
     EncryptionPolicy ce_policy;
     if (!install_storage_key(DATA_MNT_POINT, s_data_options, ce_key, &ce_policy)) return false;
-    s_ce_policies[user_id] = ce_policy;
+    {
+        std::lock_guard<std::mutex> lock(s_ce_policies_lock);
+        s_ce_policies[user_id] = ce_policy;
+    }
     LOG(INFO) << "Created CE key for user " << user_id;
     return true;
 }
@@ -430,6 +434,33 @@ static bool is_numeric(const char* name) {
     return true;
 }
 
+// Enough to overlap the Keystore round trips of a few users without flooding Keystore at boot
+static constexpr size_t kDeKeyThreads = 4;
+
+struct DeKey {
+    userid_t user_id;
+    std::string path;
+    bool retrieved = false;
+    bool exported = false;
+    // What goes into the keyring; the ephemeral key when keys are hardware-wrapped
+    KeyBuffer key;
+};
+
+// Runs the Keystore side of installing a DE key, which is safe to do for several users at once
+static void retrieve_de_key(DeKey* de_key) {
+    de_key->retrieved = retrieveKey(de_key->path, kEmptyAuthentication, &de_key->key);
+    if (!de_key->retrieved) return;
+    if (s_data_options.use_hw_wrapped_key) {
+        KeyBuffer ephemeral_wrapped_key;
+        if (!exportWrappedStorageKey(de_key->key, &ephemeral_wrapped_key)) {
+            LOG(ERROR) << "Failed to get ephemeral wrapped key for user " << de_key->user_id;
+            return;
+        }
+        de_key->key = std::move(ephemeral_wrapped_key);
+    }
+    de_key->exported = true;
+}
+
 static bool load_all_de_keys() {
     auto de_dir = user_key_dir + "/de";
     auto dirp = std::unique_ptr<DIR, int (*)(DIR*)>(opendir(de_dir.c_str()), closedir);
@@ -437,6 +468,7 @@ static bool load_all_de_keys() {
         PLOG(ERROR) << "Unable to read de key directory";
         return false;
     }
+    std::vector<DeKey> de_keys;
     for (;;) {
         errno = 0;
         auto entry = readdir(dirp.get());
@@ -452,22 +484,43 @@ static bool load_all_de_keys() {
             LOG(DEBUG) << "Skipping non-de-key " << entry->d_name;
             continue;
         }
-        userid_t user_id = std::stoi(entry->d_name);
-        auto key_path = de_dir + "/" + entry->d_name;
-        KeyBuffer de_key;
-        if (!retrieveKey(key_path, kEmptyAuthentication, &de_key)) {
+        DeKey de_key;
+        de_key.user_id = std::stoi(entry->d_name);
+        de_key.path = de_dir + "/" + entry->d_name;
+        de_keys.push_back(std::move(de_key));
+    }
+    std::sort(de_keys.begin(), de_keys.end(),
+              [](const DeKey& a, const DeKey& b) { return a.user_id < b.user_id; });
+
+    // Each user's key takes a few Keystore round trips to decrypt, so do those side by side.
+    // installKey() serializes the keyring updates under its own lock.
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> threads;
+    size_t thread_count = std::min(kDeKeyThreads, de_keys.size());
+    for (size_t i = 1; i < thread_count; i++) {
+        threads.emplace_back([&de_keys, &next]() {
+            for (size_t j = next++; j < de_keys.size(); j = next++) retrieve_de_key(&de_keys[j]);
+        });
+    }
+    for (size_t j = next++; j < de_keys.size(); j = next++) retrieve_de_key(&de_keys[j]);
+    for (auto& thread : threads) thread.join();
+
+    // Install in user order, so the first failure is the same one a serial load would hit
+    for (const auto& de_key : de_keys) {
+        if (!de_key.retrieved) {
             // This is probably a partially removed user, so ignore
-            if (user_id != 0) continue;
+            if (de_key.user_id != 0) continue;
             return false;
         }
+        if (!de_key.exported) return false;
         EncryptionPolicy de_policy;
-        if (!install_storage_key(DATA_MNT_POINT, s_data_options, de_key, &de_policy)) return false;
-        auto ret = s_de_policies.insert({user_id, de_policy});
+        if (!installKey(DATA_MNT_POINT, s_data_options, de_key.key, &de_policy)) return false;
+        auto ret = s_de_policies.insert({de_key.user_id, de_policy});
         if (!ret.second && ret.first->second != de_policy) {
-            LOG(ERROR) << "DE policy for user" << user_id << " changed";
+            LOG(ERROR) << "DE policy for user" << de_key.user_id << " changed";
             return false;
         }
-        LOG(DEBUG) << "Installed de key for user " << user_id;
+        LOG(DEBUG) << "Installed de key for user " << de_key.user_id;
     }
     // fscrypt:TODO: go through all DE directories, ensure that all user dirs have the
     // correct policy set on them, and that no rogue ones exist.
@@ -649,20 +702,43 @@ bool fscrypt_vold_create_user_key(userid_t user_id, int serial, bool ephemeral)
 // was already set up.  So to remove the per-file keys and make the files
 // "appear encrypted", these inodes must be evicted.
 //
-// To do this, sync() to clean all dirty inodes, then drop all reclaimable slab
-// objects systemwide.  This is overkill, but it's the best available method
-// currently.  Don't use drop_caches mode "3" because that also evicts pagecache
-// for in-use files; all files relevant here are already closed and sync'ed.
+// To do this, syncfs() /data to clean its dirty inodes, then drop all reclaimable
+// slab objects systemwide.  This is overkill, but it's the best available method
+// currently: nothing short of evicting an inode drops its per-file key, and there
+// is no way to evict a chosen inode, so walking the user's directories with
+// posix_fadvise() would drop their file contents but leave them readable.  Only
+// /data holds files with these keys, so there's no need to flush every other
+// filesystem with sync() first.  Don't use drop_caches mode "3" because that also
+// evicts pagecache for in-use files; all files relevant here are already closed
+// and sync'ed.
 static void drop_caches_if_needed() {
     if (android::vold::isFsKeyringSupported()) {
         return;
     }
-    sync();
+    android::base::unique_fd fd(open(DATA_MNT_POINT, O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+    if (fd == -1 || syncfs(fd) != 0) {
+        PLOG(WARNING) << "Failed to syncfs " << DATA_MNT_POINT << "; syncing everything instead";
+        sync();
+    }
     if (!writeStringToFile("2", "/proc/sys/vm/drop_caches")) {
         PLOG(ERROR) << "Failed to drop caches during key eviction";
     }
 }
 
+// CE volume keys of unlocked users, being retrieved (and exported, if hardware-wrapped) ahead of
+// the prepareUserStorage() calls that install them, by key path.  Guarded by the crypt lock.
+struct PrefetchedVolkey {
+    userid_t user_id;
+    std::future<std::optional<KeyBuffer>> key;
+};
+static std::map<std::string, PrefetchedVolkey> s_prefetched_volkeys;
+
+static void drop_prefetched_volkeys(userid_t user_id) {
+    for (auto it = s_prefetched_volkeys.begin(); it != s_prefetched_volkeys.end();) {
+        it = it->second.user_id == user_id ? s_prefetched_volkeys.erase(it) : std::next(it);
+    }
+}
+
 static bool evict_ce_key(userid_t user_id) {
     bool success = true;
     EncryptionPolicy policy;
@@ -671,8 +747,12 @@ static bool evict_ce_key(userid_t user_id) {
         success &= android::vold::evictKey(DATA_MNT_POINT, policy);
         drop_caches_if_needed();
     }
-    s_ce_policies.erase(user_id);
+    {
+        std::lock_guard<std::mutex> lock(s_ce_policies_lock);
+        s_ce_policies.erase(user_id);
+    }
     s_new_ce_keys.erase(user_id);
+    drop_prefetched_volkeys(user_id);
     return success;
 }
 
@@ -688,21 +768,22 @@ bool fscrypt_destroy_user_key(userid_t user_id) {
                android::vold::evictKey(DATA_MNT_POINT, de_policy);
     s_de_policies.erase(user_id);
     if (!s_ephemeral_users.erase(user_id)) {
+        // All of the user's keys go through one secdiscard run
+        std::vector<std::string> key_paths;
         auto ce_path = get_ce_key_directory_path(user_id);
         if (!s_new_ce_keys.erase(user_id)) {
-            for (auto const path : get_ce_key_paths(ce_path)) {
-                success &= android::vold::destroyKey(path);
-            }
+            key_paths = get_ce_key_paths(ce_path);
         }
         s_deferred_fixations.erase(ce_path);
-        success &= destroy_dir(ce_path);
 
         auto de_key_path = get_de_key_path(user_id);
         if (android::vold::pathExists(de_key_path)) {
-            success &= android::vold::destroyKey(de_key_path);
+            key_paths.push_back(de_key_path);
         } else {
             LOG(INFO) << "Not present so not erasing: " << de_key_path;
         }
+        success &= android::vold::destroyKeys(key_paths);
+        success &= destroy_dir(ce_path);
     }
     return success;
 }
@@ -738,8 +819,66 @@ static std::string volume_secdiscardable_path(const std::string& volume_uuid) {
     return systemwide_volume_key_dir + "/" + volume_uuid + "/secdiscardable";
 }
 
+// The framework prepares the user's storage on each adopted volume with a call of its own, one
+// after another, and each of those needs the volume's CE key from Keystore.  So once the user's
+// CE key is in, the existing keys of the mounted adopted volumes are all retrieved at once, and
+// each call is left with installing its key, in the order the calls come.
+static void prefetch_ce_volkeys(userid_t user_id) {
+    auto misc_ce_path = android::vold::BuildDataMiscCePath("", user_id);
+    auto keys_dir = misc_ce_path + "/vold/volume_keys";
+    auto dirp = std::unique_ptr<DIR, int (*)(DIR*)>(opendir(keys_dir.c_str()), closedir);
+    if (!dirp) return;
+    struct dirent* entry;
+    while ((entry = readdir(dirp.get())) != nullptr) {
+        if (IsDotOrDotDot(*entry) || entry->d_type != DT_DIR) continue;
+        std::string volume_uuid = entry->d_name;
+        auto key_path = volkey_path(misc_ce_path, volume_uuid);
+        auto secdiscardable_path = volume_secdiscardable_path(volume_uuid);
+        if (!android::vold::pathExists(BuildDataPath(volume_uuid)) ||
+            !android::vold::pathExists(key_path) ||
+            !android::vold::pathExists(secdiscardable_path)) {
+            continue;
+        }
+        auto fetch = [key_path, secdiscardable_path]() -> std::optional<KeyBuffer> {
+            EncryptionOptions options;
+            std::string secdiscardable_hash;
+            KeyBuffer key;
+            if (!get_volume_file_encryption_options(&options) ||
+                !android::vold::readSecdiscardable(secdiscardable_path, &secdiscardable_hash) ||
+                !retrieveKey(key_path, android::vold::KeyAuthentication(secdiscardable_hash),
+                             &key)) {
+                return std::nullopt;
+            }
+            if (!options.use_hw_wrapped_key) return key;
+            KeyBuffer ephemeral_wrapped_key;
+            if (!exportWrappedStorageKey(key, &ephemeral_wrapped_key)) return std::nullopt;
+            return ephemeral_wrapped_key;
+        };
+        s_prefetched_volkeys[key_path] = {user_id, std::async(std::launch::async, fetch)};
+    }
+}
+
+// Takes the key that prefetch_ce_volkeys() got for key_path, ready to be installed.  Anything
+// that went wrong with the prefetch is left for the regular path to run into and report.
+static bool take_prefetched_volkey(const std::string& key_path, KeyBuffer* key) {
+    auto it = s_prefetched_volkeys.find(key_path);
+    if (it == s_prefetched_volkeys.end()) return false;
+    auto fetched = it->second.key.get();
+    s_prefetched_volkeys.erase(it);
+    if (!fetched) return false;
+    *key = std::move(*fetched);
+    return true;
+}
+
 static bool read_or_create_volkey(const std::string& misc_path, const std::string& volume_uuid,
                                   EncryptionPolicy* policy, int flags) {
+    KeyBuffer prefetched_key;
+    if (take_prefetched_volkey(volkey_path(misc_path, volume_uuid), &prefetched_key)) {
+        EncryptionOptions options;
+        if (!get_volume_file_encryption_options(&options)) return false;
+        return installKey(BuildDataPath(volume_uuid), options, prefetched_key, policy);
+    }
+
     auto secdiscardable_path = volume_secdiscardable_path(volume_uuid);
     std::string secdiscardable_hash;
     if (android::vold::pathExists(secdiscardable_path)) {
@@ -765,6 +904,7 @@ static bool read_or_create_volkey(const std::string& misc_path, const std::strin
 
 static bool destroy_volkey(const std::string& misc_path, const std::string& volume_uuid) {
     auto path = volkey_path(misc_path, volume_uuid);
+    s_prefetched_volkeys.erase(path);
     if (!android::vold::pathExists(path)) return true;
     return android::vold::destroyKey(path);
 }
@@ -867,6 +1007,7 @@ void fscrypt_deferred_fixate_ce_keys() {
 }
 
 std::vector<int> fscrypt_get_unlocked_users() {
+    std::lock_guard<std::mutex> lock(s_ce_policies_lock);
     std::vector<int> user_ids;
     for (const auto& it : s_ce_policies) {
         user_ids.push_back(it.first);
@@ -888,6 +1029,7 @@ bool fscrypt_unlock_user_key(userid_t user_id, int serial, const std::string& se
             LOG(ERROR) << "Couldn't read key for " << user_id;
             return false;
         }
+        prefetch_ce_volkeys(user_id);
     }
     return true;
 }
@@ -901,15 +1043,100 @@ bool fscrypt_lock_user_key(userid_t user_id) {
     return true;
 }
 
-static bool prepare_subdirs(const std::string& action, const std::string& volume_uuid,
-                            userid_t user_id, int flags) {
-    if (0 != android::vold::ForkExecvp(
-                 std::vector<std::string>{prepare_subdirs_path, action, volume_uuid,
-                                          std::to_string(user_id), std::to_string(flags)})) {
+// vold_prepare_subdirs runs in its own SELinux domain, so it stays a separate process.  To avoid
+// a fork and a file contexts load for every user and volume, one helper serves requests until it
+// has been idle for a while, and is started again on the next request after it exits.
+//
+// The helper talks to vold over pipes it inherits as stdin and stdout, so its domain needs
+// "allow vold_prepare_subdirs vold:fifo_file { read write getattr };" in
+// system/sepolicy/private/vold_prepare_subdirs.te; keep the two in sync.
+class PrepareSubdirsHelper {
+  public:
+    bool run(const std::string& action, const std::string& volume_uuid, userid_t user_id,
+             int flags) {
+        std::lock_guard<std::mutex> lock(mLock);
+        reapIfExited();
+        // The volume uuid goes last since it may be empty
+        auto request = StringPrintf("%s %d %d %s\n", action.c_str(), user_id, flags,
+                                    volume_uuid.c_str());
+        // A helper that exited just as the request was sent gets one restart; requests are
+        // idempotent, so running one twice is harmless.
+        for (int attempt = 0; attempt < 2; attempt++) {
+            if (mPid == -1 && !start()) break;
+            std::string reply;
+            if (transact(request, &reply)) {
+                if (reply == "0") return true;
+                break;
+            }
+            stop();
+        }
         LOG(ERROR) << "vold_prepare_subdirs failed";
         return false;
     }
-    return true;
+
+  private:
+    bool start() {
+        mPid = android::vold::ForkExecvpConnected({prepare_subdirs_path, "serve"}, &mRequests,
+                                                  &mReplies);
+        return mPid != -1;
+    }
+
+    void stop() {
+        mRequests.reset();
+        mReplies.reset();
+        TEMP_FAILURE_RETRY(waitpid(mPid, nullptr, 0));
+        mPid = -1;
+    }
+
+    // A helper that timed out has exited on its own and is a zombie until reaped here, which
+    // also saves the request from failing on it first.
+    void reapIfExited() {
+        if (mPid == -1 || TEMP_FAILURE_RETRY(waitpid(mPid, nullptr, WNOHANG)) == 0) return;
+        mRequests.reset();
+        mReplies.reset();
+        mPid = -1;
+    }
+
+    bool transact(const std::string& request, std::string* reply) {
+        if (!send(request)) return false;
+        reply->clear();
+        char c;
+        while (TEMP_FAILURE_RETRY(read(mReplies, &c, 1)) == 1) {
+            if (c == '\n') return true;
+            reply->push_back(c);
+        }
+        return false;
+    }
+
+    // A helper that exited must not take vold down with SIGPIPE, so the signal is held back
+    // while writing, and one raised by the write is discarded.
+    bool send(const std::string& request) {
+        sigset_t sigpipe, old_mask, pending;
+        sigemptyset(&sigpipe);
+        sigaddset(&sigpipe, SIGPIPE);
+        pthread_sigmask(SIG_BLOCK, &sigpipe, &old_mask);
+        sigpending(&pending);
+        bool was_pending = sigismember(&pending, SIGPIPE);
+
+        bool ok = android::base::WriteStringToFd(request, mRequests);
+        if (!ok && errno == EPIPE && !was_pending) {
+            struct timespec no_wait = {};
+            TEMP_FAILURE_RETRY(sigtimedwait(&sigpipe, nullptr, &no_wait));
+        }
+        pthread_sigmask(SIG_SETMASK, &old_mask, nullptr);
+        return ok;
+    }
+
+    std::mutex mLock;
+    pid_t mPid = -1;
+    android::base::unique_fd mRequests;
+    android::base::unique_fd mReplies;
+};
+
+static bool prepare_subdirs(const std::string& action, const std::string& volume_uuid,
+                            userid_t user_id, int flags) {
+    static auto helper = new PrepareSubdirsHelper();
+    return helper->run(action, volume_uuid, user_id, flags);
 }
 
 bool fscrypt_prepare_user_storage(const std::string& volume_uuid, userid_t user_id, int serial,
@@ -1030,9 +1257,7 @@ bool fscrypt_prepare_user_storage(const std::string& volume_uuid, userid_t user_
             // Now that credentials have been installed, we can run restorecon
             // over these paths
             // NOTE: these paths need to be kept in sync with libselinux
-            android::vold::RestoreconRecursive(system_ce_path);
-            android::vold::RestoreconRecursive(vendor_ce_path);
-            android::vold::RestoreconRecursive(misc_ce_path);
+            android::vold::RestoreconTrees({system_ce_path, vendor_ce_path, misc_ce_path});
         }
     }
     if (!prepare_subdirs("prepare", volume_uuid, user_id, flags)) return false;
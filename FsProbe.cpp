@@ -0,0 +1,444 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "FsProbe.h"
+
+#include <android-base/logging.h>
+#include <android-base/stringprintf.h>
+
+#include <inttypes.h>
+#include <linux/fs.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#ifndef BLKGETDISKSEQ
+#define BLKGETDISKSEQ _IOR(0x12, 128, __u64)
+#endif
+
+using android::base::StringPrintf;
+
+namespace android {
+namespace vold {
+
+namespace {
+
+// Enough for the boot sector of the FAT family and NTFS, and the ext4 and f2fs superblocks
+// at 1024 bytes in.
+constexpr size_t kProbeBytes = 4096;
+constexpr size_t kSuperblockOffset = 1024;
+// Most of a root directory that is searched for the volume label entry
+constexpr size_t kMaxRootDirBytes = 64 * 1024;
+
+uint16_t Le16(const uint8_t* p) {
+    return p[0] | p[1] << 8;
+}
+
+uint32_t Le32(const uint8_t* p) {
+    return Le16(p) | static_cast<uint32_t>(Le16(p + 2)) << 16;
+}
+
+uint64_t Le64(const uint8_t* p) {
+    return Le32(p) | static_cast<uint64_t>(Le32(p + 4)) << 32;
+}
+
+bool IsPowerOfTwo(uint32_t n) {
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+/* Reads up to len bytes at offset, returning how many there were */
+size_t ReadAt(int fd, uint64_t offset, uint8_t* buf, size_t len) {
+    size_t done = 0;
+    while (done < len) {
+        ssize_t n = TEMP_FAILURE_RETRY(pread(fd, buf + done, len - done, offset + done));
+        if (n <= 0) {
+            if (n == -1) PLOG(WARNING) << "Failed to read superblock";
+            break;
+        }
+        done += n;
+    }
+    return done;
+}
+
+std::string FormatUuid(const uint8_t* uuid) {
+    if (std::all_of(uuid, uuid + 16, [](uint8_t b) { return b == 0; })) return "";
+    std::string out;
+    for (int i = 0; i < 16; i++) {
+        if (i == 4 || i == 6 || i == 8 || i == 10) out += '-';
+        out += StringPrintf("%02x", uuid[i]);
+    }
+    return out;
+}
+
+std::string FormatSerial(uint32_t serial) {
+    return StringPrintf("%04X-%04X", serial >> 16, serial & 0xffff);
+}
+
+/* Like blkid, labels lose trailing whitespace */
+std::string TrimLabel(std::string label) {
+    while (!label.empty() && (label.back() == ' ' || label.back() == '\t' ||
+                              label.back() == '\n' || label.back() == '\r')) {
+        label.pop_back();
+    }
+    return label;
+}
+
+std::string BytesLabel(const uint8_t* p, size_t len) {
+    const uint8_t* end = std::find(p, p + len, 0);
+    return TrimLabel(std::string(p, end));
+}
+
+std::string Utf16Label(const uint8_t* p, size_t units) {
+    std::string out;
+    for (size_t i = 0; i < units; i++) {
+        uint32_t c = Le16(p + i * 2);
+        if (c == 0) break;
+        if (c >= 0xd800 && c < 0xdc00 && i + 1 < units) {
+            uint32_t low = Le16(p + (i + 1) * 2);
+            if (low >= 0xdc00 && low < 0xe000) {
+                c = 0x10000 + ((c - 0xd800) << 10) + (low - 0xdc00);
+                i++;
+            }
+        }
+        if (c < 0x80) {
+            out += static_cast<char>(c);
+        } else if (c < 0x800) {
+            out += static_cast<char>(0xc0 | c >> 6);
+            out += static_cast<char>(0x80 | (c & 0x3f));
+        } else if (c < 0x10000) {
+            out += static_cast<char>(0xe0 | c >> 12);
+            out += static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+            out += static_cast<char>(0x80 | (c & 0x3f));
+        } else {
+            out += static_cast<char>(0xf0 | c >> 18);
+            out += static_cast<char>(0x80 | ((c >> 12) & 0x3f));
+            out += static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+            out += static_cast<char>(0x80 | (c & 0x3f));
+        }
+    }
+    return TrimLabel(out);
+}
+
+bool ProbeExt(const uint8_t* sb, FsMetadata* metadata) {
+    constexpr uint32_t kCompatHasJournal = 0x4;
+    constexpr uint32_t kIncompatJournalDev = 0x8;
+    // Features outside of these make it ext4 rather than ext2 or ext3
+    constexpr uint32_t kExt3IncompatSupported = 0x2 | 0x4 | 0x10;
+    constexpr uint32_t kExt2RoCompatSupported = 0x1 | 0x2 | 0x4;
+    constexpr uint32_t kFlagsTestFilesys = 0x4;
+
+    if (Le16(sb + 0x38) != 0xef53) return false;
+    uint32_t compat = Le32(sb + 0x5c);
+    uint32_t incompat = Le32(sb + 0x60);
+    uint32_t roCompat = Le32(sb + 0x64);
+    // Journal devices and ext4dev are rare enough to leave to blkid
+    if ((incompat & kIncompatJournalDev) || (Le32(sb + 0x160) & kFlagsTestFilesys)) return false;
+
+    if ((incompat & ~kExt3IncompatSupported) || (roCompat & ~kExt2RoCompatSupported)) {
+        metadata->type = "ext4";
+    } else if (compat & kCompatHasJournal) {
+        metadata->type = "ext3";
+    } else {
+        metadata->type = "ext2";
+    }
+    metadata->uuid = FormatUuid(sb + 0x68);
+    metadata->label = BytesLabel(sb + 0x78, 16);
+    return true;
+}
+
+bool ProbeF2fs(const uint8_t* sb, FsMetadata* metadata) {
+    if (Le32(sb) != 0xf2f52010) return false;
+    metadata->type = "f2fs";
+    // Version 1.0 predates the UUID and label
+    if (Le16(sb + 4) == 1 && Le16(sb + 6) == 0) return true;
+    metadata->uuid = FormatUuid(sb + 108);
+    metadata->label = Utf16Label(sb + 124, 512);
+    return true;
+}
+
+/* Label from the volume label entry among count FAT directory entries */
+std::string FatDirLabel(const uint8_t* dir, size_t count) {
+    constexpr uint8_t kAttrVolumeId = 0x08;
+    constexpr uint8_t kAttrDir = 0x10;
+    constexpr uint8_t kAttrLongName = 0x0f;
+
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t* ent = dir + i * 32;
+        if (ent[0] == 0) break;
+        if (ent[0] == 0xe5 || ent[11] == kAttrLongName) continue;
+        if ((ent[11] & (kAttrVolumeId | kAttrDir)) != kAttrVolumeId) continue;
+        if (Le16(ent + 20) != 0 || Le16(ent + 26) != 0) continue;
+        uint8_t name[11];
+        memcpy(name, ent, sizeof(name));
+        if (name[0] == 0x05) name[0] = 0xe5;
+        return TrimLabel(std::string(name, name + sizeof(name)));
+    }
+    return "";
+}
+
+bool ProbeVfat(int fd, const uint8_t* bs, FsMetadata* metadata) {
+    constexpr uint64_t kFat16MaxClusters = 0xfff4;
+    constexpr uint64_t kFat32MaxClusters = 0x0ffffff6;
+
+    uint32_t sectorSize = Le16(bs + 0x0b);
+    uint32_t sectorsPerCluster = bs[0x0d];
+    uint32_t reserved = Le16(bs + 0x0e);
+    uint32_t fats = bs[0x10];
+    uint32_t rootEntries = Le16(bs + 0x11);
+    uint8_t media = bs[0x15];
+    uint32_t fatLength = Le16(bs + 0x16);
+    uint32_t fat32Length = Le32(bs + 0x24);
+
+    // The same sanity checks as blkid, which doesn't insist on a signature when it finds the
+    // name of a FAT variant, but rules out other filesystems with a FAT-like boot sector.
+    bool named = memcmp(bs + 0x52, "MSWIN", 5) == 0 || memcmp(bs + 0x52, "FAT32   ", 8) == 0 ||
+                 memcmp(bs + 0x36, "MSDOS", 5) == 0 || memcmp(bs + 0x36, "FAT16   ", 8) == 0 ||
+                 memcmp(bs + 0x36, "FAT12   ", 8) == 0 || memcmp(bs + 0x36, "FAT     ", 8) == 0;
+    bool foreign = memcmp(bs + 0x36, "JFS     ", 8) == 0 || memcmp(bs + 0x36, "HPFS    ", 8) == 0;
+    if (!named && (bs[0x1fe] != 0x55 || bs[0x1ff] != 0xaa || foreign)) return false;
+    if (sectorSize < 512 || sectorSize > 4096 || !IsPowerOfTwo(sectorSize)) return false;
+    if (!IsPowerOfTwo(sectorsPerCluster) || reserved == 0 || fats == 0) return false;
+    if (media != 0xf0 && media < 0xf8) return false;
+    if (fatLength == 0 && fat32Length == 0) return false;
+
+    uint64_t sectors = Le16(bs + 0x13);
+    if (sectors == 0) sectors = Le32(bs + 0x20);
+    uint64_t fatSectors = static_cast<uint64_t>(fats) * (fatLength != 0 ? fatLength : fat32Length);
+    uint64_t metaSectors = reserved + fatSectors + (rootEntries * 32 + sectorSize - 1) / sectorSize;
+    if (sectors < metaSectors) return false;
+    uint64_t clusters = (sectors - metaSectors) / sectorsPerCluster;
+    if (clusters > (fatLength != 0 ? kFat16MaxClusters : kFat32MaxClusters)) return false;
+
+    std::vector<uint8_t> dir;
+    uint64_t dirOffset;
+    if (fatLength != 0) {
+        dirOffset = (reserved + fatSectors) * sectorSize;
+        dir.resize(std::min<size_t>(rootEntries * 32, kMaxRootDirBytes));
+        if (bs[0x26] == 0x28 || bs[0x26] == 0x29) metadata->uuid = FormatSerial(Le32(bs + 0x27));
+    } else {
+        uint32_t rootCluster = Le32(bs + 0x2c);
+        if (rootCluster < 2) return false;
+        uint64_t clusterSize = static_cast<uint64_t>(sectorsPerCluster) * sectorSize;
+        dirOffset = (reserved + fatSectors) * sectorSize + (rootCluster - 2) * clusterSize;
+        dir.resize(std::min<uint64_t>(clusterSize, kMaxRootDirBytes));
+        metadata->uuid = FormatSerial(Le32(bs + 0x43));
+    }
+    size_t read = ReadAt(fd, dirOffset, dir.data(), dir.size());
+    metadata->type = "vfat";
+    metadata->label = FatDirLabel(dir.data(), read / 32);
+    return true;
+}
+
+bool ProbeExfat(int fd, const uint8_t* bs, FsMetadata* metadata) {
+    constexpr uint8_t kEntryEnd = 0x00;
+    constexpr uint8_t kEntryLabel = 0x83;
+
+    if (memcmp(bs + 3, "EXFAT   ", 8) != 0) return false;
+    uint32_t sectorShift = bs[108];
+    uint32_t clusterShift = bs[109];
+    if (sectorShift < 9 || sectorShift > 12 || clusterShift > 25 - sectorShift) return false;
+    uint32_t rootCluster = Le32(bs + 96);
+    if (bs[110] < 1 || bs[110] > 2 || rootCluster < 2 || rootCluster - 2 >= Le32(bs + 92)) {
+        return false;
+    }
+
+    // The first 11 sectors are covered by a checksum, repeated all over the 12th
+    size_t sectorSize = size_t(1) << sectorShift;
+    std::vector<uint8_t> boot(12 * sectorSize);
+    if (ReadAt(fd, 0, boot.data(), boot.size()) != boot.size()) return false;
+    uint32_t sum = 0;
+    for (size_t i = 0; i < 11 * sectorSize; i++) {
+        // Except for the volume flags and percentage in use, which change all the time
+        if (i == 106 || i == 107 || i == 112) continue;
+        sum = ((sum & 1) ? 0x80000000 : 0) + (sum >> 1) + boot[i];
+    }
+    for (size_t i = 11 * sectorSize; i < boot.size(); i += 4) {
+        if (Le32(&boot[i]) != sum) return false;
+    }
+
+    uint64_t clusterSize = uint64_t(1) << (sectorShift + clusterShift);
+    uint64_t rootOffset = (static_cast<uint64_t>(Le32(bs + 88)) << sectorShift) +
+                          (rootCluster - 2) * clusterSize;
+    std::vector<uint8_t> dir(std::min<uint64_t>(clusterSize, kMaxRootDirBytes));
+    size_t read = ReadAt(fd, rootOffset, dir.data(), dir.size());
+
+    metadata->type = "exfat";
+    metadata->uuid = FormatSerial(Le32(bs + 100));
+    for (size_t i = 0; i + 32 <= read; i += 32) {
+        const uint8_t* ent = &dir[i];
+        if (ent[0] == kEntryEnd) break;
+        if (ent[0] == kEntryLabel) {
+            metadata->label = Utf16Label(ent + 2, std::min<uint8_t>(ent[1], 11));
+            break;
+        }
+    }
+    return true;
+}
+
+bool ProbeNtfs(int fd, const uint8_t* bs, FsMetadata* metadata) {
+    constexpr uint32_t kVolumeRecord = 3;
+    constexpr uint32_t kAttrVolumeName = 0x60;
+    constexpr uint32_t kAttrEnd = 0xffffffff;
+    constexpr uint32_t kFixupSectorBytes = 512;
+    constexpr uint32_t kMaxClusterBytes = 2 * 1024 * 1024;
+
+    if (memcmp(bs + 3, "NTFS    ", 8) != 0) return false;
+    uint32_t sectorSize = Le16(bs + 0x0b);
+    if (sectorSize < 256 || sectorSize > 4096 || !IsPowerOfTwo(sectorSize)) return false;
+    uint32_t sectorsPerCluster = bs[0x0d];
+    if (sectorsPerCluster >= 240 && sectorsPerCluster <= 249) {
+        sectorsPerCluster = 1u << (256 - sectorsPerCluster);
+    } else if (!IsPowerOfTwo(sectorsPerCluster)) {
+        return false;
+    }
+    if (sectorSize * sectorsPerCluster > kMaxClusterBytes) return false;
+    // Fields of the FAT boot sector that NTFS leaves zero
+    if (Le16(bs + 0x0e) != 0 || bs[0x10] != 0 || Le16(bs + 0x11) != 0 || Le16(bs + 0x13) != 0 ||
+        Le16(bs + 0x16) != 0 || Le32(bs + 0x20) != 0) {
+        return false;
+    }
+    uint64_t clusterSize = static_cast<uint64_t>(sectorsPerCluster) * sectorSize;
+    // Records are either a number of clusters, or if negative, the log2 of their size
+    uint8_t clustersPerRecord = bs[0x40];
+    uint64_t recordSize;
+    if (clustersPerRecord >= 0xe1 && clustersPerRecord <= 0xf7) {
+        recordSize = uint64_t(1) << (256 - clustersPerRecord);
+    } else if (IsPowerOfTwo(clustersPerRecord) && clustersPerRecord <= 64) {
+        recordSize = clustersPerRecord * clusterSize;
+    } else {
+        return false;
+    }
+    if (recordSize < kFixupSectorBytes || recordSize > kProbeBytes) return false;
+
+    uint64_t mftCluster = Le64(bs + 0x30);
+    uint64_t clusters = Le64(bs + 0x28) / sectorsPerCluster;
+    if (mftCluster > clusters || Le64(bs + 0x38) > clusters) return false;
+    std::vector<uint8_t> rec(recordSize);
+    uint64_t mftOffset = mftCluster * clusterSize;
+    if (ReadAt(fd, mftOffset, rec.data(), 4) != 4 || memcmp(rec.data(), "FILE", 4) != 0) {
+        return false;
+    }
+    // The label is the $VOLUME_NAME attribute of the $Volume file
+    if (ReadAt(fd, mftOffset + kVolumeRecord * recordSize, rec.data(), rec.size()) !=
+                rec.size() ||
+        memcmp(rec.data(), "FILE", 4) != 0) {
+        return false;
+    }
+
+    // Undo the update sequence that protects the end of each sector of the record
+    size_t usaOffset = Le16(&rec[4]);
+    size_t usaCount = Le16(&rec[6]);
+    if (usaCount == 0 || usaOffset + usaCount * 2 > rec.size() ||
+        (usaCount - 1) * kFixupSectorBytes > rec.size()) {
+        return false;
+    }
+    for (size_t i = 1; i < usaCount; i++) {
+        uint8_t* tail = &rec[i * kFixupSectorBytes - 2];
+        if (memcmp(tail, &rec[usaOffset], 2) != 0) return false;
+        memcpy(tail, &rec[usaOffset + i * 2], 2);
+    }
+
+    metadata->type = "ntfs";
+    metadata->uuid = StringPrintf("%016" PRIX64, Le64(bs + 0x48));
+    size_t attr = Le16(&rec[0x14]);
+    size_t used = std::min<size_t>(Le32(&rec[0x1c]), rec.size());
+    while (attr + 8 <= used) {
+        uint32_t type = Le32(&rec[attr]);
+        uint32_t length = Le32(&rec[attr + 4]);
+        // Nothing past the header read above is touched before the attribute is known to fit
+        if (type == kAttrEnd || length < 8 || length > used - attr) break;
+        if (type == kAttrVolumeName && length >= 0x18 && rec[attr + 8] == 0) {
+            uint32_t valueLength = Le32(&rec[attr + 0x10]);
+            uint32_t valueOffset = Le16(&rec[attr + 0x14]);
+            if (valueOffset <= length && valueLength <= length - valueOffset) {
+                metadata->label = Utf16Label(&rec[attr + valueOffset], valueLength / 2);
+            }
+            break;
+        }
+        attr += length;
+    }
+    return true;
+}
+
+struct CacheEntry {
+    uint64_t diskSeq;
+    FsMetadata metadata;
+};
+
+std::mutex sCacheLock;
+std::unordered_map<dev_t, CacheEntry> sCache;
+
+}  // namespace
+
+bool ProbeFilesystem(int fd, FsMetadata* metadata) {
+    uint8_t buf[kProbeBytes] = {};
+    size_t len = ReadAt(fd, 0, buf, sizeof(buf));
+    if (len < 512) return false;
+
+    FsMetadata found[5];
+    int matches = 0;
+    int match = -1;
+    auto check = [&](int i, bool matched) {
+        if (matched) {
+            matches++;
+            match = i;
+        }
+    };
+    check(0, ProbeVfat(fd, buf, &found[0]));
+    check(1, ProbeExfat(fd, buf, &found[1]));
+    check(2, ProbeNtfs(fd, buf, &found[2]));
+    if (len >= kSuperblockOffset + 1024) {
+        check(3, ProbeExt(buf + kSuperblockOffset, &found[3]));
+    }
+    if (len >= kSuperblockOffset + 124 + 1024) {
+        check(4, ProbeF2fs(buf + kSuperblockOffset, &found[4]));
+    }
+    if (matches != 1) return false;
+    *metadata = std::move(found[match]);
+    return true;
+}
+
+uint64_t GetDiskSequence(int fd) {
+    uint64_t seq;
+    if (ioctl(fd, BLKGETDISKSEQ, &seq) == -1) return 0;
+    return seq;
+}
+
+bool GetCachedFsMetadata(dev_t device, uint64_t diskSeq, FsMetadata* metadata) {
+    std::lock_guard<std::mutex> lock(sCacheLock);
+    auto it = sCache.find(device);
+    if (it == sCache.end() || it->second.diskSeq != diskSeq) return false;
+    *metadata = it->second.metadata;
+    return true;
+}
+
+void CacheFsMetadata(dev_t device, uint64_t diskSeq, const FsMetadata& metadata) {
+    std::lock_guard<std::mutex> lock(sCacheLock);
+    sCache[device] = {diskSeq, metadata};
+}
+
+void InvalidateFsMetadata(dev_t device) {
+    std::lock_guard<std::mutex> lock(sCacheLock);
+    sCache.erase(device);
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_VOLD_FS_PROBE_H
+#define ANDROID_VOLD_FS_PROBE_H
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#include <string>
+
+namespace android {
+namespace vold {
+
+/* Filesystem type, UUID and label, formatted the way blkid prints them */
+struct FsMetadata {
+    std::string type;
+    std::string uuid;
+    std::string label;
+};
+
+/*
+ * Identifies a vfat, exfat, ext2/3/4, f2fs or ntfs filesystem on fd from its superblock,
+ * without running blkid. Only reads fixed, bounds checked fields, so it is safe to use on
+ * untrusted devices. Returns false if none of them matches, or more than one does, in which
+ * case blkid should make the call.
+ */
+bool ProbeFilesystem(int fd, FsMetadata* metadata);
+
+/*
+ * Counter the kernel bumps whenever the media of the disk behind fd changes, or 0 if it is
+ * too old to have one.
+ */
+uint64_t GetDiskSequence(int fd);
+
+/*
+ * Metadata probed earlier from the block device, if it was cached while the disk had the
+ * same sequence number.
+ */
+bool GetCachedFsMetadata(dev_t device, uint64_t diskSeq, FsMetadata* metadata);
+void CacheFsMetadata(dev_t device, uint64_t diskSeq, const FsMetadata& metadata);
+/* Forgets the block device, after a uevent for it or before vold writes a new filesystem */
+void InvalidateFsMetadata(dev_t device);
+
+}  // namespace vold
+}  // namespace android
+
+#endif
@@ -16,19 +16,28 @@
 
 #include "IdleMaint.h"
 #include "FileDeviceUtils.h"
+#include "StorageTopology.h"
 #include "Utils.h"
 #include "VoldUtil.h"
 #include "VolumeManager.h"
 #include "model/PrivateVolume.h"
 
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <limits>
+#include <map>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include <aidl/android/hardware/health/storage/BnGarbageCollectCallback.h>
 #include <aidl/android/hardware/health/storage/IStorage.h>
 #include <android-base/chrono_utils.h>
 #include <android-base/file.h>
 #include <android-base/logging.h>
+#include <android-base/parseint.h>
+#include <android-base/properties.h>
 #include <android-base/stringprintf.h>
 #include <android-base/strings.h>
 #include <android/binder_manager.h>
@@ -39,8 +48,11 @@
 
 #include <dirent.h>
 #include <fcntl.h>
+#include <inttypes.h>
 #include <sys/mount.h>
+#include <sys/sysmacros.h>
 #include <sys/stat.h>
+#include <sys/statfs.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 
@@ -69,6 +81,14 @@ enum class PathTypes {
     kBlkDevice,
 };
 
+enum class HealthCounter {
+    kLifeTime = 0,
+    kWriteSegments,
+    kDirtySegments,
+    kFreeSegments,
+    kCount,
+};
+
 enum class IdleMaintStats {
     kStopped = 1,
     kRunning,
@@ -76,6 +96,13 @@ enum class IdleMaintStats {
 };
 
 static const char* kWakeLock = "IdleMaint";
+static const char* kTrimResumeFile = "/data/misc/vold/trim_resume";
+static const char* kTrimChunkMbProp = "ro.vold.trim_chunk_mb";
+static const char* kConcurrentDevGcProp = "ro.vold.concurrent_dev_gc";
+static const char* kIdleMaintHistoryFile = "/data/misc/vold/idle_maint_history";
+static const size_t IDLE_MAINT_HISTORY_SIZE = 32;
+// FITRIM range per ioctl; abort is only noticed between chunks. 0 trims in a single call.
+static const uint64_t kTrimChunkMbDefault = 4096;
 static const int DIRTY_SEGMENTS_THRESHOLD = 100;
 /*
  * Timing policy:
@@ -85,13 +112,36 @@ static const int DIRTY_SEGMENTS_THRESHOLD = 100;
  */
 static const int GC_TIMEOUT_SEC = 420;
 static const int DEVGC_TIMEOUT_SEC = 120;
+/*
+ * Idle trim skips a path trimmed within TRIM_MIN_INTERVAL_SEC, or one whose last trim released
+ * less than TRIM_MIN_BYTES unless TRIM_MAX_INTERVAL_SEC has passed since.
+ */
+static const int64_t TRIM_MIN_INTERVAL_SEC = 6 * 60 * 60;
+static const int64_t TRIM_MAX_INTERVAL_SEC = 3 * 24 * 60 * 60;
+static const uint64_t TRIM_MIN_BYTES = 16 * 1024 * 1024;
 static const int KBYTES_IN_SEGMENT = 2048;
 static const int ONE_MINUTE_IN_MS = 60000;
 static const int GC_NORMAL_MODE = 0;
+static constexpr std::chrono::milliseconds GC_POLL_INTERVAL = 10s;
+// GC is considered stalled once every path above the threshold has reclaimed fewer than
+// GC_STALL_SEGMENTS_PER_SEC for GC_STALL_TIME, however the polls fell in that time.
+static const double GC_STALL_SEGMENTS_PER_SEC = 1.0;
+static constexpr std::chrono::seconds GC_STALL_TIME = 30s;
 static const int GC_URGENT_MID_MODE = 3;
+// Percentage points below targetDirtyRatio that urgent GC keeps running once started.
+static const int GC_PACE_HYSTERESIS = 2;
 
 static int32_t previousSegmentWrite = 0;
 
+// What the last idle maintenance runs found on each trim mount point or f2fs sysfs path.
+struct VolumeMaintState {
+    nsecs_t lastTrim = 0;
+    uint64_t lastTrimBytes = 0;
+    int32_t dirtySegments = -1;
+};
+static std::map<std::string, VolumeMaintState> maint_state;
+static std::mutex maint_state_lock;
+
 static IdleMaintStats idle_maint_stat(IdleMaintStats::kStopped);
 static std::condition_variable cv_abort, cv_stop;
 static std::mutex cv_m;
@@ -163,6 +213,239 @@ static void addFromFstab(std::list<std::string>* paths, PathTypes path_type, boo
     }
 }
 
+// Resolves the whole-disk sysfs node that ultimately backs |path|, following device-mapper
+// slaves and partitions, so that paths sharing a physical device can be grouped together.
+static std::string getBackingDisk(const std::string& path) {
+    struct stat sb;
+    if (stat(path.c_str(), &sb) != 0) {
+        PLOG(WARNING) << "Failed to stat " << path;
+        return path;
+    }
+
+    std::string sysPath;
+    if (!Realpath(StringPrintf("/sys/dev/block/%u:%u", major(sb.st_dev), minor(sb.st_dev)),
+                  &sysPath)) {
+        // Not backed by a block device we can see (e.g. tmpfs); trim it on its own.
+        return path;
+    }
+
+    // Walk down stacked devices (dm-default-key, dm-verity, ...) to the first leaf.
+    for (int depth = 0; depth < 8; depth++) {
+        auto dir = std::unique_ptr<DIR, int (*)(DIR*)>(opendir((sysPath + "/slaves").c_str()),
+                                                       closedir);
+        if (!dir) break;
+        std::string slave;
+        struct dirent* ent;
+        while ((ent = readdir(dir.get())) != nullptr) {
+            if (ent->d_name[0] != '.') {
+                slave = ent->d_name;
+                break;
+            }
+        }
+        if (slave.empty() || !Realpath(sysPath + "/slaves/" + slave, &sysPath)) break;
+    }
+
+    // Partitions live underneath their parent disk in sysfs.
+    if (access((sysPath + "/partition").c_str(), F_OK) == 0) {
+        sysPath = android::base::Dirname(sysPath);
+    }
+    return Basename(sysPath);
+}
+
+static bool isIdleMaintAborted() {
+    std::lock_guard<std::mutex> lk(cv_m);
+    return idle_maint_stat == IdleMaintStats::kAbort;
+}
+
+static uint64_t getDiscardGranularity(const std::string& disk) {
+    std::string granularity;
+    if (!ReadFileToString("/sys/block/" + disk + "/queue/discard_granularity", &granularity)) {
+        return 0;
+    }
+    return std::strtoull(android::base::Trim(granularity).c_str(), nullptr, 10);
+}
+
+// Offsets at which an interrupted chunked trim should pick up again, keyed by path.
+static std::map<std::string, uint64_t> loadTrimResumeOffsets() {
+    std::map<std::string, uint64_t> offsets;
+    std::string contents;
+    if (!ReadFileToString(kTrimResumeFile, &contents)) {
+        return offsets;
+    }
+    for (const auto& line : android::base::Split(contents, "\n")) {
+        auto fields = android::base::Split(line, " ");
+        uint64_t offset;
+        if (fields.size() == 2 && android::base::ParseUint(fields[0], &offset)) {
+            offsets[fields[1]] = offset;
+        }
+    }
+    return offsets;
+}
+
+static void saveTrimResumeOffsets(const std::map<std::string, uint64_t>& offsets) {
+    if (offsets.empty()) {
+        if (unlink(kTrimResumeFile) != 0 && errno != ENOENT) {
+            PLOG(WARNING) << "Failed to remove " << kTrimResumeFile;
+        }
+        return;
+    }
+    std::string contents;
+    for (const auto& [path, offset] : offsets) {
+        contents += std::to_string(offset) + " " + path + "\n";
+    }
+    writeStringToFile(contents, kTrimResumeFile);
+}
+
+// Issues FITRIM over [start, start + len), retrying without a minimum extent length if the
+// filesystem rejects the discard granularity we derived from the device.
+static bool fitrim(int fd, uint64_t start, uint64_t len, uint64_t minlen, uint64_t* trimmed) {
+    struct fstrim_range range;
+    memset(&range, 0, sizeof(range));
+    range.start = start;
+    range.len = len;
+    range.minlen = minlen;
+    int ret = ioctl(fd, FITRIM, &range);
+    if (ret != 0 && errno == EINVAL && minlen != 0) {
+        range.len = len;
+        range.minlen = 0;
+        ret = ioctl(fd, FITRIM, &range);
+    }
+    if (ret != 0) {
+        return false;
+    }
+    *trimmed = range.len;
+    return true;
+}
+
+static uint64_t trimPath(const std::string& path, const std::string& disk,
+                     const android::sp<android::os::IVoldTaskListener>& listener,
+                     std::mutex& listener_lock, std::map<std::string, uint64_t>* resume_offsets,
+                     std::mutex& resume_lock) {
+    LOG(DEBUG) << "Starting trim of " << path;
+
+    android::os::PersistableBundle extras;
+    extras.putString(String16("path"), String16(path.c_str()));
+
+    int fd = open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC | O_NOFOLLOW);
+    if (fd < 0) {
+        PLOG(WARNING) << "Failed to open " << path;
+        if (listener) {
+            std::lock_guard<std::mutex> lock(listener_lock);
+            listener->onStatus(-1, extras);
+        }
+        return 0;
+    }
+
+    uint64_t minlen = getDiscardGranularity(disk);
+    uint64_t chunk =
+            android::base::GetUintProperty<uint64_t>(kTrimChunkMbProp, kTrimChunkMbDefault) *
+            1024 * 1024;
+    uint64_t fs_size = ULLONG_MAX;
+    struct statfs sf;
+    if (chunk != 0 && fstatfs(fd, &sf) == 0) {
+        fs_size = (uint64_t)sf.f_blocks * sf.f_bsize;
+    } else {
+        chunk = 0;
+    }
+
+    uint64_t offset = 0;
+    if (chunk != 0) {
+        std::lock_guard<std::mutex> lock(resume_lock);
+        auto it = resume_offsets->find(path);
+        if (it != resume_offsets->end()) {
+            if (it->second < fs_size) {
+                offset = it->second;
+                LOG(INFO) << "Resuming trim of " << path << " at " << offset;
+            }
+            resume_offsets->erase(it);
+        }
+    }
+
+    bool success = true, completed = true;
+    uint64_t bytes = 0;
+    nsecs_t start = systemTime(SYSTEM_TIME_BOOTTIME);
+    if (chunk == 0) {
+        success = fitrim(fd, 0, ULLONG_MAX, minlen, &bytes);
+    } else {
+        while (offset < fs_size) {
+            // The filesystem size leaves out metadata and reserved blocks, so the last chunk
+            // runs to the end of the device like an unchunked trim would.
+            uint64_t len = fs_size - offset > chunk ? chunk : ULLONG_MAX - offset;
+            uint64_t trimmed;
+            if (!fitrim(fd, offset, len, minlen, &trimmed)) {
+                success = false;
+                break;
+            }
+            bytes += trimmed;
+            offset += chunk;
+            if (offset < fs_size && isIdleMaintAborted()) {
+                LOG(INFO) << "Trim of " << path << " aborted at " << offset;
+                completed = false;
+                std::lock_guard<std::mutex> lock(resume_lock);
+                (*resume_offsets)[path] = offset;
+                break;
+            }
+        }
+    }
+
+    if (!success) {
+        PLOG(WARNING) << "Trim failed on " << path;
+        bytes = 0;
+        if (listener) {
+            std::lock_guard<std::mutex> lock(listener_lock);
+            listener->onStatus(-1, extras);
+        }
+    } else {
+        nsecs_t time = systemTime(SYSTEM_TIME_BOOTTIME) - start;
+        LOG(INFO) << "Trimmed " << bytes << " bytes on " << path << " in "
+                  << nanoseconds_to_milliseconds(time) << "ms";
+        extras.putLong(String16("bytes"), bytes);
+        extras.putLong(String16("time"), time);
+        if (completed) {
+            std::lock_guard<std::mutex> lock(maint_state_lock);
+            VolumeMaintState& state = maint_state[path];
+            state.lastTrim = systemTime(SYSTEM_TIME_BOOTTIME);
+            state.lastTrimBytes = bytes;
+        }
+        if (listener) {
+            std::lock_guard<std::mutex> lock(listener_lock);
+            listener->onStatus(0, extras);
+        }
+    }
+    close(fd);
+    return bytes;
+}
+
+static uint64_t trimPaths(const std::list<std::string>& paths,
+                          const android::sp<android::os::IVoldTaskListener>& listener) {
+    // Paths on the same physical device are trimmed one after another, since concurrent
+    // discards would only contend for the same queue; independent devices run in parallel.
+    std::map<std::string, std::list<std::string>> groups;
+    for (const auto& path : paths) {
+        groups[getBackingDisk(path)].push_back(path);
+    }
+
+    std::mutex listener_lock, resume_lock;
+    std::map<std::string, uint64_t> resume_offsets = loadTrimResumeOffsets();
+    std::atomic<uint64_t> bytes(0);
+    std::vector<std::thread> workers;
+    for (const auto& [disk, group] : groups) {
+        LOG(DEBUG) << "Trimming " << group.size() << " path(s) on " << disk;
+        workers.emplace_back([&, &disk = disk, &group = group] {
+            for (const auto& path : group) {
+                if (isIdleMaintAborted()) break;
+                bytes += trimPath(path, disk, listener, listener_lock, &resume_offsets,
+                                  resume_lock);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    saveTrimResumeOffsets(resume_offsets);
+    return bytes;
+}
+
 void Trim(const android::sp<android::os::IVoldTaskListener>& listener) {
     auto wl = android::wakelock::WakeLock::tryGet(kWakeLock);
     if (!wl.has_value()) {
@@ -174,83 +457,168 @@ void Trim(const android::sp<android::os::IVoldTaskListener>& listener) {
     addFromFstab(&paths, PathTypes::kMountPoint, false);
     addFromVolumeManager(&paths, PathTypes::kMountPoint);
 
-    for (const auto& path : paths) {
-        LOG(DEBUG) << "Starting trim of " << path;
+    trimPaths(paths, listener);
 
+    if (listener) {
         android::os::PersistableBundle extras;
-        extras.putString(String16("path"), String16(path.c_str()));
+        listener->onFinished(0, extras);
+    }
 
-        int fd = open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC | O_NOFOLLOW);
-        if (fd < 0) {
-            PLOG(WARNING) << "Failed to open " << path;
-            if (listener) {
-                listener->onStatus(-1, extras);
-            }
+}
+
+// Picks the mount points worth trimming in this idle window, most promising first. Paths not
+// trimmed since boot come first; the rest are ranked by the bytes their last trim released,
+// scaled by how long ago that was, and skipped entirely if that trim was recent or tiny.
+static std::list<std::string> planTrim(const std::list<std::string>& paths) {
+    nsecs_t now = systemTime(SYSTEM_TIME_BOOTTIME);
+    std::vector<std::pair<double, std::string>> plan;
+
+    std::lock_guard<std::mutex> lock(maint_state_lock);
+    for (const auto& path : paths) {
+        auto it = maint_state.find(path);
+        if (it == maint_state.end() || it->second.lastTrim == 0) {
+            plan.emplace_back(std::numeric_limits<double>::max(), path);
             continue;
         }
+        const VolumeMaintState& state = it->second;
+        nsecs_t elapsed = now - state.lastTrim;
+        if (elapsed < seconds_to_nanoseconds(TRIM_MIN_INTERVAL_SEC) ||
+            (state.lastTrimBytes < TRIM_MIN_BYTES &&
+             elapsed < seconds_to_nanoseconds(TRIM_MAX_INTERVAL_SEC))) {
+            LOG(DEBUG) << "Skipping trim of " << path << ", last trimmed "
+                       << state.lastTrimBytes << " bytes "
+                       << nanoseconds_to_milliseconds(elapsed) / 1000 << "s ago";
+            continue;
+        }
+        double benefit = (double)state.lastTrimBytes * elapsed /
+                         seconds_to_nanoseconds(TRIM_MIN_INTERVAL_SEC);
+        plan.emplace_back(benefit, path);
+    }
 
-        struct fstrim_range range;
-        memset(&range, 0, sizeof(range));
-        range.len = ULLONG_MAX;
+    std::stable_sort(plan.begin(), plan.end(),
+                     [](const auto& a, const auto& b) { return a.first > b.first; });
+    std::list<std::string> planned;
+    for (auto& [benefit, path] : plan) {
+        planned.push_back(std::move(path));
+    }
+    return planned;
+}
 
-        nsecs_t start = systemTime(SYSTEM_TIME_BOOTTIME);
-        if (ioctl(fd, FITRIM, &range)) {
-            PLOG(WARNING) << "Trim failed on " << path;
-            if (listener) {
-                listener->onStatus(-1, extras);
-            }
-        } else {
-            nsecs_t time = systemTime(SYSTEM_TIME_BOOTTIME) - start;
-            LOG(INFO) << "Trimmed " << range.len << " bytes on " << path << " in "
-                      << nanoseconds_to_milliseconds(time) << "ms";
-            extras.putLong(String16("bytes"), range.len);
-            extras.putLong(String16("time"), time);
-            if (listener) {
-                listener->onStatus(0, extras);
-            }
+// Keeps only the f2fs sysfs paths with enough dirty segments to be worth urgent GC, in
+// descending order of dirty segments.
+static std::list<std::string> planGc(const std::list<std::string>& paths) {
+    std::vector<std::pair<int32_t, std::string>> plan;
+
+    std::lock_guard<std::mutex> lock(maint_state_lock);
+    for (const auto& path : paths) {
+        std::string dirty_segments;
+        if (!ReadFileToString(path + "/dirty_segments", &dirty_segments)) {
+            PLOG(WARNING) << "Reading dirty_segments failed in " << path;
+            continue;
+        }
+        int32_t dirty = std::stoi(dirty_segments);
+        maint_state[path].dirtySegments = dirty;
+        if (dirty <= DIRTY_SEGMENTS_THRESHOLD) {
+            LOG(DEBUG) << "Skipping GC of " << path << ", " << dirty << " dirty segments";
+            continue;
         }
-        close(fd);
+        plan.emplace_back(dirty, path);
     }
 
-    if (listener) {
-        android::os::PersistableBundle extras;
-        listener->onFinished(0, extras);
+    std::stable_sort(plan.begin(), plan.end(),
+                     [](const auto& a, const auto& b) { return a.first > b.first; });
+    std::list<std::string> planned;
+    for (auto& [dirty, path] : plan) {
+        planned.push_back(std::move(path));
     }
-
+    return planned;
 }
 
-static bool waitForGc(const std::list<std::string>& paths) {
+static bool waitForGc(const std::list<std::string>& paths, IdleMaintRun* run) {
+    struct GcProgress {
+        int32_t initial = -1;
+        int32_t latest = -1;
+        int32_t dirty = -1;
+        double rate = 0;  // Smoothed dirty segments reclaimed per second.
+        double stalled_sec = 0;  // How long the rate has been below GC_STALL_SEGMENTS_PER_SEC.
+    };
+    std::map<std::string, GcProgress> progress;
+
     std::unique_lock<std::mutex> lk(cv_m, std::defer_lock);
     bool stop = false, aborted = false;
     Timer timer;
+    std::chrono::milliseconds last_sample(0);
 
     while (!stop && !aborted) {
         stop = true;
+        bool stalled = true;
+        std::chrono::milliseconds now = timer.duration();
+        double window_sec = (now - last_sample).count() / 1000.0;
+        last_sample = now;
+        std::chrono::milliseconds wait = GC_POLL_INTERVAL;
+
         for (const auto& path : paths) {
             std::string dirty_segments;
             if (!ReadFileToString(path + "/dirty_segments", &dirty_segments)) {
                 PLOG(WARNING) << "Reading dirty_segments failed in " << path;
                 continue;
             }
-            if (std::stoi(dirty_segments) > DIRTY_SEGMENTS_THRESHOLD) {
-                stop = false;
-                break;
+            int32_t dirty = std::stoi(dirty_segments);
+            GcProgress& p = progress[path];
+            if (p.initial < 0) p.initial = dirty;
+            p.latest = dirty;
+            if (dirty <= DIRTY_SEGMENTS_THRESHOLD) {
+                continue;
+            }
+            stop = false;
+
+            if (p.dirty >= 0 && window_sec > 0) {
+                int32_t reclaimed = p.dirty - dirty;
+                double window_rate = std::max(reclaimed, 0) / window_sec;
+                p.rate = p.rate == 0 ? window_rate : (p.rate + window_rate) / 2;
+                p.stalled_sec = window_rate < GC_STALL_SEGMENTS_PER_SEC ? p.stalled_sec + window_sec
+                                                                        : 0;
+            }
+            p.dirty = dirty;
+            if (p.stalled_sec < GC_STALL_TIME.count()) {
+                stalled = false;
+            }
+
+            // Wake up around when this path is predicted to reach the threshold rather than
+            // sleeping through most of a full poll interval after it already has.
+            if (p.rate > 0) {
+                double eta_sec = (dirty - DIRTY_SEGMENTS_THRESHOLD) / p.rate;
+                LOG(DEBUG) << "GC on " << path << ": " << dirty << " dirty segments, reclaiming "
+                           << p.rate << "/s, " << eta_sec << "s to threshold";
+                auto eta = std::chrono::milliseconds((int64_t)(eta_sec * 1000));
+                wait = std::min(wait, std::max(std::chrono::milliseconds(1000), eta));
             }
         }
 
         if (stop) break;
 
+        if (stalled) {
+            LOG(INFO) << "GC stalled for " << GC_STALL_TIME.count() << "s";
+            run->abortReason = "gcStalled";
+            break;
+        }
+
         if (timer.duration() >= std::chrono::seconds(GC_TIMEOUT_SEC)) {
             LOG(WARNING) << "GC timeout";
+            run->abortReason = "gcTimeout";
             break;
         }
 
         lk.lock();
         aborted =
-            cv_abort.wait_for(lk, 10s, [] { return idle_maint_stat == IdleMaintStats::kAbort; });
+            cv_abort.wait_for(lk, wait, [] { return idle_maint_stat == IdleMaintStats::kAbort; });
         lk.unlock();
     }
 
+    for (const auto& [path, p] : progress) {
+        run->gcSegmentsReclaimed += std::max(p.initial - p.latest, 0);
+    }
+    run->gcMs = timer.duration().count();
     return aborted;
 }
 
@@ -275,16 +643,99 @@ static int stopGc(const std::list<std::string>& paths) {
 }
 
 static std::string getDevSysfsPath() {
-    for (const auto& entry : fstab_default) {
-        if (!entry.sysfs_path.empty()) {
-            return entry.sysfs_path;
+    auto topology = android::vold::GetDataTopology();
+    if (topology == nullptr || topology->devSysfsPath.empty()) {
+        LOG(WARNING) << "Cannot find dev sysfs path";
+        return "";
+    }
+    return topology->devSysfsPath;
+}
+
+// Health counters are polled by the framework far more often than they meaningfully change,
+// so each one is served from a cache and only re-read from sysfs once its entry expires or
+// idle maintenance has run.
+class StorageHealthCache {
+  public:
+    int32_t get(HealthCounter counter, const std::function<int32_t()>& read) {
+        std::lock_guard<std::mutex> lock(mLock);
+        Entry& entry = mEntries[static_cast<int>(counter)];
+        auto now = std::chrono::steady_clock::now();
+        if (!entry.valid || now - entry.time >= ttl(counter)) {
+            entry.value = read();
+            entry.time = now;
+            entry.valid = entry.value != -1;
         }
+        return entry.value;
+    }
+
+    void invalidate() {
+        std::lock_guard<std::mutex> lock(mLock);
+        for (auto& entry : mEntries) {
+            entry.valid = false;
+        }
+    }
+
+    // Resolved lazily since the data block device is only known once /data is mounted.  Has a
+    // lock of its own, since the reads get() makes under mLock come back here.
+    std::string dataSysfsPath() {
+        std::lock_guard<std::mutex> lock(mPathLock);
+        if (mDataSysfsPath.empty()) {
+            std::list<std::string> paths;
+            addFromFstab(&paths, PathTypes::kBlkDevice, true);
+            if (!paths.empty()) {
+                mDataSysfsPath = paths.front();
+            }
+        }
+        return mDataSysfsPath;
+    }
+
+  private:
+    struct Entry {
+        int32_t value = -1;
+        std::chrono::steady_clock::time_point time;
+        bool valid = false;
+    };
+
+    static std::chrono::seconds ttl(HealthCounter counter) {
+        // Life time estimation moves in 10% steps over years; the rest track ongoing I/O.
+        return counter == HealthCounter::kLifeTime ? 1h : 10s;
+    }
+
+    std::mutex mLock;
+    Entry mEntries[static_cast<int>(HealthCounter::kCount)];
+    std::mutex mPathLock;
+    std::string mDataSysfsPath;
+};
+
+static StorageHealthCache healthCache;
+
+static int32_t readDataSegments(const std::string& node) {
+    std::string path = healthCache.dataSysfsPath();
+    if (path.empty()) {
+        return -1;
     }
-    LOG(WARNING) << "Cannot find dev sysfs path";
-    return "";
+    std::string value;
+    if (!ReadFileToString(path + "/" + node, &value)) {
+        PLOG(WARNING) << "Reading failed in " << path << "/" << node;
+        return -1;
+    }
+    return std::stoi(value);
+}
+
+static void reportDevGc(const android::sp<android::os::IVoldTaskListener>& listener,
+                        std::mutex& listener_lock, const std::string& path,
+                        const std::string& state, const Timer& timer) {
+    if (!listener) return;
+    android::os::PersistableBundle extras;
+    extras.putString(String16("path"), String16(path.c_str()));
+    extras.putString(String16("devGcState"), String16(state.c_str()));
+    extras.putLong(String16("time"), timer.duration().count());
+    std::lock_guard<std::mutex> lock(listener_lock);
+    listener->onStatus(0, extras);
 }
 
-static void runDevGcFstab(void) {
+static void runDevGcFstab(const android::sp<android::os::IVoldTaskListener>& listener,
+                          std::mutex& listener_lock) {
     std::string path = getDevSysfsPath();
     if (path.empty()) {
         return;
@@ -292,6 +743,7 @@ static void runDevGcFstab(void) {
 
     path = path + "/manual_gc";
     Timer timer;
+    std::unique_lock<std::mutex> lk(cv_m, std::defer_lock);
 
     LOG(DEBUG) << "Start Dev GC on " << path;
     while (1) {
@@ -301,6 +753,7 @@ static void runDevGcFstab(void) {
             break;
         }
         require = android::base::Trim(require);
+        reportDevGc(listener, listener_lock, path, require, timer);
         if (require == "" || require == "off" || require == "disabled") {
             LOG(DEBUG) << "No more to do Dev GC";
             break;
@@ -316,12 +769,21 @@ static void runDevGcFstab(void) {
             LOG(WARNING) << "Dev GC timeout";
             break;
         }
-        sleep(2);
+
+        lk.lock();
+        bool aborted =
+            cv_abort.wait_for(lk, 2s, [] { return idle_maint_stat == IdleMaintStats::kAbort; });
+        lk.unlock();
+        if (aborted) {
+            LOG(DEBUG) << "Dev GC aborted";
+            break;
+        }
     }
     LOG(DEBUG) << "Stop Dev GC on " << path;
     if (!WriteStringToFile("0", path)) {
         PLOG(WARNING) << "Stop Dev GC failed on " << path;
     }
+    reportDevGc(listener, listener_lock, path, "stopped", timer);
     return;
 }
 
@@ -344,7 +806,15 @@ class GcCallbackImpl {
   public:
     void wait(uint64_t seconds) {
         std::unique_lock<std::mutex> lock(mMutex);
-        mCv.wait_for(lock, std::chrono::seconds(seconds), [this] { return mFinished; });
+        // Wake up periodically so that an idle maintenance abort isn't stuck behind the HAL.
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(seconds);
+        while (!mCv.wait_for(lock, 1s, [this] { return mFinished; })) {
+            if (isIdleMaintAborted()) {
+                LOG(INFO) << "Dev GC on " << idl << " HAL aborted";
+                return;
+            }
+            if (std::chrono::steady_clock::now() >= deadline) break;
+        }
 
         if (!mFinished) {
             LOG(WARNING) << "Dev GC on " << idl << " HAL timeout";
@@ -389,8 +859,67 @@ static void runDevGcOnHal(Service service, GcCallbackImpl cb, GetDescription get
     cb->wait(DEVGC_TIMEOUT_SEC);
 }
 
-static void runDevGc(void) {
-    runDevGcFstab();
+static void runDevGc(const android::sp<android::os::IVoldTaskListener>& listener,
+                     std::mutex& listener_lock) {
+    runDevGcFstab(listener, listener_lock);
+}
+
+// Recent idle maintenance runs, kept across reboots so that pacing parameters can be tuned
+// from what the device actually achieved.
+static std::deque<IdleMaintRun> idle_maint_history;
+static bool idle_maint_history_loaded = false;
+static std::mutex idle_maint_history_lock;
+
+static void loadIdleMaintHistoryLocked() {
+    if (idle_maint_history_loaded) return;
+    idle_maint_history_loaded = true;
+
+    std::string contents;
+    if (!ReadFileToString(kIdleMaintHistoryFile, &contents)) {
+        return;
+    }
+    for (const auto& line : android::base::Split(contents, "\n")) {
+        auto fields = android::base::Split(line, " ");
+        IdleMaintRun run;
+        if (fields.size() != 7 || !android::base::ParseInt(fields[0], &run.startTimeMs) ||
+            !android::base::ParseInt(fields[1], &run.trimBytes) ||
+            !android::base::ParseInt(fields[2], &run.trimMs) ||
+            !android::base::ParseInt(fields[3], &run.gcSegmentsReclaimed) ||
+            !android::base::ParseInt(fields[4], &run.gcMs) ||
+            !android::base::ParseInt(fields[5], &run.devGcMs)) {
+            continue;
+        }
+        run.abortReason = fields[6] == "-" ? "" : fields[6];
+        idle_maint_history.push_back(run);
+    }
+    while (idle_maint_history.size() > IDLE_MAINT_HISTORY_SIZE) {
+        idle_maint_history.pop_front();
+    }
+}
+
+static void recordIdleMaintRun(const IdleMaintRun& run) {
+    std::lock_guard<std::mutex> lock(idle_maint_history_lock);
+    loadIdleMaintHistoryLocked();
+    idle_maint_history.push_back(run);
+    if (idle_maint_history.size() > IDLE_MAINT_HISTORY_SIZE) {
+        idle_maint_history.pop_front();
+    }
+
+    std::string contents;
+    for (const auto& r : idle_maint_history) {
+        contents += StringPrintf("%" PRId64 " %" PRId64 " %" PRId64 " %" PRId64 " %" PRId64
+                                 " %" PRId64 " %s\n",
+                                 r.startTimeMs, r.trimBytes, r.trimMs, r.gcSegmentsReclaimed,
+                                 r.gcMs, r.devGcMs,
+                                 r.abortReason.empty() ? "-" : r.abortReason.c_str());
+    }
+    writeStringToFile(contents, kIdleMaintHistoryFile);
+}
+
+std::vector<IdleMaintRun> GetIdleMaintHistory() {
+    std::lock_guard<std::mutex> lock(idle_maint_history_lock);
+    loadIdleMaintHistoryLocked();
+    return std::vector<IdleMaintRun>(idle_maint_history.begin(), idle_maint_history.end());
 }
 
 int RunIdleMaint(bool needGC, const android::sp<android::os::IVoldTaskListener>& listener) {
@@ -415,23 +944,67 @@ int RunIdleMaint(bool needGC, const android::sp<android::os::IVoldTaskListener>&
         return android::UNEXPECTED_NULL;
     }
 
+    // Device GC runs inside the storage controller, so where the hardware can do it alongside
+    // host-driven f2fs GC, overlap the two instead of running device GC last.
+    IdleMaintRun run;
+    run.startTimeMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+                              std::chrono::system_clock::now().time_since_epoch())
+                              .count();
+
+    std::mutex listener_lock;
+    std::thread dev_gc;
+    bool concurrent_dev_gc = needGC && android::base::GetBoolProperty(kConcurrentDevGcProp, false);
+    if (concurrent_dev_gc) {
+        dev_gc = std::thread([&] {
+            Timer timer;
+            runDevGc(listener, listener_lock);
+            run.devGcMs = timer.duration().count();
+        });
+    }
+
     if (needGC) {
         std::list<std::string> paths;
         addFromFstab(&paths, PathTypes::kBlkDevice, false);
         addFromVolumeManager(&paths, PathTypes::kBlkDevice);
+        paths = planGc(paths);
 
-        startGc(paths);
+        if (!paths.empty()) {
+            startGc(paths);
 
-        gc_aborted = waitForGc(paths);
+            gc_aborted = waitForGc(paths, &run);
 
-        stopGc(paths);
+            stopGc(paths);
+        }
     }
 
     if (!gc_aborted) {
-        Trim(nullptr);
-        runDevGc();
+        std::list<std::string> paths;
+        addFromFstab(&paths, PathTypes::kMountPoint, false);
+        addFromVolumeManager(&paths, PathTypes::kMountPoint);
+        paths = planTrim(paths);
+
+        LOG(DEBUG) << "Trimming " << paths.size() << " path(s) in this window";
+        Timer timer;
+        run.trimBytes = trimPaths(paths, nullptr);
+        run.trimMs = timer.duration().count();
+        if (!concurrent_dev_gc && !isIdleMaintAborted()) {
+            timer = Timer();
+            runDevGc(listener, listener_lock);
+            run.devGcMs = timer.duration().count();
+        }
+    }
+
+    if (dev_gc.joinable()) {
+        dev_gc.join();
     }
 
+    if (isIdleMaintAborted()) {
+        run.abortReason = "abort";
+    }
+    recordIdleMaintRun(run);
+
+    healthCache.invalidate();
+
     lk.lock();
     idle_maint_stat = IdleMaintStats::kStopped;
     lk.unlock();
@@ -458,7 +1031,8 @@ int AbortIdleMaint(const android::sp<android::os::IVoldTaskListener>& listener)
     if (idle_maint_stat != IdleMaintStats::kStopped) {
         idle_maint_stat = IdleMaintStats::kAbort;
         lk.unlock();
-        cv_abort.notify_one();
+        // Both the f2fs GC wait and the device GC wait, which overlap, sleep on this
+        cv_abort.notify_all();
         lk.lock();
         LOG(DEBUG) << "aborting idle maintenance";
         cv_stop.wait(lk, [] { return idle_maint_stat == IdleMaintStats::kStopped; });
@@ -485,7 +1059,7 @@ int getLifeTime(const std::string& path) {
     return std::stoi(result, 0, 16);
 }
 
-int32_t GetStorageLifeTime() {
+static int32_t readStorageLifeTime() {
     std::string path = getDevSysfsPath();
     if (path.empty()) {
         return -1;
@@ -507,20 +1081,85 @@ int32_t GetStorageLifeTime() {
     return -1;
 }
 
+static int32_t getLifeTimeWrite();
+
+int32_t GetStorageLifeTime() {
+    return healthCache.get(HealthCounter::kLifeTime, readStorageLifeTime);
+}
+
+void GetStorageHealth(StorageHealth* health) {
+    health->lifeTime = GetStorageLifeTime();
+    health->writeSegments = getLifeTimeWrite();
+    health->dirtySegments = healthCache.get(HealthCounter::kDirtySegments,
+                                            [] { return readDataSegments("dirty_segments"); });
+    health->freeSegments = healthCache.get(HealthCounter::kFreeSegments,
+                                           [] { return readDataSegments("free_segments"); });
+}
+
+// Keeps urgent GC pacing state across SetGCUrgentPace() calls. The open-loop reclaim target is
+// augmented with the recent segment write rate, corrected by the accumulated error against the
+// target dirty ratio, and slew-limited so successive sleep times never jump by more than 2x.
+class GcPaceController {
+  public:
+    void recordWrite(int32_t segmentWrite) {
+        if (segmentWrite < 0) return;
+        if (mLastWrite >= 0 && segmentWrite >= mLastWrite) {
+            double delta = segmentWrite - mLastWrite;
+            mWritePerPeriod = mWritePerPeriod < 0
+                                      ? delta
+                                      : kWriteAlpha * delta + (1 - kWriteAlpha) * mWritePerPeriod;
+        }
+        mLastWrite = segmentWrite;
+    }
+
+    // Segments expected to be written until the next call, based on the history so far.
+    double writePerPeriod() const { return std::max(mWritePerPeriod, 0.0); }
+
+    bool active() const { return mSleepTime > 0; }
+
+    int32_t pace(int32_t targetSegments, int32_t dirtyRatio, int32_t targetDirtyRatio,
+                 int32_t gcPeriod, int32_t minGCSleepTime) {
+        mIntegral = std::clamp(mIntegral + dirtyRatio - targetDirtyRatio, -kIntegralLimit,
+                               kIntegralLimit);
+        double gain = std::clamp(1.0 + kIntegralGain * mIntegral, 0.5, 2.0);
+        double sleepTime = gcPeriod * ONE_MINUTE_IN_MS / (targetSegments * gain);
+        if (mSleepTime > 0) {
+            sleepTime = std::clamp(sleepTime, mSleepTime / 2.0, mSleepTime * 2.0);
+        }
+        mSleepTime = std::max((int32_t)sleepTime, minGCSleepTime);
+        return mSleepTime;
+    }
+
+    void stop() {
+        mSleepTime = 0;
+        mIntegral = 0;
+    }
+
+  private:
+    static constexpr double kWriteAlpha = 0.3;
+    static constexpr int32_t kIntegralLimit = 50;
+    static constexpr double kIntegralGain = 0.02;
+
+    int32_t mLastWrite = -1;
+    double mWritePerPeriod = -1;
+    int32_t mSleepTime = 0;
+    int32_t mIntegral = 0;
+};
+
+static GcPaceController gcPaceController;
+
 void SetGCUrgentPace(int32_t neededSegments, int32_t minSegmentThreshold, float dirtyReclaimRate,
                      float reclaimWeight, int32_t gcPeriod, int32_t minGCSleepTime,
                      int32_t targetDirtyRatio) {
-    std::list<std::string> paths;
     bool needGC = false;
     int32_t sleepTime;
 
-    addFromFstab(&paths, PathTypes::kBlkDevice, true);
-    if (paths.empty()) {
+    std::string f2fsSysfsPath = healthCache.dataSysfsPath();
+    if (f2fsSysfsPath.empty()) {
         LOG(WARNING) << "There is no valid blk device path for data partition";
         return;
     }
 
-    std::string f2fsSysfsPath = paths.front();
     std::string freeSegmentsPath = f2fsSysfsPath + "/free_segments";
     std::string dirtySegmentsPath = f2fsSysfsPath + "/dirty_segments";
     std::string gcSleepTimePath = f2fsSysfsPath + "/gc_urgent_sleep_time";
@@ -556,20 +1195,32 @@ void SetGCUrgentPace(int32_t neededSegments, int32_t minSegmentThreshold, float
     freeSegments = freeSegments > reservedBlocks ? freeSegments - reservedBlocks : 0;
     int32_t totalSegments = freeSegments + dirtySegments;
     int32_t finalTargetSegments = 0;
+    int32_t dirtyRatio = 0;
+
+    gcPaceController.recordWrite(getLifeTimeWrite());
 
     if (totalSegments < minSegmentThreshold) {
         LOG(INFO) << "The sum of free segments: " << freeSegments
                   << ", dirty segments: " << dirtySegments << " is under " << minSegmentThreshold;
     } else {
-        int32_t dirtyRatio = dirtySegments * 100 / totalSegments;
+        dirtyRatio = dirtySegments * 100 / totalSegments;
         int32_t neededForTargetRatio =
                 (dirtyRatio > targetDirtyRatio)
                         ? totalSegments * (dirtyRatio - targetDirtyRatio) / 100
                         : 0;
         neededSegments *= reclaimWeight;
         neededSegments = (neededSegments > freeSegments) ? neededSegments - freeSegments : 0;
+        // Writes arriving during the next period overwrite roughly dirtyRatio of their volume.
+        int32_t expectedDirtied = gcPaceController.writePerPeriod() * dirtyRatio / 100;
 
         finalTargetSegments = std::max(neededSegments, neededForTargetRatio);
+        if (finalTargetSegments == 0 && gcPaceController.active() &&
+            dirtyRatio > targetDirtyRatio - GC_PACE_HYSTERESIS) {
+            // Hold GC on near the target instead of flapping between modes on every call.
+            finalTargetSegments = std::max(expectedDirtied, 1);
+        } else if (finalTargetSegments != 0) {
+            finalTargetSegments += expectedDirtied;
+        }
         if (finalTargetSegments == 0) {
             LOG(INFO) << "Enough free segments: " << freeSegments;
         } else {
@@ -577,6 +1228,10 @@ void SetGCUrgentPace(int32_t neededSegments, int32_t minSegmentThreshold, float
                     std::min(finalTargetSegments, (int32_t)(dirtySegments * dirtyReclaimRate));
             if (finalTargetSegments == 0) {
                 LOG(INFO) << "Low dirty segments: " << dirtySegments;
+            } else if (neededSegments == 0 && neededForTargetRatio == 0) {
+                LOG(INFO) << "Keep GC running, dirty ratio " << dirtyRatio
+                          << " is within hysteresis of target";
+                needGC = true;
             } else if (neededSegments >= neededForTargetRatio) {
                 LOG(INFO) << "Trigger GC, because of needed segments exceeding free segments";
                 needGC = true;
@@ -589,16 +1244,15 @@ void SetGCUrgentPace(int32_t neededSegments, int32_t minSegmentThreshold, float
     }
 
     if (!needGC) {
+        gcPaceController.stop();
         if (!WriteStringToFile(std::to_string(GC_NORMAL_MODE), gcUrgentModePath)) {
             PLOG(WARNING) << "Writing failed in " << gcUrgentModePath;
         }
         return;
     }
 
-    sleepTime = gcPeriod * ONE_MINUTE_IN_MS / finalTargetSegments;
-    if (sleepTime < minGCSleepTime) {
-        sleepTime = minGCSleepTime;
-    }
+    sleepTime = gcPaceController.pace(finalTargetSegments, dirtyRatio, targetDirtyRatio, gcPeriod,
+                                      minGCSleepTime);
 
     if (!WriteStringToFile(std::to_string(sleepTime), gcSleepTimePath)) {
         PLOG(WARNING) << "Writing failed in " << gcSleepTimePath;
@@ -615,15 +1269,14 @@ void SetGCUrgentPace(int32_t neededSegments, int32_t minSegmentThreshold, float
               << ", sleep time: " << sleepTime;
 }
 
-static int32_t getLifeTimeWrite() {
-    std::list<std::string> paths;
-    addFromFstab(&paths, PathTypes::kBlkDevice, true);
-    if (paths.empty()) {
+static int32_t readLifeTimeWrite() {
+    std::string path = healthCache.dataSysfsPath();
+    if (path.empty()) {
         LOG(WARNING) << "There is no valid blk device path for data partition";
         return -1;
     }
 
-    std::string writeKbytesPath = paths.front() + "/lifetime_write_kbytes";
+    std::string writeKbytesPath = path + "/lifetime_write_kbytes";
     std::string writeKbytesStr;
     if (!ReadFileToString(writeKbytesPath, &writeKbytesStr)) {
         PLOG(WARNING) << "Reading failed in " << writeKbytesPath;
@@ -639,6 +1292,10 @@ static int32_t getLifeTimeWrite() {
     return writeBytes / KBYTES_IN_SEGMENT;
 }
 
+static int32_t getLifeTimeWrite() {
+    return healthCache.get(HealthCounter::kWriteSegments, readLifeTimeWrite);
+}
+
 void RefreshLatestWrite() {
     int32_t segmentWrite = getLifeTimeWrite();
     if (segmentWrite != -1) {
@@ -19,13 +19,38 @@
 
 #include "android/os/IVoldTaskListener.h"
 
+#include <string>
+#include <vector>
+
 namespace android {
 namespace vold {
 
+struct StorageHealth {
+    int32_t lifeTime = -1;
+    int32_t writeSegments = -1;
+    int32_t dirtySegments = -1;
+    int32_t freeSegments = -1;
+};
+
+struct IdleMaintRun {
+    int64_t startTimeMs = 0;
+    int64_t trimBytes = 0;
+    int64_t trimMs = 0;
+    int64_t gcSegmentsReclaimed = 0;
+    int64_t gcMs = 0;
+    int64_t devGcMs = 0;
+    /* Empty when the run completed, otherwise "abort", "gcTimeout" or "gcStalled" */
+    std::string abortReason;
+};
+
 void Trim(const android::sp<android::os::IVoldTaskListener>& listener);
 int RunIdleMaint(bool needGC, const android::sp<android::os::IVoldTaskListener>& listener);
 int AbortIdleMaint(const android::sp<android::os::IVoldTaskListener>& listener);
+/* Returns the most recent idle maintenance runs, oldest first */
+std::vector<IdleMaintRun> GetIdleMaintHistory();
 int32_t GetStorageLifeTime();
+/* Fills in all cached health counters at once; unavailable values are -1 */
+void GetStorageHealth(StorageHealth* health);
 void SetGCUrgentPace(int32_t neededSegments, int32_t minSegmentThreshold, float dirtyReclaimRate,
                      float reclaimWeight, int32_t gcPeriod, int32_t minGCSleepTime,
                      int32_t targetDirtyRatio);
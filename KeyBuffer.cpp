@@ -16,20 +16,116 @@
 
 #include "KeyBuffer.h"
 
-#include <algorithm>
-#include <cstring>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <mutex>
+#include <new>
+
+#include <android-base/logging.h>
 
 namespace android {
 namespace vold {
 
+namespace {
+
+// Size classes are powers of two from kMinBlock to kMaxBlock, carved out of kChunkSize chunks.
+constexpr size_t kMinBlockShift = 5;
+constexpr size_t kMaxBlockShift = 12;
+constexpr size_t kMinBlock = 1 << kMinBlockShift;
+constexpr size_t kMaxBlock = 1 << kMaxBlockShift;
+constexpr size_t kClasses = kMaxBlockShift - kMinBlockShift + 1;
+constexpr size_t kChunkSize = 64 * 1024;
+
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+std::mutex sPoolLock;
+FreeBlock* sFreeLists[kClasses];
+
+size_t SizeClass(size_t n) {
+    size_t c = 0;
+    while ((kMinBlock << c) < n) c++;
+    return c;
+}
+
+// Maps pages that stay resident and out of core dumps, as far as the kernel lets us.
+void* MapKeyPages(size_t size) {
+    void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) throw std::bad_alloc();
+    if (mlock(p, size) != 0) {
+        static bool warned = false;
+        if (!warned) {
+            PLOG(WARNING) << "Failed to lock key memory, it may be swapped";
+            warned = true;
+        }
+    }
+    madvise(p, size, MADV_DONTDUMP);
+    return p;
+}
+
+size_t RoundToPages(size_t n) {
+    size_t page = getpagesize();
+    return (n + page - 1) & ~(page - 1);
+}
+
+}  // namespace
+
+void* AllocateKeyMemory(size_t n) {
+    if (n > kMaxBlock) return MapKeyPages(RoundToPages(n));
+
+    size_t c = SizeClass(n);
+    std::lock_guard<std::mutex> lock(sPoolLock);
+    if (sFreeLists[c] == nullptr) {
+        // The chunk is never given back; key material peaks at a few keys per user.
+        char* chunk = static_cast<char*>(MapKeyPages(kChunkSize));
+        size_t block = kMinBlock << c;
+        for (size_t off = kChunkSize; off >= block; off -= block) {
+            auto b = reinterpret_cast<FreeBlock*>(chunk + off - block);
+            b->next = sFreeLists[c];
+            sFreeLists[c] = b;
+        }
+    }
+    FreeBlock* b = sFreeLists[c];
+    sFreeLists[c] = b->next;
+    b->next = nullptr;
+    return b;
+}
+
+void FreeKeyMemory(void* p, size_t n) {
+    if (p == nullptr) return;
+    if (n > kMaxBlock) {
+        memset_explicit(p, 0, n);
+        munmap(p, RoundToPages(n));
+        return;
+    }
+
+    size_t c = SizeClass(n);
+    memset_explicit(p, 0, kMinBlock << c);
+    std::lock_guard<std::mutex> lock(sPoolLock);
+    auto b = static_cast<FreeBlock*>(p);
+    b->next = sFreeLists[c];
+    sFreeLists[c] = b;
+}
+
+KeyBuffer& operator+=(KeyBuffer& lhs, const KeyBuffer& rhs) {
+    lhs.insert(lhs.end(), rhs.begin(), rhs.end());
+    return lhs;
+}
+
+KeyBuffer& operator+=(KeyBuffer& lhs, const char* rhs) {
+    lhs.insert(lhs.end(), rhs, rhs + strlen(rhs));
+    return lhs;
+}
+
 KeyBuffer operator+(KeyBuffer&& lhs, const KeyBuffer& rhs) {
-    std::copy(rhs.begin(), rhs.end(), std::back_inserter(lhs));
-    return std::move(lhs);
+    return std::move(lhs += rhs);
 }
 
 KeyBuffer operator+(KeyBuffer&& lhs, const char* rhs) {
-    std::copy(rhs, rhs + strlen(rhs), std::back_inserter(lhs));
-    return std::move(lhs);
+    return std::move(lhs += rhs);
 }
 
 }  // namespace vold
@@ -19,24 +19,49 @@
 
 #include <string.h>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace android {
 namespace vold {
 
-// Allocator that delegates useful work to standard one but zeroes data before deallocating.
-class ZeroingAllocator : public std::allocator<char> {
+/*
+ * Memory for key material. It comes from a pool of mlock'ed pages kept out of core dumps, so
+ * keys don't end up in swap, zram or tombstones, and freed blocks are zeroed and kept for
+ * reuse instead of going back to the heap. Sizes above the largest size class get pages of
+ * their own.
+ */
+void* AllocateKeyMemory(size_t n);
+void FreeKeyMemory(void* p, size_t n);
+
+// Allocator for key material backed by AllocateKeyMemory(), which zeroes data before reuse.
+class ZeroingAllocator {
   public:
-    void deallocate(pointer p, size_type n) {
-        memset_explicit(p, 0, n);
-        std::allocator<char>::deallocate(p, n);
-    }
+    using value_type = char;
+    using pointer = char*;
+    using size_type = size_t;
+
+    template <typename U>
+    struct rebind {
+        static_assert(std::is_same_v<U, char>, "KeyBuffer only holds chars");
+        using other = ZeroingAllocator;
+    };
+
+    pointer allocate(size_type n) { return static_cast<pointer>(AllocateKeyMemory(n)); }
+    void deallocate(pointer p, size_type n) { FreeKeyMemory(p, n); }
+
+    bool operator==(const ZeroingAllocator&) const { return true; }
+    bool operator!=(const ZeroingAllocator&) const { return false; }
 };
 
 // Char vector that zeroes memory when deallocating.
 using KeyBuffer = std::vector<char, ZeroingAllocator>;
 
-// Convenience methods to concatenate key buffers.
+// Appends to a key buffer in place, growing it at most once.
+KeyBuffer& operator+=(KeyBuffer& lhs, const KeyBuffer& rhs);
+KeyBuffer& operator+=(KeyBuffer& lhs, const char* rhs);
+
+// Convenience methods to concatenate key buffers, reusing the storage of lhs.
 KeyBuffer operator+(KeyBuffer&& lhs, const KeyBuffer& rhs);
 KeyBuffer operator+(KeyBuffer&& lhs, const char* rhs);
 
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "KeyDirWriter.h"
+
+#include <android-base/file.h>
+#include <android-base/logging.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <utility>
+
+namespace android {
+namespace vold {
+
+static std::function<bool(const char*)> sFaultHook;
+
+void SetKeyDirWriterFaultHook(std::function<bool(const char* step)> hook) {
+    sFaultHook = std::move(hook);
+}
+
+static bool injectFault(const std::string& dir, const char* step) {
+    if (!sFaultHook || sFaultHook(step)) return false;
+    LOG(ERROR) << "Injected failure at " << step << " in " << dir;
+    return true;
+}
+
+bool KeyDirWriter::create(const std::string& dir) {
+    if (TEMP_FAILURE_RETRY(mkdir(dir.c_str(), 0700)) == -1) {
+        PLOG(ERROR) << "key mkdir " << dir;
+        return false;
+    }
+    mDir = dir;
+    mDirFd.reset(TEMP_FAILURE_RETRY(
+            open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC)));
+    if (mDirFd == -1) {
+        PLOG(ERROR) << "Failed to open " << dir;
+        return false;
+    }
+    return true;
+}
+
+bool KeyDirWriter::writeFile(const char* name, const std::string& contents) {
+    auto path = mDir + "/" + name;
+    if (injectFault(mDir, name)) return false;
+    android::base::unique_fd fd(TEMP_FAILURE_RETRY(openat(
+            mDirFd, name, O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC, 0666)));
+    if (fd == -1) {
+        PLOG(ERROR) << "Failed to open " << path;
+        return false;
+    }
+    if (!android::base::WriteStringToFd(contents, fd)) {
+        PLOG(ERROR) << "Failed to write to " << path;
+        unlinkat(mDirFd, name, 0);
+        return false;
+    }
+    // Start the writeback now, so that it overlaps with the rest of the key being generated and
+    // the fsync() in sync() is left with little more than to wait for it.
+    sync_file_range(fd, 0, 0, SYNC_FILE_RANGE_WRITE);
+    mFiles.emplace_back(std::move(path), std::move(fd));
+    return true;
+}
+
+static bool fsyncOrLog(int fd, const std::string& path) {
+    if (fsync(fd) == -1) {
+        if (errno == EROFS || errno == EINVAL) {
+            PLOG(WARNING) << "Skip fsync " << path
+                          << " on a file system does not support synchronization";
+        } else {
+            PLOG(ERROR) << "Failed to fsync " << path;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool KeyDirWriter::sync() {
+    // Only the files written here and their directory, not everything dirty on the filesystem
+    if (injectFault(mDir, "sync")) return false;
+    for (const auto& [path, fd] : mFiles) {
+        if (!fsyncOrLog(fd, path)) return false;
+    }
+    mFiles.clear();
+    return fsyncOrLog(mDirFd, mDir);
+}
+
+}  // namespace vold
+}  // namespace android
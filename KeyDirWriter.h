@@ -0,0 +1,60 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_VOLD_KEY_DIR_WRITER_H
+#define ANDROID_VOLD_KEY_DIR_WRITER_H
+
+#include <android-base/unique_fd.h>
+
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace android {
+namespace vold {
+
+/*
+ * Writes the files of a new key directory without waiting for each one to reach the disk, then
+ * makes all of them and the directory durable with sync().  The directory must not be made
+ * visible under its final name until sync() has succeeded, or a crash could leave a key directory
+ * with missing contents.
+ */
+class KeyDirWriter {
+  public:
+    /* Creates dir, which must not exist yet */
+    bool create(const std::string& dir);
+    /* Files are readable as soon as they're written, just not durable until sync() */
+    bool writeFile(const char* name, const std::string& contents);
+    /* fsyncs the files written, then the directory */
+    bool sync();
+
+  private:
+    std::string mDir;
+    android::base::unique_fd mDirFd;
+    std::vector<std::pair<std::string, android::base::unique_fd>> mFiles;
+};
+
+/*
+ * For tests: hook called before each file is written, with its name, and before the sync, with
+ * "sync".  Returning false fails that step just like a failed write or sync would.
+ */
+void SetKeyDirWriterFaultHook(std::function<bool(const char* step)> hook);
+
+}  // namespace vold
+}  // namespace android
+
+#endif
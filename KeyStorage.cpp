@@ -17,15 +17,20 @@
 #include "KeyStorage.h"
 
 #include "Checkpoint.h"
+#include "FileTree.h"
+#include "KeyDirWriter.h"
 #include "Keystore.h"
 #include "Utils.h"
 
 #include <algorithm>
 #include <memory>
 #include <mutex>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #include <errno.h>
+#include <fcntl.h>
 #include <stdio.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -52,10 +57,11 @@ static constexpr size_t AES_KEY_BYTES = 32;
 static constexpr size_t GCM_NONCE_BYTES = 12;
 static constexpr size_t GCM_MAC_BYTES = 16;
 static constexpr size_t SECDISCARDABLE_BYTES = 1 << 14;
+// Far bigger than any file vold keeps in a key directory
+static constexpr off_t MAX_KEY_FILE_BYTES = 1 << 20;
 constexpr int EXT4_AES_256_XTS_KEY_SIZE = 64;
 
 static const char* kCurrentVersion = "1";
-static const char* kRmPath = "/system/bin/rm";
 static const char* kSecdiscardPath = "/system/bin/secdiscard";
 static const char* kHashPrefix_secdiscardable = "Android secdiscardable SHA512";
 static const char* kHashPrefix_keygen = "Android key wrapping key generation SHA512";
@@ -102,7 +108,8 @@ static bool checkSize(const std::string& kind, size_t actual, size_t expected) {
     return true;
 }
 
-static void hashWithPrefix(char const* prefix, const std::string& tohash, std::string* res) {
+template <class T>
+static void hashWithPrefix(char const* prefix, const T& tohash, std::string* res) {
     SHA512_CTX c;
 
     SHA512_Init(&c);
@@ -196,6 +203,33 @@ static bool readFileToString(const std::string& filename, std::string* result) {
     return true;
 }
 
+// Reads |name| from the key directory open as |dirfd| straight into |result|, sized once from
+// fstat(), so the contents are never copied through memory that isn't zeroed when freed.
+static bool readKeyFile(int dirfd, const std::string& dir, const char* name, KeyBuffer* result) {
+    auto path = dir + "/" + name;
+    android::base::unique_fd fd(
+            TEMP_FAILURE_RETRY(openat(dirfd, name, O_RDONLY | O_NOFOLLOW | O_CLOEXEC)));
+    if (fd == -1) {
+        PLOG(ERROR) << "Failed to open " << path;
+        return false;
+    }
+    struct stat sb;
+    if (fstat(fd, &sb) != 0) {
+        PLOG(ERROR) << "Failed to stat " << path;
+        return false;
+    }
+    if (!S_ISREG(sb.st_mode) || sb.st_size > MAX_KEY_FILE_BYTES) {
+        LOG(ERROR) << path << " is not a key file";
+        return false;
+    }
+    result->resize(sb.st_size);
+    if (!android::base::ReadFully(fd, result->data(), result->size())) {
+        PLOG(ERROR) << "Failed to read from " << path;
+        return false;
+    }
+    return true;
+}
+
 static bool readRandomBytesOrLog(size_t count, std::string* out) {
     auto status = ReadRandomBytes(count, *out);
     if (status != OK) {
@@ -232,43 +266,60 @@ static std::mutex key_upgrade_lock;
 // A directory can be in this list at most once.
 static std::vector<std::string> key_dirs_to_commit;
 
-// Replaces |dir|/keymaster_key_blob with |dir|/keymaster_key_blob_upgraded and
-// deletes the old key from Keystore.
-static bool CommitUpgradedKey(Keystore& keystore, const std::string& dir) {
+// Replaces |dir|/keymaster_key_blob with |dir|/keymaster_key_blob_upgraded, returning the old key
+// in |old_blob| so that it can be deleted from Keystore once nothing on disk refers to it.
+static bool ReplaceWithUpgradedKey(const std::string& dir, std::string* old_blob) {
     auto blob_file = dir + "/" + kFn_keymaster_key_blob;
     auto upgraded_blob_file = dir + "/" + kFn_keymaster_key_blob_upgraded;
 
-    std::string blob;
-    if (!readFileToString(blob_file, &blob)) return false;
+    if (!readFileToString(blob_file, old_blob)) return false;
 
     if (rename(upgraded_blob_file.c_str(), blob_file.c_str()) != 0) {
         PLOG(ERROR) << "Failed to rename " << upgraded_blob_file << " to " << blob_file;
         return false;
     }
     // Ensure that the rename is persisted before deleting the Keystore key.
-    if (!FsyncDirectory(dir)) return false;
+    return FsyncDirectory(dir);
+}
 
+static void DeleteOldKey(Keystore& keystore, const std::string& dir, const std::string& blob) {
     if (!keystore || !keystore.deleteKey(blob)) {
-        LOG(WARNING) << "Failed to delete old key " << blob_file
+        LOG(WARNING) << "Failed to delete old key " << dir << "/" << kFn_keymaster_key_blob
                      << " from Keystore; continuing anyway";
         // Continue on, but the space in Keystore used by the old key won't be freed.
     }
+}
+
+// Replaces |dir|/keymaster_key_blob with |dir|/keymaster_key_blob_upgraded and
+// deletes the old key from Keystore.
+static bool CommitUpgradedKey(Keystore& keystore, const std::string& dir) {
+    std::string blob;
+    if (!ReplaceWithUpgradedKey(dir, &blob)) return false;
+    DeleteOldKey(keystore, dir, blob);
     return true;
 }
 
 void DeferredCommitKeystoreKeys() {
     LOG(INFO) << "Committing upgraded Keystore keys";
-    Keystore keystore;
-    if (!keystore) {
-        LOG(ERROR) << "Failed to open Keystore; old keys won't be deleted from Keystore";
-        // Continue on, but the space in Keystore used by the old keys won't be freed.
+    // Swap in all the upgraded keys first, and only then go to Keystore for the old ones, so
+    // that key operations waiting on key_upgrade_lock don't also wait on Keystore.
+    std::vector<std::pair<std::string, std::string>> old_keys;
+    {
+        std::lock_guard<std::mutex> lock(key_upgrade_lock);
+        for (auto& dir : key_dirs_to_commit) {
+            LOG(INFO) << "Committing upgraded Keystore key for " << dir;
+            std::string blob;
+            if (ReplaceWithUpgradedKey(dir, &blob)) old_keys.emplace_back(dir, std::move(blob));
+        }
+        key_dirs_to_commit.clear();
     }
-    std::lock_guard<std::mutex> lock(key_upgrade_lock);
-    for (auto& dir : key_dirs_to_commit) {
-        LOG(INFO) << "Committing upgraded Keystore key for " << dir;
-        CommitUpgradedKey(keystore, dir);
+    if (!old_keys.empty()) {
+        Keystore keystore;
+        if (!keystore) {
+            LOG(ERROR) << "Failed to open Keystore; old keys won't be deleted from Keystore";
+        }
+        for (const auto& [dir, blob] : old_keys) DeleteOldKey(keystore, dir, blob);
     }
-    key_dirs_to_commit.clear();
     LOG(INFO) << "Done committing upgraded Keystore keys";
 }
 
@@ -421,9 +472,14 @@ static bool encryptWithKeystoreKey(Keystore& keystore, const std::string& dir,
 
 static bool decryptWithKeystoreKey(Keystore& keystore, const std::string& dir,
                                    const km::AuthorizationSet& keyParams,
-                                   const std::string& ciphertext, KeyBuffer* message) {
-    const std::string nonce = ciphertext.substr(0, GCM_NONCE_BYTES);
-    auto bodyAndMac = ciphertext.substr(GCM_NONCE_BYTES);
+                                   const KeyBuffer& ciphertext, KeyBuffer* message) {
+    if (ciphertext.size() < GCM_NONCE_BYTES + GCM_MAC_BYTES) {
+        LOG(ERROR) << "GCM ciphertext too small: " << ciphertext.size();
+        return false;
+    }
+    const std::string nonce(ciphertext.data(), GCM_NONCE_BYTES);
+    std::string_view bodyAndMac(ciphertext.data() + GCM_NONCE_BYTES,
+                                ciphertext.size() - GCM_NONCE_BYTES);
     auto opParams = km::AuthorizationSetBuilder()
                             .Authorization(km::TAG_NONCE, nonce)
                             .Authorization(km::TAG_PURPOSE, km::KeyPurpose::DECRYPT);
@@ -507,7 +563,7 @@ static bool encryptWithoutKeystore(const std::string& preKey, const KeyBuffer& p
     return true;
 }
 
-static bool decryptWithoutKeystore(const std::string& preKey, const std::string& ciphertext,
+static bool decryptWithoutKeystore(const std::string& preKey, const KeyBuffer& ciphertext,
                                    KeyBuffer* plaintext) {
     if (ciphertext.size() < GCM_NONCE_BYTES + GCM_MAC_BYTES) {
         LOG(ERROR) << "GCM ciphertext too small: " << ciphertext.size();
@@ -568,15 +624,18 @@ static bool decryptWithoutKeystore(const std::string& preKey, const std::string&
 // If a storage binding seed has been set, then the storage binding seed will be
 // required to retrieve the key as well.
 static bool storeKey(const std::string& dir, const KeyAuthentication& auth, const KeyBuffer& key) {
-    if (TEMP_FAILURE_RETRY(mkdir(dir.c_str(), 0700)) == -1) {
-        PLOG(ERROR) << "key mkdir " << dir;
-        return false;
-    }
-    if (!writeStringToFile(kCurrentVersion, dir + "/" + kFn_version)) return false;
+    // Nothing here is synced until the end; storeKeyAtomically() only gives the directory its
+    // real name after that.
+    KeyDirWriter writer;
+    if (!writer.create(dir)) return false;
+    if (!writer.writeFile(kFn_version, kCurrentVersion)) return false;
     std::string secdiscardable_hash;
-    if (auth.usesKeystore() &&
-        !createSecdiscardable(dir + "/" + kFn_secdiscardable, &secdiscardable_hash))
-        return false;
+    if (auth.usesKeystore()) {
+        std::string secdiscardable;
+        if (!readRandomBytesOrLog(SECDISCARDABLE_BYTES, &secdiscardable)) return false;
+        if (!writer.writeFile(kFn_secdiscardable, secdiscardable)) return false;
+        hashWithPrefix(kHashPrefix_secdiscardable, secdiscardable, &secdiscardable_hash);
+    }
     std::string appId = generateAppId(auth, secdiscardable_hash);
     std::string encryptedKey;
     if (auth.usesKeystore()) {
@@ -584,7 +643,7 @@ static bool storeKey(const std::string& dir, const KeyAuthentication& auth, cons
         if (!keystore) return false;
         std::string ksKey;
         if (!generateKeyStorageKey(keystore, appId, &ksKey)) return false;
-        if (!writeStringToFile(ksKey, dir + "/" + kFn_keymaster_key_blob)) return false;
+        if (!writer.writeFile(kFn_keymaster_key_blob, ksKey)) return false;
         km::AuthorizationSet keyParams = beginParams(appId);
         if (!encryptWithKeystoreKey(keystore, dir, keyParams, key, &encryptedKey)) {
             LOG(ERROR) << "encryptWithKeystoreKey failed";
@@ -596,9 +655,8 @@ static bool storeKey(const std::string& dir, const KeyAuthentication& auth, cons
             return false;
         }
     }
-    if (!writeStringToFile(encryptedKey, dir + "/" + kFn_encrypted_key)) return false;
-    if (!FsyncDirectory(dir)) return false;
-    return true;
+    if (!writer.writeFile(kFn_encrypted_key, encryptedKey)) return false;
+    return writer.sync();
 }
 
 bool storeKeyAtomically(const std::string& key_path, const std::string& tmp_path,
@@ -621,17 +679,28 @@ bool storeKeyAtomically(const std::string& key_path, const std::string& tmp_path
 }
 
 bool retrieveKey(const std::string& dir, const KeyAuthentication& auth, KeyBuffer* key) {
-    std::string version;
-    if (!readFileToString(dir + "/" + kFn_version, &version)) return false;
-    if (version != kCurrentVersion) {
-        LOG(ERROR) << "Version mismatch, expected " << kCurrentVersion << " got " << version;
+    android::base::unique_fd dirfd(
+            TEMP_FAILURE_RETRY(open(dir.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC)));
+    if (dirfd == -1) {
+        PLOG(ERROR) << "Failed to open key directory " << dir;
+        return false;
+    }
+    KeyBuffer version;
+    if (!readKeyFile(dirfd, dir, kFn_version, &version)) return false;
+    if (std::string_view(version.data(), version.size()) != kCurrentVersion) {
+        LOG(ERROR) << "Version mismatch, expected " << kCurrentVersion << " got "
+                   << std::string(version.begin(), version.end());
         return false;
     }
     std::string secdiscardable_hash;
-    if (!readSecdiscardable(dir + "/" + kFn_secdiscardable, &secdiscardable_hash)) return false;
+    if (faccessat(dirfd, kFn_secdiscardable, F_OK, AT_SYMLINK_NOFOLLOW) == 0) {
+        KeyBuffer secdiscardable;
+        if (!readKeyFile(dirfd, dir, kFn_secdiscardable, &secdiscardable)) return false;
+        hashWithPrefix(kHashPrefix_secdiscardable, secdiscardable, &secdiscardable_hash);
+    }
     std::string appId = generateAppId(auth, secdiscardable_hash);
-    std::string encryptedMessage;
-    if (!readFileToString(dir + "/" + kFn_encrypted_key, &encryptedMessage)) return false;
+    KeyBuffer encryptedMessage;
+    if (!readKeyFile(dirfd, dir, kFn_encrypted_key, &encryptedMessage)) return false;
     if (auth.usesKeystore()) {
         Keystore keystore;
         if (!keystore) return false;
@@ -668,26 +737,23 @@ bool runSecdiscardSingle(const std::string& file) {
 }
 
 static bool recursiveDeleteKey(const std::string& dir) {
-    if (ForkExecvp(std::vector<std::string>{kRmPath, "-rf", dir}) != 0) {
+    if (RemoveTree(dir, true) != OK) {
         LOG(ERROR) << "recursive delete failed";
         return false;
     }
     return true;
 }
 
-bool destroyKey(const std::string& dir) {
+// Deletes the Keystore keys of the key in |dir| and adds its files to |secdiscard_cmd|.
+static bool prepareDestroyKey(const std::string& dir, std::vector<std::string>* secdiscard_cmd) {
     bool success = true;
 
     CancelPendingKeyCommit(dir);
 
-    auto secdiscard_cmd = std::vector<std::string>{
-        kSecdiscardPath,
-        "--",
-        dir + "/" + kFn_encrypted_key,
-    };
+    secdiscard_cmd->push_back(dir + "/" + kFn_encrypted_key);
     auto secdiscardable = dir + "/" + kFn_secdiscardable;
     if (pathExists(secdiscardable)) {
-        secdiscard_cmd.push_back(secdiscardable);
+        secdiscard_cmd->push_back(secdiscardable);
     }
     // Try each thing, even if previous things failed.
 
@@ -695,14 +761,31 @@ bool destroyKey(const std::string& dir) {
         auto blob_file = dir + "/" + fn;
         if (pathExists(blob_file)) {
             success &= DeleteKeystoreKey(blob_file);
-            secdiscard_cmd.push_back(blob_file);
+            secdiscard_cmd->push_back(blob_file);
         }
     }
+    return success;
+}
+
+bool destroyKey(const std::string& dir) {
+    return destroyKeys({dir});
+}
+
+bool destroyKeys(const std::vector<std::string>& dirs) {
+    if (dirs.empty()) return true;
+    bool success = true;
+
+    auto secdiscard_cmd = std::vector<std::string>{kSecdiscardPath, "--"};
+    for (const auto& dir : dirs) {
+        success &= prepareDestroyKey(dir, &secdiscard_cmd);
+    }
     if (ForkExecvp(secdiscard_cmd) != 0) {
         LOG(ERROR) << "secdiscard failed";
         success = false;
     }
-    success &= recursiveDeleteKey(dir);
+    for (const auto& dir : dirs) {
+        success &= recursiveDeleteKey(dir);
+    }
     return success;
 }
 
@@ -67,6 +67,8 @@ bool retrieveKey(const std::string& dir, const KeyAuthentication& auth, KeyBuffe
 
 // Securely destroy the key stored in the named directory and delete the directory.
 bool destroyKey(const std::string& dir);
+// Like destroyKey() for each directory, but with a single secdiscard run for all of them.
+bool destroyKeys(const std::vector<std::string>& dirs);
 
 bool runSecdiscardSingle(const std::string& file);
 
@@ -16,6 +16,9 @@
 
 #include "KeyUtil.h"
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <iomanip>
 #include <sstream>
 #include <string>
@@ -44,6 +47,10 @@ using android::fscrypt::EncryptionPolicy;
 // This prevents race conditions between evicting and reinstalling keys.
 static std::mutex fscrypt_keyring_mutex;
 
+// Notified whenever a key is added, so that busy file cleanup for a key that just got re-added
+// stops right away instead of at its next retry.
+static std::condition_variable fscrypt_key_added;
+
 const KeyGeneration neverGen() {
     return KeyGeneration{0, false, false};
 }
@@ -266,6 +273,7 @@ static bool installFsKeyringKey(const std::string& mountpoint, const EncryptionO
         PLOG(ERROR) << "Failed to install fscrypt key to " << mountpoint;
         return false;
     }
+    fscrypt_key_added.notify_all();
 
     return true;
 }
@@ -373,6 +381,13 @@ static bool evictProvisioningKey(const std::string& ref) {
     return true;
 }
 
+// How long to wait for busy files before each retry.  Retries start soon, because the processes
+// holding the files are usually killed within a second or so, and back off because each retry
+// syncs the filesystem.  The total is about as long as processes ever take to go away.
+static constexpr std::chrono::milliseconds kBusyFilesFirstWait(200);
+static constexpr std::chrono::milliseconds kBusyFilesMaxWait(12800);
+static constexpr std::chrono::milliseconds kBusyFilesTotalWait(102400);
+
 static void waitForBusyFiles(const struct fscrypt_key_specifier key_spec, const std::string ref,
                              const std::string mountpoint) {
     android::base::unique_fd fd(open(mountpoint.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
@@ -381,28 +396,33 @@ static void waitForBusyFiles(const struct fscrypt_key_specifier key_spec, const
         return;
     }
 
-    std::chrono::milliseconds wait_time(3200);
-    std::chrono::milliseconds total_wait_time(0);
-    while (wait_time <= std::chrono::milliseconds(51200)) {
-        total_wait_time += wait_time;
-        std::this_thread::sleep_for(wait_time);
-
-        const std::lock_guard<std::mutex> lock(fscrypt_keyring_mutex);
-
-        struct fscrypt_get_key_status_arg get_arg;
-        memset(&get_arg, 0, sizeof(get_arg));
-        get_arg.key_spec = key_spec;
-
-        if (ioctl(fd, FS_IOC_GET_ENCRYPTION_KEY_STATUS, &get_arg) != 0) {
-            PLOG(ERROR) << "Failed to get status for fscrypt key with ref " << ref << " from "
-                        << mountpoint;
-            return;
-        }
-        if (get_arg.status != FSCRYPT_KEY_STATUS_INCOMPLETELY_REMOVED) {
-            LOG(DEBUG) << "Key status changed, cancelling busy file cleanup for key with ref "
-                       << ref << ".";
-            return;
+    auto start = std::chrono::steady_clock::now();
+    std::chrono::milliseconds wait_time = kBusyFilesFirstWait;
+    std::unique_lock<std::mutex> lock(fscrypt_keyring_mutex);
+    while (std::chrono::steady_clock::now() - start < kBusyFilesTotalWait) {
+        // Wake early if a key gets added, in case it's this one and the user got unlocked again
+        auto retry_time = std::chrono::steady_clock::now() + wait_time;
+        bool retry = false;
+        while (!retry) {
+            retry = fscrypt_key_added.wait_until(lock, retry_time) == std::cv_status::timeout;
+
+            struct fscrypt_get_key_status_arg get_arg;
+            memset(&get_arg, 0, sizeof(get_arg));
+            get_arg.key_spec = key_spec;
+
+            if (ioctl(fd, FS_IOC_GET_ENCRYPTION_KEY_STATUS, &get_arg) != 0) {
+                PLOG(ERROR) << "Failed to get status for fscrypt key with ref " << ref << " from "
+                            << mountpoint;
+                return;
+            }
+            if (get_arg.status != FSCRYPT_KEY_STATUS_INCOMPLETELY_REMOVED) {
+                LOG(DEBUG) << "Key status changed, cancelling busy file cleanup for key with ref "
+                           << ref << ".";
+                return;
+            }
         }
+        auto total_wait_time = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - start);
 
         struct fscrypt_remove_key_arg remove_arg;
         memset(&remove_arg, 0, sizeof(remove_arg));
@@ -425,7 +445,7 @@ static void waitForBusyFiles(const struct fscrypt_key_specifier key_spec, const
         }
         LOG(WARNING) << "Files still open after waiting " << total_wait_time.count()
                      << "ms.  Key with ref " << ref << " still has unlocked files!";
-        wait_time *= 2;
+        wait_time = std::min(wait_time * 2, kBusyFilesMaxWait);
     }
     LOG(ERROR) << "Waiting for files to close never completed.  Files using key with ref " << ref
                << " were not locked!";
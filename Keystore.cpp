@@ -17,6 +17,9 @@
 #include "Keystore.h"
 
 #include <android-base/logging.h>
+#include <android/binder_ibinder.h>
+
+#include <mutex>
 
 #include <aidl/android/hardware/security/keymint/SecurityLevel.h>
 #include <aidl/android/security/maintenance/IKeystoreMaintenance.h>
@@ -103,13 +106,30 @@ bool KeystoreOperation::finish(std::string* output) {
     return true;
 }
 
-Keystore::Keystore() {
+// The security level is shared by every Keystore in vold, so that a user unlock doesn't look up
+// keystore2 once per key.  It's dropped when keystore2 dies and looked up again on next use.
+static std::mutex security_level_lock;
+static std::shared_ptr<ks2::IKeystoreSecurityLevel> security_level;  // Guarded by the lock
+// Kept so that its death notification stays registered.  Guarded by the lock.
+static ::ndk::SpAIBinder keystore2_binder;
+
+static void onKeystoreDied(void*) {
+    LOG(WARNING) << "keystore2 died; reconnecting on next use";
+    std::lock_guard<std::mutex> lock(security_level_lock);
+    security_level = nullptr;
+    keystore2_binder = ::ndk::SpAIBinder();
+}
+
+static std::shared_ptr<ks2::IKeystoreSecurityLevel> getSecurityLevel() {
+    std::lock_guard<std::mutex> lock(security_level_lock);
+    if (security_level) return security_level;
+
     ::ndk::SpAIBinder binder(AServiceManager_waitForService(keystore2_service_name));
     auto keystore2Service = ks2::IKeystoreService::fromBinder(binder);
 
     if (!keystore2Service) {
         LOG(ERROR) << "Vold unable to connect to keystore2.";
-        return;
+        return nullptr;
     }
 
     /*
@@ -121,12 +141,28 @@ Keystore::Keystore() {
      * a TEE instance when there isn't a TEE instance available, but in that case, a STRONGBOX
      * instance won't be available either, so we'll still be doing the best we can.
      */
+    std::shared_ptr<ks2::IKeystoreSecurityLevel> securityLevel;
     auto rc = keystore2Service->getSecurityLevel(km::SecurityLevel::TRUSTED_ENVIRONMENT,
                                                  &securityLevel);
-    if (logKeystore2ExceptionIfPresent(rc, "getSecurityLevel"))
+    if (logKeystore2ExceptionIfPresent(rc, "getSecurityLevel")) {
         LOG(ERROR) << "Vold unable to get security level from keystore2.";
+        return nullptr;
+    }
+
+    // The security level lives in the keystore2 process, so it dies along with the service
+    static AIBinder_DeathRecipient* death_recipient = AIBinder_DeathRecipient_new(onKeystoreDied);
+    if (AIBinder_linkToDeath(binder.get(), death_recipient, nullptr) != STATUS_OK) {
+        // Without a death notification a stale connection would never be dropped
+        LOG(WARNING) << "Failed to watch keystore2 for death; not keeping the connection";
+        return securityLevel;
+    }
+    keystore2_binder = binder;
+    security_level = securityLevel;
+    return security_level;
 }
 
+Keystore::Keystore() : securityLevel(getSecurityLevel()) {}
+
 bool Keystore::generateKey(const km::AuthorizationSet& inParams, std::string* key) {
     ks2::KeyDescriptor in_key = {
             .domain = ks2::Domain::BLOB,
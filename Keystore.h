@@ -104,7 +104,8 @@ class KeystoreOperation {
     friend class Keystore;
 };
 
-// Wrapper for keystore2 methods that vold uses.
+// Wrapper for keystore2 methods that vold uses.  All instances share one connection to
+// keystore2, so they are cheap to create and can be used from any thread.
 class Keystore {
   public:
     Keystore();
@@ -41,6 +41,7 @@
 #include <utils/Trace.h>
 
 #include "Loop.h"
+#include "Utils.h"
 #include "VoldUtil.h"
 #include "sehandle.h"
 
@@ -48,10 +49,54 @@ using namespace std::literals;
 using android::base::StringPrintf;
 using android::base::unique_fd;
 
+// Loop ioctls newer than some of the kernels we run on
+#ifndef LOOP_SET_DIRECT_IO
+#define LOOP_SET_DIRECT_IO 0x4C08
+#endif
+#ifndef LOOP_SET_BLOCK_SIZE
+#define LOOP_SET_BLOCK_SIZE 0x4C09
+#endif
+#ifndef LOOP_CONFIGURE
+#define LOOP_CONFIGURE 0x4C0A
+struct loop_config {
+    __u32 fd;
+    __u32 block_size;
+    struct loop_info64 info;
+    __u64 __reserved[8];
+};
+#endif
+#ifndef LO_FLAGS_DIRECT_IO
+#define LO_FLAGS_DIRECT_IO 16
+#endif
+
 static const char* kVoldPrefix = "vold:";
 static constexpr size_t kLoopDeviceRetryAttempts = 3u;
 
-int Loop::create(const std::string& target, std::string& out_device) {
+// Binds the target to the loop device the pre-5.8 way, one ioctl per setting
+static int configureLegacy(int device_fd, const struct loop_config& config) {
+    if (ioctl(device_fd, LOOP_SET_FD, config.fd) == -1) {
+        PLOG(ERROR) << "Failed to LOOP_SET_FD";
+        return -errno;
+    }
+    auto info = config.info;
+    info.lo_flags &= ~LO_FLAGS_DIRECT_IO;
+    if (ioctl(device_fd, LOOP_SET_STATUS64, &info) == -1) {
+        PLOG(ERROR) << "Failed to LOOP_SET_STATUS64";
+        return -errno;
+    }
+    // Both settings are only optimizations, so the device is still usable without them
+    if (config.block_size != 0 && ioctl(device_fd, LOOP_SET_BLOCK_SIZE, config.block_size) == -1) {
+        PLOG(WARNING) << "Failed to LOOP_SET_BLOCK_SIZE";
+    }
+    if ((config.info.lo_flags & LO_FLAGS_DIRECT_IO) &&
+        ioctl(device_fd, LOOP_SET_DIRECT_IO, 1UL) == -1) {
+        PLOG(WARNING) << "Failed to LOOP_SET_DIRECT_IO";
+    }
+    return 0;
+}
+
+int Loop::create(const std::string& target, std::string& out_device, bool directIo,
+                 uint32_t blockSize) {
     unique_fd ctl_fd(open("/dev/loop-control", O_RDWR | O_CLOEXEC));
     if (ctl_fd.get() == -1) {
         PLOG(ERROR) << "Failed to open loop-control";
@@ -78,6 +123,7 @@ int Loop::create(const std::string& target, std::string& out_device) {
         PLOG(ERROR) << "Failed to open " << target;
         return -errno;
     }
+    // Returns straight away if ueventd has already made the node, otherwise waits on inotify
     if (!android::fs_mgr::WaitForFile(out_device, 2s)) {
         LOG(ERROR) << "Failed to find " << out_device;
         return -ENOENT;
@@ -88,22 +134,48 @@ int Loop::create(const std::string& target, std::string& out_device) {
         return -errno;
     }
 
-    if (ioctl(device_fd.get(), LOOP_SET_FD, target_fd.get()) == -1) {
-        PLOG(ERROR) << "Failed to LOOP_SET_FD";
-        return -errno;
-    }
-
-    struct loop_info64 li;
-    memset(&li, 0, sizeof(li));
-    strlcpy((char*)li.lo_crypt_name, kVoldPrefix, LO_NAME_SIZE);
-    if (ioctl(device_fd.get(), LOOP_SET_STATUS64, &li) == -1) {
-        PLOG(ERROR) << "Failed to LOOP_SET_STATUS64";
-        return -errno;
+    struct loop_config config;
+    memset(&config, 0, sizeof(config));
+    config.fd = target_fd.get();
+    config.block_size = blockSize;
+    strlcpy((char*)config.info.lo_crypt_name, kVoldPrefix, LO_NAME_SIZE);
+    if (directIo) config.info.lo_flags |= LO_FLAGS_DIRECT_IO;
+
+    // LOOP_CONFIGURE sets up everything in one go, without a window where the device is bound
+    // but not yet configured. Kernels before 5.8 reject it with EINVAL.
+    if (ioctl(device_fd.get(), LOOP_CONFIGURE, &config) == -1) {
+        if (errno != EINVAL && errno != ENOTTY) {
+            PLOG(ERROR) << "Failed to LOOP_CONFIGURE";
+            return -errno;
+        }
+        if (int ret = configureLegacy(device_fd.get(), config); ret != 0) return ret;
     }
 
     return 0;
 }
 
+uint32_t Loop::directIoBlockSize(const std::string& file) {
+#ifdef STATX_DIOALIGN
+    struct statx stx;
+    if (statx(AT_FDCWD, file.c_str(), 0, STATX_DIOALIGN, &stx) == 0 &&
+        (stx.stx_mask & STATX_DIOALIGN) && stx.stx_dio_offset_align != 0) {
+        return stx.stx_dio_offset_align;
+    }
+#endif
+    // Before 6.1, go by the logical block size of the device the file lives on
+    struct stat sb;
+    if (stat(file.c_str(), &sb) != 0) {
+        PLOG(WARNING) << "Failed to stat " << file;
+        return 0;
+    }
+    uint64_t blockSize;
+    if (!android::vold::GetBlockQueueAttribute(sb.st_dev, "logical_block_size", &blockSize)) {
+        LOG(WARNING) << "Failed to find the logical block size under " << file;
+        return 0;
+    }
+    return blockSize;
+}
+
 int Loop::destroyByDevice(const char* loopDevice) {
     int device_fd;
 
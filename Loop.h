@@ -18,6 +18,7 @@
 #define _LOOP_H
 
 #include <linux/loop.h>
+#include <stdint.h>
 #include <unistd.h>
 #include <string>
 
@@ -26,7 +27,13 @@ class Loop {
     static const int LOOP_MAX = 4096;
 
   public:
-    static int create(const std::string& file, std::string& out_device);
+    // Direct I/O skips the page cache of the backing file, so only the loop device caches;
+    // blockSize 0 keeps the kernel's default of 512.
+    static int create(const std::string& file, std::string& out_device, bool directIo = false,
+                      uint32_t blockSize = 0);
+    // Smallest logical block size a loop device over the file needs for direct I/O, or 0 if
+    // it can't be found out. Below it, the kernel quietly sticks to buffered I/O.
+    static uint32_t directIoBlockSize(const std::string& file);
     static int destroyByDevice(const char* loopDevice);
     static int destroyAll();
     static int createImageFile(const char* file, unsigned long numSectors);
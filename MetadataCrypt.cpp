@@ -18,13 +18,16 @@
 #include "KeyBuffer.h"
 
 #include <string>
+#include <vector>
 
 #include <fcntl.h>
+#include <string.h>
 #include <sys/param.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 
 #include <android-base/logging.h>
+#include <android-base/parseint.h>
 #include <android-base/properties.h>
 #include <android-base/strings.h>
 #include <android-base/unique_fd.h>
@@ -55,15 +58,24 @@ using android::vold::KeyBuffer;
 using namespace android::dm;
 using namespace std::chrono_literals;
 
+// DmTargetDefaultKey always uses 4096-byte crypto sectors, except in the legacy format.
+constexpr unsigned int kDefaultCryptoSectorSize = 4096;
+
 // Parsed from metadata options
 struct CryptoOptions {
     struct CryptoType cipher = invalid_crypto_type;
     bool use_legacy_options_format = false;
     bool set_dun = true;  // Non-legacy driver always sets DUN
     bool use_hw_wrapped_key = false;
+    // Size of the crypto data units, from the sector_size=<bytes> flag.  It's fixed once data
+    // has been written, since it changes the DUN (the IV) of every block.
+    unsigned int sector_size = kDefaultCryptoSectorSize;
 };
 
 static const std::string kDmNameUserdata = "userdata";
+// Lives next to the metadata key, and exists only while in-place encryption is
+// in progress.  See encrypt_inplace().
+static const std::string kInplaceProgressFile = "/encrypt_inplace_progress";
 static const std::string kDmNameUserdataZoned = "userdata_zoned";
 
 // The first entry in this table is the default crypto type.
@@ -146,6 +158,48 @@ static bool read_key(const std::string& metadata_key_dir, const KeyGeneration& g
     return retrieveOrGenerateKey(dir, temp, kEmptyAuthentication, gen, key);
 }
 
+// A dm-default-key target with crypto sectors of other than kDefaultCryptoSectorSize, which
+// DmTargetDefaultKey can't ask for.  It takes the same arguments, in the non-legacy format.
+// Sectors over 512 bytes need iv_large_sectors, where the DUN counts crypto sectors rather
+// than 512-byte ones, so it goes with the sector size instead of being an option of its own.
+class DmTargetDefaultKeySectors : public DmTarget {
+  public:
+    DmTargetDefaultKeySectors(uint64_t start, uint64_t length, const std::string& cipher,
+                              const std::string& key, const std::string& blockdev,
+                              const CryptoOptions& options)
+        : DmTarget(start, length),
+          cipher_(cipher),
+          key_(key),
+          blockdev_(blockdev),
+          sector_size_(options.sector_size),
+          is_hw_wrapped_(options.use_hw_wrapped_key) {}
+
+    std::string name() const override { return "default-key"; }
+    bool Valid() const override { return true; }
+
+  protected:
+    std::string GetParameterString() const override {
+        std::vector<std::string> extra_argv = {"allow_discards"};
+        if (sector_size_ != 512) {
+            extra_argv.emplace_back("sector_size:" + std::to_string(sector_size_));
+            extra_argv.emplace_back("iv_large_sectors");
+        }
+        if (is_hw_wrapped_) extra_argv.emplace_back("wrappedkey_v0");
+
+        std::vector<std::string> argv = {cipher_, key_, "0", blockdev_, "0",
+                                         std::to_string(extra_argv.size())};
+        argv.insert(argv.end(), extra_argv.begin(), extra_argv.end());
+        return android::base::Join(argv, " ");
+    }
+
+  private:
+    std::string cipher_;
+    std::string key_;
+    std::string blockdev_;
+    unsigned int sector_size_;
+    bool is_hw_wrapped_;
+};
+
 static bool get_number_of_sectors(const std::string& real_blkdev, uint64_t* nr_sec) {
     if (android::vold::GetBlockDev512Sectors(real_blkdev, nr_sec) != android::OK) {
         PLOG(ERROR) << "Unable to measure size of " << real_blkdev;
@@ -156,11 +210,12 @@ static bool get_number_of_sectors(const std::string& real_blkdev, uint64_t* nr_s
 
 static bool create_crypto_blk_dev(const std::string& dm_name, const std::string& blk_device,
                                   const KeyBuffer& key, const CryptoOptions& options,
-                                  std::string* crypto_blkdev, uint64_t* nr_sec) {
+                                  std::string* crypto_blkdev, uint64_t* nr_sec,
+                                  bool read_only = false) {
     if (!get_number_of_sectors(blk_device, nr_sec)) return false;
-    // TODO(paulcrowley): don't hardcode that DmTargetDefaultKey uses 4096-byte
-    // sectors
-    *nr_sec &= ~7;
+    // The legacy format always used 512-byte crypto sectors, but was truncated the same way.
+    *nr_sec &= ~static_cast<uint64_t>(
+            (options.use_legacy_options_format ? 8 : options.sector_size / 512) - 1);
 
     KeyBuffer module_key;
     if (options.use_hw_wrapped_key) {
@@ -179,14 +234,19 @@ static bool create_crypto_blk_dev(const std::string& dm_name, const std::string&
     }
     std::string hex_key(hex_key_buffer.data(), hex_key_buffer.size());
 
-    auto target = std::make_unique<DmTargetDefaultKey>(0, *nr_sec, options.cipher.get_kernel_name(),
-                                                       hex_key, blk_device, 0);
-    if (options.use_legacy_options_format) target->SetUseLegacyOptionsFormat();
-    if (options.set_dun) target->SetSetDun();
-    if (options.use_hw_wrapped_key) target->SetWrappedKeyV0();
-
     DmTable table;
-    table.AddTarget(std::move(target));
+    if (!options.use_legacy_options_format && options.sector_size != kDefaultCryptoSectorSize) {
+        table.AddTarget(std::make_unique<DmTargetDefaultKeySectors>(
+                0, *nr_sec, options.cipher.get_kernel_name(), hex_key, blk_device, options));
+    } else {
+        auto target = std::make_unique<DmTargetDefaultKey>(
+                0, *nr_sec, options.cipher.get_kernel_name(), hex_key, blk_device, 0);
+        if (options.use_legacy_options_format) target->SetUseLegacyOptionsFormat();
+        if (options.set_dun) target->SetSetDun();
+        if (options.use_hw_wrapped_key) target->SetWrappedKeyV0();
+        table.AddTarget(std::move(target));
+    }
+    table.set_readonly(read_only);
 
     auto& dm = DeviceMapper::Instance();
     if (dm_name == kDmNameUserdata && dm.GetState(dm_name) == DmDeviceState::SUSPENDED) {
@@ -216,9 +276,10 @@ static const CryptoType& lookup_cipher(const std::string& cipher_name) {
     return invalid_crypto_type;
 }
 
+// Parses "<cipher>[:<flag>...]", where the flags are wrappedkey_v0 and sector_size=<bytes>.
 static bool parse_options(const std::string& options_string, CryptoOptions* options) {
     auto parts = android::base::Split(options_string, ":");
-    if (parts.size() < 1 || parts.size() > 2) {
+    if (parts.size() < 1 || parts.size() > 3) {
         LOG(ERROR) << "Invalid metadata encryption option: " << options_string;
         return false;
     }
@@ -229,17 +290,54 @@ static bool parse_options(const std::string& options_string, CryptoOptions* opti
         return false;
     }
 
-    if (parts.size() == 2) {
-        if (parts[1] == "wrappedkey_v0") {
+    for (size_t i = 1; i < parts.size(); i++) {
+        if (parts[i] == "wrappedkey_v0") {
             options->use_hw_wrapped_key = true;
+        } else if (android::base::StartsWith(parts[i], "sector_size=")) {
+            auto size = parts[i].substr(strlen("sector_size="));
+            if (!android::base::ParseUint(size, &options->sector_size, 4096u) ||
+                options->sector_size < 512 || (options->sector_size & (options->sector_size - 1))) {
+                LOG(ERROR) << "Invalid metadata encryption sector size: " << size;
+                return false;
+            }
         } else {
-            LOG(ERROR) << "Invalid metadata encryption flag: " << parts[1];
+            LOG(ERROR) << "Invalid metadata encryption flag: " << parts[i];
             return false;
         }
     }
     return true;
 }
 
+// Works out the options of the dm-default-key device of a metadata-encrypted fstab entry.
+static bool get_entry_options(const FstabEntry& data_rec, CryptoOptions* options) {
+    unsigned int options_format_version = android::base::GetUintProperty<unsigned int>(
+            "ro.crypto.dm_default_key.options_format.version",
+            (GetFirstApiLevel() <= __ANDROID_API_Q__ ? 1 : 2));
+
+    if (options_format_version == 1) {
+        if (!data_rec.metadata_encryption_options.empty()) {
+            LOG(ERROR) << "metadata_encryption options cannot be set in legacy mode";
+            return false;
+        }
+        options->cipher = legacy_aes_256_xts;
+        options->use_legacy_options_format = true;
+        if (is_metadata_wrapped_key_supported())
+            options->use_hw_wrapped_key = true;
+        options->set_dun = android::base::GetBoolProperty("ro.crypto.set_dun", false);
+        if (!options->set_dun && data_rec.fs_mgr_flags.checkpoint_blk) {
+            LOG(ERROR)
+                    << "Block checkpoints and metadata encryption require ro.crypto.set_dun option";
+            return false;
+        }
+    } else if (options_format_version == 2) {
+        if (!parse_options(data_rec.metadata_encryption_options, options)) return false;
+    } else {
+        LOG(ERROR) << "Unknown options_format_version: " << options_format_version;
+        return false;
+    }
+    return true;
+}
+
 bool fscrypt_mount_metadata_encrypted(const std::string& blk_device, const std::string& mount_point,
                                       bool needs_encrypt, bool should_format,
                                       const std::string& fs_type, const std::string& zoned_device) {
@@ -260,32 +358,8 @@ bool fscrypt_mount_metadata_encrypted(const std::string& blk_device, const std::
         return false;
     }
 
-    unsigned int options_format_version = android::base::GetUintProperty<unsigned int>(
-            "ro.crypto.dm_default_key.options_format.version",
-            (GetFirstApiLevel() <= __ANDROID_API_Q__ ? 1 : 2));
-
     CryptoOptions options;
-    if (options_format_version == 1) {
-        if (!data_rec->metadata_encryption_options.empty()) {
-            LOG(ERROR) << "metadata_encryption options cannot be set in legacy mode";
-            return false;
-        }
-        options.cipher = legacy_aes_256_xts;
-        options.use_legacy_options_format = true;
-        if (is_metadata_wrapped_key_supported())
-            options.use_hw_wrapped_key = true;
-        options.set_dun = android::base::GetBoolProperty("ro.crypto.set_dun", false);
-        if (!options.set_dun && data_rec->fs_mgr_flags.checkpoint_blk) {
-            LOG(ERROR)
-                    << "Block checkpoints and metadata encryption require ro.crypto.set_dun option";
-            return false;
-        }
-    } else if (options_format_version == 2) {
-        if (!parse_options(data_rec->metadata_encryption_options, &options)) return false;
-    } else {
-        LOG(ERROR) << "Unknown options_format_version: " << options_format_version;
-        return false;
-    }
+    if (!get_entry_options(*data_rec, &options)) return false;
 
     auto default_metadata_key_dir = data_rec->metadata_key_dir;
     if (!zoned_device.empty()) {
@@ -323,10 +397,15 @@ bool fscrypt_mount_metadata_encrypted(const std::string& blk_device, const std::
         }
     }
 
+    auto progress_path = default_metadata_key_dir + kInplaceProgressFile;
     if (needs_encrypt) {
         if (should_format) {
             status_t error;
 
+            if (unlink(progress_path.c_str()) != 0 && errno != ENOENT) {
+                PLOG(WARNING) << "Failed to remove " << progress_path;
+            }
+
             if (fs_type == "ext4") {
                 error = ext4::Format(crypto_blkdev, 0, mount_point);
             } else if (fs_type == "f2fs") {
@@ -346,11 +425,20 @@ bool fscrypt_mount_metadata_encrypted(const std::string& blk_device, const std::
                 LOG(ERROR) << "encrypt_inplace cannot support zoned device; should format it.";
                 return false;
             }
-            if (!encrypt_inplace(crypto_blkdev, blk_device, nr_sec)) {
+            if (!encrypt_inplace(crypto_blkdev, blk_device, nr_sec, progress_path)) {
                 LOG(ERROR) << "encrypt_inplace failed in mountFstab";
                 return false;
             }
         }
+    } else if (pathExists(progress_path)) {
+        // A previous boot was interrupted while encrypting in-place.  Mounting the
+        // half-encrypted filesystem would corrupt it, so finish the job first.
+        LOG(INFO) << "Resuming interrupted in-place encryption of " << blk_device;
+        if (!zoned_device.empty() ||
+            !encrypt_inplace(crypto_blkdev, blk_device, nr_sec, progress_path)) {
+            LOG(ERROR) << "Failed to resume encrypt_inplace in mountFstab";
+            return false;
+        }
     }
 
     LOG(DEBUG) << "Mounting metadata-encrypted filesystem:" << mount_point;
@@ -385,6 +473,44 @@ bool defaultkey_setup_ext_volume(const std::string& label, const std::string& bl
     return create_crypto_blk_dev(label, blk_device, key, options, out_crypto_blkdev, &nr_sec);
 }
 
+bool defaultkey_create_benchmark_device(const std::string& dm_name, const std::string& blk_device,
+                                        unsigned int sector_size, dev_t* dev) {
+    auto data_rec = GetEntryForMountPoint(&fstab_default, "/data");
+    CryptoOptions options;
+    if (!data_rec || !get_entry_options(*data_rec, &options)) return false;
+    // A wrapped key can't be made up, so even devices that use them are measured with a
+    // standard key of the same cipher.
+    options.use_legacy_options_format = false;
+    options.use_hw_wrapped_key = false;
+    options.sector_size = sector_size;
+
+    KeyBuffer key(options.cipher.get_keysize());
+    if (ReadRandomBytes(key.size(), key.data()) != OK) {
+        LOG(ERROR) << "Failed to generate benchmark key";
+        return false;
+    }
+    std::string crypto_blkdev;
+    uint64_t nr_sec;
+    if (!create_crypto_blk_dev(dm_name, blk_device, key, options, &crypto_blkdev, &nr_sec,
+                               true)) {
+        return false;
+    }
+    if (!DeviceMapper::Instance().GetDeviceNumber(dm_name, dev)) {
+        LOG(ERROR) << "Failed to get device number of " << dm_name;
+        defaultkey_destroy_benchmark_device(dm_name);
+        return false;
+    }
+    return true;
+}
+
+bool defaultkey_destroy_benchmark_device(const std::string& dm_name) {
+    if (!DeviceMapper::Instance().DeleteDeviceIfExists(dm_name)) {
+        LOG(ERROR) << "Failed to delete benchmark device " << dm_name;
+        return false;
+    }
+    return true;
+}
+
 bool destroy_dsu_metadata_key(const std::string& dsu_slot) {
     LOG(DEBUG) << "destroy_dsu_metadata_key: " << dsu_slot;
 
@@ -19,6 +19,8 @@
 
 #include <string>
 
+#include <sys/types.h>
+
 #include "KeyBuffer.h"
 #include "KeyUtil.h"
 
@@ -37,6 +39,15 @@ bool defaultkey_setup_ext_volume(const std::string& label, const std::string& bl
                                  const android::vold::KeyBuffer& key,
                                  std::string* out_crypto_blkdev);
 
+/*
+ * Creates a read-only dm-default-key device named dm_name over blk_device, with the cipher of
+ * /data, crypto sectors of sector_size bytes and a throwaway key, for the raw block benchmark
+ * to compare sector sizes on.  Being read-only, it can sit on top of a partition in use.
+ */
+bool defaultkey_create_benchmark_device(const std::string& dm_name, const std::string& blk_device,
+                                        unsigned int sector_size, dev_t* dev);
+bool defaultkey_destroy_benchmark_device(const std::string& dm_name);
+
 bool destroy_dsu_metadata_key(const std::string& dsu_slot);
 
 }  // namespace vold
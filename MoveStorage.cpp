@@ -15,25 +15,28 @@
  */
 
 #include "MoveStorage.h"
+#include "FileTree.h"
 #include "Utils.h"
 #include "VolumeManager.h"
 
 #include <android-base/logging.h>
 #include <android-base/properties.h>
 #include <android-base/stringprintf.h>
+#include <cutils/iosched_policy.h>
 #include <private/android_filesystem_config.h>
 #include <wakelock/wakelock.h>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <thread>
 
 #include <dirent.h>
-#include <sys/wait.h>
 
 #define CONSTRAIN(amount, low, high) \
     ((amount) < (low) ? (low) : ((amount) > (high) ? (high) : (amount)))
 
-static const char* kPropBlockingExec = "persist.sys.blocking_exec";
-
 using android::base::StringPrintf;
 
 namespace android {
@@ -43,10 +46,76 @@ namespace vold {
 static const int kMoveSucceeded = -100;
 static const int kMoveFailedInternalError = -6;
 
-static const char* kCpPath = "/system/bin/cp";
-static const char* kRmPath = "/system/bin/rm";
 
 static const char* kWakeLock = "MoveTask";
+static const char* kMoveManifestPath = "/data/misc/vold/move_manifest";
+
+// Bandwidth a move may use while the user is active, in MiB/s; 0 leaves it uncapped
+static const char* kPropActiveBandwidth = "ro.vold.move_active_bandwidth_mb";
+static constexpr uint64_t kDefaultActiveBandwidthMb = 32;
+// How much unused bandwidth budget carries over, so a move that was waiting on something else
+// isn't slowed down further when it picks up again
+static constexpr auto kThrottleBurst = std::chrono::seconds(1);
+
+/*
+ * How hard a move may drive storage. While the user is active, moves run at the lowest
+ * best-effort I/O priority and under a bandwidth cap, so foreground I/O isn't starved; otherwise
+ * they run at normal priority and full speed. Changes apply to all workers the next time they
+ * call throttle(), including workers that are currently waiting for budget.
+ */
+class MoveIoPolicy {
+  public:
+    void setUserActive(bool active) {
+        std::lock_guard<std::mutex> lock(mLock);
+        if (active == mUserActive) return;
+        LOG(DEBUG) << "Storage moves now " << (active ? "throttled" : "unthrottled");
+        mUserActive = active;
+        mGeneration++;
+        mBudgetUsedUntil = std::chrono::steady_clock::now();
+        mCv.notify_all();
+    }
+
+    void throttle(uint64_t bytes) {
+        static thread_local uint64_t tAppliedGeneration = 0;
+
+        std::unique_lock<std::mutex> lock(mLock);
+        if (tAppliedGeneration != mGeneration) {
+            tAppliedGeneration = mGeneration;
+            if (android_set_ioprio(0, IoSchedClass_BE, mUserActive ? 7 : 4)) {
+                PLOG(WARNING) << "Failed to android_set_ioprio";
+            }
+        }
+
+        uint64_t bytesPerSec = mUserActive ? activeBytesPerSec() : 0;
+        if (bytes == 0 || bytesPerSec == 0) return;
+        auto now = std::chrono::steady_clock::now();
+        mBudgetUsedUntil = std::max(mBudgetUsedUntil, now - kThrottleBurst) +
+                           std::chrono::nanoseconds(bytes * 1000000000 / bytesPerSec);
+        uint64_t generation = mGeneration;
+        mCv.wait_until(lock, mBudgetUsedUntil, [&] { return mGeneration != generation; });
+    }
+
+  private:
+    static uint64_t activeBytesPerSec() {
+        static const uint64_t bytesPerSec =
+                android::base::GetUintProperty(kPropActiveBandwidth, kDefaultActiveBandwidthMb) *
+                1024 * 1024;
+        return bytesPerSec;
+    }
+
+    std::mutex mLock;
+    std::condition_variable mCv;
+    // Matches VolumeManager, which assumes a secure keyguard until told otherwise
+    bool mUserActive = false;
+    uint64_t mGeneration = 1;
+    std::chrono::steady_clock::time_point mBudgetUsedUntil;
+};
+
+static MoveIoPolicy sMoveIoPolicy;
+
+static void throttleMove(uint64_t bytes) {
+    sMoveIoPolicy.throttle(bytes);
+}
 
 static void notifyProgress(int progress,
                            const android::sp<android::os::IVoldTaskListener>& listener) {
@@ -56,123 +125,101 @@ static void notifyProgress(int progress,
     }
 }
 
-static bool pushBackContents(const std::string& path, std::vector<std::string>& cmd,
-                             int searchLevels) {
-    if (searchLevels == 0) {
-        cmd.emplace_back(path);
-        return true;
+// Reports progress through [startProgress, startProgress + stepProgress] as done approaches
+// total, but only when the reported percentage actually moves.
+static void notifyWorkProgress(uint64_t done, uint64_t total, int startProgress,
+                               int stepProgress, int* lastProgress,
+                               const android::sp<android::os::IVoldTaskListener>& listener) {
+    if (total == 0) return;
+    int progress = startProgress + CONSTRAIN((int)((done * stepProgress) / total), 0,
+                                             stepProgress);
+    if (progress != *lastProgress) {
+        *lastProgress = progress;
+        notifyProgress(progress, listener);
     }
+}
+
+// Removal cost is dominated by the number of entries rather than their size, so progress is
+// counted in entries. usage, if known, describes the tree; otherwise it is scanned once first.
+static status_t execRm(const std::string& path, int startProgress, int stepProgress,
+                       const TreeUsage* usage,
+                       const android::sp<android::os::IVoldTaskListener>& listener) {
+    notifyProgress(startProgress, listener);
+
+    // Like "rm -f -R path/*/*": the per-user directories directly below path stay in place.
     auto dirp = std::unique_ptr<DIR, int (*)(DIR*)>(opendir(path.c_str()), closedir);
     if (!dirp) {
         PLOG(ERROR) << "Unable to open directory: " << path;
-        return false;
+        return OK;
     }
-    bool found = false;
+    std::vector<std::string> subdirs;
     struct dirent* ent;
     while ((ent = readdir(dirp.get())) != NULL) {
         if (IsDotOrDotDot(*ent)) continue;
-        auto subdir = path + "/" + ent->d_name;
-        found |= pushBackContents(subdir, cmd, searchLevels - 1);
+        if (ent->d_type == DT_DIR) subdirs.push_back(path + "/" + ent->d_name);
     }
-    return found;
-}
-
-static status_t execRm(const std::string& path, int startProgress, int stepProgress,
-                       const android::sp<android::os::IVoldTaskListener>& listener) {
-    notifyProgress(startProgress, listener);
-
-    uint64_t expectedBytes = GetTreeBytes(path);
-    uint64_t startFreeBytes = GetFreeBytes(path);
-
-    std::vector<std::string> cmd;
-    cmd.push_back(kRmPath);
-    cmd.push_back("-f"); /* force: remove without confirmation, no error if it doesn't exist */
-    cmd.push_back("-R"); /* recursive: remove directory contents */
-    if (!pushBackContents(path, cmd, 2)) {
+    dirp.reset();
+    if (subdirs.empty()) {
         LOG(WARNING) << "No contents in " << path;
         return OK;
     }
 
-    if (android::base::GetBoolProperty(kPropBlockingExec, false)) {
-        return ForkExecvp(cmd);
+    TreeUsage scanned;
+    if (!usage) {
+        GetTreeUsage(path, &scanned);
+        usage = &scanned;
     }
-
-    pid_t pid = ForkExecvpAsync(cmd);
-    if (pid == -1) return -1;
-
-    int status;
-    while (true) {
-        if (waitpid(pid, &status, WNOHANG) == pid) {
-            if (WIFEXITED(status)) {
-                LOG(DEBUG) << "Finished rm with status " << WEXITSTATUS(status);
-                return (WEXITSTATUS(status) == 0) ? OK : -1;
-            } else {
-                break;
-            }
-        }
-
-        sleep(1);
-        uint64_t deltaFreeBytes = GetFreeBytes(path) - startFreeBytes;
-        notifyProgress(
-            startProgress +
-                CONSTRAIN((int)((deltaFreeBytes * stepProgress) / expectedBytes), 0, stepProgress),
-            listener);
+    uint64_t expectedEntries = usage->files + usage->dirs;
+    expectedEntries -= std::min<uint64_t>(expectedEntries, subdirs.size());
+
+    status_t res = OK;
+    uint64_t doneEntries = 0;
+    int lastProgress = startProgress;
+    for (const auto& subdir : subdirs) {
+        uint64_t subdirEntries = 0;
+        status_t subres = RemoveTree(subdir, false, [&](uint64_t /* bytes */, uint64_t files) {
+            subdirEntries = files;
+            notifyWorkProgress(doneEntries + files, expectedEntries, startProgress, stepProgress,
+                               &lastProgress, listener);
+        }, throttleMove);
+        if (subres != OK) res = subres;
+        doneEntries += subdirEntries;
     }
-    return -1;
+    LOG(DEBUG) << "Finished rm of " << doneEntries << " entries with status " << res;
+    return res == OK ? OK : -1;
 }
 
+// Scans fromPath into usage first, which both checks that it fits and gives the total that
+// progress is measured against, in bytes copied or, for a tree of empty files, files copied.
 static status_t execCp(const std::string& fromPath, const std::string& toPath, int startProgress,
-                       int stepProgress,
+                       int stepProgress, CopyManifest* manifest, TreeUsage* usage,
                        const android::sp<android::os::IVoldTaskListener>& listener) {
     notifyProgress(startProgress, listener);
 
-    uint64_t expectedBytes = GetTreeBytes(fromPath);
-    uint64_t startFreeBytes = GetFreeBytes(toPath);
-
-    if (expectedBytes > startFreeBytes) {
-        LOG(ERROR) << "Data size " << expectedBytes << " is too large to fit in free space "
-                   << startFreeBytes;
+    if (GetTreeUsage(fromPath, usage) != OK) {
         return -1;
     }
-
-    std::vector<std::string> cmd;
-    cmd.push_back(kCpPath);
-    cmd.push_back("-p"); /* preserve timestamps, ownership, and permissions */
-    cmd.push_back("-R"); /* recurse into subdirectories (DEST must be a directory) */
-    cmd.push_back("-P"); /* Do not follow symlinks [default] */
-    cmd.push_back("-d"); /* don't dereference symlinks */
-    if (!pushBackContents(fromPath, cmd, 1)) {
-        LOG(WARNING) << "No contents in " << fromPath;
-        return OK;
-    }
-    cmd.push_back(toPath.c_str());
-
-    if (android::base::GetBoolProperty(kPropBlockingExec, false)) {
-        return ForkExecvp(cmd);
+    // What an earlier attempt already copied is taking up space on the target already
+    uint64_t copiedBytes = manifest ? std::min(manifest->copiedBytes(), usage->bytes) : 0;
+    uint64_t startFreeBytes = GetFreeBytes(toPath);
+    if (usage->bytes - copiedBytes > startFreeBytes) {
+        LOG(ERROR) << "Data size " << usage->bytes << " (" << copiedBytes
+                   << " already copied) is too large to fit in free space " << startFreeBytes;
+        return -1;
     }
 
-    pid_t pid = ForkExecvpAsync(cmd);
-    if (pid == -1) return -1;
-
-    int status;
-    while (true) {
-        if (waitpid(pid, &status, WNOHANG) == pid) {
-            if (WIFEXITED(status)) {
-                LOG(DEBUG) << "Finished cp with status " << WEXITSTATUS(status);
-                return (WEXITSTATUS(status) == 0) ? OK : -1;
-            } else {
-                break;
-            }
+    int lastProgress = startProgress;
+    status_t res = CopyTreeContents(fromPath, toPath, [&](uint64_t bytes, uint64_t files) {
+        if (usage->bytes > 0) {
+            notifyWorkProgress(bytes, usage->bytes, startProgress, stepProgress, &lastProgress,
+                               listener);
+        } else {
+            notifyWorkProgress(files, usage->files, startProgress, stepProgress, &lastProgress,
+                               listener);
         }
-
-        sleep(1);
-        uint64_t deltaFreeBytes = startFreeBytes - GetFreeBytes(toPath);
-        notifyProgress(
-            startProgress +
-                CONSTRAIN((int)((deltaFreeBytes * stepProgress) / expectedBytes), 0, stepProgress),
-            listener);
-    }
-    return -1;
+    }, manifest, throttleMove);
+    LOG(DEBUG) << "Finished copy with status " << res;
+    return res;
 }
 
 static void bringOffline(const std::shared_ptr<VolumeBase>& vol) {
@@ -194,6 +241,8 @@ static status_t moveStorageInternal(const std::shared_ptr<VolumeBase>& from,
                                     const android::sp<android::os::IVoldTaskListener>& listener) {
     std::string fromPath;
     std::string toPath;
+    CopyManifest manifest;
+    TreeUsage fromUsage;
 
     // TODO: add support for public volumes
     if (from->getType() != VolumeBase::Type::kEmulated) goto fail;
@@ -210,15 +259,28 @@ static status_t moveStorageInternal(const std::shared_ptr<VolumeBase>& from,
     fromPath = from->getInternalPath();
     toPath = to->getInternalPath();
 
-    // Step 2: clean up any stale data
-    if (execRm(toPath, 10, 10, listener) != OK) {
+    if (!manifest.Open(kMoveManifestPath, from->getId() + " " + fromPath + " " + to->getId() +
+                                                  " " + toPath)) {
+        goto fail;
+    }
+
+    // Step 2: clean up any stale data.  The partial result of an interrupted attempt at this
+    // same move is picked up where it left off instead, once whatever has been deleted from
+    // the source since is gone from it too.
+    if (manifest.resumed()) {
+        notifyProgress(10, listener);
+        if (PruneTreeContents(fromPath, toPath) != OK) {
+            goto fail;
+        }
+    } else if (execRm(toPath, 10, 10, nullptr, listener) != OK) {
         goto fail;
     }
 
     // Step 3: perform actual copy
-    if (execCp(fromPath, toPath, 20, 60, listener) != OK) {
+    if (execCp(fromPath, toPath, 20, 60, &manifest, &fromUsage, listener) != OK) {
         goto copy_fail;
     }
+    manifest.Remove();
 
     // NOTE: MountService watches for this magic value to know
     // that move was successful
@@ -229,8 +291,8 @@ static status_t moveStorageInternal(const std::shared_ptr<VolumeBase>& from,
         bringOnline(to);
     }
 
-    // Step 4: clean up old data
-    if (execRm(fromPath, 85, 15, listener) != OK) {
+    // Step 4: clean up old data, which is exactly what was just copied
+    if (execRm(fromPath, 85, 15, &fromUsage, listener) != OK) {
         goto fail;
     }
 
@@ -240,8 +302,9 @@ static status_t moveStorageInternal(const std::shared_ptr<VolumeBase>& from,
 copy_fail:
     // if we failed to copy the data we should not leave it laying around
     // in target location. Do not check return value, we can not do any
-    // useful anyway.
-    execRm(toPath, 80, 1, listener);
+    // useful anyway.  Only an interrupted move leaves a manifest to resume from.
+    execRm(toPath, 80, 1, nullptr, listener);
+    manifest.Remove();
 fail:
     // clang-format off
     {
@@ -254,6 +317,10 @@ fail:
     return -1;
 }
 
+void SetMoveStorageUserActive(bool active) {
+    sMoveIoPolicy.setUserActive(active);
+}
+
 void MoveStorage(const std::shared_ptr<VolumeBase>& from, const std::shared_ptr<VolumeBase>& to,
                  const android::sp<android::os::IVoldTaskListener>& listener) {
     auto wl = android::wakelock::WakeLock::tryGet(kWakeLock);
@@ -26,6 +26,9 @@ namespace vold {
 void MoveStorage(const std::shared_ptr<VolumeBase>& from, const std::shared_ptr<VolumeBase>& to,
                  const android::sp<android::os::IVoldTaskListener>& listener);
 
+/* While the user is active, moves in progress and later ones yield I/O to the foreground */
+void SetMoveStorageUserActive(bool active);
+
 }  // namespace vold
 }  // namespace android
 
@@ -19,13 +19,32 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+
 #include <android-base/logging.h>
+#include <cutils/uevent.h>
 
 #include <sysutils/NetlinkEvent.h>
+#include <sysutils/SocketClient.h>
 #include "NetlinkHandler.h"
 #include "VolumeManager.h"
 
-NetlinkHandler::NetlinkHandler(int listenerSocket) : NetlinkListener(listenerSocket) {}
+// Large enough for any uevent; the kernel caps the environment of one at 2 KiB
+static constexpr size_t kRecvBufferSize = 8 * 1024;
+// Bounds a batch, so events queued faster than they are handled don't starve the loop
+static constexpr size_t kMaxBatch = 256;
+
+// Kernel uevents are NUL separated "KEY=value" strings after an "action@devpath" header
+static bool IsBlockEvent(const char* buffer, size_t size) {
+    static constexpr std::string_view kBlockSubsystem("\0SUBSYSTEM=block\0", 17);
+    return std::string_view(buffer, size).find(kBlockSubsystem) != std::string_view::npos;
+}
+
+NetlinkHandler::NetlinkHandler(int listenerSocket)
+    : NetlinkListener(listenerSocket), mRecvBuffer(kRecvBufferSize) {}
 
 NetlinkHandler::~NetlinkHandler() {}
 
@@ -33,6 +52,56 @@ int NetlinkHandler::start() {
     return this->startListener();
 }
 
+bool NetlinkHandler::onDataAvailable(SocketClient* cli) {
+    int socket = cli->getSocket();
+    std::vector<std::unique_ptr<NetlinkEvent>> events;
+    // Index in events of the last change event of each device since it was last added
+    std::map<std::string, size_t> lastChange;
+
+    // The socket is non-blocking, so this stops once it's been drained
+    for (size_t i = 0; i < kMaxBatch; i++) {
+        uid_t uid = -1;
+        ssize_t count = uevent_kernel_multicast_uid_recv(socket, mRecvBuffer.data(),
+                                                          mRecvBuffer.size(), &uid);
+        if (count < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            if (errno == ENOBUFS) {
+                LOG(ERROR) << "uevent socket overflowed, block events were lost";
+                continue;
+            }
+            if (errno == EIO) continue;  // Not sent by the kernel, and dropped
+            PLOG(ERROR) << "Failed to receive uevent";
+            break;
+        }
+        if (!IsBlockEvent(mRecvBuffer.data(), count)) continue;
+
+        auto evt = std::make_unique<NetlinkEvent>();
+        if (!evt->decode(mRecvBuffer.data(), count, NETLINK_FORMAT_ASCII)) {
+            LOG(WARNING) << "Failed to decode uevent";
+            continue;
+        }
+        const char* devPath = evt->findParam("DEVPATH");
+        if (devPath != nullptr) {
+            if (evt->getAction() == NetlinkEvent::Action::kChange) {
+                auto previous = lastChange.find(devPath);
+                if (previous != lastChange.end()) {
+                    events[previous->second].reset();
+                }
+                lastChange[devPath] = events.size();
+            } else {
+                // A change before an add or remove was about what came before, so it stays
+                lastChange.erase(devPath);
+            }
+        }
+        events.push_back(std::move(evt));
+    }
+
+    for (const auto& evt : events) {
+        if (evt) onEvent(evt.get());
+    }
+    return true;
+}
+
 void NetlinkHandler::onEvent(NetlinkEvent* evt) {
     VolumeManager* vm = VolumeManager::Instance();
     const char* subsys = evt->getSubsystem();
@@ -19,6 +19,8 @@
 
 #include <sysutils/NetlinkListener.h>
 
+#include <vector>
+
 class NetlinkHandler : public NetlinkListener {
   public:
     explicit NetlinkHandler(int listenerSocket);
@@ -27,6 +29,15 @@ class NetlinkHandler : public NetlinkListener {
     int start(void);
 
   protected:
+    /*
+     * Drains every uevent queued on the socket, so a burst is handled as one batch: events
+     * of other subsystems are dropped before they are parsed, and of several change events
+     * for a device only the last one is kept.
+     */
+    bool onDataAvailable(SocketClient* cli) override;
     virtual void onEvent(NetlinkEvent* evt);
+
+  private:
+    std::vector<char> mRecvBuffer;
 };
 #endif
@@ -46,7 +46,8 @@ NetlinkManager::~NetlinkManager() {}
 
 int NetlinkManager::start() {
     struct sockaddr_nl nladdr;
-    int sz = 64 * 1024;
+    // Holds the bursts of uevents sent when hubs or many dm devices come up at once
+    int sz = 1024 * 1024;
     int on = 1;
 
     memset(&nladdr, 0, sizeof(nladdr));
@@ -54,7 +55,9 @@ int NetlinkManager::start() {
     nladdr.nl_pid = getpid();
     nladdr.nl_groups = 0xffffffff;
 
-    if ((mSock = socket(PF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT)) < 0) {
+    // Non-blocking so NetlinkHandler can drain the socket without waiting for more
+    if ((mSock = socket(PF_NETLINK, SOCK_DGRAM | SOCK_CLOEXEC | SOCK_NONBLOCK,
+                        NETLINK_KOBJECT_UEVENT)) < 0) {
         PLOG(ERROR) << "Unable to create uevent socket";
         return -1;
     }
@@ -0,0 +1,254 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PartitionTable.h"
+#include "Crc32.h"
+
+#include <android-base/logging.h>
+#include <android-base/parseint.h>
+#include <android-base/stringprintf.h>
+#include <android-base/strings.h>
+
+#include <linux/fs.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using android::base::StringPrintf;
+
+namespace android {
+namespace vold {
+
+namespace {
+
+constexpr const char* kSgdiskToken = " \t\n";
+
+constexpr size_t kMbrEntriesOffset = 446;
+constexpr int kMbrEntries = 4;
+constexpr uint8_t kMbrTypeProtective = 0xee;
+// Largest partition entry array that is read, 128 times what sgdisk creates
+constexpr size_t kMaxGptEntriesBytes = 2 * 1024 * 1024;
+
+uint16_t Le16(const uint8_t* p) {
+    return p[0] | p[1] << 8;
+}
+
+uint32_t Le32(const uint8_t* p) {
+    return Le16(p) | static_cast<uint32_t>(Le16(p + 2)) << 16;
+}
+
+uint64_t Le64(const uint8_t* p) {
+    return Le32(p) | static_cast<uint64_t>(Le32(p + 4)) << 32;
+}
+
+bool ReadFullyAt(int fd, uint64_t offset, uint8_t* buf, size_t len) {
+    size_t done = 0;
+    while (done < len) {
+        ssize_t n = TEMP_FAILURE_RETRY(pread(fd, buf + done, len - done, offset + done));
+        if (n <= 0) {
+            if (n == -1) PLOG(WARNING) << "Failed to read partition table";
+            return false;
+        }
+        done += n;
+    }
+    return true;
+}
+
+uint32_t Crc32(const uint8_t* data, size_t len) {
+    uint32_t crc = ~0u;
+    crc32(data, len, &crc);
+    return ~crc;
+}
+
+/* Mixed-endian, like sgdisk prints GUIDs */
+std::string FormatGuid(const uint8_t* guid) {
+    return StringPrintf("%08X-%04X-%04X-%02X%02X-%02X%02X%02X%02X%02X%02X", Le32(guid),
+                        Le16(guid + 4), Le16(guid + 6), guid[8], guid[9], guid[10], guid[11],
+                        guid[12], guid[13], guid[14], guid[15]);
+}
+
+bool ReadGpt(int fd, uint32_t sectorSize, uint64_t sectors, PartitionTable* table) {
+    std::vector<uint8_t> header(sectorSize);
+    if (!ReadFullyAt(fd, sectorSize, header.data(), header.size())) return false;
+    if (memcmp(header.data(), "EFI PART", 8) != 0) return false;
+
+    uint32_t headerSize = Le32(&header[12]);
+    if (headerSize < 92 || headerSize > sectorSize) return false;
+    uint32_t headerCrc = Le32(&header[16]);
+    memset(&header[16], 0, 4);
+    if (Crc32(header.data(), headerSize) != headerCrc || Le64(&header[24]) != 1) {
+        LOG(WARNING) << "Primary GPT header is corrupt";
+        return false;
+    }
+
+    uint64_t entriesLba = Le64(&header[72]);
+    uint32_t entryCount = Le32(&header[80]);
+    uint32_t entrySize = Le32(&header[84]);
+    if (entrySize < 128 || entrySize % 8 != 0 || entriesLba < 2 || entriesLba >= sectors ||
+        static_cast<uint64_t>(entryCount) * entrySize > kMaxGptEntriesBytes) {
+        return false;
+    }
+    std::vector<uint8_t> entries(static_cast<size_t>(entryCount) * entrySize);
+    if (!ReadFullyAt(fd, entriesLba * sectorSize, entries.data(), entries.size())) return false;
+    if (Crc32(entries.data(), entries.size()) != Le32(&header[88])) {
+        LOG(WARNING) << "GPT partition entries are corrupt";
+        return false;
+    }
+
+    table->type = PartitionTable::Type::kGpt;
+    table->checksum = headerCrc;
+    for (uint32_t i = 0; i < entryCount; i++) {
+        const uint8_t* entry = &entries[static_cast<size_t>(i) * entrySize];
+        if (Le64(entry + 32) == 0) continue;
+        PartitionTable::Partition partition;
+        partition.number = i + 1;
+        partition.typeGuid = FormatGuid(entry);
+        partition.partGuid = FormatGuid(entry + 16);
+        table->partitions.push_back(std::move(partition));
+    }
+    return true;
+}
+
+}  // namespace
+
+bool ReadPartitionTable(int fd, PartitionTable* table) {
+    table->type = PartitionTable::Type::kUnknown;
+    table->partitions.clear();
+    table->checksum = 0;
+
+    int sectorSize = 0;
+    uint64_t bytes = 0;
+    struct stat st;
+    if (fstat(fd, &st) == -1) {
+        PLOG(WARNING) << "Failed to stat disk";
+        return false;
+    }
+    if (S_ISBLK(st.st_mode)) {
+        if (ioctl(fd, BLKSSZGET, &sectorSize) == -1 || ioctl(fd, BLKGETSIZE64, &bytes) == -1) {
+            PLOG(WARNING) << "Failed to get disk geometry";
+            return false;
+        }
+    } else {
+        sectorSize = 512;
+        bytes = st.st_size;
+    }
+    if (sectorSize < 512 || sectorSize > 4096 || (sectorSize & (sectorSize - 1)) != 0) {
+        return false;
+    }
+    uint64_t sectors = bytes / sectorSize;
+    if (sectors < 2) return false;
+
+    uint8_t mbr[512];
+    if (!ReadFullyAt(fd, 0, mbr, sizeof(mbr))) return false;
+    if (mbr[510] != 0x55 || mbr[511] != 0xaa) {
+        // A GPT without a protective MBR is still one, otherwise there's no table at all
+        if (ReadGpt(fd, sectorSize, sectors, table)) return true;
+        uint8_t header[8];
+        if (!ReadFullyAt(fd, sectorSize, header, sizeof(header))) return false;
+        return memcmp(header, "EFI PART", 8) != 0;
+    }
+
+    bool protective = false;
+    std::vector<PartitionTable::Partition> partitions;
+    for (int i = 0; i < kMbrEntries; i++) {
+        const uint8_t* entry = &mbr[kMbrEntriesOffset + i * 16];
+        uint8_t type = entry[4];
+        uint64_t start = Le32(entry + 8);
+        uint64_t length = Le32(entry + 12);
+        // Boot code of a disk without a partition table, or something more than a plain MBR
+        if (entry[0] != 0x00 && entry[0] != 0x80) return false;
+        if (type == 0x05 || type == 0x0f || type == 0x85) return false;
+        if (type == kMbrTypeProtective) {
+            protective = true;
+            continue;
+        }
+        if (length == 0) continue;
+        if (start == 0 || start + length > sectors) return false;
+
+        PartitionTable::Partition partition;
+        partition.number = i + 1;
+        partition.mbrType = type;
+        partitions.push_back(partition);
+    }
+
+    if (protective) {
+        // Including hybrid MBRs, where the GPT is what counts
+        return ReadGpt(fd, sectorSize, sectors, table);
+    }
+    uint8_t header[8];
+    if (!ReadFullyAt(fd, sectorSize, header, sizeof(header))) return false;
+    if (memcmp(header, "EFI PART", 8) == 0) return false;
+
+    table->type = PartitionTable::Type::kMbr;
+    table->partitions = std::move(partitions);
+    table->checksum = Crc32(mbr, sizeof(mbr));
+    return true;
+}
+
+void ParseSgdiskDump(const std::vector<std::string>& lines, PartitionTable* table) {
+    table->type = PartitionTable::Type::kUnknown;
+    table->partitions.clear();
+    table->checksum = 0;
+
+    for (const auto& line : lines) {
+        auto split = android::base::Split(line, kSgdiskToken);
+        auto it = split.begin();
+        if (it == split.end()) continue;
+
+        if (*it == "DISK") {
+            if (++it == split.end()) continue;
+            if (*it == "mbr") {
+                table->type = PartitionTable::Type::kMbr;
+            } else if (*it == "gpt") {
+                table->type = PartitionTable::Type::kGpt;
+            } else {
+                LOG(WARNING) << "Invalid partition table " << *it;
+                continue;
+            }
+        } else if (*it == "PART") {
+            // Kept even if malformed, since its presence alone means the disk is partitioned
+            table->partitions.emplace_back();
+            auto& partition = table->partitions.back();
+
+            if (++it == split.end()) continue;
+            // Left as 0 if invalid, for the caller to skip
+            if (!android::base::ParseInt(*it, &partition.number, 1)) {
+                partition.number = 0;
+                continue;
+            }
+
+            if (table->type == PartitionTable::Type::kMbr) {
+                if (++it == split.end()) continue;
+                int type = 0;
+                if (!android::base::ParseInt("0x" + *it, &type, 0, 0xff)) {
+                    LOG(WARNING) << "Invalid partition type " << *it;
+                    continue;
+                }
+                partition.mbrType = type;
+            } else if (table->type == PartitionTable::Type::kGpt) {
+                if (++it == split.end()) continue;
+                auto typeGuid = *it;
+                if (++it == split.end()) continue;
+                partition.typeGuid = typeGuid;
+                partition.partGuid = *it;
+            }
+        }
+    }
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_VOLD_PARTITION_TABLE_H
+#define ANDROID_VOLD_PARTITION_TABLE_H
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace android {
+namespace vold {
+
+/* The partitions of a disk, as `sgdisk --android-dump` lists them */
+struct PartitionTable {
+    enum class Type {
+        kUnknown,
+        kMbr,
+        kGpt,
+    };
+
+    struct Partition {
+        /* Starting from 1, the way the kernel numbers them */
+        int number = 0;
+        /* Partition type, for MBR */
+        uint8_t mbrType = 0;
+        /* Partition type and unique GUIDs for GPT, in uppercase like sgdisk prints them */
+        std::string typeGuid;
+        std::string partGuid;
+    };
+
+    Type type = Type::kUnknown;
+    std::vector<Partition> partitions;
+    /*
+     * Tells tables on disk apart: the CRC-32 of the MBR sector, which includes its disk
+     * signature, or the CRC of the GPT header, which covers the disk GUID and the entries.
+     * 0 when the table came from sgdisk.
+     */
+    uint32_t checksum = 0;
+};
+
+/*
+ * Reads the MBR or GPT at the start of fd, checking the CRCs of a GPT. Returns false if the
+ * table is damaged or unusual enough, such as an MBR with logical partitions, that sgdisk should
+ * decide what it holds.
+ */
+bool ReadPartitionTable(int fd, PartitionTable* table);
+
+/* Parses the output of `sgdisk --android-dump` */
+void ParseSgdiskDump(const std::vector<std::string>& lines, PartitionTable* table);
+
+}  // namespace vold
+}  // namespace android
+
+#endif
@@ -26,17 +26,26 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
-#include <mntent.h>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <android-base/file.h>
 #include <android-base/logging.h>
 #include <android-base/parseint.h>
 #include <android-base/stringprintf.h>
 #include <android-base/strings.h>
+#include <android-base/unique_fd.h>
 
 #include "Process.h"
 #include "Utils.h"
@@ -46,148 +55,463 @@ using android::base::StringPrintf;
 namespace android {
 namespace vold {
 
-static bool checkMaps(const std::string& path, const std::string& prefix) {
-    bool found = false;
-    auto file = std::unique_ptr<FILE, decltype(&fclose)>{fopen(path.c_str(), "re"), fclose};
-    if (!file) {
+namespace {
+
+// Reading maps, fds and mount tables of every process dominates a scan, so those are spread over
+// a few threads.
+constexpr size_t kMaxScanWorkers = 4;
+
+// Big enough for the mount table of a typical app in one read
+constexpr size_t kMountInfoBufferSize = 64 * 1024;
+
+// Mount namespaces of the processes seen by earlier scans, which let a scan for tmpfs mounts read
+// the mount table of each namespace once however many processes share it, without opening ns/mnt
+// again for processes it has seen before. A process keeps its namespace once it runs as its final
+// uid, so an entry stays valid as long as the /proc/<pid> inode it was read through (a reused pid
+// gets a new one) and the uid (which a zygote child changes at specialization, after setting up
+// its namespace) are the same. Pids that weren't seen by the latest full scan have died and are
+// dropped.
+class NamespaceCache {
+  public:
+    ino_t get(int pidFd, pid_t pid, const struct stat& sb) {
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            auto it = mEntries.find(pid);
+            if (it != mEntries.end() && it->second.dirIno == sb.st_ino &&
+                it->second.uid == sb.st_uid) {
+                return it->second.mntNs;
+            }
+        }
+        // The inode of the namespace is what distinguishes it, just like the "mnt:[<inode>]" link.
+        struct stat ns;
+        ino_t mntNs = fstatat(pidFd, "ns/mnt", &ns, 0) == 0 ? ns.st_ino : 0;
+        if (mntNs != 0) {
+            std::lock_guard<std::mutex> lock(mLock);
+            mEntries[pid] = {sb.st_ino, sb.st_uid, mntNs};
+        }
+        return mntNs;
+    }
+
+    void retainOnly(const std::vector<pid_t>& pids) {
+        std::unordered_set<pid_t> alive(pids.begin(), pids.end());
+        std::lock_guard<std::mutex> lock(mLock);
+        for (auto it = mEntries.begin(); it != mEntries.end();) {
+            it = alive.count(it->first) ? std::next(it) : mEntries.erase(it);
+        }
+    }
+
+  private:
+    struct Entry {
+        ino_t dirIno;
+        uid_t uid;
+        ino_t mntNs;
+    };
+
+    std::mutex mLock;
+    std::unordered_map<pid_t, Entry> mEntries;
+};
+
+NamespaceCache sNamespaceCache;
+
+// Buffers reused from one process to the next by each scanning thread.
+struct ScanBuffers {
+    ~ScanBuffers() { free(line); }
+
+    char* line = nullptr;
+    size_t lineLen = 0;
+    char link[PATH_MAX];
+    // Allocated by the first mount table read
+    std::unique_ptr<char[]> mountInfo;
+};
+
+// Decodes the octal escapes (like "\\040" for a space) of a path from a mount table in place.
+void UnescapeMountPath(char* path) {
+    char* out = path;
+    for (const char* in = path; *in != '\0';) {
+        if (in[0] == '\\' && in[1] >= '0' && in[1] <= '3' && in[2] >= '0' && in[2] <= '7' &&
+            in[3] >= '0' && in[3] <= '7') {
+            *out++ = ((in[1] - '0') << 6) | ((in[2] - '0') << 3) | (in[3] - '0');
+            in += 4;
+        } else {
+            *out++ = *in++;
+        }
+    }
+    *out = '\0';
+}
+
+// Scans /proc for one ProcessScan. The tmpfs check, which only depends on the mount namespace,
+// is done once per namespace, however many processes share it and whichever thread gets to it
+// first.
+class ProcessScanner {
+  public:
+    explicit ProcessScanner(const ProcessScan& scan) : mScan(scan) {}
+
+    bool run(const std::function<void(const ProcessInfo&)>& callback) {
+        auto proc_d = std::unique_ptr<DIR, int (*)(DIR*)>(opendir(mScan.procRoot.c_str()),
+                                                      closedir);
+        if (!proc_d) {
+            PLOG(ERROR) << "Failed to open proc";
+            return false;
+        }
+        int procDfd = dirfd(proc_d.get());
+
+        std::vector<pid_t> pids;
+        struct dirent* proc_de;
+        while ((proc_de = readdir(proc_d.get())) != nullptr) {
+            // We only care about valid PIDs
+            pid_t pid;
+            if (proc_de->d_type != DT_DIR) continue;
+            if (!android::base::ParseInt(proc_de->d_name, &pid)) continue;
+            pids.push_back(pid);
+        }
+
+        sNamespaceCache.retainOnly(pids);
+
+        std::atomic<size_t> next(0);
+        auto work = [&] {
+            ScanBuffers buffers;
+            size_t i;
+            while ((i = next++) < pids.size()) {
+                scanPid(procDfd, pids[i], buffers, callback);
+            }
+        };
+        size_t workers = 1;
+        if (mScan.refs & (kRefMaps | kRefFds | kRefTmpfsMount)) {
+            workers = std::clamp<size_t>(std::thread::hardware_concurrency(), 1, kMaxScanWorkers);
+        }
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < workers; i++) {
+            threads.emplace_back(work);
+        }
+        work();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        return true;
+    }
+
+  private:
+    void scanPid(int procDfd, pid_t pid, ScanBuffers& buffers,
+                 const std::function<void(const ProcessInfo&)>& callback) {
+        char name[16];
+        snprintf(name, sizeof(name), "%d", pid);
+        android::base::unique_fd pidFd(openat(procDfd, name, O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+        if (pidFd == -1) return;
+        struct stat sb;
+        if (fstat(pidFd, &sb) != 0) {
+            PLOG(WARNING) << "Failed to stat /proc/" << pid;
+            return;
+        }
+        if (mScan.uid != 0 && sb.st_uid != mScan.uid) return;
+        if (mScan.userId != static_cast<userid_t>(-1) &&
+            multiuser_get_user_id(sb.st_uid) != mScan.userId) {
+            return;
+        }
+
+        ProcessInfo info = {pid, sb.st_uid, sNamespaceCache.get(pidFd, pid, sb), pidFd, 0};
+
+        // Cheapest checks first, so that with firstRefOnly the expensive ones are often skipped.
+        auto wanted = [&](uint32_t ref) {
+            return (mScan.refs & ref) && !(mScan.firstRefOnly && info.refs);
+        };
+        if (wanted(kRefCwdRootExe)) {
+            bool found = checkLink(pidFd, "cwd", pid, buffers);
+            if (!found || !mScan.firstRefOnly) found |= checkLink(pidFd, "root", pid, buffers);
+            if (!found || !mScan.firstRefOnly) found |= checkLink(pidFd, "exe", pid, buffers);
+            if (found) info.refs |= kRefCwdRootExe;
+        }
+        if (wanted(kRefTmpfsMount) && checkTmpfsMounts(pidFd, pid, info.mntNs, buffers)) {
+            info.refs |= kRefTmpfsMount;
+        }
+        if (wanted(kRefMaps) && checkMaps(pidFd, pid, buffers)) info.refs |= kRefMaps;
+        if (wanted(kRefFds) && checkFds(pidFd, pid, buffers)) info.refs |= kRefFds;
+
+        std::lock_guard<std::mutex> lock(mCallbackLock);
+        callback(info);
+    }
+
+    bool startsWithPrefix(const char* path) const {
+        if (strncmp(path, mScan.prefix.c_str(), mScan.prefix.size()) == 0) return true;
+        for (const auto& prefix : mScan.morePrefixes) {
+            if (strncmp(path, prefix.c_str(), prefix.size()) == 0) return true;
+        }
         return false;
     }
 
-    char* buf = nullptr;
-    size_t len = 0;
-    while (getline(&buf, &len, file.get()) != -1) {
-        std::string line(buf);
-        std::string::size_type pos = line.find('/');
-        if (pos != std::string::npos) {
-            line = line.substr(pos);
-            if (android::base::StartsWith(line, prefix)) {
-                LOG(WARNING) << "Found map " << path << " referencing " << line;
-                found = true;
-                break;
+    bool checkMaps(int pidFd, pid_t pid, ScanBuffers& buffers) {
+        int fd = openat(pidFd, "maps", O_RDONLY | O_CLOEXEC);
+        if (fd == -1) return false;
+        auto file = std::unique_ptr<FILE, decltype(&fclose)>{fdopen(fd, "re"), fclose};
+        if (!file) {
+            close(fd);
+            return false;
+        }
+
+        while (getline(&buffers.line, &buffers.lineLen, file.get()) != -1) {
+            const char* path = strchr(buffers.line, '/');
+            if (path != nullptr && startsWithPrefix(path)) {
+                LOG(WARNING) << "Found map /proc/" << pid << "/maps referencing " << path;
+                return true;
             }
         }
+        return false;
     }
-    free(buf);
 
-    return found;
-}
+    bool checkLink(int dfd, const char* name, pid_t pid, ScanBuffers& buffers,
+                   const char* dir = "") {
+        ssize_t len = readlinkat(dfd, name, buffers.link, sizeof(buffers.link) - 1);
+        if (len < 0) return false;
+        buffers.link[len] = '\0';
+        if (!startsWithPrefix(buffers.link)) return false;
+        LOG(WARNING) << "Found symlink /proc/" << pid << "/" << dir << name << " referencing "
+                     << buffers.link;
+        return true;
+    }
+
+    bool checkFds(int pidFd, pid_t pid, ScanBuffers& buffers) {
+        android::base::unique_fd fd(openat(pidFd, "fd", O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+        auto fd_d = std::unique_ptr<DIR, int (*)(DIR*)>(
+                fd == -1 ? nullptr : android::base::Fdopendir(std::move(fd)), closedir);
+        if (!fd_d) {
+            PLOG(WARNING) << "Failed to open /proc/" << pid << "/fd";
+            return false;
+        }
 
-static bool checkSymlink(const std::string& path, const std::string& prefix) {
-    std::string res;
-    if (android::base::Readlink(path, &res)) {
-        if (android::base::StartsWith(res, prefix)) {
-            LOG(WARNING) << "Found symlink " << path << " referencing " << res;
-            return true;
+        bool found = false;
+        struct dirent* fd_de;
+        while ((fd_de = readdir(fd_d.get())) != nullptr) {
+            if (fd_de->d_type != DT_LNK) continue;
+            found |= checkLink(dirfd(fd_d.get()), fd_de->d_name, pid, buffers, "fd/");
+            if (found && mScan.firstRefOnly) break;
         }
+        return found;
     }
-    return false;
-}
 
-// TODO: Refactor the code with KillProcessesWithOpenFiles().
-int KillProcessesWithTmpfsMounts(const std::string& prefix, int signal) {
-    std::unordered_set<pid_t> pids;
+    bool checkTmpfsMounts(int pidFd, pid_t pid, ino_t mntNs, ScanBuffers& buffers) {
+        if (mntNs == 0) return readTmpfsMounts(pidFd, pid, buffers);
 
-    auto proc_d = std::unique_ptr<DIR, int (*)(DIR*)>(opendir("/proc"), closedir);
-    if (!proc_d) {
-        PLOG(ERROR) << "Failed to open proc";
-        return -1;
+        // Another thread may be reading the namespace's table, in which case wait for it.
+        std::promise<bool> result;
+        std::unique_lock<std::mutex> lock(mTmpfsLock);
+        auto [it, inserted] = mTmpfsByNamespace.try_emplace(mntNs);
+        if (!inserted) {
+            auto pending = it->second;
+            lock.unlock();
+            return pending.get();
+        }
+        it->second = result.get_future().share();
+        lock.unlock();
+
+        bool found = readTmpfsMounts(pidFd, pid, buffers);
+        result.set_value(found);
+        return found;
     }
 
-    struct dirent* proc_de;
-    while ((proc_de = readdir(proc_d.get())) != nullptr) {
-        // We only care about valid PIDs
-        pid_t pid;
-        if (proc_de->d_type != DT_DIR) continue;
-        if (!android::base::ParseInt(proc_de->d_name, &pid)) continue;
-
-        // Look for references to prefix
-        std::string mounts_file(StringPrintf("/proc/%d/mounts", pid));
-        auto fp = std::unique_ptr<FILE, int (*)(FILE*)>(
-                setmntent(mounts_file.c_str(), "r"), endmntent);
-        if (!fp) {
-            PLOG(WARNING) << "Failed to open " << mounts_file;
-            continue;
-        }
-
-        // Check if obb directory is mounted, and get all packages of mounted app data directory.
-        mntent* mentry;
-        while ((mentry = getmntent(fp.get())) != nullptr) {
-            if (mentry->mnt_fsname != nullptr && strncmp(mentry->mnt_fsname, "tmpfs", 5) == 0
-                    && android::base::StartsWith(mentry->mnt_dir, prefix)) {
-                pids.insert(pid);
-                break;
+    // Reads /proc/<pid>/mountinfo a buffer at a time and parses each line in place, looking for
+    // a tmpfs mounted under the prefix.
+    bool readTmpfsMounts(int pidFd, pid_t pid, ScanBuffers& buffers) {
+        android::base::unique_fd fd(openat(pidFd, "mountinfo", O_RDONLY | O_CLOEXEC));
+        if (fd == -1) {
+            PLOG(WARNING) << "Failed to open /proc/" << pid << "/mountinfo";
+            return false;
+        }
+        if (!buffers.mountInfo) buffers.mountInfo.reset(new char[kMountInfoBufferSize]);
+        char* buf = buffers.mountInfo.get();
+
+        size_t len = 0;
+        // Set while skipping the rest of a line that didn't fit in the buffer
+        bool overlong = false;
+        while (true) {
+            ssize_t n = TEMP_FAILURE_RETRY(read(fd, buf + len, kMountInfoBufferSize - len));
+            if (n < 0) {
+                PLOG(WARNING) << "Failed to read /proc/" << pid << "/mountinfo";
+                return false;
+            }
+            if (n == 0) return false;
+            len += n;
+
+            char* line = buf;
+            char* end = buf + len;
+            char* newline;
+            while ((newline = static_cast<char*>(memchr(line, '\n', end - line))) != nullptr) {
+                *newline = '\0';
+                if (!overlong && isTmpfsUnderPrefix(line)) return true;
+                overlong = false;
+                line = newline + 1;
+            }
+            len = end - line;
+            if (len == kMountInfoBufferSize) {
+                overlong = true;
+                len = 0;
+            } else {
+                memmove(buf, line, len);
             }
         }
     }
-    if (signal != 0) {
-        for (const auto& pid : pids) {
-            LOG(WARNING) << "Killing pid "<< pid << " with signal " << strsignal(signal) <<
-                    " because it has a mount with prefix " << prefix;
-            kill(pid, signal);
+
+    // Parses a mountinfo line, "<id> <parent id> <dev> <root> <mount point> <options>
+    // [<optional field>...] - <type> <source> <super options>", overwriting parts of it.
+    bool isTmpfsUnderPrefix(char* line) const {
+        char* mountPoint = line;
+        for (int i = 0; i < 4 && mountPoint != nullptr; i++) {
+            mountPoint = strchr(mountPoint, ' ');
+            if (mountPoint != nullptr) mountPoint++;
         }
+        if (mountPoint == nullptr) return false;
+        char* options = strchr(mountPoint, ' ');
+        if (options == nullptr) return false;
+        *options++ = '\0';
+
+        const char* separator = strstr(options, " - ");
+        if (separator == nullptr || strncmp(separator + 3, "tmpfs ", 6) != 0) return false;
+        UnescapeMountPath(mountPoint);
+        return startsWithPrefix(mountPoint);
     }
-    return pids.size();
+
+    const ProcessScan& mScan;
+    std::mutex mCallbackLock;
+    std::mutex mTmpfsLock;
+    std::unordered_map<ino_t, std::shared_future<bool>> mTmpfsByNamespace;
+};
+
+}  // namespace
+
+// A process found by a scan, to be signalled once the scan is done
+struct ScannedProcess {
+    pid_t pid;
+    // -1 if the kernel has no pidfds
+    android::base::unique_fd pidFd;
+};
+
+// Opens a pidfd for the process during its scan callback, while its /proc/<pid> directory is held
+// open. If the process still exists once the pidfd is open, its pid can't have been reused in
+// between, so the pidfd is the process the scan looked at. Returns false if it has exited.
+static bool openScannedProcess(const ProcessInfo& info, std::vector<ScannedProcess>* processes) {
+    android::base::unique_fd pidFd(syscall(__NR_pidfd_open, info.pid, 0));
+    if (pidFd == -1 && errno == ESRCH) return false;
+    struct stat sb;
+    if (fstatat(info.procFd, "stat", &sb, 0) != 0) return false;
+    processes->push_back({info.pid, std::move(pidFd)});
+    return true;
 }
 
-int KillProcessesWithOpenFiles(const std::string& prefix, int signal, bool killFuseDaemon) {
-    std::unordered_set<pid_t> pids;
+// Signals through the pidfd opened by the scan, so that the signal can't reach an unrelated
+// process that reused the pid since, and so that the caller can wait for the exit.
+static void signalProcess(ScannedProcess& process, int signal,
+                          std::vector<android::base::unique_fd>* signalled) {
+    if (process.pidFd == -1) {
+        kill(process.pid, signal);
+    } else if (syscall(__NR_pidfd_send_signal, process.pidFd.get(), signal, nullptr, 0) != 0 &&
+               errno != ESRCH) {
+        PLOG(WARNING) << "Failed to signal pid " << process.pid;
+    }
+    if (signalled) signalled->push_back(std::move(process.pidFd));
+}
 
-    auto proc_d = std::unique_ptr<DIR, int (*)(DIR*)>(opendir("/proc"), closedir);
-    if (!proc_d) {
-        PLOG(ERROR) << "Failed to open proc";
+bool WaitForProcessesToExit(const std::vector<android::base::unique_fd>& pidFds,
+                            std::chrono::milliseconds timeout) {
+    std::vector<struct pollfd> fds;
+    for (const auto& pidFd : pidFds) {
+        if (pidFd == -1) {
+            std::this_thread::sleep_for(timeout);
+            return false;
+        }
+        fds.push_back({pidFd.get(), POLLIN, 0});
+    }
+
+    // A pidfd becomes readable once its process has exited.
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!fds.empty()) {
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now());
+        if (left.count() <= 0) return false;
+        int n = TEMP_FAILURE_RETRY(poll(fds.data(), fds.size(), left.count()));
+        if (n == -1) {
+            PLOG(ERROR) << "Failed to poll pidfds";
+            std::this_thread::sleep_until(deadline);
+            return false;
+        }
+        fds.erase(std::remove_if(fds.begin(), fds.end(),
+                                 [](const struct pollfd& fd) { return fd.revents != 0; }),
+                  fds.end());
+    }
+    return true;
+}
+
+bool ScanProcesses(const ProcessScan& scan,
+                   const std::function<void(const ProcessInfo&)>& callback) {
+    ProcessScanner scanner(scan);
+    return scanner.run(callback);
+}
+
+int KillProcessesWithTmpfsMounts(const std::string& prefix, int signal,
+                                 std::vector<android::base::unique_fd>* signalled) {
+    std::vector<ScannedProcess> processes;
+    int found = 0;
+
+    ProcessScan scan;
+    scan.prefix = prefix;
+    scan.refs = kRefTmpfsMount;
+    scan.firstRefOnly = true;
+    // Check if obb directory is mounted, and get all packages of mounted app data directory.
+    if (!ScanProcesses(scan, [&](const ProcessInfo& info) {
+            if (!info.refs) return;
+            found++;
+            if (signal != 0) openScannedProcess(info, &processes);
+        })) {
         return -1;
     }
+    for (auto& process : processes) {
+        LOG(WARNING) << "Killing pid "<< process.pid << " with signal " << strsignal(signal) <<
+                " because it has a mount with prefix " << prefix;
+        signalProcess(process, signal, signalled);
+    }
+    return found;
+}
 
-    struct dirent* proc_de;
-    while ((proc_de = readdir(proc_d.get())) != nullptr) {
-        // We only care about valid PIDs
-        pid_t pid;
-        if (proc_de->d_type != DT_DIR) continue;
-        if (!android::base::ParseInt(proc_de->d_name, &pid)) continue;
+int KillProcessesWithOpenFiles(const std::string& prefix, int signal, bool killFuseDaemon,
+                               std::vector<android::base::unique_fd>* signalled) {
+    return KillProcessesWithOpenFiles(std::vector<std::string>{prefix}, signal, killFuseDaemon,
+                                      signalled);
+}
 
-        // Look for references to prefix
-        bool found = false;
-        auto path = StringPrintf("/proc/%d", pid);
-        found |= checkMaps(path + "/maps", prefix);
-        found |= checkSymlink(path + "/cwd", prefix);
-        found |= checkSymlink(path + "/root", prefix);
-        found |= checkSymlink(path + "/exe", prefix);
-
-        auto fd_path = path + "/fd";
-        auto fd_d = std::unique_ptr<DIR, int (*)(DIR*)>(opendir(fd_path.c_str()), closedir);
-        if (!fd_d) {
-            PLOG(WARNING) << "Failed to open " << fd_path;
-        } else {
-            struct dirent* fd_de;
-            while ((fd_de = readdir(fd_d.get())) != nullptr) {
-                if (fd_de->d_type != DT_LNK) continue;
-                found |= checkSymlink(fd_path + "/" + fd_de->d_name, prefix);
-            }
-        }
+int KillProcessesWithOpenFiles(const std::vector<std::string>& prefixes, int signal,
+                               bool killFuseDaemon,
+                               std::vector<android::base::unique_fd>* signalled) {
+    if (prefixes.empty()) return 0;
+    std::vector<ScannedProcess> processes;
+    int found = 0;
 
-        if (found) {
-            if (!IsFuseDaemon(pid) || killFuseDaemon) {
-                pids.insert(pid);
+    ProcessScan scan;
+    scan.prefix = prefixes[0];
+    scan.morePrefixes.assign(prefixes.begin() + 1, prefixes.end());
+    scan.refs = kRefMaps | kRefFds | kRefCwdRootExe;
+    scan.firstRefOnly = true;
+    if (!ScanProcesses(scan, [&](const ProcessInfo& info) {
+            if (!info.refs) return;
+            if (!IsFuseDaemon(info.pid) || killFuseDaemon) {
+                found++;
+                if (signal != 0) openScannedProcess(info, &processes);
             } else {
                 LOG(WARNING) << "Found FUSE daemon with open file. Skipping...";
             }
-        }
+        })) {
+        return -1;
     }
-    if (signal != 0) {
-        for (const auto& pid : pids) {
-            std::string comm;
-            android::base::ReadFileToString(StringPrintf("/proc/%d/comm", pid), &comm);
-            comm = android::base::Trim(comm);
+    for (auto& process : processes) {
+        pid_t pid = process.pid;
+        std::string comm;
+        android::base::ReadFileToString(StringPrintf("/proc/%d/comm", pid), &comm);
+        comm = android::base::Trim(comm);
 
-            std::string exe;
-            android::base::Readlink(StringPrintf("/proc/%d/exe", pid), &exe);
+        std::string exe;
+        android::base::Readlink(StringPrintf("/proc/%d/exe", pid), &exe);
 
-            LOG(WARNING) << "Sending " << strsignal(signal) << " to pid " << pid << " (" << comm
-                         << ", " << exe << ")";
-            kill(pid, signal);
-        }
+        LOG(WARNING) << "Sending " << strsignal(signal) << " to pid " << pid << " (" << comm
+                     << ", " << exe << ")";
+        signalProcess(process, signal, signalled);
     }
-    return pids.size();
+    return found;
 }
 
 }  // namespace vold
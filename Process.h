@@ -17,11 +17,88 @@
 #ifndef _PROCESS_H
 #define _PROCESS_H
 
+#include <android-base/unique_fd.h>
+#include <cutils/multiuser.h>
+#include <sys/types.h>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
 namespace android {
 namespace vold {
 
-int KillProcessesWithOpenFiles(const std::string& path, int signal, bool killFuseDaemon = true);
-int KillProcessesWithTmpfsMounts(const std::string& path, int signal);
+/* Ways in which a process can reference a path, checked by ScanProcesses() */
+enum ProcessRef : uint32_t {
+    kRefMaps = 1 << 0,        /* a file mapped into its memory */
+    kRefFds = 1 << 1,         /* an open file descriptor */
+    kRefCwdRootExe = 1 << 2,  /* its working directory, root directory or executable */
+    kRefTmpfsMount = 1 << 3,  /* a tmpfs mounted in its mount namespace */
+};
+
+struct ProcessScan {
+    /* Path prefix the refs are checked against */
+    std::string prefix;
+    /* Further prefixes, a reference to any of which counts as one to prefix */
+    std::vector<std::string> morePrefixes;
+    /* ProcessRef kinds to check */
+    uint32_t refs = 0;
+    /* If not 0, only processes running as this uid are considered */
+    uid_t uid = 0;
+    /* If not -1, only processes of this Android user are considered */
+    userid_t userId = static_cast<userid_t>(-1);
+    /* Stop checking a process at its first reference, so refs holds just that one kind */
+    bool firstRefOnly = false;
+    /* Directory to scan, which tests and benchmarks point at a synthetic tree */
+    std::string procRoot = "/proc";
+};
+
+struct ProcessInfo {
+    pid_t pid;
+    uid_t uid;
+    /*
+     * Inode of its mount namespace, or 0 if it couldn't be read. Cached across scans, so it is
+     * only good for grouping processes: entering the namespace needs an fstat() of the ns/mnt fd
+     * actually opened to match it.
+     */
+    ino_t mntNs;
+    /* The /proc/<pid> directory, only valid during the callback */
+    int procFd;
+    /* The ProcessRef kinds that were found to reference the prefix */
+    uint32_t refs;
+};
+
+/*
+ * Walks /proc once and calls callback for every process that passes the filters in scan, telling
+ * it which of the requested kinds of reference to scan.prefix were found. Each pid directory is
+ * opened once and everything else is read relative to it. Returns false if /proc can't be read.
+ *
+ * When maps or fds are checked, processes are scanned on a few threads at once; callbacks are
+ * still serialized, but may then come from any of those threads and in any pid order.
+ */
+bool ScanProcesses(const ProcessScan& scan,
+                   const std::function<void(const ProcessInfo&)>& callback);
+
+/*
+ * Signal the processes found and return how many there were. If signalled is given, a pidfd for
+ * each signalled process is added to it, or -1 where one couldn't be opened.
+ */
+int KillProcessesWithOpenFiles(const std::string& path, int signal, bool killFuseDaemon = true,
+                               std::vector<android::base::unique_fd>* signalled = nullptr);
+/* Like the above for all of paths at once, with a single walk of /proc */
+int KillProcessesWithOpenFiles(const std::vector<std::string>& paths, int signal,
+                               bool killFuseDaemon = true,
+                               std::vector<android::base::unique_fd>* signalled = nullptr);
+int KillProcessesWithTmpfsMounts(const std::string& path, int signal,
+                                 std::vector<android::base::unique_fd>* signalled = nullptr);
+
+/*
+ * Waits until every process in pidFds has exited or timeout has passed, and returns whether they
+ * all exited. If any of them has no pidfd, the whole timeout is waited out.
+ */
+bool WaitForProcessesToExit(const std::vector<android::base::unique_fd>& pidFds,
+                            std::chrono::milliseconds timeout);
 
 }  // namespace vold
 }  // namespace android
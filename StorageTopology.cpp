@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StorageTopology.h"
+#include "VoldUtil.h"
+
+#include <memory>
+#include <mutex>
+
+#include <android-base/file.h>
+#include <android-base/logging.h>
+#include <android-base/parseint.h>
+#include <android-base/strings.h>
+#include <libdm/dm.h>
+
+namespace android {
+namespace vold {
+
+// Finds the /sys/block entry of the disk holding the block device at path, and its size
+static bool ResolveDisk(const std::string& path, DataTopology* topology) {
+    // Get the potential /sys/block entry
+    std::size_t leaf = path.rfind('/');
+    if (leaf == std::string::npos) {
+        LOG(ERROR) << "data device " << path << " is not a path";
+        return false;
+    }
+    if (path.substr(0, leaf) != "/dev/block") {
+        LOG(ERROR) << "data device " << path << " is not a block device";
+        return false;
+    }
+    std::string sysfs = std::string() + "/sys/block/" + path.substr(leaf + 1);
+
+    // Look for a directory in /sys/block containing size where the name is a shortened
+    // version of the name we now have
+    // Typically we start with something like /sys/block/sda2, and we want /sys/block/sda
+    // Note that this directory only contains actual disks, not partitions, so this is
+    // not going to find anything other than the disks
+    std::string size;
+    for (std::string sysfsDir = sysfs;; sysfsDir = sysfsDir.substr(0, sysfsDir.size() - 1)) {
+        if (sysfsDir.back() == '/') {
+            LOG(ERROR) << "Could not find valid block device from " << sysfs;
+            return false;
+        }
+        if (android::base::ReadFileToString(sysfsDir + "/size", &size, true)) {
+            topology->diskSysfsPath = sysfsDir;
+            break;
+        }
+    }
+    int64_t sectors;
+    if (!android::base::ParseInt(android::base::Trim(size), &sectors, int64_t(0))) {
+        LOG(ERROR) << topology->diskSysfsPath << "/size cannot be read as an integer";
+        return false;
+    }
+    topology->diskSize = sectors * 512;
+    return true;
+}
+
+static bool ResolveDataTopology(DataTopology* topology) {
+    // Start with the /data mount point from fs_mgr
+    auto entry = android::fs_mgr::GetEntryForMountPoint(&fstab_default, DATA_MNT_POINT);
+    if (entry == nullptr) {
+        LOG(ERROR) << "No mount point entry for " << DATA_MNT_POINT;
+        return false;
+    }
+
+    // Follow any symbolic links
+    std::string dataDevice;
+    if (!android::base::Realpath(entry->blk_device, &dataDevice)) {
+        dataDevice = entry->blk_device;
+    }
+
+    // Handle mapped volumes.
+    auto& dm = android::dm::DeviceMapper::Instance();
+    topology->chain.push_back(dataDevice);
+    for (;;) {
+        auto parent = dm.GetParentBlockDeviceByPath(dataDevice);
+        if (!parent.has_value()) break;
+        dataDevice = *parent;
+        topology->chain.push_back(dataDevice);
+    }
+
+    // Only the storage size needs the disk, so the rest is still useful without it
+    ResolveDisk(dataDevice, topology);
+
+    for (const auto& entry : fstab_default) {
+        if (!entry.sysfs_path.empty()) {
+            topology->devSysfsPath = entry.sysfs_path;
+            break;
+        }
+    }
+    return true;
+}
+
+const DataTopology* GetDataTopology() {
+    static std::mutex lock;
+    static std::unique_ptr<DataTopology> topology;
+
+    std::lock_guard<std::mutex> guard(lock);
+    if (!topology) {
+        auto resolved = std::make_unique<DataTopology>();
+        if (!ResolveDataTopology(resolved.get())) return nullptr;
+        topology = std::move(resolved);
+    }
+    return topology.get();
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_VOLD_STORAGE_TOPOLOGY_H
+#define ANDROID_VOLD_STORAGE_TOPOLOGY_H
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+namespace android {
+namespace vold {
+
+/* How the /data block device sits on the physical storage */
+struct DataTopology {
+    /*
+     * The /data block device from fstab with symlinks resolved, then each device-mapper
+     * device's parent in turn, ending with the partition (or disk) they all sit on.
+     */
+    std::vector<std::string> chain;
+    /* The /sys/block directory of the disk holding that partition, if it could be found */
+    std::string diskSysfsPath;
+    /* Size of that disk in bytes, or 0 if it couldn't be found */
+    int64_t diskSize = 0;
+    /* The sysfs_path given in fstab for the storage device, if any */
+    std::string devSysfsPath;
+};
+
+/*
+ * The topology of /data, which is resolved on first use and never changes after that. Returns
+ * nullptr, to be tried again on the next call, if fstab has no /data.
+ */
+const DataTopology* GetDataTopology();
+
+}  // namespace vold
+}  // namespace android
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TaskExecutor.h"
+
+#include "android/os/BnVoldTaskListener.h"
+
+#include <android-base/logging.h>
+#include <cutils/iosched_policy.h>
+
+#include <errno.h>
+
+#include <algorithm>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+using android::os::IVoldTaskListener;
+using android::os::PersistableBundle;
+
+namespace android {
+namespace vold {
+
+/* Everyone waiting for a task, which can be more than one caller once duplicates are merged */
+class TaskExecutor::Listeners : public android::os::BnVoldTaskListener {
+  public:
+    void add(const android::sp<IVoldTaskListener>& listener) {
+        if (listener) mListeners.push_back(listener);
+    }
+    bool empty() const { return mListeners.empty(); }
+
+    binder::Status onStatus(int status, const PersistableBundle& extras) override {
+        for (const auto& listener : mListeners) listener->onStatus(status, extras);
+        return binder::Status::ok();
+    }
+    binder::Status onFinished(int status, const PersistableBundle& extras) override {
+        for (const auto& listener : mListeners) listener->onFinished(status, extras);
+        return binder::Status::ok();
+    }
+
+  private:
+    /* Only added to while the task is queued, under the executor's lock */
+    std::vector<android::sp<IVoldTaskListener>> mListeners;
+};
+
+TaskExecutor* TaskExecutor::Instance() {
+    static TaskExecutor* sInstance = new TaskExecutor();
+    return sInstance;
+}
+
+void TaskExecutor::post(Lane lane, const std::string& key,
+                        const android::sp<IVoldTaskListener>& listener, Fn fn) {
+    std::lock_guard<std::mutex> lock(mLock);
+    auto& state = mLanes[lane];
+    auto it = std::find_if(state.queue.begin(), state.queue.end(),
+                           [&key](const Task& task) { return task.key == key; });
+    if (it != state.queue.end()) {
+        LOG(DEBUG) << "Joining queued task " << key;
+        it->listeners->add(listener);
+        return;
+    }
+
+    Task task{key, new Listeners(), std::move(fn)};
+    task.listeners->add(listener);
+    state.queue.push_back(std::move(task));
+    if (!state.running) {
+        state.running = true;
+        std::thread(&TaskExecutor::runLane, this, lane).detach();
+    }
+}
+
+int TaskExecutor::cancel(const std::string& key) {
+    std::vector<Task> cancelled;
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        for (auto& state : mLanes) {
+            auto it = std::stable_partition(state.queue.begin(), state.queue.end(),
+                                            [&key](const Task& task) { return task.key != key; });
+            std::move(it, state.queue.end(), std::back_inserter(cancelled));
+            state.queue.erase(it, state.queue.end());
+        }
+    }
+    for (const auto& task : cancelled) {
+        LOG(DEBUG) << "Cancelled queued task " << task.key;
+        task.listeners->onFinished(-ECANCELED, PersistableBundle());
+    }
+    return cancelled.size();
+}
+
+void TaskExecutor::runLane(Lane lane) {
+    // Maintenance can wait for everything else; a benchmark boosts itself while it runs
+    if (lane == kMaintenance && android_set_ioprio(0, IoSchedClass_BE, 7)) {
+        PLOG(WARNING) << "Failed to android_set_ioprio";
+    }
+
+    while (true) {
+        Task task;
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            auto& state = mLanes[lane];
+            if (state.queue.empty()) {
+                state.running = false;
+                return;
+            }
+            task = std::move(state.queue.front());
+            state.queue.pop_front();
+        }
+        LOG(DEBUG) << "Running task " << task.key;
+        task.fn(task.listeners->empty() ? nullptr : task.listeners);
+    }
+}
+
+}  // namespace vold
+}  // namespace android
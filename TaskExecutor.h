@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ANDROID_VOLD_TASK_EXECUTOR_H
+#define ANDROID_VOLD_TASK_EXECUTOR_H
+
+#include "android/os/IVoldTaskListener.h"
+
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace android {
+namespace vold {
+
+/*
+ * Runs the long tasks that binder calls start, such as trims and benchmarks. Each lane runs its
+ * tasks one at a time in the order they were posted, on a thread that only exists while the lane
+ * has work, so tasks in the same lane don't fight over the device.
+ */
+class TaskExecutor {
+  public:
+    enum Lane {
+        /* Trims, GC and benchmarks, which would slow down or skew each other */
+        kMaintenance,
+        /* Moving storage between volumes */
+        kMove,
+        /* Quick tasks that act on the others, like aborting idle maintenance */
+        kControl,
+        kLanes,
+    };
+
+    using Fn = std::function<void(const android::sp<android::os::IVoldTaskListener>&)>;
+
+    static TaskExecutor* Instance();
+
+    /*
+     * Queues fn on lane, to be called with a listener that reports to the given one. If a task
+     * with the same key is still queued, it's identical to this one, so listener waits for that
+     * task instead and fn is dropped.
+     */
+    void post(Lane lane, const std::string& key,
+              const android::sp<android::os::IVoldTaskListener>& listener, Fn fn);
+
+    /*
+     * Drops the queued tasks with the given key, finishing their listeners with -ECANCELED, and
+     * returns how many there were. A task that already started is up to its own abort.
+     */
+    int cancel(const std::string& key);
+
+  private:
+    class Listeners;
+
+    struct Task {
+        std::string key;
+        android::sp<Listeners> listeners;
+        Fn fn;
+    };
+
+    struct LaneState {
+        std::deque<Task> queue;
+        bool running = false;
+    };
+
+    void runLane(Lane lane);
+
+    std::mutex mLock;
+    LaneState mLanes[kLanes];
+};
+
+}  // namespace vold
+}  // namespace android
+
+#endif
@@ -16,12 +16,15 @@
 
 #include "Utils.h"
 
+#include "FileTree.h"
+#include "FsProbe.h"
 #include "Process.h"
 #include "sehandle.h"
 
 #include <android-base/chrono_utils.h>
 #include <android-base/file.h>
 #include <android-base/logging.h>
+#include <android-base/parseint.h>
 #include <android-base/properties.h>
 #include <android-base/scopeguard.h>
 #include <android-base/stringprintf.h>
@@ -38,19 +41,25 @@
 #include <linux/posix_acl.h>
 #include <linux/posix_acl_xattr.h>
 #include <mntent.h>
+#include <poll.h>
+#include <spawn.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/mount.h>
 #include <sys/stat.h>
 #include <sys/statvfs.h>
+#include <sys/syscall.h>
+#include <sys/sysinfo.h>
 #include <sys/sysmacros.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <sys/xattr.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <list>
+#include <map>
 #include <mutex>
 #include <regex>
 #include <thread>
@@ -87,6 +96,9 @@ static const char* kAppDataDir = "/Android/data/";
 static const char* kAppMediaDir = "/Android/media/";
 static const char* kAppObbDir = "/Android/obb/";
 
+// Set on devices whose policy lets vold relabel the trees RestoreconTrees() is used on.
+static const char* kParallelRestoreconProp = "persist.vold.parallel_restorecon";
+
 static const char* kMediaProviderCtx = "u:r:mediaprovider:";
 static const char* kMediaProviderAppCtx = "u:r:mediaprovider_app:";
 
@@ -94,6 +106,11 @@ static const char* kMediaProviderAppCtx = "u:r:mediaprovider_app:";
 // other between multiple threads.
 static std::mutex kSecurityLock;
 
+// Volume roots whose Android/ directories PrepareAndroidDirs() has set up, with the device and
+// inode of their Android/ directory at the time.
+static std::mutex kPreparedAndroidDirsLock;
+static std::map<std::string, std::pair<dev_t, ino_t>> kPreparedAndroidDirs;
+
 std::string GetFuseMountPathForUser(userid_t user_id, const std::string& relative_upper_path) {
     return StringPrintf("/mnt/user/%d/%s", user_id, relative_upper_path.c_str());
 }
@@ -227,20 +244,18 @@ int SetQuotaInherit(const std::string& path) {
     return 0;
 }
 
-int SetQuotaProjectId(const std::string& path, long projectId) {
+// Sets the project id of the already open |path|, unless it has it already.
+static int SetQuotaProjectId(int fd, const std::string& path, long projectId) {
     struct fsxattr fsx;
 
-    android::base::unique_fd fd(TEMP_FAILURE_RETRY(open(path.c_str(), O_RDONLY | O_CLOEXEC)));
-    if (fd == -1) {
-        PLOG(ERROR) << "Failed to open " << path << " to set project id.";
-        return -1;
-    }
-
     int ret = ioctl(fd, FS_IOC_FSGETXATTR, &fsx);
     if (ret == -1) {
         PLOG(ERROR) << "Failed to get extended attributes for " << path << " to get project id.";
         return ret;
     }
+    if (fsx.fsx_projid == static_cast<uint32_t>(projectId)) {
+        return 0;
+    }
 
     fsx.fsx_projid = projectId;
     ret = ioctl(fd, FS_IOC_FSSETXATTR, &fsx);
@@ -251,6 +266,15 @@ int SetQuotaProjectId(const std::string& path, long projectId) {
     return 0;
 }
 
+int SetQuotaProjectId(const std::string& path, long projectId) {
+    android::base::unique_fd fd(TEMP_FAILURE_RETRY(open(path.c_str(), O_RDONLY | O_CLOEXEC)));
+    if (fd == -1) {
+        PLOG(ERROR) << "Failed to open " << path << " to set project id.";
+        return -1;
+    }
+    return SetQuotaProjectId(fd, path, projectId);
+}
+
 int PrepareDirWithProjectId(const std::string& path, mode_t mode, uid_t uid, gid_t gid,
                             long projectId) {
     int ret = fs_prepare_dir(path.c_str(), mode, uid, gid);
@@ -267,28 +291,58 @@ int PrepareDirWithProjectId(const std::string& path, mode_t mode, uid_t uid, gid
 }
 
 static int FixupAppDir(const std::string& path, mode_t mode, uid_t uid, gid_t gid, long projectId) {
-    namespace fs = std::filesystem;
-
     // Setup the directory itself correctly
     int ret = PrepareDirWithProjectId(path, mode, uid, gid, projectId);
     if (ret != OK) {
         return ret;
     }
 
-    // Fixup all of its file entries
-    for (const auto& itEntry : fs::directory_iterator(path)) {
-        ret = lchown(itEntry.path().c_str(), uid, gid);
-        if (ret != 0) {
-            return ret;
+    unique_fd dirFd(TEMP_FAILURE_RETRY(
+            open(path.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC)));
+    auto dir = std::unique_ptr<DIR, int (*)(DIR*)>(
+            dirFd == -1 ? nullptr : android::base::Fdopendir(std::move(dirFd)), closedir);
+    if (!dir) {
+        PLOG(ERROR) << "Failed to open " << path << " to fix up its entries";
+        return -errno;
+    }
+    int dfd = dirfd(dir.get());
+    bool setProjectId = !IsSdcardfsUsed();
+
+    // Fixup all of its file entries, relative to the directory and only where they are wrong.
+    // Symlinks are owned like everything else, but never followed.
+    struct dirent* ent;
+    while ((ent = readdir(dir.get())) != nullptr) {
+        if (!strcmp(ent->d_name, ".") || !strcmp(ent->d_name, "..")) continue;
+        std::string entryPath = path + "/" + ent->d_name;
+
+        struct stat sb;
+        if (fstatat(dfd, ent->d_name, &sb, AT_SYMLINK_NOFOLLOW) != 0) {
+            PLOG(ERROR) << "Failed to stat " << entryPath;
+            return -errno;
         }
 
-        ret = chmod(itEntry.path().c_str(), mode);
-        if (ret != 0) {
-            return ret;
+        // A chown clears the setgid bit, so the mode has to be set again after one.
+        bool chowned = sb.st_uid != uid || sb.st_gid != gid;
+        if (chowned && fchownat(dfd, ent->d_name, uid, gid, AT_SYMLINK_NOFOLLOW) != 0) {
+            PLOG(ERROR) << "Failed to chown " << entryPath;
+            return -errno;
+        }
+        if (S_ISLNK(sb.st_mode)) continue;
+
+        if ((chowned || (sb.st_mode & 07777) != mode) &&
+            fchmodat(dfd, ent->d_name, mode, 0) != 0) {
+            PLOG(ERROR) << "Failed to chmod " << entryPath;
+            return -errno;
         }
 
-        if (!IsSdcardfsUsed()) {
-            ret = SetQuotaProjectId(itEntry.path(), projectId);
+        if (setProjectId && (S_ISREG(sb.st_mode) || S_ISDIR(sb.st_mode))) {
+            unique_fd fd(TEMP_FAILURE_RETRY(
+                    openat(dfd, ent->d_name, O_RDONLY | O_NOFOLLOW | O_NONBLOCK | O_CLOEXEC)));
+            if (fd == -1) {
+                PLOG(ERROR) << "Failed to open " << entryPath << " to set project id.";
+                return -errno;
+            }
+            ret = SetQuotaProjectId(fd, entryPath, projectId);
             if (ret != 0) {
                 return ret;
             }
@@ -299,17 +353,20 @@ static int FixupAppDir(const std::string& path, mode_t mode, uid_t uid, gid_t gi
 }
 
 int PrepareAppDirFromRoot(const std::string& path, const std::string& root, int appUid,
-                          bool fixupExisting) {
+                          bool fixupExisting, bool prepareAndroidDirs) {
     long projectId;
     size_t pos;
     int ret = 0;
     bool sdcardfsSupport = IsSdcardfsUsed();
 
-    // Make sure the Android/ directories exist and are setup correctly
-    ret = PrepareAndroidDirs(root);
-    if (ret != 0) {
-        LOG(ERROR) << "Failed to prepare Android/ directories.";
-        return ret;
+    // Make sure the Android/ directories exist and are setup correctly, unless the caller
+    // already did for this root
+    if (prepareAndroidDirs) {
+        ret = PrepareAndroidDirs(root);
+        if (ret != 0) {
+            LOG(ERROR) << "Failed to prepare Android/ directories.";
+            return ret;
+        }
     }
 
     // Now create the application-specific subdir(s)
@@ -390,6 +447,12 @@ int PrepareAppDirFromRoot(const std::string& path, const std::string& root, int
         } else {
             ret = PrepareDirWithProjectId(pathToCreate, mode, uid, gid, projectId);
         }
+        // Android/data and the like were taken to be there, but have gone since.
+        if (ret != 0 && depth == 0 && errno == ENOENT && ForgetPreparedAndroidDirs(root)) {
+            LOG(WARNING) << "Android/ directories of " << root << " went missing";
+            ret = PrepareAndroidDirs(root);
+            if (ret == 0) ret = PrepareDirWithProjectId(pathToCreate, mode, uid, gid, projectId);
+        }
 
         if (ret != 0) {
             return ret;
@@ -450,8 +513,16 @@ int SetAttrs(const std::string& path, unsigned int attrs) {
 
 status_t PrepareDir(const std::string& path, mode_t mode, uid_t uid, gid_t gid,
                     unsigned int attrs) {
-    std::lock_guard<std::mutex> lock(kSecurityLock);
     const char* cpath = path.c_str();
+    // Most calls are for directories that were set up on an earlier boot or unlock. The label
+    // only matters when creating, so those need neither the lookup nor the lock.
+    struct stat sb;
+    if (!attrs && lstat(cpath, &sb) == 0 && S_ISDIR(sb.st_mode) &&
+        (sb.st_mode & 07777) == mode && sb.st_uid == uid && sb.st_gid == gid) {
+        return OK;
+    }
+
+    std::lock_guard<std::mutex> lock(kSecurityLock);
     auto clearfscreatecon = android::base::make_scope_guard([] { setfscreatecon(nullptr); });
     auto secontext = std::unique_ptr<char, void (*)(char*)>(nullptr, freecon);
     char* tmp_secontext;
@@ -474,6 +545,16 @@ status_t PrepareDir(const std::string& path, mode_t mode, uid_t uid, gid_t gid,
     return OK;
 }
 
+// How long signalled processes get to exit before they are looked for again
+static constexpr auto kKillTimeout = 5s;
+
+// Gives the processes just signalled up to kKillTimeout to exit, returning as soon as they all
+// have, or right away if sleeping on unmount is disabled.
+static void WaitForSignalledProcesses(std::vector<unique_fd>* signalled) {
+    if (sSleepOnUnmount) WaitForProcessesToExit(*signalled, kKillTimeout);
+    signalled->clear();
+}
+
 status_t ForceUnmount(const std::string& path) {
     const char* cpath = path.c_str();
     if (!umount2(cpath, UMOUNT_NOFOLLOW) || errno == EINVAL || errno == ENOENT) {
@@ -483,20 +564,21 @@ status_t ForceUnmount(const std::string& path) {
     // we start sending signals
     if (sSleepOnUnmount) sleep(5);
 
-    KillProcessesWithOpenFiles(path, SIGINT);
-    if (sSleepOnUnmount) sleep(5);
+    std::vector<unique_fd> signalled;
+    KillProcessesWithOpenFiles(path, SIGINT, true, &signalled);
+    WaitForSignalledProcesses(&signalled);
     if (!umount2(cpath, UMOUNT_NOFOLLOW) || errno == EINVAL || errno == ENOENT) {
         return OK;
     }
 
-    KillProcessesWithOpenFiles(path, SIGTERM);
-    if (sSleepOnUnmount) sleep(5);
+    KillProcessesWithOpenFiles(path, SIGTERM, true, &signalled);
+    WaitForSignalledProcesses(&signalled);
     if (!umount2(cpath, UMOUNT_NOFOLLOW) || errno == EINVAL || errno == ENOENT) {
         return OK;
     }
 
-    KillProcessesWithOpenFiles(path, SIGKILL);
-    if (sSleepOnUnmount) sleep(5);
+    KillProcessesWithOpenFiles(path, SIGKILL, true, &signalled);
+    WaitForSignalledProcesses(&signalled);
     if (!umount2(cpath, UMOUNT_NOFOLLOW) || errno == EINVAL || errno == ENOENT) {
         return OK;
     }
@@ -504,21 +586,52 @@ status_t ForceUnmount(const std::string& path) {
     return -errno;
 }
 
+status_t ForceUnmountAll(const std::vector<std::string>& paths) {
+    std::vector<std::string> mounted = paths;
+    // Unmounts what it can, keeping the rest in order, and returns whether all are gone
+    auto unmountRemaining = [&mounted] {
+        std::vector<std::string> busy;
+        for (const auto& path : mounted) {
+            if (umount2(path.c_str(), UMOUNT_NOFOLLOW) && errno != EINVAL && errno != ENOENT) {
+                busy.push_back(path);
+            }
+        }
+        mounted = std::move(busy);
+        return mounted.empty();
+    };
+    if (unmountRemaining()) return OK;
+    // Apps might still be handling eject request, so wait before
+    // we start sending signals
+    if (sSleepOnUnmount) sleep(5);
+
+    for (int signal : {SIGINT, SIGTERM, SIGKILL}) {
+        std::vector<unique_fd> signalled;
+        KillProcessesWithOpenFiles(mounted, signal, true, &signalled);
+        WaitForSignalledProcesses(&signalled);
+        if (unmountRemaining()) return OK;
+    }
+    for (const auto& path : mounted) {
+        LOG(INFO) << "ForceUnmount failed for " << path;
+    }
+    return -EBUSY;
+}
+
 status_t KillProcessesWithTmpfsMountPrefix(const std::string& path) {
-    if (KillProcessesWithTmpfsMounts(path, SIGINT) == 0) {
+    std::vector<unique_fd> signalled;
+    if (KillProcessesWithTmpfsMounts(path, SIGINT, &signalled) == 0) {
         return OK;
     }
-    if (sSleepOnUnmount) sleep(5);
+    WaitForSignalledProcesses(&signalled);
 
-    if (KillProcessesWithTmpfsMounts(path, SIGTERM) == 0) {
+    if (KillProcessesWithTmpfsMounts(path, SIGTERM, &signalled) == 0) {
         return OK;
     }
-    if (sSleepOnUnmount) sleep(5);
+    WaitForSignalledProcesses(&signalled);
 
-    if (KillProcessesWithTmpfsMounts(path, SIGKILL) == 0) {
+    if (KillProcessesWithTmpfsMounts(path, SIGKILL, &signalled) == 0) {
         return OK;
     }
-    if (sSleepOnUnmount) sleep(5);
+    WaitForSignalledProcesses(&signalled);
 
     // Send SIGKILL a second time to determine if we've
     // actually killed everyone mount
@@ -530,20 +643,21 @@ status_t KillProcessesWithTmpfsMountPrefix(const std::string& path) {
 }
 
 status_t KillProcessesUsingPath(const std::string& path) {
-    if (KillProcessesWithOpenFiles(path, SIGINT, false /* killFuseDaemon */) == 0) {
+    std::vector<unique_fd> signalled;
+    if (KillProcessesWithOpenFiles(path, SIGINT, false /* killFuseDaemon */, &signalled) == 0) {
         return OK;
     }
-    if (sSleepOnUnmount) sleep(5);
+    WaitForSignalledProcesses(&signalled);
 
-    if (KillProcessesWithOpenFiles(path, SIGTERM, false /* killFuseDaemon */) == 0) {
+    if (KillProcessesWithOpenFiles(path, SIGTERM, false /* killFuseDaemon */, &signalled) == 0) {
         return OK;
     }
-    if (sSleepOnUnmount) sleep(5);
+    WaitForSignalledProcesses(&signalled);
 
-    if (KillProcessesWithOpenFiles(path, SIGKILL, false /* killFuseDaemon */) == 0) {
+    if (KillProcessesWithOpenFiles(path, SIGKILL, false /* killFuseDaemon */, &signalled) == 0) {
         return OK;
     }
-    if (sSleepOnUnmount) sleep(5);
+    WaitForSignalledProcesses(&signalled);
 
     // Send SIGKILL a second time to determine if we've
     // actually killed everyone with open files
@@ -566,6 +680,71 @@ status_t BindMount(const std::string& source, const std::string& target) {
     return OK;
 }
 
+#ifndef OPEN_TREE_CLONE
+#define OPEN_TREE_CLONE 1
+#endif
+#ifndef MOVE_MOUNT_F_EMPTY_PATH
+#define MOVE_MOUNT_F_EMPTY_PATH 0x00000004
+#endif
+
+status_t BindMounts(const std::vector<std::pair<std::string, std::string>>& mounts,
+                    std::list<std::string>* mounted) {
+    std::vector<unique_fd> trees;
+    for (const auto& [source, target] : mounts) {
+        unique_fd tree(syscall(__NR_open_tree, AT_FDCWD, source.c_str(),
+                               OPEN_TREE_CLONE | O_CLOEXEC));
+        if (tree == -1 && errno == ENOSYS) {
+            trees.clear();
+            break;
+        }
+        if (tree == -1) {
+            PLOG(ERROR) << "Failed to clone " << source;
+            return -errno;
+        }
+        trees.push_back(std::move(tree));
+    }
+
+    for (size_t i = 0; i < mounts.size(); i++) {
+        const auto& [source, target] = mounts[i];
+        if (trees.empty()) {
+            if (auto status = BindMount(source, target); status != OK) return status;
+        } else {
+            if (UnmountTree(target) < 0) {
+                return -errno;
+            }
+            if (syscall(__NR_move_mount, trees[i].get(), "", AT_FDCWD, target.c_str(),
+                        MOVE_MOUNT_F_EMPTY_PATH) != 0) {
+                PLOG(ERROR) << "Failed to bind mount " << source << " to " << target;
+                return -errno;
+            }
+        }
+        LOG(INFO) << "Bind mounted " << source << " on " << target;
+        mounted->push_front(target);
+    }
+    return OK;
+}
+
+status_t RemountBindWritable(const std::string& path) {
+    struct statvfs sv;
+    if (statvfs(path.c_str(), &sv) != 0) {
+        PLOG(ERROR) << "Failed to statvfs " << path;
+        return -errno;
+    }
+    // A bind remount sets exactly the flags given, so carry over the ones it has
+    unsigned long flags = MS_REMOUNT | MS_BIND;
+    flags |= (sv.f_flag & ST_NOSUID) ? MS_NOSUID : 0;
+    flags |= (sv.f_flag & ST_NODEV) ? MS_NODEV : 0;
+    flags |= (sv.f_flag & ST_NOEXEC) ? MS_NOEXEC : 0;
+    flags |= (sv.f_flag & ST_NOATIME) ? MS_NOATIME : 0;
+    flags |= (sv.f_flag & ST_NODIRATIME) ? MS_NODIRATIME : 0;
+    flags |= (sv.f_flag & ST_RELATIME) ? MS_RELATIME : 0;
+    if (mount(nullptr, path.c_str(), nullptr, flags, nullptr) != 0) {
+        PLOG(ERROR) << "Failed to remount " << path << " read-write";
+        return -errno;
+    }
+    return OK;
+}
+
 status_t Symlink(const std::string& target, const std::string& linkpath) {
     if (Unlink(linkpath) < 0) {
         return -errno;
@@ -631,32 +810,55 @@ static status_t readMetadata(const std::string& path, std::string* fsType, std::
     fsUuid->clear();
     fsLabel->clear();
 
-    std::vector<std::string> cmd;
-    cmd.push_back(kBlkidPath);
-    cmd.push_back("-c");
-    cmd.push_back("/dev/null");
-    cmd.push_back("-s");
-    cmd.push_back("TYPE");
-    cmd.push_back("-s");
-    cmd.push_back("UUID");
-    cmd.push_back("-s");
-    cmd.push_back("LABEL");
-    cmd.push_back(path);
-
-    std::vector<std::string> output;
-    status_t res = ForkExecvp(cmd, &output, untrusted ? sBlkidUntrustedContext : sBlkidContext);
-    if (res != OK) {
-        LOG(WARNING) << "blkid failed to identify " << path;
-        return res;
+    // Common filesystems are parsed in-process, and only the rest are left to blkid. Either way
+    // the result is remembered until the disk changes or a uevent arrives for the device.
+    android::base::unique_fd fd(TEMP_FAILURE_RETRY(open(path.c_str(), O_RDONLY | O_CLOEXEC)));
+    struct stat st;
+    bool cacheable = fd != -1 && fstat(fd.get(), &st) == 0 && S_ISBLK(st.st_mode);
+    uint64_t diskSeq = cacheable ? GetDiskSequence(fd.get()) : 0;
+    FsMetadata metadata;
+    if (cacheable && GetCachedFsMetadata(st.st_rdev, diskSeq, &metadata)) {
+        *fsType = metadata.type;
+        *fsUuid = metadata.uuid;
+        *fsLabel = metadata.label;
+        return OK;
     }
 
-    for (const auto& line : output) {
-        // Extract values from blkid output, if defined
-        FindValue(line, "TYPE", fsType);
-        FindValue(line, "UUID", fsUuid);
-        FindValue(line, "LABEL", fsLabel);
+    if (fd == -1 || !ProbeFilesystem(fd.get(), &metadata)) {
+        std::vector<std::string> cmd;
+        cmd.push_back(kBlkidPath);
+        cmd.push_back("-c");
+        cmd.push_back("/dev/null");
+        cmd.push_back("-s");
+        cmd.push_back("TYPE");
+        cmd.push_back("-s");
+        cmd.push_back("UUID");
+        cmd.push_back("-s");
+        cmd.push_back("LABEL");
+        cmd.push_back(path);
+
+        std::vector<std::string> output;
+        status_t res =
+                ForkExecvp(cmd, &output, untrusted ? sBlkidUntrustedContext : sBlkidContext);
+        if (res != OK) {
+            LOG(WARNING) << "blkid failed to identify " << path;
+            return res;
+        }
+
+        for (const auto& line : output) {
+            // Extract values from blkid output, if defined
+            FindValue(line, "TYPE", &metadata.type);
+            FindValue(line, "UUID", &metadata.uuid);
+            FindValue(line, "LABEL", &metadata.label);
+        }
     }
 
+    if (cacheable) {
+        CacheFsMetadata(st.st_rdev, diskSeq, metadata);
+    }
+    *fsType = metadata.type;
+    *fsUuid = metadata.uuid;
+    *fsLabel = metadata.label;
     return OK;
 }
 
@@ -685,62 +887,85 @@ static std::vector<const char*> ConvertToArgv(const std::vector<std::string>& ar
     return argv;
 }
 
-static status_t ReadLinesFromFdAndLog(std::vector<std::string>* output,
+// Output is read in chunks this large, and lines are handed out straight from the buffer.
+static constexpr size_t kExecOutputBufferBytes = 16 * 1024;
+
+static status_t ReadLinesFromFdAndLog(const ExecLineCallback& onLine,
                                       android::base::unique_fd ufd) {
-    std::unique_ptr<FILE, int (*)(FILE*)> fp(android::base::Fdopen(std::move(ufd), "r"), fclose);
-    if (!fp) {
-        PLOG(ERROR) << "fdopen in ReadLinesFromFdAndLog";
-        return -errno;
-    }
-    if (output) output->clear();
-    char line[1024];
-    while (fgets(line, sizeof(line), fp.get()) != nullptr) {
+    std::unique_ptr<char[]> buf(new char[kExecOutputBufferBytes]);
+    auto emit = [&](size_t start, size_t end) {
+        std::string_view line(buf.get() + start, end - start);
         LOG(DEBUG) << line;
-        if (output) output->emplace_back(line);
+        if (onLine) onLine(line);
+    };
+
+    size_t start = 0;
+    size_t end = 0;
+    while (true) {
+        if (end == kExecOutputBufferBytes) {
+            if (start == 0) {
+                // A line longer than the buffer goes out in pieces, as it did through fgets()
+                emit(0, end);
+                end = 0;
+            } else {
+                memmove(buf.get(), buf.get() + start, end - start);
+                end -= start;
+                start = 0;
+            }
+        }
+        ssize_t n =
+                TEMP_FAILURE_RETRY(read(ufd.get(), buf.get() + end, kExecOutputBufferBytes - end));
+        if (n == -1) {
+            PLOG(ERROR) << "read in ReadLinesFromFdAndLog";
+            return -errno;
+        }
+        if (n == 0) break;
+
+        size_t scanned = end;
+        end += n;
+        const char* newline;
+        while ((newline = static_cast<const char*>(
+                        memchr(buf.get() + scanned, '\n', end - scanned))) != nullptr) {
+            scanned = newline - buf.get() + 1;
+            emit(start, scanned);
+            start = scanned;
+        }
+        if (start == end) start = end = 0;
     }
+    if (end > start) emit(start, end);
     return OK;
 }
 
-status_t ForkExecvp(const std::vector<std::string>& args, std::vector<std::string>* output,
-                    char* context) {
+// Starts args with posix_spawnp(), which unlike fork() doesn't copy vold's page tables. The
+// SELinux exec context belongs to the calling thread, so it is only set around the spawn.
+static pid_t SpawnProcess(const std::vector<std::string>& args, char* context,
+                          const posix_spawn_file_actions_t* actions, const char* caller) {
     auto argv = ConvertToArgv(args);
 
-    android::base::unique_fd pipe_read, pipe_write;
-    if (!android::base::Pipe(&pipe_read, &pipe_write)) {
-        PLOG(ERROR) << "Pipe in ForkExecvp";
-        return -errno;
-    }
-
-    pid_t pid = fork();
-    if (pid == 0) {
-        if (context) {
-            if (setexeccon(context)) {
-                LOG(ERROR) << "Failed to setexeccon in ForkExecvp";
-                abort();
-            }
-        }
-        pipe_read.reset();
-        if (dup2(pipe_write.get(), STDOUT_FILENO) == -1) {
-            PLOG(ERROR) << "dup2 in ForkExecvp";
-            _exit(EXIT_FAILURE);
+    if (context) {
+        if (setexeccon(context)) {
+            PLOG(ERROR) << "Failed to setexeccon in " << caller;
+            return -1;
         }
-        pipe_write.reset();
-        execvp(argv[0], const_cast<char**>(argv.data()));
-        PLOG(ERROR) << "exec in ForkExecvp";
-        _exit(EXIT_FAILURE);
     }
-    if (pid == -1) {
-        PLOG(ERROR) << "fork in ForkExecvp";
-        return -errno;
+    pid_t pid;
+    int res = posix_spawnp(&pid, argv[0], actions, nullptr, const_cast<char**>(argv.data()),
+                           environ);
+    if (context) {
+        setexeccon(nullptr);
     }
+    if (res != 0) {
+        errno = res;
+        PLOG(ERROR) << "spawn in " << caller;
+        return -1;
+    }
+    return pid;
+}
 
-    pipe_write.reset();
-    auto st = ReadLinesFromFdAndLog(output, std::move(pipe_read));
-    if (st != 0) return st;
-
+static status_t WaitForExit(pid_t pid, const char* caller) {
     int status;
-    if (waitpid(pid, &status, 0) == -1) {
-        PLOG(ERROR) << "waitpid in ForkExecvp";
+    if (TEMP_FAILURE_RETRY(waitpid(pid, &status, 0)) == -1) {
+        PLOG(ERROR) << "waitpid in " << caller;
         return -errno;
     }
     if (!WIFEXITED(status)) {
@@ -754,75 +979,118 @@ status_t ForkExecvp(const std::vector<std::string>& args, std::vector<std::strin
     return OK;
 }
 
+status_t ForkExecvpStreaming(const std::vector<std::string>& args, const ExecLineCallback& onLine,
+                             char* context) {
+    android::base::unique_fd pipe_read, pipe_write;
+    if (!android::base::Pipe(&pipe_read, &pipe_write)) {
+        PLOG(ERROR) << "Pipe in ForkExecvp";
+        return -errno;
+    }
+
+    // Both ends are close-on-exec, so only the dup2() copy survives into the child.
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, pipe_write.get(), STDOUT_FILENO);
+    pid_t pid = SpawnProcess(args, context, &actions, "ForkExecvp");
+    posix_spawn_file_actions_destroy(&actions);
+    if (pid == -1) {
+        return -errno;
+    }
+
+    pipe_write.reset();
+    auto st = ReadLinesFromFdAndLog(onLine, std::move(pipe_read));
+    status_t exit = WaitForExit(pid, "ForkExecvp");
+    return st != OK ? st : exit;
+}
+
+status_t ForkExecvp(const std::vector<std::string>& args, std::vector<std::string>* output,
+                    char* context) {
+    if (output) output->clear();
+    return ForkExecvpStreaming(
+            args,
+            [output](std::string_view line) {
+                if (output) output->emplace_back(line);
+            },
+            context);
+}
+
 status_t ForkExecvpTimeout(const std::vector<std::string>& args, std::chrono::seconds timeout,
                            char* context) {
-    int status;
+    pid_t pid = ForkExecvpAsync(args, context);
+    if (pid == -1) {
+        return -errno;
+    }
 
-    pid_t wait_timeout_pid = fork();
-    if (wait_timeout_pid == 0) {
-        pid_t pid = ForkExecvpAsync(args, context);
-        if (pid == -1) {
-            _exit(EXIT_FAILURE);
-        }
-        pid_t timer_pid = fork();
-        if (timer_pid == 0) {
-            std::this_thread::sleep_for(timeout);
-            _exit(ETIMEDOUT);
+    // The pidfd becomes readable when the process exits; without one, poll for the exit.
+    android::base::unique_fd pidFd(syscall(__NR_pidfd_open, pid, 0));
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (true) {
+        int status;
+        pid_t res = TEMP_FAILURE_RETRY(waitpid(pid, &status, WNOHANG));
+        if (res == -1) {
+            PLOG(ERROR) << "waitpid in ForkExecvpTimeout";
+            return -errno;
         }
-        if (timer_pid == -1) {
-            PLOG(ERROR) << "fork in ForkExecvpAsync_timeout";
-            kill(pid, SIGTERM);
-            _exit(EXIT_FAILURE);
+        if (res == pid) {
+            if (!WIFEXITED(status)) {
+                LOG(ERROR) << "Process did not exit normally, status: " << status;
+                return -ECHILD;
+            }
+            if (WEXITSTATUS(status)) {
+                LOG(ERROR) << "Process exited with code: " << WEXITSTATUS(status);
+                return WEXITSTATUS(status);
+            }
+            return OK;
         }
-        pid_t finished = wait(&status);
-        if (finished == pid) {
-            kill(timer_pid, SIGTERM);
+
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now());
+        if (left.count() <= 0) break;
+        if (pidFd != -1) {
+            struct pollfd pfd = {pidFd.get(), POLLIN, 0};
+            TEMP_FAILURE_RETRY(poll(&pfd, 1, left.count()));
         } else {
-            kill(pid, SIGTERM);
+            std::this_thread::sleep_for(std::min(left, std::chrono::milliseconds(10)));
         }
-        if (!WIFEXITED(status)) {
-            _exit(ECHILD);
-        }
-        _exit(WEXITSTATUS(status));
-    }
-    if (waitpid(wait_timeout_pid, &status, 0) == -1) {
-        PLOG(ERROR) << "waitpid in ForkExecvpAsync_timeout";
-        return -errno;
-    }
-    if (!WIFEXITED(status)) {
-        LOG(ERROR) << "Process did not exit normally, status: " << status;
-        return -ECHILD;
-    }
-    if (WEXITSTATUS(status)) {
-        LOG(ERROR) << "Process exited with code: " << WEXITSTATUS(status);
-        return WEXITSTATUS(status);
     }
-    return OK;
+
+    // Reaped in the background, so that a process stuck in the kernel can't hold up vold.
+    LOG(ERROR) << "Process timed out after " << timeout.count() << "s, killing it";
+    kill(pid, SIGTERM);
+    std::thread([pid] { TEMP_FAILURE_RETRY(waitpid(pid, nullptr, 0)); }).detach();
+    return ETIMEDOUT;
 }
 
 pid_t ForkExecvpAsync(const std::vector<std::string>& args, char* context) {
-    auto argv = ConvertToArgv(args);
-
-    pid_t pid = fork();
-    if (pid == 0) {
-        close(STDIN_FILENO);
-        close(STDOUT_FILENO);
-        close(STDERR_FILENO);
-        if (context) {
-            if (setexeccon(context)) {
-                LOG(ERROR) << "Failed to setexeccon in ForkExecvpAsync";
-                abort();
-            }
-        }
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_addclose(&actions, STDIN_FILENO);
+    posix_spawn_file_actions_addclose(&actions, STDOUT_FILENO);
+    posix_spawn_file_actions_addclose(&actions, STDERR_FILENO);
+    pid_t pid = SpawnProcess(args, context, &actions, "ForkExecvpAsync");
+    posix_spawn_file_actions_destroy(&actions);
+    return pid;
+}
 
-        execvp(argv[0], const_cast<char**>(argv.data()));
-        PLOG(ERROR) << "exec in ForkExecvpAsync";
-        _exit(EXIT_FAILURE);
-    }
-    if (pid == -1) {
-        PLOG(ERROR) << "fork in ForkExecvpAsync";
+pid_t ForkExecvpConnected(const std::vector<std::string>& args, android::base::unique_fd* in,
+                          android::base::unique_fd* out, char* context) {
+    android::base::unique_fd in_read, in_write, out_read, out_write;
+    if (!android::base::Pipe(&in_read, &in_write) || !android::base::Pipe(&out_read, &out_write)) {
+        PLOG(ERROR) << "Pipe in ForkExecvpConnected";
         return -1;
     }
+
+    // All ends are close-on-exec, so only the dup2() copies survive into the child.
+    posix_spawn_file_actions_t actions;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawn_file_actions_adddup2(&actions, in_read.get(), STDIN_FILENO);
+    posix_spawn_file_actions_adddup2(&actions, out_write.get(), STDOUT_FILENO);
+    pid_t pid = SpawnProcess(args, context, &actions, "ForkExecvpConnected");
+    posix_spawn_file_actions_destroy(&actions);
+    if (pid != -1) {
+        *in = std::move(in_write);
+        *out = std::move(out_read);
+    }
     return pid;
 }
 
@@ -915,10 +1183,11 @@ status_t StrToHex(const std::string& str, std::string& hex) {
 }
 
 status_t StrToHex(const KeyBuffer& str, KeyBuffer& hex) {
-    hex.clear();
+    // Sized once, so the key isn't left behind in buffers outgrown along the way
+    hex.assign(str.size() * 2, 0);
     for (size_t i = 0; i < str.size(); i++) {
-        hex.push_back(kLookup[(str.data()[i] & 0xF0) >> 4]);
-        hex.push_back(kLookup[str.data()[i] & 0x0F]);
+        hex[2 * i] = kLookup[(str.data()[i] & 0xF0) >> 4];
+        hex[2 * i + 1] = kLookup[str.data()[i] & 0x0F];
     }
     return OK;
 }
@@ -976,64 +1245,8 @@ uint64_t GetFreeBytes(const std::string& path) {
     }
 }
 
-// TODO: borrowed from frameworks/native/libs/diskusage/ which should
-// eventually be migrated into system/
-static int64_t stat_size(struct stat* s) {
-    int64_t blksize = s->st_blksize;
-    // count actual blocks used instead of nominal file size
-    int64_t size = s->st_blocks * 512;
-
-    if (blksize) {
-        /* round up to filesystem block size */
-        size = (size + blksize - 1) & (~(blksize - 1));
-    }
-
-    return size;
-}
-
-// TODO: borrowed from frameworks/native/libs/diskusage/ which should
-// eventually be migrated into system/
-int64_t calculate_dir_size(int dfd) {
-    int64_t size = 0;
-    struct stat s;
-    DIR* d;
-    struct dirent* de;
-
-    d = fdopendir(dfd);
-    if (d == NULL) {
-        close(dfd);
-        return 0;
-    }
-
-    while ((de = readdir(d))) {
-        const char* name = de->d_name;
-        if (fstatat(dfd, name, &s, AT_SYMLINK_NOFOLLOW) == 0) {
-            size += stat_size(&s);
-        }
-        if (de->d_type == DT_DIR) {
-            int subfd;
-
-            /* always skip "." and ".." */
-            if (IsDotOrDotDot(*de)) continue;
-
-            subfd = openat(dfd, name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
-            if (subfd >= 0) {
-                size += calculate_dir_size(subfd);
-            }
-        }
-    }
-    closedir(d);
-    return size;
-}
-
 uint64_t GetTreeBytes(const std::string& path) {
-    int dirfd = open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
-    if (dirfd < 0) {
-        PLOG(WARNING) << "Failed to open " << path;
-        return -1;
-    } else {
-        return calculate_dir_size(dirfd);
-    }
+    return GetTreeAllocatedBytes(path);
 }
 
 // TODO: Use a better way to determine if it's media provider app.
@@ -1067,33 +1280,54 @@ bool IsSdcardfsUsed() {
            base::GetBoolProperty(kExternalStorageSdcardfs, true);
 }
 
-status_t WipeBlockDevice(const std::string& path) {
-    status_t res = -1;
-    const char* c_path = path.c_str();
-    uint64_t range[2] = {0, 0};
+status_t WipeBlockDevice(const std::string& path, const WipeProgressCallback& onProgress) {
+    // Keeps each discard short enough for progress to move and an abort to be noticed
+    static constexpr uint64_t kMaxDiscardChunk = 256 * 1024 * 1024;
 
-    int fd = TEMP_FAILURE_RETRY(open(c_path, O_RDWR | O_CLOEXEC));
+    android::base::unique_fd fd(TEMP_FAILURE_RETRY(open(path.c_str(), O_RDWR | O_CLOEXEC)));
     if (fd == -1) {
         PLOG(ERROR) << "Failed to open " << path;
-        goto done;
+        return -errno;
     }
 
-    if (GetBlockDevSize(fd, &range[1]) != OK) {
+    uint64_t size;
+    if (GetBlockDevSize(fd, &size) != OK) {
         PLOG(ERROR) << "Failed to determine size of " << path;
-        goto done;
+        return -EIO;
     }
 
-    LOG(INFO) << "About to discard " << range[1] << " on " << path;
-    if (ioctl(fd, BLKDISCARD, &range) == 0) {
-        LOG(INFO) << "Discard success on " << path;
-        res = 0;
-    } else {
-        PLOG(ERROR) << "Discard failure on " << path;
+    uint64_t chunk = kMaxDiscardChunk;
+    struct stat st;
+    if (fstat(fd, &st) == 0) {
+        uint64_t maxBytes, granularity;
+        if (GetBlockQueueAttribute(st.st_rdev, "discard_max_bytes", &maxBytes)) {
+            if (maxBytes == 0) {
+                LOG(INFO) << path << " doesn't support discard; not wiping";
+                return -EOPNOTSUPP;
+            }
+            chunk = std::min(chunk, maxBytes);
+        }
+        if (GetBlockQueueAttribute(st.st_rdev, "discard_granularity", &granularity) &&
+            granularity != 0 && chunk > granularity) {
+            chunk -= chunk % granularity;
+        }
     }
 
-done:
-    close(fd);
-    return res;
+    LOG(INFO) << "About to discard " << size << " on " << path << " in chunks of " << chunk;
+    for (uint64_t done = 0; done < size;) {
+        uint64_t range[2] = {done, std::min(chunk, size - done)};
+        if (ioctl(fd, BLKDISCARD, &range) != 0) {
+            PLOG(ERROR) << "Discard failure on " << path << " at " << done;
+            return errno == EOPNOTSUPP ? -EOPNOTSUPP : -EIO;
+        }
+        done += range[1];
+        if (onProgress && !onProgress(done, size)) {
+            LOG(INFO) << "Discard stopped on " << path << " after " << done;
+            return -ECANCELED;
+        }
+    }
+    LOG(INFO) << "Discard success on " << path;
+    return OK;
 }
 
 static bool isValidFilename(const std::string& name) {
@@ -1210,6 +1444,26 @@ status_t RestoreconRecursive(const std::string& path) {
     return OK;
 }
 
+status_t RestoreconTrees(const std::vector<std::string>& paths) {
+    if (sehandle != nullptr && base::GetBoolProperty(kParallelRestoreconProp, false)) {
+        auto start = std::chrono::steady_clock::now();
+        status_t res = RelabelTrees(paths, sehandle);
+        if (res == OK) {
+            LOG(DEBUG) << "Finished parallel restorecon of " << base::Join(paths, ", ") << " in "
+                       << std::chrono::duration_cast<std::chrono::milliseconds>(
+                                  std::chrono::steady_clock::now() - start)
+                                  .count()
+                       << "ms";
+            return OK;
+        }
+        LOG(WARNING) << "Parallel restorecon failed with " << res << ", handing it to init";
+    }
+    for (const auto& path : paths) {
+        RestoreconRecursive(path);
+    }
+    return OK;
+}
+
 bool Readlinkat(int dirfd, const std::string& path, std::string* result) {
     // Shamelessly borrowed from android::base::Readlink()
     result->clear();
@@ -1281,50 +1535,6 @@ bool IsDotOrDotDot(const struct dirent& ent) {
     return strcmp(ent.d_name, ".") == 0 || strcmp(ent.d_name, "..") == 0;
 }
 
-static status_t delete_dir_contents(DIR* dir) {
-    // Shamelessly borrowed from android::installd
-    int dfd = dirfd(dir);
-    if (dfd < 0) {
-        return -errno;
-    }
-
-    status_t result = OK;
-    struct dirent* de;
-    while ((de = readdir(dir))) {
-        const char* name = de->d_name;
-        if (de->d_type == DT_DIR) {
-            /* always skip "." and ".." */
-            if (IsDotOrDotDot(*de)) continue;
-
-            android::base::unique_fd subfd(
-                openat(dfd, name, O_RDONLY | O_DIRECTORY | O_NOFOLLOW | O_CLOEXEC));
-            if (subfd.get() == -1) {
-                PLOG(ERROR) << "Couldn't openat " << name;
-                result = -errno;
-                continue;
-            }
-            std::unique_ptr<DIR, decltype(&closedir)> subdirp(
-                android::base::Fdopendir(std::move(subfd)), closedir);
-            if (!subdirp) {
-                PLOG(ERROR) << "Couldn't fdopendir " << name;
-                result = -errno;
-                continue;
-            }
-            result = delete_dir_contents(subdirp.get());
-            if (unlinkat(dfd, name, AT_REMOVEDIR) < 0) {
-                PLOG(ERROR) << "Couldn't unlinkat " << name;
-                result = -errno;
-            }
-        } else {
-            if (unlinkat(dfd, name, 0) < 0) {
-                PLOG(ERROR) << "Couldn't unlinkat " << name;
-                result = -errno;
-            }
-        }
-    }
-    return result;
-}
-
 status_t DeleteDirContentsAndDir(const std::string& pathname) {
     status_t res = DeleteDirContents(pathname);
     if (res < 0) {
@@ -1339,16 +1549,7 @@ status_t DeleteDirContentsAndDir(const std::string& pathname) {
 }
 
 status_t DeleteDirContents(const std::string& pathname) {
-    // Shamelessly borrowed from android::installd
-    std::unique_ptr<DIR, decltype(&closedir)> dirp(opendir(pathname.c_str()), closedir);
-    if (!dirp) {
-        if (errno == ENOENT) {
-            return OK;
-        }
-        PLOG(ERROR) << "Failed to opendir " << pathname;
-        return -errno;
-    }
-    return delete_dir_contents(dirp.get());
+    return RemoveTree(pathname, false);
 }
 
 // TODO(118708649): fix duplication with init/util.h
@@ -1552,6 +1753,64 @@ void ConfigureReadAheadForFuse(const std::string& fuse_mount, size_t read_ahead_
     }
 }
 
+bool GetBlockQueueAttribute(dev_t dev, const std::string& name, uint64_t* value) {
+    // A partition has no queue of its own, but ".." from its sysfs node leads to its disk
+    auto node = StringPrintf("/sys/dev/block/%u:%u", major(dev), minor(dev));
+    for (const auto& queue : {node + "/queue/", node + "/../queue/"}) {
+        std::string contents;
+        if (ReadFileToString(queue + name, &contents) &&
+            android::base::ParseUint(android::base::Trim(contents), value)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+FuseTuning GetFuseTuning(const std::string& kind, const std::string& lower_path) {
+    // Read ahead no less than the lower device itself does, and at least one of its largest
+    // requests, so that streaming through FUSE keeps the device as busy as direct reads
+    static constexpr size_t kMinReadAheadKb = 256;
+    static constexpr size_t kMaxReadAheadKb = 2048;
+    size_t read_ahead_kb = kMinReadAheadKb;
+    struct stat sb;
+    if (stat(lower_path.c_str(), &sb) == 0) {
+        for (const char* attr : {"read_ahead_kb", "max_sectors_kb"}) {
+            uint64_t kb;
+            if (GetBlockQueueAttribute(sb.st_dev, attr, &kb)) {
+                read_ahead_kb = std::max(read_ahead_kb, static_cast<size_t>(kb));
+            }
+        }
+        read_ahead_kb = std::min(read_ahead_kb, kMaxReadAheadKb);
+    } else {
+        PLOG(WARNING) << "Failed to stat " << lower_path;
+    }
+
+    // The dirty pages FUSE may hold are taken from everyone else; where RAM is tight, hand
+    // over less of it
+    static constexpr uint64_t kLowRamBytes = 2ULL << 30;
+    unsigned int max_ratio = 40;
+    struct sysinfo info;
+    if (sysinfo(&info) == 0 &&
+        static_cast<uint64_t>(info.totalram) * info.mem_unit < kLowRamBytes) {
+        max_ratio = 20;
+    }
+
+    auto prefix = "ro.vold.fuse." + kind + ".";
+    return FuseTuning{
+            .read_ahead_kb = android::base::GetUintProperty(prefix + "read_ahead_kb",
+                                                            read_ahead_kb),
+            .max_ratio = android::base::GetUintProperty(prefix + "max_ratio", max_ratio, 100u),
+    };
+}
+
+void ConfigureFuse(const std::string& fuse_mount, FuseTuning tuning, int read_ahead_kb,
+                   int max_ratio) {
+    if (read_ahead_kb >= 0) tuning.read_ahead_kb = read_ahead_kb;
+    if (max_ratio >= 0) tuning.max_ratio = max_ratio;
+    ConfigureReadAheadForFuse(fuse_mount, tuning.read_ahead_kb);
+    ConfigureMaxDirtyRatioForFuse(fuse_mount, tuning.max_ratio);
+}
+
 status_t MountUserFuse(userid_t user_id, const std::string& absolute_lower_path,
                        const std::string& relative_upper_path, android::base::unique_fd* fuse_fd) {
     std::string pre_fuse_path(StringPrintf("/mnt/user/%d", user_id));
@@ -1687,12 +1946,31 @@ status_t UnmountUserFuse(userid_t user_id, const std::string& absolute_lower_pat
     return result;
 }
 
+bool ForgetPreparedAndroidDirs(const std::string& volumeRoot) {
+    std::lock_guard<std::mutex> lock(kPreparedAndroidDirsLock);
+    return kPreparedAndroidDirs.erase(volumeRoot) != 0;
+}
+
 status_t PrepareAndroidDirs(const std::string& volumeRoot) {
     std::string androidDir = volumeRoot + kAndroidDir;
     std::string androidDataDir = volumeRoot + kAppDataDir;
     std::string androidObbDir = volumeRoot + kAppObbDir;
     std::string androidMediaDir = volumeRoot + kAppMediaDir;
 
+    // A root prepared before only needs its Android/ to still be the one that was prepared.
+    struct stat sb;
+    {
+        std::lock_guard<std::mutex> lock(kPreparedAndroidDirsLock);
+        auto prepared = kPreparedAndroidDirs.find(volumeRoot);
+        if (prepared != kPreparedAndroidDirs.end()) {
+            if (lstat(androidDir.c_str(), &sb) == 0 && S_ISDIR(sb.st_mode) &&
+                std::make_pair(sb.st_dev, sb.st_ino) == prepared->second) {
+                return OK;
+            }
+            kPreparedAndroidDirs.erase(prepared);
+        }
+    }
+
     bool useSdcardFs = IsSdcardfsUsed();
 
     // mode 0771 + sticky bit for inheriting GIDs
@@ -1723,6 +2001,10 @@ status_t PrepareAndroidDirs(const std::string& volumeRoot) {
         return -errno;
     }
 
+    if (lstat(androidDir.c_str(), &sb) == 0) {
+        std::lock_guard<std::mutex> lock(kPreparedAndroidDirsLock);
+        kPreparedAndroidDirs[volumeRoot] = {sb.st_dev, sb.st_ino};
+    }
     return OK;
 }
 
@@ -26,8 +26,11 @@
 #include <utils/Errors.h>
 
 #include <chrono>
+#include <functional>
+#include <list>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 struct DIR;
@@ -69,7 +72,7 @@ int SetQuotaProjectId(const std::string& path, long projectId);
  * (eg, /Android/data/com.foo, /Android/obb/com.foo, etc.)
  */
 int PrepareAppDirFromRoot(const std::string& path, const std::string& root, int appUid,
-                          bool fixupExisting);
+                          bool fixupExisting, bool prepareAndroidDirs = true);
 
 /* fs_prepare_dir wrapper that creates with SELinux context */
 status_t PrepareDir(const std::string& path, mode_t mode, uid_t uid, gid_t gid,
@@ -77,6 +80,11 @@ status_t PrepareDir(const std::string& path, mode_t mode, uid_t uid, gid_t gid,
 
 /* Really unmounts the path, killing active processes along the way */
 status_t ForceUnmount(const std::string& path);
+/*
+ * ForceUnmount() for many paths, in the given order, with children before their parents.
+ * Processes are looked for once per signal for all the paths still mounted, not per path.
+ */
+status_t ForceUnmountAll(const std::vector<std::string>& paths);
 
 /* Kills any processes using given path */
 status_t KillProcessesUsingPath(const std::string& path);
@@ -87,6 +95,17 @@ status_t KillProcessesWithTmpfsMountPrefix(const std::string& path);
 /* Creates bind mount from source to target */
 status_t BindMount(const std::string& source, const std::string& target);
 
+/*
+ * Bind mounts each source on its target, and adds the targets mounted to the front of mounted.
+ * Every source is cloned with open_tree() before any target is touched, so a bad source fails
+ * the whole set with nothing mounted; kernels without the new mount API get BindMount() calls.
+ */
+status_t BindMounts(const std::vector<std::pair<std::string, std::string>>& mounts,
+                    std::list<std::string>* mounted);
+
+/* Clears the read-only flag of the mount at path, keeping its other flags */
+status_t RemountBindWritable(const std::string& path);
+
 /** Creates a symbolic link to target */
 status_t Symlink(const std::string& target, const std::string& linkpath);
 
@@ -106,13 +125,26 @@ status_t ReadMetadata(const std::string& path, std::string* fsType, std::string*
 status_t ReadMetadataUntrusted(const std::string& path, std::string* fsType, std::string* fsUuid,
                                std::string* fsLabel);
 
+/* Called with each line a command prints, newline included, only valid during the call */
+using ExecLineCallback = std::function<void(std::string_view line)>;
+
 /* Returns either WEXITSTATUS() status, or a negative errno */
 status_t ForkExecvp(const std::vector<std::string>& args,
                     std::vector<std::string>* output = nullptr, char* context = nullptr);
+/* Like ForkExecvp(), but hands the output to onLine as it is read instead of collecting it */
+status_t ForkExecvpStreaming(const std::vector<std::string>& args, const ExecLineCallback& onLine,
+                             char* context = nullptr);
 status_t ForkExecvpTimeout(const std::vector<std::string>& args, std::chrono::seconds timeout,
                            char* context = nullptr);
 
 pid_t ForkExecvpAsync(const std::vector<std::string>& args, char* context = nullptr);
+/*
+ * Starts args with pipes as its stdin and stdout, for helpers that serve requests a line at a
+ * time, and hands back the end to write requests to in in and the end to read replies from in
+ * out. Returns the pid or -1.
+ */
+pid_t ForkExecvpConnected(const std::vector<std::string>& args, android::base::unique_fd* in,
+                          android::base::unique_fd* out, char* context = nullptr);
 
 /* Gets block device size in bytes */
 status_t GetBlockDevSize(int fd, uint64_t* size);
@@ -140,8 +172,16 @@ bool IsFilesystemSupported(const std::string& fsType);
 bool IsSdcardfsUsed();
 bool IsFuseDaemon(const pid_t pid);
 
-/* Wipes contents of block device at given path */
-status_t WipeBlockDevice(const std::string& path);
+/* Called with the bytes wiped so far and the total; returning false stops the wipe */
+using WipeProgressCallback = std::function<bool(uint64_t done, uint64_t total)>;
+
+/*
+ * Wipes contents of block device at given path, with discards of at most discard_max_bytes
+ * so the wipe can report progress and stop between them. Returns -EOPNOTSUPP without trying
+ * when the device doesn't support discard, and -ECANCELED when onProgress stopped it.
+ */
+status_t WipeBlockDevice(const std::string& path,
+                         const WipeProgressCallback& onProgress = nullptr);
 
 std::string BuildKeyPath(const std::string& partGuid);
 
@@ -170,6 +210,10 @@ status_t EnsureDirExists(const std::string& path, mode_t mode, uid_t uid, gid_t
 
 status_t RestoreconRecursive(const std::string& path);
 
+// Restorecon of trees labeled from file_contexts alone, done in parallel by vold itself where
+// it is allowed to relabel them, and otherwise by init one tree at a time.
+status_t RestoreconTrees(const std::vector<std::string>& paths);
+
 // TODO: promote to android::base
 bool Readlinkat(int dirfd, const std::string& path, std::string* result);
 
@@ -199,13 +243,39 @@ void ConfigureMaxDirtyRatioForFuse(const std::string& fuse_mount, unsigned int m
 
 void ConfigureReadAheadForFuse(const std::string& fuse_mount, size_t read_ahead_kb);
 
+/* Reads a queue attribute of the block device behind |dev|, or of its disk for a partition */
+bool GetBlockQueueAttribute(dev_t dev, const std::string& name, uint64_t* value);
+
+/* Read-ahead and dirty page share of a FUSE filesystem */
+struct FuseTuning {
+    size_t read_ahead_kb;
+    unsigned int max_ratio;
+};
+
+/*
+ * Picks the tuning of a FUSE filesystem of the volume kind |kind| ("emulated" or "public")
+ * stacked on |lower_path|. Each value can be set for a kind with ro.vold.fuse.<kind>.*,
+ * and otherwise follows the lower block device and the amount of RAM.
+ */
+FuseTuning GetFuseTuning(const std::string& kind, const std::string& lower_path);
+
+/* Applies |tuning|, with any non-negative override taking the place of its value */
+void ConfigureFuse(const std::string& fuse_mount, FuseTuning tuning, int read_ahead_kb = -1,
+                   int max_ratio = -1);
+
 status_t MountUserFuse(userid_t user_id, const std::string& absolute_lower_path,
                        const std::string& relative_upper_path, android::base::unique_fd* fuse_fd);
 
 status_t UnmountUserFuse(userid_t userId, const std::string& absolute_lower_path,
                          const std::string& relative_upper_path);
 
+/*
+ * Sets up the Android/ directories of a volume root. Once it has, later calls for the root only
+ * check that Android/ is still the same directory, until ForgetPreparedAndroidDirs().
+ */
 status_t PrepareAndroidDirs(const std::string& volumeRoot);
+/* Makes PrepareAndroidDirs() set up volumeRoot in full again; returns whether it was prepared */
+bool ForgetPreparedAndroidDirs(const std::string& volumeRoot);
 
 bool IsFuseBpfEnabled();
 
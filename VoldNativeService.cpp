@@ -19,30 +19,41 @@
 #include "VoldNativeService.h"
 
 #include <android-base/logging.h>
+#include <android-base/macros.h>
+#include <android-base/stringprintf.h>
 #include <android-base/strings.h>
 #include <fs_mgr.h>
 #include <fscrypt/fscrypt.h>
 #include <private/android_filesystem_config.h>
 #include <utils/Trace.h>
 
+#include <inttypes.h>
 #include <stdio.h>
+#include <sys/stat.h>
+#include <atomic>
+#include <chrono>
 #include <fstream>
-#include <thread>
+#include <map>
+#include <mutex>
 
 #include "Benchmark.h"
+#include "CallStats.h"
 #include "Checkpoint.h"
+#include "EncryptInplace.h"
 #include "FsCrypt.h"
 #include "IdleMaint.h"
 #include "KeyStorage.h"
 #include "Keystore.h"
 #include "MetadataCrypt.h"
 #include "MoveStorage.h"
+#include "TaskExecutor.h"
 #include "VoldNativeServiceValidation.h"
 #include "VoldUtil.h"
 #include "VolumeManager.h"
 #include "cryptfs.h"
 #include "incfs.h"
 
+using android::base::StringPrintf;
 using namespace std::literals;
 
 namespace android {
@@ -74,12 +85,15 @@ static binder::Status translateBool(bool status) {
     }
 }
 
-#define ENFORCE_SYSTEM_OR_ROOT                              \
-    {                                                       \
-        binder::Status status = CheckUidOrRoot(AID_SYSTEM); \
-        if (!status.isOk()) {                               \
-            return status;                                  \
-        }                                                   \
+// Nearly every method starts with this, so it also times each call for dump()
+#define ENFORCE_SYSTEM_OR_ROOT                                     \
+    static CallStats* const sCallStats = CallStats::Get(__func__); \
+    ScopedCallStats callStats(sCallStats);                         \
+    {                                                              \
+        binder::Status status = CheckUidOrRoot(AID_SYSTEM);        \
+        if (!status.isOk()) {                                      \
+            return status;                                         \
+        }                                                          \
     }
 
 #define CHECK_ARGUMENT_ID(id)                          \
@@ -106,14 +120,95 @@ static binder::Status translateBool(bool status) {
         }                                                \
     }
 
-#define ACQUIRE_LOCK                                                        \
-    std::lock_guard<std::mutex> lock(VolumeManager::Instance()->getLock()); \
+// Waiting longer than this for one of the locks below gets logged, with who was holding it
+constexpr auto kLockContentionWarning = 100ms;
+
+std::atomic<const char*> sLockHolder(nullptr);
+std::atomic<const char*> sCryptLockHolder(nullptr);
+
+// A lock_guard that traces and reports time spent waiting for a lock another method holds
+class ContendedLockGuard {
+  public:
+    ContendedLockGuard(std::mutex& mutex, std::atomic<const char*>& holder, const char* name,
+                       const char* func)
+        : mMutex(mutex), mHolder(holder) {
+        if (!mMutex.try_lock()) {
+            const char* owner = mHolder.load();
+            std::string section = StringPrintf("%s contention", name);
+            ATRACE_BEGIN(section.c_str());
+            auto start = std::chrono::steady_clock::now();
+            mMutex.lock();
+            auto wait = std::chrono::steady_clock::now() - start;
+            ATRACE_END();
+            CallStats::Get(func)->recordLockWait(wait);
+            if (wait >= kLockContentionWarning) {
+                LOG(WARNING) << func << " waited "
+                             << std::chrono::duration_cast<std::chrono::milliseconds>(wait).count()
+                             << "ms for " << name << " held by "
+                             << (owner ? owner : "a non-binder thread");
+            }
+        }
+        mHolder = func;
+    }
+    ~ContendedLockGuard() {
+        mHolder = nullptr;
+        mMutex.unlock();
+    }
+
+  private:
+    std::mutex& mMutex;
+    std::atomic<const char*>& mHolder;
+
+    DISALLOW_COPY_AND_ASSIGN(ContendedLockGuard);
+};
+
+#define ACQUIRE_LOCK                                                                     \
+    ContendedLockGuard lock(VolumeManager::Instance()->getLock(), sLockHolder, "lock",   \
+                            __func__);                                                   \
     ATRACE_CALL();
 
-#define ACQUIRE_CRYPT_LOCK                                                       \
-    std::lock_guard<std::mutex> lock(VolumeManager::Instance()->getCryptLock()); \
+#define ACQUIRE_CRYPT_LOCK                                                               \
+    ContendedLockGuard lock(VolumeManager::Instance()->getCryptLock(), sCryptLockHolder, \
+                            "crypt lock", __func__);                                     \
     ATRACE_CALL();
 
+// What each IncFS mount was last set up with by vold, by the device of the mount, so that
+// setIncFsMountOptions() calls that change nothing don't remount. Each mount replaces whatever
+// an earlier mount with the same device left behind.
+struct IncFsMountState {
+    bool readLogs;
+    bool readTimeouts;
+    std::string sysfsName;
+
+    bool operator==(const IncFsMountState& other) const {
+        return readLogs == other.readLogs && readTimeouts == other.readTimeouts &&
+               sysfsName == other.sysfsName;
+    }
+};
+
+std::mutex sIncFsMountsLock;
+std::map<dev_t, IncFsMountState> sIncFsMounts;
+
+// Returns the device of the IncFS mount that fd, a control file or the root, is on, or 0.
+dev_t incFsDevice(int fd) {
+    struct stat st;
+    return fd >= 0 && fstat(fd, &st) == 0 ? st.st_dev : 0;
+}
+
+void setIncFsMountState(dev_t dev, std::optional<IncFsMountState> state) {
+    if (dev == 0) return;
+    std::lock_guard<std::mutex> lock(sIncFsMountsLock);
+    if (state) {
+        sIncFsMounts[dev] = std::move(*state);
+    } else {
+        sIncFsMounts.erase(dev);
+    }
+}
+
+std::string idleMaintKey(bool needGC) {
+    return needGC ? "idle_maint gc" : "idle_maint";
+}
+
 }  // namespace
 
 status_t VoldNativeService::start() {
@@ -135,6 +230,43 @@ status_t VoldNativeService::dump(int fd, const Vector<String16>& /* args */) {
         return PERMISSION_DENIED;
     }
 
+    // Doesn't need the lock, which is held for as long as encryptFstab() or a
+    // checkpoint restore runs.
+    EncryptInplaceStats stats;
+    get_encrypt_inplace_stats(&stats);
+    if (stats.bytes_total > 0) {
+        dprintf(fd, "In-place encryption %s: %" PRIu64 " of %" PRIu64 " bytes in %" PRIu64
+                    " ms, %.1f MB/s, ETA %" PRId64 " s\n",
+                stats.active ? "running" : "finished", stats.bytes_done, stats.bytes_total,
+                stats.elapsed_ms, stats.mb_per_sec, stats.eta_seconds);
+        dprintf(fd, "  read latency (2^i us): %s\n",
+                android::base::Join(stats.read_latency_hist, ' ').c_str());
+        dprintf(fd, "  write latency (2^i us): %s\n",
+                android::base::Join(stats.write_latency_hist, ' ').c_str());
+    }
+    auto checkpoint_stats = cp_getStats();
+    if (!checkpoint_stats.empty()) {
+        dprintf(fd, "Checkpoint:\n");
+        for (const auto& [name, value] : checkpoint_stats) {
+            dprintf(fd, "  %s: %" PRId64 "\n", name.c_str(), value);
+        }
+    }
+
+    auto idle_maint_history = GetIdleMaintHistory();
+    if (!idle_maint_history.empty()) {
+        dprintf(fd, "Idle maintenance runs:\n");
+        for (const auto& run : idle_maint_history) {
+            dprintf(fd,
+                    "  %" PRId64 ": trim %" PRId64 " bytes in %" PRId64 " ms, GC %" PRId64
+                    " segments in %" PRId64 " ms, dev GC %" PRId64 " ms%s%s\n",
+                    run.startTimeMs, run.trimBytes, run.trimMs, run.gcSegmentsReclaimed,
+                    run.gcMs, run.devGcMs, run.abortReason.empty() ? "" : ", ",
+                    run.abortReason.c_str());
+        }
+    }
+
+    CallStats::Dump(fd);
+
     ACQUIRE_LOCK;
     dprintf(fd, "vold is happy!\n");
     return NO_ERROR;
@@ -299,7 +431,9 @@ binder::Status VoldNativeService::unmount(const std::string& volId) {
     return translate(vol->unmount());
 }
 
-binder::Status VoldNativeService::format(const std::string& volId, const std::string& fsType) {
+binder::Status VoldNativeService::format(
+        const std::string& volId, const std::string& fsType,
+        const android::sp<android::os::IVoldTaskListener>& listener) {
     ENFORCE_SYSTEM_OR_ROOT;
     CHECK_ARGUMENT_ID(volId);
     ACQUIRE_LOCK;
@@ -308,7 +442,33 @@ binder::Status VoldNativeService::format(const std::string& volId, const std::st
     if (vol == nullptr) {
         return error("Failed to find volume " + volId);
     }
-    return translate(vol->format(fsType));
+    int res = vol->format(fsType, listener);
+    if (listener) {
+        android::os::PersistableBundle extras;
+        listener->onFinished(res, extras);
+    }
+    return translate(res);
+}
+
+binder::Status VoldNativeService::abortFormat(const std::string& volId) {
+    ENFORCE_SYSTEM_OR_ROOT;
+    CHECK_ARGUMENT_ID(volId);
+    // The format to abort holds the lock until it's done, so don't acquire it
+
+    return translate(VolumeManager::Instance()->abortFormat(volId));
+}
+
+binder::Status VoldNativeService::tuneFuse(const std::string& volId, int32_t readAheadKb,
+                                           int32_t maxRatio) {
+    ENFORCE_SYSTEM_OR_ROOT;
+    CHECK_ARGUMENT_ID(volId);
+    ACQUIRE_LOCK;
+
+    auto vol = VolumeManager::Instance()->findVolume(volId);
+    if (vol == nullptr) {
+        return error("Failed to find volume " + volId);
+    }
+    return translate(vol->tuneFuse(readAheadKb, maxRatio));
 }
 
 static binder::Status pathForVolId(const std::string& volId, std::string* path) {
@@ -333,18 +493,58 @@ static binder::Status pathForVolId(const std::string& volId, std::string* path)
     return Ok();
 }
 
+// Validates the options and queues the benchmark; callers hold the lock
+static binder::Status postBenchmark(const std::string& volId, const BenchmarkOptions& options,
+                                    const android::sp<android::os::IVoldTaskListener>& listener) {
+    // Keep the working set and run time within what a benchmark can reasonably ask for.
+    if (!(options.scale >= 0.01f && options.scale <= 16.0f)) {
+        return Exception(binder::Status::EX_ILLEGAL_ARGUMENT,
+                         "Benchmark scale " + std::to_string(options.scale) + " out of range");
+    }
+    int64_t timeBudgetMs = options.timeBudget.count();
+    if (timeBudgetMs < 1000 || timeBudgetMs > 10 * 60 * 1000) {
+        return Exception(binder::Status::EX_ILLEGAL_ARGUMENT,
+                         "Benchmark time budget " + std::to_string(timeBudgetMs) +
+                                 "ms out of range");
+    }
+
+    std::string path;
+    auto status = pathForVolId(volId, &path);
+    if (!status.isOk()) return status;
+
+    std::string key = StringPrintf("benchmark %s %.2f %" PRId64 " %d %d", path.c_str(),
+                                   options.scale, timeBudgetMs, options.directIo,
+                                   options.rawBlock);
+    TaskExecutor::Instance()->post(
+            TaskExecutor::kMaintenance, key, listener,
+            [=](const auto& taskListener) {
+                android::vold::Benchmark(path, options, taskListener);
+            });
+    return Ok();
+}
+
 binder::Status VoldNativeService::benchmark(
         const std::string& volId, const android::sp<android::os::IVoldTaskListener>& listener) {
     ENFORCE_SYSTEM_OR_ROOT;
     CHECK_ARGUMENT_ID(volId);
     ACQUIRE_LOCK;
 
-    std::string path;
-    auto status = pathForVolId(volId, &path);
-    if (!status.isOk()) return status;
+    return postBenchmark(volId, BenchmarkOptions(), listener);
+}
 
-    std::thread([=]() { android::vold::Benchmark(path, listener); }).detach();
-    return Ok();
+binder::Status VoldNativeService::benchmarkWithOptions(
+        const std::string& volId, float scale, int64_t timeBudgetMs, bool directIo,
+        bool rawBlock, const android::sp<android::os::IVoldTaskListener>& listener) {
+    ENFORCE_SYSTEM_OR_ROOT;
+    CHECK_ARGUMENT_ID(volId);
+    ACQUIRE_LOCK;
+
+    BenchmarkOptions options;
+    options.scale = scale;
+    options.timeBudget = std::chrono::milliseconds(timeBudgetMs);
+    options.directIo = directIo;
+    options.rawBlock = rawBlock;
+    return postBenchmark(volId, options, listener);
 }
 
 binder::Status VoldNativeService::moveStorage(
@@ -363,7 +563,11 @@ binder::Status VoldNativeService::moveStorage(
         return error("Failed to find volume " + toVolId);
     }
 
-    std::thread([=]() { android::vold::MoveStorage(fromVol, toVol, listener); }).detach();
+    TaskExecutor::Instance()->post(
+            TaskExecutor::kMove, "move " + fromVolId + " " + toVolId, listener,
+            [=](const auto& taskListener) {
+                android::vold::MoveStorage(fromVol, toVol, taskListener);
+            });
     return Ok();
 }
 
@@ -395,7 +599,7 @@ binder::Status VoldNativeService::unmountAppStorageDirs(int uid, int pid,
 binder::Status VoldNativeService::setupAppDir(const std::string& path, int32_t appUid) {
     ENFORCE_SYSTEM_OR_ROOT;
     CHECK_ARGUMENT_PATH(path);
-    ACQUIRE_LOCK;
+    ATRACE_CALL();
 
     return translate(VolumeManager::Instance()->setupAppDir(path, appUid));
 }
@@ -403,7 +607,7 @@ binder::Status VoldNativeService::setupAppDir(const std::string& path, int32_t a
 binder::Status VoldNativeService::ensureAppDirsCreated(const std::vector<std::string>& paths,
         int32_t appUid) {
     ENFORCE_SYSTEM_OR_ROOT;
-    ACQUIRE_LOCK;
+    ATRACE_CALL();
 
     return translate(VolumeManager::Instance()->ensureAppDirsCreated(paths, appUid));
 }
@@ -411,7 +615,7 @@ binder::Status VoldNativeService::ensureAppDirsCreated(const std::vector<std::st
 binder::Status VoldNativeService::fixupAppDir(const std::string& path, int32_t appUid) {
     ENFORCE_SYSTEM_OR_ROOT;
     CHECK_ARGUMENT_PATH(path);
-    ACQUIRE_LOCK;
+    ATRACE_CALL();
 
     return translate(VolumeManager::Instance()->fixupAppDir(path, appUid));
 }
@@ -464,7 +668,9 @@ binder::Status VoldNativeService::fstrim(
     ENFORCE_SYSTEM_OR_ROOT;
     ACQUIRE_LOCK;
 
-    std::thread([=]() { android::vold::Trim(listener); }).detach();
+    TaskExecutor::Instance()->post(
+            TaskExecutor::kMaintenance, "fstrim", listener,
+            [](const auto& taskListener) { android::vold::Trim(taskListener); });
     return Ok();
 }
 
@@ -473,7 +679,9 @@ binder::Status VoldNativeService::runIdleMaint(
     ENFORCE_SYSTEM_OR_ROOT;
     ACQUIRE_LOCK;
 
-    std::thread([=]() { android::vold::RunIdleMaint(needGC, listener); }).detach();
+    TaskExecutor::Instance()->post(
+            TaskExecutor::kMaintenance, idleMaintKey(needGC), listener,
+            [=](const auto& taskListener) { android::vold::RunIdleMaint(needGC, taskListener); });
     return Ok();
 }
 
@@ -482,7 +690,37 @@ binder::Status VoldNativeService::abortIdleMaint(
     ENFORCE_SYSTEM_OR_ROOT;
     ACQUIRE_LOCK;
 
-    std::thread([=]() { android::vold::AbortIdleMaint(listener); }).detach();
+    // Runs queued behind something else haven't started, so they only need to be dropped
+    TaskExecutor::Instance()->cancel(idleMaintKey(false));
+    TaskExecutor::Instance()->cancel(idleMaintKey(true));
+    TaskExecutor::Instance()->post(
+            TaskExecutor::kControl, "abort_idle_maint", listener,
+            [](const auto& taskListener) { android::vold::AbortIdleMaint(taskListener); });
+    return Ok();
+}
+
+binder::Status VoldNativeService::getIdleMaintHistory(
+        android::os::PersistableBundle* _aidl_return) {
+    ENFORCE_SYSTEM_OR_ROOT;
+
+    std::vector<int64_t> startTimeMs, trimBytes, trimMs, gcSegmentsReclaimed, gcMs, devGcMs;
+    std::vector<String16> abortReason;
+    for (const auto& run : GetIdleMaintHistory()) {
+        startTimeMs.push_back(run.startTimeMs);
+        trimBytes.push_back(run.trimBytes);
+        trimMs.push_back(run.trimMs);
+        gcSegmentsReclaimed.push_back(run.gcSegmentsReclaimed);
+        gcMs.push_back(run.gcMs);
+        devGcMs.push_back(run.devGcMs);
+        abortReason.push_back(String16(run.abortReason.c_str()));
+    }
+    _aidl_return->putLongVector(String16("startTimeMs"), startTimeMs);
+    _aidl_return->putLongVector(String16("trimBytes"), trimBytes);
+    _aidl_return->putLongVector(String16("trimMs"), trimMs);
+    _aidl_return->putLongVector(String16("gcSegmentsReclaimed"), gcSegmentsReclaimed);
+    _aidl_return->putLongVector(String16("gcMs"), gcMs);
+    _aidl_return->putLongVector(String16("devGcMs"), devGcMs);
+    _aidl_return->putStringVector(String16("abortReason"), abortReason);
     return Ok();
 }
 
@@ -494,6 +732,18 @@ binder::Status VoldNativeService::getStorageLifeTime(int32_t* _aidl_return) {
     return Ok();
 }
 
+binder::Status VoldNativeService::getStorageHealth(android::os::PersistableBundle* _aidl_return) {
+    ENFORCE_SYSTEM_OR_ROOT;
+
+    StorageHealth health;
+    GetStorageHealth(&health);
+    _aidl_return->putInt(String16("lifeTime"), health.lifeTime);
+    _aidl_return->putInt(String16("writeSegments"), health.writeSegments);
+    _aidl_return->putInt(String16("dirtySegments"), health.dirtySegments);
+    _aidl_return->putInt(String16("freeSegments"), health.freeSegments);
+    return Ok();
+}
+
 binder::Status VoldNativeService::setGCUrgentPace(int32_t neededSegments,
                                                   int32_t minSegmentThreshold,
                                                   float dirtyReclaimRate, float reclaimWeight,
@@ -590,6 +840,29 @@ binder::Status VoldNativeService::encryptFstab(const std::string& blkDevice,
                                                           fsType, zonedDevice));
 }
 
+// Deliberately doesn't take the lock: encryptFstab() holds it for the whole
+// encryption.
+binder::Status VoldNativeService::getEncryptionProgress(
+        android::os::PersistableBundle* _aidl_return) {
+    ENFORCE_SYSTEM_OR_ROOT;
+
+    EncryptInplaceStats stats;
+    get_encrypt_inplace_stats(&stats);
+    _aidl_return->putBoolean(String16("active"), stats.active);
+    _aidl_return->putLong(String16("bytesDone"), stats.bytes_done);
+    _aidl_return->putLong(String16("bytesTotal"), stats.bytes_total);
+    _aidl_return->putLong(String16("elapsedMs"), stats.elapsed_ms);
+    _aidl_return->putDouble(String16("mbPerSec"), stats.mb_per_sec);
+    _aidl_return->putLong(String16("etaSeconds"), stats.eta_seconds);
+    _aidl_return->putLongVector(
+            String16("readLatencyHistUs"),
+            std::vector<int64_t>(stats.read_latency_hist.begin(), stats.read_latency_hist.end()));
+    _aidl_return->putLongVector(
+            String16("writeLatencyHistUs"),
+            std::vector<int64_t>(stats.write_latency_hist.begin(), stats.write_latency_hist.end()));
+    return Ok();
+}
+
 binder::Status VoldNativeService::setStorageBindingSeed(const std::vector<uint8_t>& seed) {
     ENFORCE_SYSTEM_OR_ROOT;
     ACQUIRE_CRYPT_LOCK;
@@ -621,7 +894,7 @@ binder::Status VoldNativeService::setUserKeyProtection(int32_t userId, const std
 
 binder::Status VoldNativeService::getUnlockedUsers(std::vector<int>* _aidl_return) {
     ENFORCE_SYSTEM_OR_ROOT;
-    ACQUIRE_CRYPT_LOCK;
+    ATRACE_CALL();
 
     *_aidl_return = fscrypt_get_unlocked_users();
     return Ok();
@@ -782,6 +1055,17 @@ binder::Status VoldNativeService::resetCheckpoint() {
     return Ok();
 }
 
+// Doesn't need the lock, so that it can be called while a restore is running.
+binder::Status VoldNativeService::getCheckpointStats(
+        android::os::PersistableBundle* _aidl_return) {
+    ENFORCE_SYSTEM_OR_ROOT;
+
+    for (const auto& [name, value] : cp_getStats()) {
+        _aidl_return->putLong(String16(name.c_str()), value);
+    }
+    return Ok();
+}
+
 static void initializeIncFs() {
     // Obtaining IncFS features triggers initialization of IncFS.
     incfs::features();
@@ -837,6 +1121,9 @@ binder::Status VoldNativeService::mountIncFs(
         return translate(-errno);
     }
     auto fds = control.releaseFds();
+    setIncFsMountState(incFsDevice(fds[CMD].get()),
+                       IncFsMountState{.readLogs = false, .readTimeouts = true,
+                                       .sysfsName = sysfsName});
     using android::base::unique_fd;
     _aidl_return->cmd.reset(unique_fd(fds[CMD].release()));
     _aidl_return->pendingReads.reset(unique_fd(fds[PENDING_READS].release()));
@@ -857,6 +1144,7 @@ binder::Status VoldNativeService::unmountIncFs(const std::string& dir) {
     if (!fd.ok()) {
         return translate(-errno);
     }
+    setIncFsMountState(incFsDevice(fd.get()), std::nullopt);
     return translate(incfs::unmount(symLink));
 }
 
@@ -865,6 +1153,17 @@ binder::Status VoldNativeService::setIncFsMountOptions(
         bool enableReadLogs, bool enableReadTimeouts, const std::string& sysfsName) {
     ENFORCE_SYSTEM_OR_ROOT;
 
+    const auto dev = incFsDevice(control.cmd.get());
+    IncFsMountState requested{.readLogs = enableReadLogs,
+                              .readTimeouts = enableReadTimeouts,
+                              .sysfsName = sysfsName};
+    {
+        std::lock_guard<std::mutex> lock(sIncFsMountsLock);
+        if (auto it = sIncFsMounts.find(dev); it != sIncFsMounts.end() && it->second == requested) {
+            return Ok();
+        }
+    }
+
     auto incfsControl =
             incfs::createControl(control.cmd.get(), control.pendingReads.get(), control.log.get(),
                                  control.blocksWritten ? control.blocksWritten->get() : -1);
@@ -887,8 +1186,11 @@ binder::Status VoldNativeService::setIncFsMountOptions(
     for (;;) {
         const auto error = incfs::setOptions(incfsControl, options);
         if (!error) {
+            setIncFsMountState(dev, std::move(requested));
             return Ok();
         }
+        // A failed remount may have left any of the options applied.
+        setIncFsMountState(dev, std::nullopt);
         if (!enableReadLogs || error != -ENOMEM) {
             return binder::Status::fromServiceSpecificError(error);
         }
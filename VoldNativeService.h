@@ -56,9 +56,15 @@ class VoldNativeService : public BinderService<VoldNativeService>, public os::Bn
     binder::Status mount(const std::string& volId, int32_t mountFlags, int32_t mountUserId,
                          const android::sp<android::os::IVoldMountCallback>& callback);
     binder::Status unmount(const std::string& volId);
-    binder::Status format(const std::string& volId, const std::string& fsType);
+    binder::Status format(const std::string& volId, const std::string& fsType,
+                          const android::sp<android::os::IVoldTaskListener>& listener);
+    binder::Status abortFormat(const std::string& volId);
+    binder::Status tuneFuse(const std::string& volId, int32_t readAheadKb, int32_t maxRatio);
     binder::Status benchmark(const std::string& volId,
                              const android::sp<android::os::IVoldTaskListener>& listener);
+    binder::Status benchmarkWithOptions(
+            const std::string& volId, float scale, int64_t timeBudgetMs, bool directIo,
+            bool rawBlock, const android::sp<android::os::IVoldTaskListener>& listener);
 
     binder::Status moveStorage(const std::string& fromVolId, const std::string& toVolId,
                                const android::sp<android::os::IVoldTaskListener>& listener);
@@ -88,7 +94,9 @@ class VoldNativeService : public BinderService<VoldNativeService>, public os::Bn
     binder::Status runIdleMaint(bool needGC,
                                 const android::sp<android::os::IVoldTaskListener>& listener);
     binder::Status abortIdleMaint(const android::sp<android::os::IVoldTaskListener>& listener);
+    binder::Status getIdleMaintHistory(android::os::PersistableBundle* _aidl_return);
     binder::Status getStorageLifeTime(int32_t* _aidl_return);
+    binder::Status getStorageHealth(android::os::PersistableBundle* _aidl_return);
     binder::Status setGCUrgentPace(int32_t neededSegments, int32_t minSegmentThreshold,
                                    float dirtyReclaimRate, float reclaimWeight, int32_t gcPeriod,
                                    int32_t minGCSleepTime, int32_t targetDirtyRatio);
@@ -109,6 +117,7 @@ class VoldNativeService : public BinderService<VoldNativeService>, public os::Bn
     binder::Status encryptFstab(const std::string& blkDevice, const std::string& mountPoint,
                                 bool shouldFormat, const std::string& fsType,
                                 const std::string& zonedDevice);
+    binder::Status getEncryptionProgress(android::os::PersistableBundle* _aidl_return);
 
     binder::Status setStorageBindingSeed(const std::vector<uint8_t>& seed);
 
@@ -145,6 +154,7 @@ class VoldNativeService : public BinderService<VoldNativeService>, public os::Bn
     binder::Status supportsBlockCheckpoint(bool* _aidl_return);
     binder::Status supportsFileCheckpoint(bool* _aidl_return);
     binder::Status resetCheckpoint();
+    binder::Status getCheckpointStats(android::os::PersistableBundle* _aidl_return);
 
     binder::Status earlyBootEnded();
 
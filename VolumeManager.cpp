@@ -31,11 +31,13 @@
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
+#include <algorithm>
 #include <array>
+#include <thread>
+#include <unordered_set>
 
 #include <linux/kdev_t.h>
 
-#include <ApexProperties.sysprop.h>
 #include <android-base/file.h>
 #include <android-base/logging.h>
 #include <android-base/parseint.h>
@@ -54,13 +56,14 @@
 #include <private/android_filesystem_config.h>
 
 #include <fscrypt/fscrypt.h>
-#include <libdm/dm.h>
 
 #include "AppFuseUtil.h"
 #include "FsCrypt.h"
+#include "FsProbe.h"
 #include "Loop.h"
+#include "MoveStorage.h"
 #include "NetlinkManager.h"
-#include "Process.h"
+#include "StorageTopology.h"
 #include "Utils.h"
 #include "VoldNativeService.h"
 #include "VoldUtil.h"
@@ -107,7 +110,21 @@ static const unsigned int kSizeVirtualDisk = 536870912;
 
 static const unsigned int kMajorBlockMmc = 179;
 
-using ScanProcCallback = bool(*)(uid_t uid, pid_t pid, int nsFd, const char* name, void* params);
+// Calls fn on each item on a thread of its own, and returns once they are all done
+template <typename T, typename Fn>
+static void ForEachInParallel(const std::list<T>& items, Fn fn) {
+    if (items.size() <= 1) {
+        for (const auto& item : items) fn(item);
+        return;
+    }
+    std::vector<std::thread> threads;
+    for (const auto& item : items) {
+        threads.emplace_back([&fn, &item] { fn(item); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
 
 VolumeManager* VolumeManager::sInstance = NULL;
 
@@ -120,6 +137,7 @@ VolumeManager::VolumeManager() {
     mDebug = false;
     mNextObbId = 0;
     mNextStubId = 0;
+    mNextDiskProbeSeq = 0;
     // For security reasons, assume that a secure keyguard is
     // showing until we hear otherwise
     mSecureKeyguardShowing = true;
@@ -135,7 +153,10 @@ int VolumeManager::updateVirtualDisk() {
         }
 
         if (mVirtualDisk == nullptr) {
-            if (Loop::create(kPathVirtualDisk, mVirtualDiskPath) != 0) {
+            // The image lives on /data, whose page cache would only duplicate the disk's own.
+            // It's partitioned with 512-byte sectors, so it can't take larger blocks.
+            bool directIo = Loop::directIoBlockSize(kPathVirtualDisk) == 512;
+            if (Loop::create(kPathVirtualDisk, mVirtualDiskPath, directIo) != 0) {
                 LOG(ERROR) << "Failed to create virtual disk";
                 return -1;
             }
@@ -210,12 +231,16 @@ void VolumeManager::handleBlockEvent(NetlinkEvent* evt) {
     std::string eventPath(evt->findParam("DEVPATH") ? evt->findParam("DEVPATH") : "");
     std::string devType(evt->findParam("DEVTYPE") ? evt->findParam("DEVTYPE") : "");
 
-    if (devType != "disk") return;
+    if (devType != "disk" && devType != "partition") return;
 
     int major = std::stoi(evt->findParam("MAJOR"));
     int minor = std::stoi(evt->findParam("MINOR"));
     dev_t device = makedev(major, minor);
 
+    // Whatever happened, the filesystem last probed on the device may no longer be there
+    android::vold::InvalidateFsMetadata(device);
+    if (devType != "disk") return;
+
     switch (evt->getAction()) {
         case NetlinkEvent::Action::kAdd: {
             for (const auto& source : mDiskSources) {
@@ -269,16 +294,20 @@ void VolumeManager::handleDiskAdded(const std::shared_ptr<android::vold::Disk>&
                   << " but delaying scan due to user zero not having started";
         mPendingDisks.push_back(disk);
     } else {
-        disk->create();
-        mDisks.push_back(disk);
+        createDisk(disk);
     }
 }
 
 void VolumeManager::handleDiskChanged(dev_t device) {
     for (const auto& disk : mDisks) {
-        if (disk->getDevice() == device) {
-            disk->readMetadata();
-            disk->readPartitions();
+        if (disk->getDevice() == device && !disk->skipChange()) {
+            probeDisk(disk);
+        }
+    }
+    // Disks still being probed for creation start over
+    for (const auto& probe : mDiskProbes) {
+        if (probe.disk->getDevice() == device && !probe.disk->isCreated()) {
+            probeDisk(probe.disk);
         }
     }
 
@@ -304,6 +333,59 @@ void VolumeManager::handleDiskRemoved(dev_t device) {
             ++j;
         }
     }
+    mDiskProbes.remove_if([device](const auto& probe) {
+        return probe.disk->getDevice() == device;
+    });
+}
+
+void VolumeManager::createDisk(const std::shared_ptr<android::vold::Disk>& disk) {
+    // Stub disks are managed from outside Android and have nothing to probe
+    if (disk->isStub()) {
+        disk->create();
+        mDisks.push_back(disk);
+    } else {
+        probeDisk(disk);
+    }
+}
+
+void VolumeManager::probeDisk(const std::shared_ptr<android::vold::Disk>& disk) {
+    uint64_t seq = ++mNextDiskProbeSeq;
+    auto it = std::find_if(mDiskProbes.begin(), mDiskProbes.end(),
+                           [&disk](const auto& entry) { return entry.disk == disk; });
+    if (it != mDiskProbes.end()) {
+        it->seq = seq;
+    } else {
+        mDiskProbes.push_back({disk, seq});
+    }
+
+    // Reading the partition table and filesystem can take seconds on slow media, so do it
+    // without holding up the netlink thread or the other disks
+    std::thread([this, disk, seq]() {
+        auto probe = disk->probe();
+        std::lock_guard<std::mutex> lock(mLock);
+        finishDiskProbe(disk, seq, probe);
+    }).detach();
+}
+
+void VolumeManager::finishDiskProbe(const std::shared_ptr<android::vold::Disk>& disk,
+                                    uint64_t seq, const android::vold::Disk::Probe& probe) {
+    auto it = std::find_if(mDiskProbes.begin(), mDiskProbes.end(),
+                           [&disk](const auto& entry) { return entry.disk == disk; });
+    // Removed, or changed again and about to be probed once more
+    if (it == mDiskProbes.end() || it->seq != seq) return;
+    mDiskProbes.erase(it);
+
+    if (disk->isCreated()) {
+        if (disk->isUnchanged(probe)) {
+            LOG(DEBUG) << disk->getId() << " is unchanged, keeping its volumes";
+            return;
+        }
+        disk->readMetadata(probe);
+        disk->readPartitions(probe);
+    } else {
+        disk->create(probe);
+        mDisks.push_back(disk);
+    }
 }
 
 void VolumeManager::addDiskSource(const std::shared_ptr<DiskSource>& diskSource) {
@@ -484,8 +566,7 @@ void VolumeManager::createPendingDisksIfNeeded() {
         // Now that secure keyguard has been dismissed and user 0 has
         // started, process any pending disks
         for (const auto& disk : mPendingDisks) {
-            disk->create();
-            mDisks.push_back(disk);
+            createDisk(disk);
         }
         mPendingDisks.clear();
     }
@@ -493,201 +574,11 @@ void VolumeManager::createPendingDisksIfNeeded() {
 
 int VolumeManager::onSecureKeyguardStateChanged(bool isShowing) {
     mSecureKeyguardShowing = isShowing;
+    android::vold::SetMoveStorageUserActive(!isShowing);
     createPendingDisksIfNeeded();
     return 0;
 }
 
-// This code is executed after a fork so it's very important that the set of
-// methods we call here is strictly limited.
-//
-// TODO: Get rid of this guesswork altogether and instead exec a process
-// immediately after fork to do our bindding for us.
-static bool childProcess(const char* storageSource, const char* userSource, int nsFd,
-                         const char* name) {
-    if (setns(nsFd, CLONE_NEWNS) != 0) {
-        async_safe_format_log(ANDROID_LOG_ERROR, "vold", "Failed to setns for %s :%s", name,
-                              strerror(errno));
-        return false;
-    }
-
-    // NOTE: Inlined from vold::UnmountTree here to avoid using PLOG methods and
-    // to also protect against future changes that may cause issues across a
-    // fork.
-    if (TEMP_FAILURE_RETRY(umount2("/storage/", MNT_DETACH)) < 0 && errno != EINVAL &&
-        errno != ENOENT) {
-        async_safe_format_log(ANDROID_LOG_ERROR, "vold", "Failed to unmount /storage/ :%s",
-                              strerror(errno));
-        return false;
-    }
-
-    if (TEMP_FAILURE_RETRY(mount(storageSource, "/storage", NULL, MS_BIND | MS_REC, NULL)) == -1) {
-        async_safe_format_log(ANDROID_LOG_ERROR, "vold", "Failed to mount %s for %s :%s",
-                              storageSource, name, strerror(errno));
-        return false;
-    }
-
-    if (TEMP_FAILURE_RETRY(mount(NULL, "/storage", NULL, MS_REC | MS_SLAVE, NULL)) == -1) {
-        async_safe_format_log(ANDROID_LOG_ERROR, "vold",
-                              "Failed to set MS_SLAVE to /storage for %s :%s", name,
-                              strerror(errno));
-        return false;
-    }
-
-    if (TEMP_FAILURE_RETRY(mount(userSource, "/storage/self", NULL, MS_BIND, NULL)) == -1) {
-        async_safe_format_log(ANDROID_LOG_ERROR, "vold", "Failed to mount %s for %s :%s",
-                              userSource, name, strerror(errno));
-        return false;
-    }
-
-    return true;
-}
-
-// Fork the process and remount storage
-bool forkAndRemountChild(uid_t uid, pid_t pid, int nsFd, const char* name, void* params) {
-    int32_t mountMode = *static_cast<int32_t*>(params);
-    std::string userSource;
-    std::string storageSource;
-    pid_t child;
-    // Need to fix these paths to account for when sdcardfs is gone
-    switch (mountMode) {
-        case VoldNativeService::REMOUNT_MODE_NONE:
-            return true;
-        case VoldNativeService::REMOUNT_MODE_DEFAULT:
-            storageSource = "/mnt/runtime/default";
-            break;
-        case VoldNativeService::REMOUNT_MODE_ANDROID_WRITABLE:
-        case VoldNativeService::REMOUNT_MODE_INSTALLER:
-            storageSource = "/mnt/runtime/write";
-            break;
-        case VoldNativeService::REMOUNT_MODE_PASS_THROUGH:
-            return true;
-        default:
-            PLOG(ERROR) << "Unknown mode " << std::to_string(mountMode);
-            return false;
-    }
-    LOG(DEBUG) << "Remounting " << uid << " as " << storageSource;
-
-    // Fork a child to mount user-specific symlink helper into place
-    userSource = StringPrintf("/mnt/user/%d", multiuser_get_user_id(uid));
-    if (!(child = fork())) {
-        if (childProcess(storageSource.c_str(), userSource.c_str(), nsFd, name)) {
-            _exit(0);
-        } else {
-            _exit(1);
-        }
-    }
-
-    if (child == -1) {
-        PLOG(ERROR) << "Failed to fork";
-        return false;
-    } else {
-        TEMP_FAILURE_RETRY(waitpid(child, nullptr, 0));
-    }
-    return true;
-}
-
-// Helper function to scan all processes in /proc and call the callback if:
-// 1). pid belongs to an app process
-// 2). If input uid is 0 or it matches the process uid
-// 3). If userId is not -1 or userId matches the process userId
-bool scanProcProcesses(uid_t uid, userid_t userId, ScanProcCallback callback, void* params) {
-    DIR* dir;
-    struct dirent* de;
-    std::string rootName;
-    std::string pidName;
-    int pidFd;
-    int nsFd;
-    struct stat sb;
-
-    static bool apexUpdatable = android::sysprop::ApexProperties::updatable().value_or(false);
-
-    if (!(dir = opendir("/proc"))) {
-        async_safe_format_log(ANDROID_LOG_ERROR, "vold", "Failed to opendir");
-        return false;
-    }
-
-    // Figure out root namespace to compare against below
-    if (!android::vold::Readlinkat(dirfd(dir), "1/ns/mnt", &rootName)) {
-        async_safe_format_log(ANDROID_LOG_ERROR, "vold", "Failed to read root namespace");
-        closedir(dir);
-        return false;
-    }
-
-    async_safe_format_log(ANDROID_LOG_INFO, "vold", "Start scanning all processes");
-    // Poke through all running PIDs look for apps running as UID
-    while ((de = readdir(dir))) {
-        pid_t pid;
-        if (de->d_type != DT_DIR) continue;
-        if (!android::base::ParseInt(de->d_name, &pid)) continue;
-
-        pidFd = -1;
-        nsFd = -1;
-
-        pidFd = openat(dirfd(dir), de->d_name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
-        if (pidFd < 0) {
-            goto next;
-        }
-        if (fstat(pidFd, &sb) != 0) {
-            async_safe_format_log(ANDROID_LOG_ERROR, "vold", "Failed to stat %s", de->d_name);
-            goto next;
-        }
-        if (uid != 0 && sb.st_uid != uid) {
-            goto next;
-        }
-        if (userId != static_cast<userid_t>(-1) && multiuser_get_user_id(sb.st_uid) != userId) {
-            goto next;
-        }
-
-        // Matches so far, but refuse to touch if in root namespace
-        if (!android::vold::Readlinkat(pidFd, "ns/mnt", &pidName)) {
-            async_safe_format_log(ANDROID_LOG_ERROR, "vold",
-                    "Failed to read namespacefor %s", de->d_name);
-            goto next;
-        }
-        if (rootName == pidName) {
-            goto next;
-        }
-
-        if (apexUpdatable) {
-            std::string exeName;
-            // When ro.apex.bionic_updatable is set to true,
-            // some early native processes have mount namespaces that are different
-            // from that of the init. Therefore, above check can't filter them out.
-            // Since the propagation type of / is 'shared', unmounting /storage
-            // for the early native processes affects other processes including
-            // init. Filter out such processes by skipping if a process is a
-            // non-Java process whose UID is < AID_APP_START. (The UID condition
-            // is required to not filter out child processes spawned by apps.)
-            if (!android::vold::Readlinkat(pidFd, "exe", &exeName)) {
-                goto next;
-            }
-            if (!StartsWith(exeName, "/system/bin/app_process") && sb.st_uid < AID_APP_START) {
-                goto next;
-            }
-        }
-
-        // We purposefully leave the namespace open across the fork
-        // NOLINTNEXTLINE(android-cloexec-open): Deliberately not O_CLOEXEC
-        nsFd = openat(pidFd, "ns/mnt", O_RDONLY);
-        if (nsFd < 0) {
-            async_safe_format_log(ANDROID_LOG_ERROR, "vold",
-                    "Failed to open namespace for %s", de->d_name);
-            goto next;
-        }
-
-        if (!callback(sb.st_uid, pid, nsFd, de->d_name, params)) {
-            async_safe_format_log(ANDROID_LOG_ERROR, "vold", "Failed in callback");
-        }
-
-    next:
-        close(nsFd);
-        close(pidFd);
-    }
-    closedir(dir);
-    async_safe_format_log(ANDROID_LOG_INFO, "vold", "Finished scanning all processes");
-    return true;
-}
-
 // In each app's namespace, unmount obb and data dirs
 static bool umountStorageDirs(int nsFd, const char* android_data_dir, const char* android_obb_dir,
         int uid, const char* targets[], int size) {
@@ -903,6 +794,33 @@ int VolumeManager::abortFuse() {
     return android::vold::AbortFuseConnections();
 }
 
+int VolumeManager::abortFormat(const std::string& volId) {
+    std::lock_guard<std::mutex> lock(mFormatLock);
+    if (mFormattingVolume != volId) {
+        LOG(WARNING) << volId << " is not being formatted";
+        return -ENOENT;
+    }
+    mFormatAborted = true;
+    return 0;
+}
+
+void VolumeManager::beginFormat(const std::string& volId) {
+    std::lock_guard<std::mutex> lock(mFormatLock);
+    mFormattingVolume = volId;
+    mFormatAborted = false;
+}
+
+void VolumeManager::endFormat() {
+    std::lock_guard<std::mutex> lock(mFormatLock);
+    mFormattingVolume.clear();
+    mFormatAborted = false;
+}
+
+bool VolumeManager::isFormatAborted() {
+    std::lock_guard<std::mutex> lock(mFormatLock);
+    return mFormatAborted;
+}
+
 int VolumeManager::reset() {
     // Tear down all existing disks/volumes and start from a blank slate so
     // newly connected framework hears all events.
@@ -916,12 +834,16 @@ int VolumeManager::reset() {
     // StubVolumes are managed from outside Android (e.g. from Chrome OS) and
     // their disk recreation on reset events should be handled from outside by
     // calling createStubVolume() again.
+    // Disks are torn down in parallel, but created again in order so the framework hears
+    // about them the same way every time.
+    ForEachInParallel(mDisks, [](const auto& disk) { disk->destroy(); });
     for (const auto& disk : mDisks) {
-        disk->destroy();
         if (!disk->isStub()) {
             disk->create();
         }
     }
+    // Rescans in flight are stale now, while disks still being probed get created as usual
+    mDiskProbes.remove_if([](const auto& probe) { return probe.disk->isCreated(); });
     const auto isStub = [](const auto& disk) { return disk->isStub(); };
     mDisks.remove_if(isStub);
     mPendingDisks.remove_if(isStub);
@@ -953,6 +875,7 @@ int VolumeManager::shutdown() {
     mInternalEmulatedVolumes.clear();
     mDisks.clear();
     mPendingDisks.clear();
+    mDiskProbes.clear();
     android::vold::sSleepOnUnmount = true;
 
     return 0;
@@ -962,13 +885,13 @@ int VolumeManager::unmountAll() {
     std::lock_guard<std::mutex> lock(mLock);
     ATRACE_NAME("VolumeManager::unmountAll()");
 
-    // First, try gracefully unmounting all known devices
+    // First, try gracefully unmounting all known devices. The emulated volumes over /data go
+    // first, since one user's may be bind mounted into another's; disks only hold volumes
+    // stacked on their own, so they come down in parallel.
     for (const auto& vol : mInternalEmulatedVolumes) {
         vol->unmount();
     }
-    for (const auto& disk : mDisks) {
-        disk->unmountAll();
-    }
+    ForEachInParallel(mDisks, [](const auto& disk) { disk->unmountAll(); });
 
     // Worst case we might have some stale mounts lurking around, so
     // force unmount those just to be safe.
@@ -980,7 +903,7 @@ int VolumeManager::unmountAll() {
 
     // Some volumes can be stacked on each other, so force unmount in
     // reverse order to give us the best chance of success.
-    std::list<std::string> toUnmount;
+    std::vector<std::string> toUnmount;
     mntent* mentry;
     while ((mentry = getmntent(fp)) != NULL) {
         auto test = std::string(mentry->mnt_dir);
@@ -991,24 +914,61 @@ int VolumeManager::unmountAll() {
              !StartsWith(test, "/mnt/vendor") && !StartsWith(test, "/mnt/product") &&
              !StartsWith(test, "/mnt/installer") && !StartsWith(test, "/mnt/androidwritable")) ||
             StartsWith(test, "/storage/")) {
-            toUnmount.push_front(test);
+            LOG(DEBUG) << "Tearing down stale mount " << test;
+            toUnmount.push_back(test);
         }
     }
     endmntent(fp);
 
-    for (const auto& path : toUnmount) {
-        LOG(DEBUG) << "Tearing down stale mount " << path;
-        android::vold::ForceUnmount(path);
-    }
+    std::reverse(toUnmount.begin(), toUnmount.end());
+    android::vold::ForceUnmountAll(toUnmount);
 
     return 0;
 }
 
 int VolumeManager::ensureAppDirsCreated(const std::vector<std::string>& paths, int32_t appUid) {
-    int size = paths.size();
-    for (int i = 0; i < size; i++) {
-        int result = setupAppDir(paths[i], appUid, false /* fixupExistingOnly */,
-                true /* skipIfDirExists */);
+    // The paths are nearly always on one or two volumes, so each volume is looked up and has
+    // its Android/ dirs prepared once for all of them, and only if a dir is actually missing.
+    std::shared_lock<std::shared_mutex> lock(mAppDirLock);
+    std::vector<VolumeBase*> volumes;
+    std::unordered_set<VolumeBase*> preparedVolumes;
+    for (const auto& path : paths) {
+        auto volume = std::find_if(volumes.begin(), volumes.end(), [&](const auto& vol) {
+            return StartsWith(path, vol->getPath());
+        });
+        if (volume == volumes.end()) {
+            auto found = findAppDirVolume(path, appUid);
+            if (found == nullptr) {
+                LOG(ERROR) << "Failed to find mounted volume for " << path;
+                return -EINVAL;
+            }
+            volume = volumes.insert(volumes.end(), found);
+        }
+
+        // See setupAppDir() for why these go to the lower filesystem
+        const std::string lowerPath =
+                (*volume)->getInternalPath() + path.substr((*volume)->getPath().length());
+        if (access(lowerPath.c_str(), F_OK) == 0) {
+            // Zygote only bind mounts these, which doesn't need them to be fixed up yet.
+            continue;
+        }
+
+        int result;
+        if ((*volume)->getType() == VolumeBase::Type::kPublic) {
+            result = fs_mkdirs(lowerPath.c_str(), 0700);
+        } else {
+            const std::string volumeRoot = (*volume)->getRootPath();
+            if (preparedVolumes.insert(*volume).second) {
+                result = PrepareAndroidDirs(volumeRoot);
+                if (result != OK) {
+                    LOG(ERROR) << "Failed to prepare Android/ directories.";
+                    return result;
+                }
+            }
+            result = PrepareAppDirFromRoot(lowerPath, volumeRoot, appUid,
+                                           false /* fixupExisting */,
+                                           false /* prepareAndroidDirs */);
+        }
         if (result != OK) {
             return result;
         }
@@ -1016,20 +976,26 @@ int VolumeManager::ensureAppDirsCreated(const std::vector<std::string>& paths, i
     return OK;
 }
 
-int VolumeManager::setupAppDir(const std::string& path, int32_t appUid, bool fixupExistingOnly,
-        bool skipIfDirExists) {
+void VolumeManager::setAppDirVolume(VolumeBase* vol, bool mounted) {
+    std::unique_lock<std::shared_mutex> lock(mAppDirLock);
+    auto it = std::find(mAppDirVolumes.begin(), mAppDirVolumes.end(), vol);
+    if (mounted && it == mAppDirVolumes.end()) {
+        mAppDirVolumes.push_back(vol);
+    } else if (!mounted && it != mAppDirVolumes.end()) {
+        mAppDirVolumes.erase(it);
+    }
+    // Whatever is mounted there next may not have the same Android/ directories.
+    if (!mounted) android::vold::ForgetPreparedAndroidDirs(vol->getRootPath());
+}
+
+VolumeBase* VolumeManager::findAppDirVolume(const std::string& path, int32_t appUid) {
     // Only offer to create directories for paths managed by vold
     if (!StartsWith(path, "/storage/")) {
-        LOG(ERROR) << "Failed to find mounted volume for " << path;
-        return -EINVAL;
+        return nullptr;
     }
 
-    // Find the volume it belongs to
+    // The volumes are all mounted, which is what an app dir needs
     auto filter_fn = [&](const VolumeBase& vol) {
-        if (vol.getState() != VolumeBase::State::kMounted) {
-            // The volume must be mounted
-            return false;
-        }
         if (!vol.isVisibleForWrite()) {
             // App dirs should only be created for writable volumes.
             return false;
@@ -1048,7 +1014,19 @@ int VolumeManager::setupAppDir(const std::string& path, int32_t appUid, bool fix
 
         return false;
     };
-    auto volume = findVolumeWithFilter(filter_fn);
+    for (auto vol : mAppDirVolumes) {
+        if (filter_fn(*vol)) {
+            return vol;
+        }
+    }
+    return nullptr;
+}
+
+int VolumeManager::setupAppDir(const std::string& path, int32_t appUid, bool fixupExistingOnly,
+        bool skipIfDirExists) {
+    std::shared_lock<std::shared_mutex> lock(mAppDirLock);
+    // Find the volume it belongs to
+    auto volume = findAppDirVolume(path, appUid);
     if (volume == nullptr) {
         LOG(ERROR) << "Failed to find mounted volume for " << path;
         return -EINVAL;
@@ -1200,66 +1178,10 @@ int VolumeManager::openAppFuseFile(uid_t uid, int mountId, int fileId, int flags
 }
 
 android::status_t android::vold::GetStorageSize(int64_t* storageSize) {
-    // Start with the /data mount point from fs_mgr
-    auto entry = android::fs_mgr::GetEntryForMountPoint(&fstab_default, DATA_MNT_POINT);
-    if (entry == nullptr) {
-        LOG(ERROR) << "No mount point entry for " << DATA_MNT_POINT;
-        return EINVAL;
-    }
-
-    // Follow any symbolic links
-    std::string blkDevice = entry->blk_device;
-    std::string dataDevice;
-    if (!android::base::Realpath(blkDevice, &dataDevice)) {
-        dataDevice = blkDevice;
-    }
-
-    // Handle mapped volumes.
-    auto& dm = android::dm::DeviceMapper::Instance();
-    for (;;) {
-        auto parent = dm.GetParentBlockDeviceByPath(dataDevice);
-        if (!parent.has_value()) break;
-        dataDevice = *parent;
-    }
-
-    // Get the potential /sys/block entry
-    std::size_t leaf = dataDevice.rfind('/');
-    if (leaf == std::string::npos) {
-        LOG(ERROR) << "data device " << dataDevice << " is not a path";
+    auto topology = GetDataTopology();
+    if (topology == nullptr || topology->diskSize == 0) {
         return EINVAL;
     }
-    if (dataDevice.substr(0, leaf) != "/dev/block") {
-        LOG(ERROR) << "data device " << dataDevice << " is not a block device";
-        return EINVAL;
-    }
-    std::string sysfs = std::string() + "/sys/block/" + dataDevice.substr(leaf + 1);
-
-    // Look for a directory in /sys/block containing size where the name is a shortened
-    // version of the name we now have
-    // Typically we start with something like /sys/block/sda2, and we want /sys/block/sda
-    // Note that this directory only contains actual disks, not partitions, so this is
-    // not going to find anything other than the disks
-    std::string size;
-    std::string sizeFile;
-    for (std::string sysfsDir = sysfs;; sysfsDir = sysfsDir.substr(0, sysfsDir.size() - 1)) {
-        if (sysfsDir.back() == '/') {
-            LOG(ERROR) << "Could not find valid block device from " << sysfs;
-            return EINVAL;
-        }
-        sizeFile = sysfsDir + "/size";
-        if (android::base::ReadFileToString(sizeFile, &size, true)) {
-            break;
-        }
-    }
-
-    // Read the size file and be done
-    std::stringstream ssSize(size);
-    ssSize >> *storageSize;
-    if (ssSize.fail()) {
-        LOG(ERROR) << sizeFile << " cannot be read as an integer";
-        return EINVAL;
-    }
-
-    *storageSize *= 512;
+    *storageSize = topology->diskSize;
     return OK;
 }
\ No newline at end of file
@@ -24,6 +24,7 @@
 #include <list>
 #include <mutex>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -128,6 +129,12 @@ class VolumeManager {
 
     /* Aborts all FUSE filesystems, in case the FUSE daemon is no longer up. */
     int abortFuse();
+    /* Stops the wipe of the volume being formatted, if it is volId. Doesn't need mLock. */
+    int abortFormat(const std::string& volId);
+    /* Brackets the format of volId, which polls isFormatAborted() while it wipes */
+    void beginFormat(const std::string& volId);
+    void endFormat();
+    bool isFormatAborted();
     /* Reset all internal state, typically during framework boot */
     int reset();
     /* Prepare for device shutdown, safely unmounting all devices */
@@ -194,6 +201,9 @@ class VolumeManager {
     // Called before zygote starts to ensure dir exists so zygote can bind mount them.
     int ensureAppDirsCreated(const std::vector<std::string>& paths, int32_t appUid);
 
+    // Called by VolumeBase::setState() as vol enters kMounted, and before it leaves it.
+    void setAppDirVolume(android::vold::VolumeBase* vol, bool mounted);
+
     int createObb(const std::string& path, int32_t ownerGid, std::string* outVolId);
     int destroyObb(const std::string& volId);
 
@@ -219,18 +229,48 @@ class VolumeManager {
     void handleDiskChanged(dev_t device);
     void handleDiskRemoved(dev_t device);
 
+    void createDisk(const std::shared_ptr<android::vold::Disk>& disk);
+    // Probes the disk on its own thread, then creates or rescans it under mLock
+    void probeDisk(const std::shared_ptr<android::vold::Disk>& disk);
+    void finishDiskProbe(const std::shared_ptr<android::vold::Disk>& disk, uint64_t seq,
+                         const android::vold::Disk::Probe& probe);
+
     bool updateFuseMountedProperty();
 
+    // The mounted, writable volume of appUid's user that holds path, if any. Needs mAppDirLock.
+    android::vold::VolumeBase* findAppDirVolume(const std::string& path, int32_t appUid);
+
+    // Lock hierarchy: mCryptLock and mLock are never held together, and mAppDirLock may be
+    // taken with mLock held but not the other way around. Binder calls that only set up app
+    // dirs take mAppDirLock alone, so they don't wait behind a mount, format or fsck.
     std::mutex mLock;
     std::mutex mCryptLock;
+    std::shared_mutex mAppDirLock;
+
+    // The volume being formatted, which abortFormat() can flag without waiting for mLock.
+    // mFormatLock is only ever held on its own.
+    std::mutex mFormatLock;
+    std::string mFormattingVolume;
+    bool mFormatAborted = false;
 
     android::sp<android::os::IVoldListener> mListener;
 
     std::list<std::shared_ptr<DiskSource>> mDiskSources;
     std::list<std::shared_ptr<android::vold::Disk>> mDisks;
     std::list<std::shared_ptr<android::vold::Disk>> mPendingDisks;
+    // Disks with a probe in flight, and the latest one started for each, which the others
+    // yield to. Disks that aren't in mDisks yet are created once it finishes.
+    struct DiskProbe {
+        std::shared_ptr<android::vold::Disk> disk;
+        uint64_t seq;
+    };
+    std::list<DiskProbe> mDiskProbes;
+    uint64_t mNextDiskProbeSeq;
     std::list<std::shared_ptr<android::vold::VolumeBase>> mObbVolumes;
     std::list<std::shared_ptr<android::vold::VolumeBase>> mInternalEmulatedVolumes;
+    // The mounted volumes, guarded by mAppDirLock. Volumes leave before they unmount and are
+    // destroyed, so they stay valid and mounted for as long as the lock is held.
+    std::vector<android::vold::VolumeBase*> mAppDirVolumes;
 
     std::unordered_map<userid_t, int> mAddedUsers;
     // Map of users to a user with which they can share storage (eg clone profiles)
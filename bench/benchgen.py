@@ -18,15 +18,19 @@
 Generates storage benchmark from captured strace output.
 
 Currently assumes that all mmap'ed regions are resource accesses, and emulates as pread().
+The resulting trace is installed under /system/etc/vold/benchmark, or pushed to
+/data/misc/vold/benchmark_traces to try it without a new build.
 
 Usage:
 $ adb shell strace -p `pid zygote` -o /data/local/tmp/trace -f -ff -y -ttt -e trace=file,desc,munmap
 $ adb pull /data/local/tmp/trace*
-$ python benchgen.py trace.*
+$ python benchgen.py -n app_launch trace.*
 
 """
 
-import re, sys, collections, traceback, argparse
+from __future__ import print_function
+
+import re, sys, collections, traceback, argparse, struct
 
 from operator import itemgetter
 from collections import defaultdict
@@ -109,7 +113,13 @@ interesting = ["mmap2","read","write","pread64","pwrite64","fsync","fdatasync","
 
 re_event = re.compile(r"^([\d\.]+) (.+?)\((.+?)\) = (.+?)$")
 re_arg = re.compile(r'''((?:[^,"']|"[^"]*"|'[^']*')+)''')
-for fn in sys.argv[1:]:
+parser = argparse.ArgumentParser(description="Generates a vold benchmark trace from strace output")
+parser.add_argument("-n", "--name", default="app_launch", help="name of the workload")
+parser.add_argument("-o", "--output", help="trace file to write, <name>.vbt by default")
+parser.add_argument("traces", nargs="+", help="strace output files, one per thread")
+opts = parser.parse_args()
+
+for fn in opts.traces:
     with open(fn) as f:
         thread = int(fn.split(".")[-1])
         for line in f:
@@ -125,232 +135,109 @@ for fn in sys.argv[1:]:
             events.append(Event(thread, time, call, args, ret))
 
 
-with open("BenchmarkGen.h", 'w') as bench:
-    print >>bench, """/*
- * Copyright (C) 2015 The Android Open Source Project
- *
- * Licensed under the Apache License, Version 2.0 (the "License");
- * you may not use this file except in compliance with the License.
- * You may obtain a copy of the License at
- *
- *      http://www.apache.org/licenses/LICENSE-2.0
- *
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an "AS IS" BASIS,
- * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
- */
-
-
-/******************************************************************
- * THIS CODE WAS GENERATED BY benchgen.py, DO NOT MODIFY DIRECTLY *
- ******************************************************************/
-
+# Must match the trace format described in BenchmarkTrace.h
+OP_OPEN, OP_CLOSE, OP_READ, OP_WRITE, OP_PREAD, OP_PWRITE, OP_LSEEK, OP_FSYNC, OP_FDATASYNC = \
+        range(1, 10)
+OPEN_FLAGS = {"O_RDONLY": 0, "O_WRONLY": 1 << 0, "O_RDWR": 1 << 1, "O_CREAT": 1 << 2,
+              "O_EXCL": 1 << 3, "O_TRUNC": 1 << 4, "O_DIRECTORY": 1 << 5, "O_CLOEXEC": 1 << 6}
+WHENCE = {"SEEK_SET": 0, "SEEK_CUR": 1, "SEEK_END": 2}
 
-#include <android-base/logging.h>
+ops = []
+handles = {}
+threads = {}
 
-#include <stdlib.h>
-#include <sys/types.h>
-#include <sys/stat.h>
-#include <sys/sendfile.h>
-#include <fcntl.h>
+def add_op(code, handle, flags=0, length=0, arg=0, offset=0):
+    thread = threads.setdefault(handle.split("f")[0], len(threads))
+    index = handles.setdefault(handle, len(handles))
+    ops.append(struct.pack("<BBHIIIq", code, flags, thread, index, length, arg, offset))
 
-#include <algorithm>
-#include <functional>
-#include <string>
+def open_flags(arg):
+    flags = 0
+    for flag in arg.split("|"):
+        flags |= OPEN_FLAGS.get(flag, 0)
+    return flags
 
-#include <Utils.h>
-
-namespace android {
-namespace vold {
-
-static status_t BenchmarkRun(std::function<bool(int)> checkpoint) {
-
-"""
-
-    print >>bench, "char* buf = (char*) malloc(%d);" % (bufsize)
-
-    nread = 0
-    nwrite = 0
-    nsync = 0
-    events = sorted(events, key=lambda e: e.time)
-    active = set()
-    defined = set()
-    i = 0
-    total = len(events)
-    for e in events:
-        i += 1
-        if i % 256 == 0:
-            print >>bench, "if (!checkpoint(%d)) return -1;" % (50 + ((i * 50) / total))
-
-        if e.call == "openat":
-            fd, f, handle = extract_file(e, e.ret)
-            if f:
-                active.add(handle)
-                if handle not in defined:
-                    print >>bench, "int",
-                    defined.add(handle)
-                create_mode = ''
-                if 'O_CREAT' in e.args[2]:
-                    assert len(e.args) > 3, 'File creation lacks a mode?'
-                    create_mode = ', ' + e.args[3]
-                print >>bench, '%s = TEMP_FAILURE_RETRY(open("file%s", %s%s));' \
-                        % (handle, f.ident, e.args[2], create_mode)
-
-        elif e.call == "close":
-            fd, f, handle = extract_file(e, e.args[0])
-            if handle in active:
-                active.remove(handle)
-                print >>bench, 'close(%s);' % (handle)
-
-        elif e.call == "lseek":
-            fd, f, handle = extract_file(e, e.args[0])
-            if handle in active:
-                print >>bench, 'TEMP_FAILURE_RETRY(lseek(%s, %s, %s));' % (handle, e.args[1], e.args[2])
-
-        elif e.call == "_llseek":
-            fd, f, handle = extract_file(e, e.args[0])
-            if handle in active:
-                print >>bench, 'TEMP_FAILURE_RETRY(lseek(%s, %s, %s));' % (handle, e.args[1], e.args[3])
-
-        elif e.call == "read":
-            fd, f, handle = extract_file(e, e.args[0])
-            if handle in active:
-                # TODO: track actual file size instead of guessing
-                count = min(int(e.args[2]), bufsize)
-                f.size += count
-                print >>bench, 'TEMP_FAILURE_RETRY(read(%s, buf, %d));' % (handle, count)
-                nread += 1
-
-        elif e.call == "write":
-            fd, f, handle = extract_file(e, e.args[0])
-            if handle in active:
-                # TODO: track actual file size instead of guessing
-                count = min(int(e.args[2]), bufsize)
-                f.size += count
-                print >>bench, 'TEMP_FAILURE_RETRY(write(%s, buf, %d));' % (handle, count)
-                nwrite += 1
-
-        elif e.call == "pread64":
-            fd, f, handle = extract_file(e, e.args[0])
-            if handle in active:
-                f.size = max(f.size, int(e.args[2]) + int(e.args[3]))
-                count = min(int(e.args[2]), bufsize)
-                print >>bench, 'TEMP_FAILURE_RETRY(pread(%s, buf, %d, %s));' % (handle, count, e.args[3])
-                nread += 1
-
-        elif e.call == "pwrite64":
-            fd, f, handle = extract_file(e, e.args[0])
-            if handle in active:
-                f.size = max(f.size, int(e.args[2]) + int(e.args[3]))
-                count = min(int(e.args[2]), bufsize)
-                print >>bench, 'TEMP_FAILURE_RETRY(pwrite(%s, buf, %d, %s));' % (handle, count, e.args[3])
-                nwrite += 1
-
-        elif e.call == "fsync":
-            fd, f, handle = extract_file(e, e.args[0])
-            if handle in active:
-                print >>bench, 'TEMP_FAILURE_RETRY(fsync(%s));' % (handle)
-                nsync += 1
-
-        elif e.call == "fdatasync":
-            fd, f, handle = extract_file(e, e.args[0])
-            if handle in active:
-                print >>bench, 'TEMP_FAILURE_RETRY(fdatasync(%s));' % (handle)
-                nsync += 1
-
-        elif e.call == "mmap2":
-            fd, f, handle = extract_file(e, e.args[4])
-            if handle in active:
-                count = min(int(e.args[1]), bufsize)
-                offset = int(e.args[5], 0)
-                f.size = max(f.size, count + offset)
-                print >>bench, 'TEMP_FAILURE_RETRY(pread(%s, buf, %s, %s)); // mmap2' % (handle, count, offset)
-                nread += 1
-
-    for handle in active:
-        print >>bench, 'close(%s);' % (handle)
-
-    print >>bench, """
-free(buf);
-return 0;
-}
-
-static status_t CreateFile(const char* name, int len) {
-    int chunk = std::min(len, 65536);
-    int out = -1;
-    std::string buf;
-
-    if (android::vold::ReadRandomBytes(chunk, buf) != OK) {
-        LOG(ERROR) << "Failed to read random data";
-        return -EIO;
-    }
-    if ((out = TEMP_FAILURE_RETRY(open(name, O_WRONLY|O_CREAT|O_TRUNC, 0644))) < 0) {
-        PLOG(ERROR) << "Failed to open " << name;
-        return -errno;
-    }
-
-    while (len > 0) {
-        int n = write(out, buf.c_str(), std::min(len, chunk));
-        if (n < 0) {
-            PLOG(ERROR) << "Failed to write";
-            close(out);
-            return -errno;
-        }
-        len -= n;
-    }
-
-    close(out);
-    return OK;
-}
-
-static status_t BenchmarkCreate(std::function<bool(int)> checkpoint) {
-status_t res = 0;
-res |= CreateFile("stub", 0);
-"""
-    i = 0
-    total = len(files.values())
-    for f in files.values():
-        i += 1
-        if i % 12 == 0:
-            print >>bench, "if (!checkpoint(%d)) return -1;" % ((i * 50) / total)
-
-        print >>bench, 'res |= CreateFile("file%s", %d);' % (f.ident, f.size)
-
-    print >>bench, """
-return res;
-}
-
-static status_t BenchmarkDestroy() {
-status_t res = 0;
-res |= unlink("stub");
-"""
-    for f in files.values():
-        print >>bench, 'res |= unlink("file%s");' % (f.ident)
-
-    print >>bench, """
-return res;
-}
-
-static std::string BenchmarkIdent() {"""
-    print >>bench, """return "r%d:w%d:s%d";""" % (nread, nwrite, nsync)
-    print >>bench, """}
-
-}  // namespace vold
-}  // namespace android
-"""
+events = sorted(events, key=lambda e: e.time)
+active = set()
+for e in events:
+    if e.call == "openat":
+        fd, f, handle = extract_file(e, e.ret)
+        if f:
+            active.add(handle)
+            mode = 0
+            if 'O_CREAT' in e.args[2]:
+                assert len(e.args) > 3, 'File creation lacks a mode?'
+                mode = int(e.args[3], 8)
+            add_op(OP_OPEN, handle, flags=open_flags(e.args[2]), length=mode, arg=f.ident)
+
+    elif e.call == "close":
+        fd, f, handle = extract_file(e, e.args[0])
+        if handle in active:
+            active.remove(handle)
+            add_op(OP_CLOSE, handle)
+
+    elif e.call == "lseek":
+        fd, f, handle = extract_file(e, e.args[0])
+        if handle in active:
+            add_op(OP_LSEEK, handle, arg=WHENCE[e.args[2]], offset=int(e.args[1]))
+
+    elif e.call == "_llseek":
+        fd, f, handle = extract_file(e, e.args[0])
+        if handle in active:
+            add_op(OP_LSEEK, handle, arg=WHENCE[e.args[3]], offset=int(e.args[1]))
+
+    elif e.call in ("read", "write"):
+        fd, f, handle = extract_file(e, e.args[0])
+        if handle in active:
+            # TODO: track actual file size instead of guessing
+            count = min(int(e.args[2]), bufsize)
+            f.size += count
+            add_op(OP_READ if e.call == "read" else OP_WRITE, handle, length=count)
+
+    elif e.call in ("pread64", "pwrite64"):
+        fd, f, handle = extract_file(e, e.args[0])
+        if handle in active:
+            f.size = max(f.size, int(e.args[2]) + int(e.args[3]))
+            count = min(int(e.args[2]), bufsize)
+            add_op(OP_PREAD if e.call == "pread64" else OP_PWRITE, handle, length=count,
+                   offset=int(e.args[3]))
+
+    elif e.call in ("fsync", "fdatasync"):
+        fd, f, handle = extract_file(e, e.args[0])
+        if handle in active:
+            add_op(OP_FSYNC if e.call == "fsync" else OP_FDATASYNC, handle)
+
+    elif e.call == "mmap2":
+        fd, f, handle = extract_file(e, e.args[4])
+        if handle in active:
+            count = min(int(e.args[1]), bufsize)
+            offset = int(e.args[5], 0)
+            f.size = max(f.size, count + offset)
+            add_op(OP_PREAD, handle, length=count, offset=offset)
+
+for handle in active:
+    add_op(OP_CLOSE, handle)
+
+name = opts.name.encode("ascii")
+with open(opts.output or (opts.name + ".vbt"), "wb") as out:
+    out.write(struct.pack("<4sIIIHH", b"VBT1", len(files), len(handles), len(ops),
+                          len(threads), len(name)))
+    out.write(name)
+    for f in sorted(files.values(), key=lambda f: f.ident):
+        out.write(struct.pack("<Q", f.size))
+    for op in ops:
+        out.write(op)
 
 
 size = sum([ f.size for f in files.values() ])
-print "Found", len(files), "data files accessed, total size", (size/1024), "kB"
+print("Found", len(files), "data files accessed, total size", (size // 1024), "kB")
 
 types = defaultdict(int)
 for e in events:
     types[e.call] += 1
 
-print "Found syscalls:"
-for t, n in types.iteritems():
-    print str(n).rjust(8), t
+print("Found syscalls:")
+for t, n in types.items():
+    print(str(n).rjust(8), t)
 
-print
+print()
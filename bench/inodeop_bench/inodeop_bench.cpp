@@ -13,59 +13,153 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <functional>
+#include <future>
 #include <iostream>
+#include <iterator>
+#include <numeric>
 #include <ratio>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
 #include <dirent.h>
 #include <fcntl.h>
+#include <linux/fs.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/xattr.h>
 #include <unistd.h>
 
-static constexpr char VERSION[] = "0";
+static constexpr char VERSION[] = "1";
 
 // Self-contained class for collecting and reporting benchmark metrics
-// (currently only execution time).
+// (currently only execution time), summarized over repeated runs of each workload.
 class Collector {
     using time_point = std::chrono::time_point<std::chrono::steady_clock>;
     using time_unit = std::chrono::duration<double, std::milli>;
 
     struct Metric {
         std::string workload;
-        time_unit exec_time;
-        Metric(const std::string& workload, const time_unit& exec_time)
-            : workload(workload), exec_time(exec_time) {}
+        std::vector<double> samples;
+        explicit Metric(const std::string& workload) : workload(workload) {}
+    };
+
+    struct Summary {
+        double mean = 0;
+        double stddev = 0;
+        double min = 0;
+        double max = 0;
+        // Half width of the 95% confidence interval of the mean.
+        double ci95 = 0;
     };
 
     static constexpr char TIME_UNIT[] = "ms";
-    static constexpr char VERSION[] = "0";
     std::vector<Metric> metrics;
     time_point reset_time;
+    bool recording = true;
+    bool new_command = true;
+
+    // Two-sided 95% quantile of Student's t distribution with the given degrees of freedom.
+    static double t95(size_t dof) {
+        static constexpr double TABLE[] = {12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365,
+                                           2.306,  2.262, 2.228, 2.201, 2.179, 2.160, 2.145,
+                                           2.131,  2.120, 2.110, 2.101, 2.093, 2.086, 2.080,
+                                           2.074,  2.069, 2.064, 2.060, 2.056, 2.052, 2.048,
+                                           2.045,  2.042};
+        if (dof == 0) return 0;
+        if (dof <= std::size(TABLE)) return TABLE[dof - 1];
+        return 1.960;
+    }
+
+    static Summary summarize(const std::vector<double>& samples) {
+        Summary summary;
+        summary.min = *std::min_element(samples.begin(), samples.end());
+        summary.max = *std::max_element(samples.begin(), samples.end());
+        summary.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+        if (samples.size() > 1) {
+            double squares = 0;
+            for (double sample : samples) {
+                squares += (sample - summary.mean) * (sample - summary.mean);
+            }
+            summary.stddev = std::sqrt(squares / (samples.size() - 1));
+            summary.ci95 = t95(samples.size() - 1) * summary.stddev / std::sqrt(samples.size());
+        }
+        return summary;
+    }
+
+    static std::string json_string(const std::string& str) {
+        std::string quoted = "\"";
+        for (char c : str) {
+            if (c == '"' || c == '\\') quoted += '\\';
+            quoted += c;
+        }
+        return quoted + "\"";
+    }
 
   public:
     Collector() { reset(); }
 
     void reset() { reset_time = std::chrono::steady_clock::now(); }
 
+    // Runs of a command are summarized together, apart from any other command's.
+    void start_command() { new_command = true; }
+
+    // Warmup runs are timed like any other, but not recorded.
+    void set_recording(bool record) { recording = record; }
+
     void collect_metric(const std::string& workload) {
         auto elapsed = std::chrono::steady_clock::now() - reset_time;
-        metrics.emplace_back(workload, std::chrono::duration_cast<time_unit>(elapsed));
+        if (!recording) return;
+        if (new_command || metrics.back().workload != workload) metrics.emplace_back(workload);
+        new_command = false;
+        metrics.back().samples.push_back(std::chrono::duration_cast<time_unit>(elapsed).count());
     }
 
+    // One line per workload:
+    // VERSION;workload;runs;mean;stddev;min;max;ci95_low;ci95_high;unit
     void report_metrics() {
-        for (const Metric& metric : metrics)
-            std::cout << VERSION << ";" << metric.workload << ";" << metric.exec_time.count() << ";"
-                      << TIME_UNIT << std::endl;
+        for (const Metric& metric : metrics) {
+            Summary summary = summarize(metric.samples);
+            std::cout << VERSION << ";" << metric.workload << ";" << metric.samples.size() << ";"
+                      << summary.mean << ";" << summary.stddev << ";" << summary.min << ";"
+                      << summary.max << ";" << summary.mean - summary.ci95 << ";"
+                      << summary.mean + summary.ci95 << ";" << TIME_UNIT << std::endl;
+        }
+    }
+
+    void report_metrics_json() {
+        std::cout << "{\n  \"version\": " << json_string(VERSION) << ",\n  \"unit\": "
+                  << json_string(TIME_UNIT) << ",\n  \"metrics\": [";
+        for (size_t i = 0; i < metrics.size(); i++) {
+            const Metric& metric = metrics[i];
+            Summary summary = summarize(metric.samples);
+            std::cout << (i ? "," : "") << "\n    {\"workload\": " << json_string(metric.workload)
+                      << ", \"runs\": " << metric.samples.size() << ", \"mean\": " << summary.mean
+                      << ", \"stddev\": " << summary.stddev << ", \"min\": " << summary.min
+                      << ", \"max\": " << summary.max
+                      << ", \"ci95\": [" << summary.mean - summary.ci95 << ", "
+                      << summary.mean + summary.ci95 << "], \"samples\": [";
+            for (size_t j = 0; j < metric.samples.size(); j++) {
+                std::cout << (j ? ", " : "") << metric.samples[j];
+            }
+            std::cout << "]}";
+        }
+        std::cout << "\n  ]\n}" << std::endl;
     }
 };
 
+// What to make durable after every operation of a workload.
+enum class SyncMode { NONE, FSYNC, FDATASYNC };
+
 struct Command {
     static constexpr char CREATE[] = "create";
     static constexpr char DELETE[] = "delete";
@@ -73,6 +167,14 @@ struct Command {
     static constexpr char HARDLINK[] = "hardlink";
     static constexpr char SYMLINK[] = "symlink";
     static constexpr char READDIR[] = "readdir";
+    static constexpr char STAT[] = "stat";
+    static constexpr char STATX[] = "statx";
+    static constexpr char GETXATTR[] = "getxattr";
+    static constexpr char SETXATTR[] = "setxattr";
+    static constexpr char CHOWN[] = "chown";
+    static constexpr char CHMOD[] = "chmod";
+    static constexpr char SETFLAGS[] = "setflags";
+    static constexpr char PROJQUOTA[] = "projquota";
     std::string workload;
     std::string from_dir;
     std::string from_basename;
@@ -80,9 +182,24 @@ struct Command {
     std::string to_basename;
     bool drop_state;
     int n_file;
+    int n_thread;
+    bool shared_dir;
+    SyncMode sync_mode;
+    int project_id;
+    int n_warmup;
+    int n_repeat;
 
     Command() { reset(); }
 
+    // Name the metric is reported under, which notes any non-default concurrency and syncing.
+    std::string metric_name() const {
+        std::string name = workload;
+        if (n_thread > 1) name += "_j" + std::to_string(n_thread) + (shared_dir ? "_shared" : "");
+        if (sync_mode == SyncMode::FSYNC) name += "_fsync";
+        if (sync_mode == SyncMode::FDATASYNC) name += "_fdatasync";
+        return name;
+    }
+
     std::string to_string() const {
         std::stringstream string_repr;
         string_repr << "Command {\n";
@@ -92,7 +209,13 @@ struct Command {
         string_repr << "\t.to_dir = " << to_dir << ",\n";
         string_repr << "\t.to_basename = " << to_basename << ",\n";
         string_repr << "\t.drop_state = " << drop_state << ",\n";
-        string_repr << "\t.n_file = " << n_file << "\n";
+        string_repr << "\t.n_file = " << n_file << ",\n";
+        string_repr << "\t.n_thread = " << n_thread << ",\n";
+        string_repr << "\t.shared_dir = " << shared_dir << ",\n";
+        string_repr << "\t.sync_mode = " << static_cast<int>(sync_mode) << ",\n";
+        string_repr << "\t.project_id = " << project_id << ",\n";
+        string_repr << "\t.n_warmup = " << n_warmup << ",\n";
+        string_repr << "\t.n_repeat = " << n_repeat << "\n";
         string_repr << "}\n";
         return string_repr.str();
     }
@@ -104,6 +227,12 @@ struct Command {
         to_basename = "to_file";
         drop_state = true;
         n_file = 0;
+        n_thread = 1;
+        shared_dir = false;
+        sync_mode = SyncMode::NONE;
+        project_id = 1000;
+        n_warmup = 0;
+        n_repeat = 1;
     }
 };
 
@@ -120,13 +249,17 @@ void usage(std::ostream& ostr, const std::string& program_name) {
 
     ostr << "Usage: " << program_name << " [global_options] {[workload_options] -w WORKLOAD_T}\n";
     ostr << "WORKLOAD_T = {" << Command::CREATE << ", " << Command::DELETE << ", " << Command::MOVE
-         << ", " << Command::HARDLINK << ", " << Command::SYMLINK << "}\n";
+         << ", " << Command::HARDLINK << ", " << Command::SYMLINK << ", " << Command::READDIR
+         << ", " << Command::STAT << ", " << Command::STATX << ", " << Command::GETXATTR << ", "
+         << Command::SETXATTR << ", " << Command::CHOWN << ", " << Command::CHMOD << ", "
+         << Command::SETFLAGS << ", " << Command::PROJQUOTA << "}\n";
     ostr << "Global options\n";
     ostr << "\t-v: Print version.\n";
     ostr << "\t-p: Print parsed workloads and exit.\n";
+    ostr << "\t-o FORMAT: Report metrics as 'csv' or 'json' (default 'csv').\n";
     ostr << "Workload options\n";
     ostr << "\t-d DIR\t\t: Work directory for " << Command::CREATE << "/" << Command::DELETE
-         << " (default '" << command.from_dir << "').\n";
+         << " and the metadata workloads (default '" << command.from_dir << "').\n";
     ostr << "\t-f FROM-DIR\t: Source directory for " << Command::MOVE << "/" << Command::SYMLINK
          << "/" << Command::HARDLINK << " (default '" << command.from_dir << "').\n";
     ostr << "\t-t TO-DIR\t: Destination directory for " << Command::MOVE << "/" << Command::SYMLINK
@@ -135,6 +268,22 @@ void usage(std::ostream& ostr, const std::string& program_name) {
          << ").\n";
     ostr << "\t-s\t\t: Do not drop state (caches) before running the workload (default "
          << !command.drop_state << ").\n";
+    ostr << "\t-j N_THREADS\t: Run the workload on this many threads at once, each on N_FILES "
+            "files of its own (default "
+         << command.n_thread << ").\n";
+    ostr << "\t-m\t\t: Have the threads share the directories, rather than each working in "
+            "a subdirectory 't<N>' of them.\n";
+    ostr << "\t-y SYNC\t\t: After each operation, 'fsync' or 'fdatasync' the file and the "
+            "directories it changed (default 'none').\n";
+    ostr << "\t-q PROJECT_ID\t: Project id " << Command::PROJQUOTA
+         << " assigns, which needs project quota enabled on the filesystem (default "
+         << command.project_id << ").\n";
+    ostr << "\t-r N_RUNS\t: Run the workload this many times and report statistics over them "
+            "(default "
+         << command.n_repeat << ").\n";
+    ostr << "\t-u N_WARMUP\t: Run the workload this many more times first without recording "
+            "them (default "
+         << command.n_warmup << ").\n";
     ostr << "NOTE: -w WORKLOAD_T defines a new command and must come after its workload_options."
          << std::endl;
 }
@@ -146,8 +295,27 @@ void drop_state() {
 
 static constexpr int OPEN_DIR_FLAGS = O_RDONLY | O_DIRECTORY | O_PATH | O_CLOEXEC;
 
-bool delete_files(const std::string& dir, int n_file, const std::string& basename) {
-    int dir_fd = open(dir.c_str(), OPEN_DIR_FLAGS);
+// O_PATH descriptors can't be synced, so directories are opened normally when they need to be.
+int open_dir(const std::string& dir, SyncMode sync) {
+    return open(dir.c_str(), sync == SyncMode::NONE ? OPEN_DIR_FLAGS
+                                                    : O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+}
+
+bool sync_fd(int fd, SyncMode sync) {
+    switch (sync) {
+        case SyncMode::NONE:
+            return true;
+        case SyncMode::FSYNC:
+            return fsync(fd) == 0;
+        case SyncMode::FDATASYNC:
+            return fdatasync(fd) == 0;
+    }
+    return false;
+}
+
+bool delete_files(const std::string& dir, int n_file, const std::string& basename,
+                  SyncMode sync = SyncMode::NONE) {
+    int dir_fd = open_dir(dir, sync);
     if (dir_fd == -1) {
         int error = errno;
         std::cerr << "Failed to open work directory '" << dir << "', error '" << strerror(error)
@@ -158,7 +326,7 @@ bool delete_files(const std::string& dir, int n_file, const std::string& basenam
     bool ret = true;
     for (int i = 0; i < n_file; i++) {
         std::string filename = basename + std::to_string(i);
-        ret = ret && (unlinkat(dir_fd, filename.c_str(), 0) == 0);
+        ret = ret && (unlinkat(dir_fd, filename.c_str(), 0) == 0) && sync_fd(dir_fd, sync);
     }
 
     if (!ret) std::cerr << "Failed to delete at least one of the files" << std::endl;
@@ -166,8 +334,9 @@ bool delete_files(const std::string& dir, int n_file, const std::string& basenam
     return ret;
 }
 
-bool create_files(const std::string& dir, int n_file, const std::string& basename) {
-    int dir_fd = open(dir.c_str(), OPEN_DIR_FLAGS);
+bool create_files(const std::string& dir, int n_file, const std::string& basename,
+                  SyncMode sync = SyncMode::NONE) {
+    int dir_fd = open_dir(dir, sync);
     if (dir_fd == -1) {
         int error = errno;
         std::cerr << "Failed to open work directory '" << dir << "', error '" << strerror(error)
@@ -179,7 +348,7 @@ bool create_files(const std::string& dir, int n_file, const std::string& basenam
     for (int i = 0; i < n_file; i++) {
         std::string filename = basename + std::to_string(i);
         int fd = openat(dir_fd, filename.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0777);
-        ret = ret && fd != -1;
+        ret = ret && fd != -1 && sync_fd(fd, sync) && sync_fd(dir_fd, sync);
         close(fd);
     }
 
@@ -192,15 +361,15 @@ bool create_files(const std::string& dir, int n_file, const std::string& basenam
 }
 
 bool move_files(const std::string& from_dir, const std::string& to_dir, int n_file,
-                const std::string& from_basename, const std::string& to_basename) {
-    int from_dir_fd = open(from_dir.c_str(), OPEN_DIR_FLAGS);
+                const std::string& from_basename, const std::string& to_basename, SyncMode sync) {
+    int from_dir_fd = open_dir(from_dir, sync);
     if (from_dir_fd == -1) {
         int error = errno;
         std::cerr << "Failed to open source directory '" << from_dir << "', error '"
                   << strerror(error) << "'." << std::endl;
         return false;
     }
-    int to_dir_fd = open(to_dir.c_str(), OPEN_DIR_FLAGS);
+    int to_dir_fd = open_dir(to_dir, sync);
     if (to_dir_fd == -1) {
         int error = errno;
         std::cerr << "Failed to open destination directory '" << to_dir << "', error '"
@@ -214,17 +383,19 @@ bool move_files(const std::string& from_dir, const std::string& to_dir, int n_fi
         std::string from_filename = from_basename + std::to_string(i);
         std::string to_filename = to_basename + std::to_string(i);
         ret = ret &&
-              (renameat(from_dir_fd, from_filename.c_str(), to_dir_fd, to_filename.c_str()) == 0);
+              (renameat(from_dir_fd, from_filename.c_str(), to_dir_fd, to_filename.c_str()) == 0) &&
+              sync_fd(to_dir_fd, sync) && (from_dir == to_dir || sync_fd(from_dir_fd, sync));
     }
 
     if (!ret) std::cerr << "Failed to move at least one of the files" << std::endl;
     close(from_dir_fd);
-    close(from_dir_fd);
+    close(to_dir_fd);
     return ret;
 }
 
 bool hardlink_files(const std::string& from_dir, const std::string& to_dir, int n_file,
-                    const std::string& from_basename, const std::string& to_basename) {
+                    const std::string& from_basename, const std::string& to_basename,
+                    SyncMode sync) {
     int from_dir_fd = open(from_dir.c_str(), OPEN_DIR_FLAGS);
     if (from_dir_fd == -1) {
         int error = errno;
@@ -232,7 +403,7 @@ bool hardlink_files(const std::string& from_dir, const std::string& to_dir, int
                   << strerror(error) << "'." << std::endl;
         return false;
     }
-    int to_dir_fd = open(to_dir.c_str(), OPEN_DIR_FLAGS);
+    int to_dir_fd = open_dir(to_dir, sync);
     if (to_dir_fd == -1) {
         int error = errno;
         std::cerr << "Failed to open destination directory '" << to_dir << "', error '"
@@ -246,7 +417,8 @@ bool hardlink_files(const std::string& from_dir, const std::string& to_dir, int
         std::string from_filename = from_basename + std::to_string(i);
         std::string to_filename = to_basename + std::to_string(i);
         ret = ret &&
-              (linkat(from_dir_fd, from_filename.c_str(), to_dir_fd, to_filename.c_str(), 0) == 0);
+              linkat(from_dir_fd, from_filename.c_str(), to_dir_fd, to_filename.c_str(), 0) == 0 &&
+              sync_fd(to_dir_fd, sync);
     }
 
     if (!ret) std::cerr << "Failed to hardlink at least one of the files" << std::endl;
@@ -256,9 +428,10 @@ bool hardlink_files(const std::string& from_dir, const std::string& to_dir, int
 }
 
 bool symlink_files(std::string from_dir, const std::string& to_dir, int n_file,
-                   const std::string& from_basename, const std::string& to_basename) {
+                   const std::string& from_basename, const std::string& to_basename,
+                   SyncMode sync) {
     if (from_dir.back() != '/') from_dir.push_back('/');
-    int to_dir_fd = open(to_dir.c_str(), OPEN_DIR_FLAGS);
+    int to_dir_fd = open_dir(to_dir, sync);
     if (to_dir_fd == -1) {
         int error = errno;
         std::cerr << "Failed to open destination directory '" << to_dir << "', error '"
@@ -270,7 +443,8 @@ bool symlink_files(std::string from_dir, const std::string& to_dir, int n_file,
     for (int i = 0; i < n_file; i++) {
         std::string from_filepath = from_dir + from_basename + std::to_string(i);
         std::string to_filename = to_basename + std::to_string(i);
-        ret = ret && (symlinkat(from_filepath.c_str(), to_dir_fd, to_filename.c_str()) == 0);
+        ret = ret && (symlinkat(from_filepath.c_str(), to_dir_fd, to_filename.c_str()) == 0) &&
+              sync_fd(to_dir_fd, sync);
     }
 
     if (!ret) std::cerr << "Failed to symlink at least one of the files" << std::endl;
@@ -299,70 +473,358 @@ bool exhaustive_readdir(const std::string& from_dir) {
     return ret;
 }
 
+static constexpr char XATTR_NAME[] = "user.inodeop_bench";
+static constexpr char XATTR_VALUE[] = "u:object_r:app_data_file:s0:c512,c768";
+
+// Runs op on each of the files, given an O_PATH descriptor of their directory.
+bool for_each_file(const std::string& dir, int n_file, const std::string& basename,
+                   const std::string& action,
+                   const std::function<bool(int, const std::string&)>& op) {
+    int dir_fd = open(dir.c_str(), OPEN_DIR_FLAGS);
+    if (dir_fd == -1) {
+        int error = errno;
+        std::cerr << "Failed to open work directory '" << dir << "', error '" << strerror(error)
+                  << "'." << std::endl;
+        return false;
+    }
+
+    bool ret = true;
+    for (int i = 0; i < n_file; i++) {
+        ret = ret && op(dir_fd, basename + std::to_string(i));
+    }
+
+    if (!ret) std::cerr << "Failed to " << action << " at least one of the files" << std::endl;
+    close(dir_fd);
+    return ret;
+}
+
+// Opens the file read-only, the way vold does to issue its ioctls, and syncs it after op.
+bool with_file_fd(int dir_fd, const std::string& filename, SyncMode sync,
+                  const std::function<bool(int)>& op) {
+    int fd = openat(dir_fd, filename.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd == -1) return false;
+    bool ret = op(fd) && sync_fd(fd, sync);
+    close(fd);
+    return ret;
+}
+
+// Syncs the file after an operation that didn't need it open.
+bool sync_file(int dir_fd, const std::string& filename, SyncMode sync) {
+    if (sync == SyncMode::NONE) return true;
+    return with_file_fd(dir_fd, filename, sync, [](int) { return true; });
+}
+
+bool stat_files(const std::string& dir, int n_file, const std::string& basename) {
+    return for_each_file(dir, n_file, basename, "stat", [](int dir_fd, const std::string& name) {
+        struct stat st;
+        return fstatat(dir_fd, name.c_str(), &st, AT_SYMLINK_NOFOLLOW) == 0;
+    });
+}
+
+bool statx_files(const std::string& dir, int n_file, const std::string& basename) {
+    return for_each_file(dir, n_file, basename, "statx", [](int dir_fd, const std::string& name) {
+        struct statx stx;
+        return statx(dir_fd, name.c_str(), AT_SYMLINK_NOFOLLOW, STATX_BASIC_STATS, &stx) == 0;
+    });
+}
+
+bool getxattr_files(const std::string& dir, int n_file, const std::string& basename) {
+    return for_each_file(dir, n_file, basename, "getxattr",
+                         [&dir](int, const std::string& name) {
+                             char value[sizeof(XATTR_VALUE)];
+                             std::string path = dir + "/" + name;
+                             return lgetxattr(path.c_str(), XATTR_NAME, value, sizeof(value)) ==
+                                    sizeof(value);
+                         });
+}
+
+bool setxattr_files(const std::string& dir, int n_file, const std::string& basename,
+                    SyncMode sync = SyncMode::NONE) {
+    return for_each_file(dir, n_file, basename, "setxattr",
+                         [&dir, sync](int dir_fd, const std::string& name) {
+                             std::string path = dir + "/" + name;
+                             return lsetxattr(path.c_str(), XATTR_NAME, XATTR_VALUE,
+                                              sizeof(XATTR_VALUE), 0) == 0 &&
+                                    sync_file(dir_fd, name, sync);
+                         });
+}
+
+// Sets the owner the files already have, which still updates them as a real change would.
+bool chown_files(const std::string& dir, int n_file, const std::string& basename, SyncMode sync) {
+    uid_t uid = geteuid();
+    gid_t gid = getegid();
+    return for_each_file(dir, n_file, basename, "chown",
+                         [uid, gid, sync](int dir_fd, const std::string& name) {
+                             return fchownat(dir_fd, name.c_str(), uid, gid,
+                                             AT_SYMLINK_NOFOLLOW) == 0 &&
+                                    sync_file(dir_fd, name, sync);
+                         });
+}
+
+bool chmod_files(const std::string& dir, int n_file, const std::string& basename, SyncMode sync) {
+    return for_each_file(dir, n_file, basename, "chmod",
+                         [sync](int dir_fd, const std::string& name) {
+                             return fchmodat(dir_fd, name.c_str(), 0770, 0) == 0 &&
+                                    sync_file(dir_fd, name, sync);
+                         });
+}
+
+// Reads and updates the inode flags like SetQuotaInherit(), which sets FS_PROJINHERIT_FL on
+// directories; that flag is meaningless on files, so FS_NODUMP_FL stands in for it.
+bool setflags_files(const std::string& dir, int n_file, const std::string& basename,
+                    SyncMode sync) {
+    return for_each_file(dir, n_file, basename, "set flags on",
+                         [sync](int dir_fd, const std::string& name) {
+                             return with_file_fd(dir_fd, name, sync, [](int fd) {
+                                 unsigned int flags;
+                                 if (ioctl(fd, FS_IOC_GETFLAGS, &flags) == -1) return false;
+                                 flags |= FS_NODUMP_FL;
+                                 return ioctl(fd, FS_IOC_SETFLAGS, &flags) == 0;
+                             });
+                         });
+}
+
+// Assigns the project id like SetQuotaProjectId().
+bool projquota_files(const std::string& dir, int n_file, const std::string& basename,
+                     int project_id, SyncMode sync) {
+    return for_each_file(dir, n_file, basename, "set the project id of",
+                         [project_id, sync](int dir_fd, const std::string& name) {
+                             return with_file_fd(dir_fd, name, sync, [project_id](int fd) {
+                                 struct fsxattr fsx;
+                                 if (ioctl(fd, FS_IOC_FSGETXATTR, &fsx) == -1) return false;
+                                 fsx.fsx_projid = project_id;
+                                 return ioctl(fd, FS_IOC_FSSETXATTR, &fsx) == 0;
+                             });
+                         });
+}
+
+// The share of command one of its threads works on: a subdirectory "t<thread>" of each directory
+// of its own or, with shared directories, files named after the thread.
+Command thread_command(const Command& command, int thread) {
+    Command share = command;
+    std::string suffix = "t" + std::to_string(thread);
+    if (command.shared_dir) {
+        share.from_basename += suffix + "_";
+        share.to_basename += suffix + "_";
+    } else {
+        share.from_dir += "/" + suffix;
+        share.to_dir += "/" + suffix;
+    }
+    return share;
+}
+
+bool for_each_thread_dir(const Command& command,
+                         const std::function<bool(const std::string&)>& action) {
+    if (command.n_thread <= 1 || command.shared_dir) return true;
+    bool ret = true;
+    for (int i = 0; i < command.n_thread; i++) {
+        Command share = thread_command(command, i);
+        ret = action(share.from_dir) && ret;
+        if (share.to_dir != share.from_dir) ret = action(share.to_dir) && ret;
+    }
+    return ret;
+}
+
+bool make_thread_dirs(const Command& command) {
+    return for_each_thread_dir(command, [](const std::string& dir) {
+        if (mkdir(dir.c_str(), 0777) == 0 || errno == EEXIST) return true;
+        int error = errno;
+        std::cerr << "Failed to create thread directory '" << dir << "', error '"
+                  << strerror(error) << "'." << std::endl;
+        return false;
+    });
+}
+
+void remove_thread_dirs(const Command& command) {
+    for_each_thread_dir(command, [](const std::string& dir) { return rmdir(dir.c_str()) == 0; });
+}
+
+// Runs step on each of the threads of command at once, released together right after the
+// collector (if any) is reset. Returns whether it succeeded on all of them.
+bool run_threads(const Command& command, Collector* collector,
+                 const std::function<bool(const Command&)>& step) {
+    if (command.n_thread <= 1) {
+        if (collector) collector->reset();
+        return step(command);
+    }
+
+    std::promise<void> start;
+    std::shared_future<void> started = start.get_future().share();
+    std::vector<std::future<bool>> results;
+    for (int i = 0; i < command.n_thread; i++) {
+        results.push_back(std::async(std::launch::async, [&, share = thread_command(command, i)] {
+            started.wait();
+            return step(share);
+        }));
+    }
+
+    if (collector) collector->reset();
+    start.set_value();
+    bool ret = true;
+    for (auto& result : results) ret = result.get() && ret;
+    return ret;
+}
+
+bool create_from_files(const Command& command) {
+    return run_threads(command, nullptr, [](const Command& share) {
+        return create_files(share.from_dir, share.n_file, share.from_basename);
+    });
+}
+
+void delete_from_files(const Command& command) {
+    run_threads(command, nullptr, [](const Command& share) {
+        return delete_files(share.from_dir, share.n_file, share.from_basename);
+    });
+}
+
+void delete_to_files(const Command& command) {
+    run_threads(command, nullptr, [](const Command& share) {
+        return delete_files(share.to_dir, share.n_file, share.to_basename);
+    });
+}
+
 void create_workload(Collector* collector, const Command& command) {
     if (command.drop_state) drop_state();
-    collector->reset();
-    if (create_files(command.from_dir, command.n_file, command.from_basename))
-        collector->collect_metric(command.workload);
+    if (run_threads(command, collector, [](const Command& share) {
+            return create_files(share.from_dir, share.n_file, share.from_basename,
+                                share.sync_mode);
+        }))
+        collector->collect_metric(command.metric_name());
 
-    delete_files(command.from_dir, command.n_file, command.from_basename);
+    delete_from_files(command);
 }
 
 void delete_workload(Collector* collector, const Command& command) {
-    if (!create_files(command.from_dir, command.n_file, command.from_basename)) return;
+    if (!create_from_files(command)) return;
 
     if (command.drop_state) drop_state();
-    collector->reset();
-    if (delete_files(command.from_dir, command.n_file, command.from_basename))
-        collector->collect_metric(command.workload);
+    if (run_threads(command, collector, [](const Command& share) {
+            return delete_files(share.from_dir, share.n_file, share.from_basename,
+                                share.sync_mode);
+        }))
+        collector->collect_metric(command.metric_name());
 }
 
 void move_workload(Collector* collector, const Command& command) {
-    if (!create_files(command.from_dir, command.n_file, command.from_basename)) return;
+    if (!create_from_files(command)) return;
 
     if (command.drop_state) drop_state();
-    collector->reset();
-    if (move_files(command.from_dir, command.to_dir, command.n_file, command.from_basename,
-                   command.to_basename))
-        collector->collect_metric(command.workload);
+    if (run_threads(command, collector, [](const Command& share) {
+            return move_files(share.from_dir, share.to_dir, share.n_file, share.from_basename,
+                              share.to_basename, share.sync_mode);
+        }))
+        collector->collect_metric(command.metric_name());
 
-    delete_files(command.to_dir, command.n_file, command.to_basename);
+    delete_to_files(command);
 }
 
 void hardlink_workload(Collector* collector, const Command& command) {
-    if (!create_files(command.from_dir, command.n_file, command.from_basename)) return;
+    if (!create_from_files(command)) return;
 
     if (command.drop_state) drop_state();
-    collector->reset();
-    if (hardlink_files(command.from_dir, command.to_dir, command.n_file, command.from_basename,
-                       command.to_basename))
-        collector->collect_metric(command.workload);
-
-    delete_files(command.from_dir, command.n_file, command.from_basename);
-    delete_files(command.to_dir, command.n_file, command.to_basename);
+    if (run_threads(command, collector, [](const Command& share) {
+            return hardlink_files(share.from_dir, share.to_dir, share.n_file, share.from_basename,
+                                  share.to_basename, share.sync_mode);
+        }))
+        collector->collect_metric(command.metric_name());
+
+    delete_from_files(command);
+    delete_to_files(command);
 }
 
 void symlink_workload(Collector* collector, const Command& command) {
-    if (!create_files(command.from_dir, command.n_file, command.from_basename)) return;
+    if (!create_from_files(command)) return;
 
     if (command.drop_state) drop_state();
-    collector->reset();
-    if (symlink_files(command.from_dir, command.to_dir, command.n_file, command.from_basename,
-                      command.to_basename))
-        collector->collect_metric(command.workload);
-
-    delete_files(command.to_dir, command.n_file, command.to_basename);
-    delete_files(command.from_dir, command.n_file, command.from_basename);
+    if (run_threads(command, collector, [](const Command& share) {
+            return symlink_files(share.from_dir, share.to_dir, share.n_file, share.from_basename,
+                                 share.to_basename, share.sync_mode);
+        }))
+        collector->collect_metric(command.metric_name());
+
+    delete_to_files(command);
+    delete_from_files(command);
 }
 
 void readdir_workload(Collector* collector, const Command& command) {
-    if (!create_files(command.from_dir, command.n_file, command.from_basename)) return;
+    if (!create_from_files(command)) return;
 
     if (command.drop_state) drop_state();
-    collector->reset();
-    if (exhaustive_readdir(command.from_dir)) collector->collect_metric(command.workload);
+    if (run_threads(command, collector,
+                    [](const Command& share) { return exhaustive_readdir(share.from_dir); }))
+        collector->collect_metric(command.metric_name());
+
+    delete_from_files(command);
+}
+
+// Times step on files created for it beforehand, and prepared by prepare if given.
+void existing_files_workload(Collector* collector, const Command& command,
+                             const std::function<bool(const Command&)>& step,
+                             const std::function<bool(const Command&)>& prepare = nullptr) {
+    if (!create_from_files(command)) return;
+
+    if (!prepare || run_threads(command, nullptr, prepare)) {
+        if (command.drop_state) drop_state();
+        if (run_threads(command, collector, step)) collector->collect_metric(command.metric_name());
+    }
+
+    delete_from_files(command);
+}
+
+void stat_workload(Collector* collector, const Command& command) {
+    existing_files_workload(collector, command, [](const Command& share) {
+        return stat_files(share.from_dir, share.n_file, share.from_basename);
+    });
+}
+
+void statx_workload(Collector* collector, const Command& command) {
+    existing_files_workload(collector, command, [](const Command& share) {
+        return statx_files(share.from_dir, share.n_file, share.from_basename);
+    });
+}
+
+void getxattr_workload(Collector* collector, const Command& command) {
+    existing_files_workload(
+            collector, command,
+            [](const Command& share) {
+                return getxattr_files(share.from_dir, share.n_file, share.from_basename);
+            },
+            [](const Command& share) {
+                return setxattr_files(share.from_dir, share.n_file, share.from_basename);
+            });
+}
+
+void setxattr_workload(Collector* collector, const Command& command) {
+    existing_files_workload(collector, command, [](const Command& share) {
+        return setxattr_files(share.from_dir, share.n_file, share.from_basename,
+                              share.sync_mode);
+    });
+}
 
-    delete_files(command.from_dir, command.n_file, command.from_basename);
+void chown_workload(Collector* collector, const Command& command) {
+    existing_files_workload(collector, command, [](const Command& share) {
+        return chown_files(share.from_dir, share.n_file, share.from_basename, share.sync_mode);
+    });
+}
+
+void chmod_workload(Collector* collector, const Command& command) {
+    existing_files_workload(collector, command, [](const Command& share) {
+        return chmod_files(share.from_dir, share.n_file, share.from_basename, share.sync_mode);
+    });
+}
+
+void setflags_workload(Collector* collector, const Command& command) {
+    existing_files_workload(collector, command, [](const Command& share) {
+        return setflags_files(share.from_dir, share.n_file, share.from_basename,
+                              share.sync_mode);
+    });
+}
+
+void projquota_workload(Collector* collector, const Command& command) {
+    existing_files_workload(collector, command, [](const Command& share) {
+        return projquota_files(share.from_dir, share.n_file, share.from_basename,
+                               share.project_id, share.sync_mode);
+    });
 }
 
 using workload_executor_t = std::function<void(Collector*, const Command&)>;
@@ -370,14 +832,19 @@ using workload_executor_t = std::function<void(Collector*, const Command&)>;
 std::unordered_map<std::string, workload_executor_t> executors = {
         {Command::CREATE, create_workload},   {Command::DELETE, delete_workload},
         {Command::MOVE, move_workload},       {Command::HARDLINK, hardlink_workload},
-        {Command::SYMLINK, symlink_workload}, {Command::READDIR, readdir_workload}};
+        {Command::SYMLINK, symlink_workload}, {Command::READDIR, readdir_workload},
+        {Command::STAT, stat_workload},       {Command::STATX, statx_workload},
+        {Command::GETXATTR, getxattr_workload}, {Command::SETXATTR, setxattr_workload},
+        {Command::CHOWN, chown_workload},     {Command::CHMOD, chmod_workload},
+        {Command::SETFLAGS, setflags_workload}, {Command::PROJQUOTA, projquota_workload}};
 
 int main(int argc, char** argv) {
     std::vector<Command> commands;
     Command command;
+    bool json = false;
     int opt;
 
-    while ((opt = getopt(argc, argv, "hvpsw:d:f:t:n:")) != -1) {
+    while ((opt = getopt(argc, argv, "hvpo:smw:d:f:t:n:j:y:q:r:u:")) != -1) {
         switch (opt) {
             case 'h':
                 usage(std::cout, argv[0]);
@@ -388,6 +855,14 @@ int main(int argc, char** argv) {
             case 'p':
                 print_commands(commands);
                 return EXIT_SUCCESS;
+            case 'o':
+                if (std::string(optarg) == "json") {
+                    json = true;
+                } else if (std::string(optarg) != "csv") {
+                    usage(std::cerr, argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
             case 's':
                 command.drop_state = false;
                 break;
@@ -406,6 +881,31 @@ int main(int argc, char** argv) {
             case 'n':
                 command.n_file = std::stoi(optarg);
                 break;
+            case 'r':
+                command.n_repeat = std::stoi(optarg);
+                break;
+            case 'u':
+                command.n_warmup = std::stoi(optarg);
+                break;
+            case 'q':
+                command.project_id = std::stoi(optarg);
+                break;
+            case 'j':
+                command.n_thread = std::stoi(optarg);
+                break;
+            case 'm':
+                command.shared_dir = true;
+                break;
+            case 'y':
+                if (std::string(optarg) == "fsync") {
+                    command.sync_mode = SyncMode::FSYNC;
+                } else if (std::string(optarg) == "fdatasync") {
+                    command.sync_mode = SyncMode::FDATASYNC;
+                } else if (std::string(optarg) != "none") {
+                    usage(std::cerr, argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
             default:
                 usage(std::cerr, argv[0]);
                 return EXIT_FAILURE;
@@ -416,9 +916,18 @@ int main(int argc, char** argv) {
     for (const Command& command : commands) {
         auto executor = executors.find(command.workload);
         if (executor == executors.end()) continue;
-        executor->second(&collector, command);
+        collector.start_command();
+        for (int run = 0; run < command.n_warmup + command.n_repeat; run++) {
+            collector.set_recording(run >= command.n_warmup);
+            if (make_thread_dirs(command)) executor->second(&collector, command);
+            remove_thread_dirs(command);
+        }
+    }
+    if (json) {
+        collector.report_metrics_json();
+    } else {
+        collector.report_metrics();
     }
-    collector.report_metrics();
 
     return EXIT_SUCCESS;
 }
@@ -14,10 +14,14 @@
  * limitations under the License.
  */
 
+#include <fcntl.h>
+#include <string.h>
 #include <sys/mount.h>
 
+#include <android-base/file.h>
 #include <android-base/logging.h>
 #include <android-base/stringprintf.h>
+#include <android-base/unique_fd.h>
 
 #include <logwrap/logwrap.h>
 
@@ -38,10 +42,10 @@ bool IsSupported() {
            IsFilesystemSupported("exfat");
 }
 
-status_t Check(const std::string& source) {
+status_t Check(const std::string& source, bool repair) {
     std::vector<std::string> cmd;
     cmd.push_back(kFsckPath);
-    cmd.push_back("-y");
+    cmd.push_back(repair ? "-y" : "-n");
     cmd.push_back(source);
 
     int rc = ForkExecvpTimeout(cmd, kUntrustedFsckSleepTime, sFsckUntrustedContext);
@@ -55,9 +59,27 @@ status_t Check(const std::string& source) {
     }
 }
 
+bool IsClean(const std::string& source) {
+    android::base::unique_fd fd(open(source.c_str(), O_RDONLY | O_CLOEXEC));
+    uint8_t boot[512];
+    if (fd == -1 || !android::base::ReadFullyAtOffset(fd, boot, sizeof(boot), 0)) {
+        PLOG(WARNING) << "Failed to read boot sector of " << source;
+        return false;
+    }
+    if (memcmp(boot + 3, "EXFAT   ", 8) != 0 || boot[510] != 0x55 || boot[511] != 0xaa) {
+        LOG(WARNING) << "Not an exFAT boot sector on " << source;
+        return false;
+    }
+    static constexpr uint16_t kVolumeDirty = 0x0002, kMediaFailure = 0x0004;
+    uint16_t volumeFlags = boot[106] | (boot[107] << 8);
+    return (volumeFlags & (kVolumeDirty | kMediaFailure)) == 0;
+}
+
 status_t Mount(const std::string& source, const std::string& target, int ownerUid, int ownerGid,
-               int permMask) {
+               int permMask, bool ro, bool remount) {
     int mountFlags = MS_NODEV | MS_NOSUID | MS_DIRSYNC | MS_NOATIME | MS_NOEXEC;
+    mountFlags |= (ro ? MS_RDONLY : 0);
+    mountFlags |= (remount ? MS_REMOUNT : 0);
     auto mountData = android::base::StringPrintf("uid=%d,gid=%d,fmask=%o,dmask=%o", ownerUid,
                                                  ownerGid, permMask, permMask);
 
@@ -27,9 +27,12 @@ namespace exfat {
 
 bool IsSupported();
 
-status_t Check(const std::string& source);
+// Checks and repairs the filesystem, or with repair unset only checks it, read-only
+status_t Check(const std::string& source, bool repair = true);
+// Whether the boot sector says the filesystem was unmounted cleanly, without media errors
+bool IsClean(const std::string& source);
 status_t Mount(const std::string& source, const std::string& target, int ownerUid, int ownerGid,
-               int permMask);
+               int permMask, bool ro = false, bool remount = false);
 status_t Format(const std::string& source);
 
 }  // namespace exfat
@@ -174,7 +174,8 @@ status_t Resize(const std::string& source, unsigned long numSectors) {
     return ForkExecvp(cmd);
 }
 
-status_t Format(const std::string& source, unsigned long numSectors, const std::string& target) {
+status_t Format(const std::string& source, unsigned long numSectors, const std::string& target,
+                bool lazyInit, bool discard) {
     std::vector<std::string> cmd;
     cmd.push_back(kMkfsPath);
 
@@ -210,11 +211,13 @@ status_t Format(const std::string& source, unsigned long numSectors, const std::
     cmd.push_back("-O");
     cmd.push_back(options);
 
-    if (needs_casefold || needs_projid) {
+    if (needs_casefold || needs_projid || lazyInit || !discard) {
         cmd.push_back("-E");
         std::string extopts = "";
         if (needs_casefold) extopts += "encoding=utf8,";
         if (needs_projid) extopts += "quotatype=usrquota:grpquota:prjquota,";
+        if (lazyInit) extopts += "lazy_itable_init=1,lazy_journal_init=1,";
+        if (!discard) extopts += "nodiscard,";
         cmd.push_back(extopts);
     }
 
@@ -31,7 +31,12 @@ status_t Check(const std::string& source, const std::string& target, bool truste
 status_t Mount(const std::string& source, const std::string& target, bool ro, bool remount,
                bool executable, const std::string& opts = "", bool trusted = false,
                bool portable = false);
-status_t Format(const std::string& source, unsigned long numSectors, const std::string& target);
+/*
+ * With lazyInit, inode tables and the journal are left for the kernel to zero after mounting,
+ * and without discard, mke2fs doesn't discard the device first, as when it was just wiped.
+ */
+status_t Format(const std::string& source, unsigned long numSectors, const std::string& target,
+                bool lazyInit = false, bool discard = true);
 status_t Resize(const std::string& source, unsigned long numSectors);
 
 }  // namespace ext4
@@ -94,7 +94,7 @@ status_t Mount(const std::string& source, const std::string& target,
     return res;
 }
 
-status_t Format(const std::string& source, const std::string& zoned_device) {
+status_t Format(const std::string& source, const std::string& zoned_device, bool discard) {
     std::vector<char const*> cmd;
     cmd.emplace_back(kMkfsPath);
 
@@ -104,6 +104,11 @@ status_t Format(const std::string& source, const std::string& zoned_device) {
     cmd.emplace_back("-g");
     cmd.emplace_back("android");
 
+    if (!discard) {
+        cmd.emplace_back("-t");
+        cmd.emplace_back("0");
+    }
+
     if (android::base::GetBoolProperty("vold.has_compress", false)) {
         cmd.emplace_back("-O");
         cmd.emplace_back("compression");
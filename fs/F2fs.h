@@ -31,7 +31,9 @@ status_t Check(const std::string& source, bool trusted);
 status_t Mount(const std::string& source, const std::string& target,
         const std::string& opts = "", bool trusted = false,
         bool portable = false);
-status_t Format(const std::string& source, const std::string& zoned_device = "");
+/* Without discard, make_f2fs doesn't discard the device first, as when it was just wiped */
+status_t Format(const std::string& source, const std::string& zoned_device = "",
+                bool discard = true);
 
 }  // namespace f2fs
 }  // namespace vold
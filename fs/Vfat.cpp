@@ -32,8 +32,10 @@
 
 #include <linux/kdev_t.h>
 
+#include <android-base/file.h>
 #include <android-base/logging.h>
 #include <android-base/stringprintf.h>
+#include <android-base/unique_fd.h>
 #include <selinux/selinux.h>
 
 #include <logwrap/logwrap.h>
@@ -56,7 +58,20 @@ bool IsSupported() {
            IsFilesystemSupported("vfat");
 }
 
-status_t Check(const std::string& source) {
+status_t Check(const std::string& source, bool repair) {
+    if (!repair) {
+        // Any problem found fails the check, since nothing gets fixed
+        std::vector<std::string> cmd = {kFsckPath, "-f", "-n", source};
+        int rc = ForkExecvpTimeout(cmd, kUntrustedFsckSleepTime, sFsckUntrustedContext);
+        if (rc == 0) {
+            LOG(INFO) << "Filesystem check completed OK";
+            return 0;
+        }
+        LOG(WARNING) << "Filesystem check found problems (code " << rc << ")";
+        errno = EIO;
+        return -1;
+    }
+
     int pass = 1;
     int rc = 0;
     do {
@@ -118,6 +133,64 @@ status_t Check(const std::string& source) {
     return 0;
 }
 
+static uint32_t le16(const uint8_t* p) {
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t le32(const uint8_t* p) {
+    return le16(p) | (le16(p + 2) << 16);
+}
+
+bool IsClean(const std::string& source) {
+    android::base::unique_fd fd(open(source.c_str(), O_RDONLY | O_CLOEXEC));
+    uint8_t boot[512];
+    if (fd == -1 || !android::base::ReadFullyAtOffset(fd, boot, sizeof(boot), 0)) {
+        PLOG(WARNING) << "Failed to read boot sector of " << source;
+        return false;
+    }
+    uint32_t bytesPerSector = le16(boot + 11);
+    uint32_t sectorsPerCluster = boot[13];
+    uint32_t reservedSectors = le16(boot + 14);
+    uint32_t numFats = boot[16];
+    uint32_t rootEntries = le16(boot + 17);
+    uint32_t totalSectors = le16(boot + 19) ? le16(boot + 19) : le32(boot + 32);
+    uint32_t fatSectors = le16(boot + 22) ? le16(boot + 22) : le32(boot + 36);
+    if (boot[510] != 0x55 || boot[511] != 0xaa || bytesPerSector < 512 ||
+        (bytesPerSector & (bytesPerSector - 1)) != 0 || sectorsPerCluster == 0 ||
+        numFats == 0 || fatSectors == 0) {
+        LOG(WARNING) << "Not a FAT boot sector on " << source;
+        return false;
+    }
+    uint32_t rootSectors = (rootEntries * 32 + bytesPerSector - 1) / bytesPerSector;
+    uint64_t metaSectors = reservedSectors + uint64_t(numFats) * fatSectors + rootSectors;
+    if (metaSectors >= totalSectors) {
+        LOG(WARNING) << "Bad FAT geometry on " << source;
+        return false;
+    }
+    uint64_t clusters = (totalSectors - metaSectors) / sectorsPerCluster;
+
+    // Linux keeps a dirty bit in the boot sector while mounted read-write
+    static constexpr uint8_t kStateDirty = 0x01;
+    bool fat32 = le16(boot + 22) == 0;
+    if (boot[fat32 ? 65 : 37] & kStateDirty) return false;
+
+    // Windows clears the clean shutdown bit and sets the hard error bit in FAT[1]. FAT12 has
+    // no room for either.
+    if (clusters < 4085) return true;
+    uint8_t fat1[4];
+    off64_t fat1Offset = off64_t(reservedSectors) * bytesPerSector + (fat32 ? 4 : 2);
+    if (!android::base::ReadFullyAtOffset(fd, fat1, fat32 ? 4 : 2, fat1Offset)) {
+        PLOG(WARNING) << "Failed to read FAT of " << source;
+        return false;
+    }
+    if (fat32) {
+        static constexpr uint32_t kCleanShutdown = 0x08000000, kNoHardError = 0x04000000;
+        return (le32(fat1) & (kCleanShutdown | kNoHardError)) == (kCleanShutdown | kNoHardError);
+    }
+    static constexpr uint32_t kCleanShutdown = 0x8000, kNoHardError = 0x4000;
+    return (le16(fat1) & (kCleanShutdown | kNoHardError)) == (kCleanShutdown | kNoHardError);
+}
+
 status_t Mount(const std::string& source, const std::string& target, bool ro, bool remount,
                bool executable, int ownerUid, int ownerGid, int permMask, bool createLost) {
     int rc;
@@ -27,7 +27,10 @@ namespace vfat {
 
 bool IsSupported();
 
-status_t Check(const std::string& source);
+// Checks and repairs the filesystem, or with repair unset only checks it, read-only
+status_t Check(const std::string& source, bool repair = true);
+// Whether the boot sector and FAT say the filesystem was unmounted cleanly, without errors
+bool IsClean(const std::string& source);
 status_t Mount(const std::string& source, const std::string& target, bool ro, bool remount,
                bool executable, int ownerUid, int ownerGid, int permMask, bool createLost);
 status_t Format(const std::string& source, unsigned long numSectors);
@@ -25,6 +25,7 @@
 #include "model/Disk.h"
 #include "sehandle.h"
 
+#include <android-base/chrono_utils.h>
 #include <android-base/logging.h>
 #include <android-base/properties.h>
 #include <android-base/stringprintf.h>
@@ -42,6 +43,13 @@
 #include <string.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
 
 typedef struct vold_configs {
     bool has_adoptable : 1;
@@ -185,45 +193,68 @@ static void parse_args(int argc, char** argv) {
     CHECK(android::vold::sFsckUntrustedContext != nullptr);
 }
 
-static void do_coldboot(DIR* d, int lvl) {
-    struct dirent* de;
-    int dfd, fd;
-
-    dfd = dirfd(d);
+// Enough to overlap the uevent writes, each of which waits for the kernel to send the event
+static constexpr size_t kColdbootThreads = 4;
 
-    fd = openat(dfd, "uevent", O_WRONLY | O_CLOEXEC);
+static void coldboot_trigger(const std::string& uevent) {
+    int fd = open(uevent.c_str(), O_WRONLY | O_CLOEXEC);
     if (fd >= 0) {
         write(fd, "add\n", 4);
         close(fd);
     }
+}
 
-    while ((de = readdir(d))) {
-        DIR* d2;
+// Block devices under path are disks, with their partitions as the only subdirectories
+// that have a uevent, so there's no need to walk queue/, mq/ and the rest of sysfs.
+static std::vector<std::string> coldboot_scan(const char* path) {
+    ATRACE_NAME("coldboot_scan");
+    std::vector<std::string> uevents;
+    DIR* d = opendir(path);
+    if (!d) return uevents;
 
+    struct dirent* de;
+    while ((de = readdir(d))) {
         if (de->d_name[0] == '.') continue;
-
-        if (de->d_type != DT_DIR && lvl > 0) continue;
-
-        fd = openat(dfd, de->d_name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
-        if (fd < 0) continue;
-
-        d2 = fdopendir(fd);
-        if (d2 == 0)
-            close(fd);
-        else {
-            do_coldboot(d2, lvl + 1);
-            closedir(d2);
+        std::string disk = StringPrintf("%s/%s", path, de->d_name);
+        uevents.push_back(disk + "/uevent");
+
+        DIR* d2 = opendir(disk.c_str());
+        if (!d2) continue;
+        struct dirent* de2;
+        while ((de2 = readdir(d2))) {
+            if (de2->d_name[0] == '.' || de2->d_type != DT_DIR) continue;
+            std::string part = StringPrintf("%s/%s", disk.c_str(), de2->d_name);
+            if (access((part + "/partition").c_str(), F_OK) == 0) {
+                uevents.push_back(part + "/uevent");
+            }
         }
+        closedir(d2);
     }
+    closedir(d);
+    return uevents;
 }
 
 static void coldboot(const char* path) {
     ATRACE_NAME("coldboot");
-    DIR* d = opendir(path);
-    if (d) {
-        do_coldboot(d, 0);
-        closedir(d);
+    android::base::Timer timer;
+    std::vector<std::string> uevents = coldboot_scan(path);
+
+    std::atomic<size_t> next(0);
+    std::vector<std::thread> threads;
+    size_t thread_count = std::min(kColdbootThreads, uevents.size());
+    for (size_t i = 0; i < thread_count; i++) {
+        threads.emplace_back([&uevents, &next]() {
+            ATRACE_NAME("coldboot_trigger");
+            for (size_t j = next++; j < uevents.size(); j = next++) {
+                coldboot_trigger(uevents[j]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
     }
+    LOG(INFO) << "Coldboot triggered " << uevents.size() << " uevents in "
+              << timer.duration().count() << "ms";
 }
 
 static int process_config(VolumeManager* vm, VoldConfigs* configs) {
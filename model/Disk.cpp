@@ -16,6 +16,8 @@
 
 #include "Disk.h"
 #include "FsCrypt.h"
+#include "FsProbe.h"
+#include "PartitionTable.h"
 #include "PrivateVolume.h"
 #include "PublicVolume.h"
 #include "Utils.h"
@@ -43,13 +45,13 @@
 
 using android::base::ReadFileToString;
 using android::base::StringPrintf;
+using android::base::unique_fd;
 using android::base::WriteStringToFile;
 
 namespace android {
 namespace vold {
 
 static const char* kSgdiskPath = "/system/bin/sgdisk";
-static const char* kSgdiskToken = " \t\n";
 
 static const char* kSysfsLoopMaxMinors = "/sys/module/loop/parameters/max_part";
 static const char* kSysfsMmcMaxMinorsDeprecated = "/sys/module/mmcblk/parameters/perdev_minors";
@@ -81,12 +83,6 @@ static const char* kGptLinuxFilesystem = "0FC63DAF-8483-4772-8E79-3D69D8477DE4";
 static const char* kGptAndroidMeta = "19A710A2-B3CA-11E4-B026-10604B889DCF";
 static const char* kGptAndroidExpand = "193D1EA4-B3CA-11E4-B075-10604B889DCF";
 
-enum class Table {
-    kUnknown,
-    kMbr,
-    kGpt,
-};
-
 static bool isNvmeBlkDevice(unsigned int major, const std::string& sysPath) {
     return sysPath.find("nvme") != std::string::npos && major >= kMajorBlockDynamicMin &&
            major <= kMajorBlockDynamicMax;
@@ -145,7 +141,26 @@ std::vector<std::shared_ptr<VolumeBase>> Disk::getVolumes() const {
     return vols;
 }
 
+Disk::Probe Disk::probe() const {
+    Probe probe;
+    unique_fd fd(TEMP_FAILURE_RETRY(open(mDevPath.c_str(), O_RDONLY | O_CLOEXEC)));
+    if (fd != -1) probe.diskSeq = GetDiskSequence(fd.get());
+    probe.metadataResult = probeMetadata(&probe);
+    probe.tableResult = readPartitionTable(&probe.table);
+    if (probe.tableResult == OK && (probe.table.type == PartitionTable::Type::kUnknown ||
+                                    probe.table.partitions.empty())) {
+        std::string fsType;
+        std::string unused;
+        probe.wholeDiskFs = ReadMetadataUntrusted(mDevPath, &fsType, &unused, &unused) == OK;
+    }
+    return probe;
+}
+
 status_t Disk::create() {
+    return create(isStub() ? Probe() : probe());
+}
+
+status_t Disk::create(const Probe& probe) {
     CHECK(!mCreated);
     mCreated = true;
 
@@ -156,14 +171,15 @@ status_t Disk::create() {
         createStubVolume();
         return OK;
     }
-    readMetadata();
-    readPartitions();
+    readMetadata(probe);
+    readPartitions(probe);
     return OK;
 }
 
 status_t Disk::destroy() {
     CHECK(mCreated);
     destroyAllVolumes();
+    mLastProbe.reset();
     mCreated = false;
 
     auto listener = VolumeManager::Instance()->getListener();
@@ -238,23 +254,37 @@ void Disk::destroyAllVolumes() {
     mVolumes.clear();
 }
 
-status_t Disk::readMetadata() {
-
+bool Disk::skipChange() {
     if (mSkipChange) {
-        return OK;
+        mSkipChange = false;
+        LOG(INFO) << "Skip first change";
+        return true;
     }
+    return false;
+}
+
+status_t Disk::readMetadata(const Probe& probe) {
+    mSize = probe.size;
+    mLabel = probe.label;
+    if (probe.metadataResult != OK) {
+        return probe.metadataResult;
+    }
+
+    auto listener = VolumeManager::Instance()->getListener();
+    if (listener) listener->onDiskMetadataChanged(getId(), mSize, mLabel, mSysPath);
 
-    mSize = -1;
-    mLabel.clear();
+    return OK;
+}
 
-    if (GetBlockDevSize(mDevPath, &mSize) != OK) {
-        mSize = -1;
+status_t Disk::probeMetadata(Probe* probe) const {
+    if (GetBlockDevSize(mDevPath, &probe->size) != OK) {
+        probe->size = -1;
     }
 
     unsigned int majorId = major(mDevice);
     switch (majorId) {
         case kMajorBlockLoop: {
-            mLabel = "Virtual";
+            probe->label = "Virtual";
             break;
         }
         // clang-format off
@@ -272,7 +302,7 @@ status_t Disk::readMetadata() {
                 return -errno;
             }
             tmp = android::base::Trim(tmp);
-            mLabel = tmp;
+            probe->label = tmp;
             break;
         }
         case kMajorBlockMmc: {
@@ -293,10 +323,10 @@ status_t Disk::readMetadata() {
             // user confusion, this list doesn't contain white-label manfid.
             switch (manfid) {
                 // clang-format off
-                case 0x000003: mLabel = "SanDisk"; break;
-                case 0x00001b: mLabel = "Samsung"; break;
-                case 0x000028: mLabel = "Lexar"; break;
-                case 0x000074: mLabel = "Transcend"; break;
+                case 0x000003: probe->label = "SanDisk"; break;
+                case 0x00001b: probe->label = "Samsung"; break;
+                case 0x000028: probe->label = "Lexar"; break;
+                case 0x000074: probe->label = "Transcend"; break;
                     // clang-format on
             }
             break;
@@ -305,7 +335,7 @@ status_t Disk::readMetadata() {
             if (IsVirtioBlkDevice(majorId)) {
                 LOG(DEBUG) << "Recognized experimental block major ID " << majorId
                            << " as virtio-blk (emulator's virtual SD card device)";
-                mLabel = "Virtual";
+                probe->label = "Virtual";
                 break;
             }
             if (isNvmeBlkDevice(majorId, mSysPath)) {
@@ -315,7 +345,7 @@ status_t Disk::readMetadata() {
                     PLOG(WARNING) << "Failed to read vendor from " << path;
                     return -errno;
                 }
-                mLabel = tmp;
+                probe->label = tmp;
                 break;
             }
             LOG(WARNING) << "Unsupported block major type " << majorId;
@@ -323,35 +353,31 @@ status_t Disk::readMetadata() {
         }
     }
 
-    auto listener = VolumeManager::Instance()->getListener();
-    if (listener) listener->onDiskMetadataChanged(getId(), mSize, mLabel, mSysPath);
-
     return OK;
 }
 
-status_t Disk::readPartitions() {
+bool Disk::isUnchanged(const Probe& probe) const {
+    if (!mLastProbe || mJustPartitioned) return false;
+    const Probe& last = *mLastProbe;
+    // Tables that sgdisk had to read have no checksum, and are always read again
+    return probe.metadataResult == OK && last.metadataResult == OK &&
+           probe.tableResult == OK && last.tableResult == OK && probe.size == last.size &&
+           probe.label == last.label && probe.diskSeq == last.diskSeq &&
+           probe.table.type == last.table.type && probe.table.checksum != 0 &&
+           probe.table.checksum == last.table.checksum;
+}
+
+status_t Disk::readPartitions(const Probe& probe) {
     int maxMinors = getMaxMinors();
     if (maxMinors < 0) {
         return -ENOTSUP;
     }
 
-    if (mSkipChange) {
-        mSkipChange = false;
-        LOG(INFO) << "Skip first change";
-        return OK;
-    }
-
     destroyAllVolumes();
+    mLastProbe = probe;
 
-    // Parse partition table
-
-    std::vector<std::string> cmd;
-    cmd.push_back(kSgdiskPath);
-    cmd.push_back("--android-dump");
-    cmd.push_back(mDevPath);
-
-    std::vector<std::string> output;
-    status_t res = ForkExecvp(cmd, &output);
+    const PartitionTable& table = probe.table;
+    status_t res = probe.tableResult;
     if (res != OK) {
         LOG(WARNING) << "sgdisk failed to scan " << mDevPath;
 
@@ -362,75 +388,39 @@ status_t Disk::readPartitions() {
         return res;
     }
 
-    Table table = Table::kUnknown;
-    bool foundParts = false;
-    for (const auto& line : output) {
-        auto split = android::base::Split(line, kSgdiskToken);
-        auto it = split.begin();
-        if (it == split.end()) continue;
-
-        if (*it == "DISK") {
-            if (++it == split.end()) continue;
-            if (*it == "mbr") {
-                table = Table::kMbr;
-            } else if (*it == "gpt") {
-                table = Table::kGpt;
-            } else {
-                LOG(WARNING) << "Invalid partition table " << *it;
-                continue;
-            }
-        } else if (*it == "PART") {
-            foundParts = true;
-
-            if (++it == split.end()) continue;
-            int i = 0;
-            if (!android::base::ParseInt(*it, &i, 1, maxMinors)) {
-                LOG(WARNING) << "Invalid partition number " << *it;
-                continue;
-            }
-            dev_t partDevice = makedev(major(mDevice), minor(mDevice) + i);
-
-            if (table == Table::kMbr) {
-                if (++it == split.end()) continue;
-                int type = 0;
-                if (!android::base::ParseInt("0x" + *it, &type)) {
-                    LOG(WARNING) << "Invalid partition type " << *it;
-                    continue;
-                }
-
-                switch (type) {
-                    case 0x06:  // FAT16
-                    case 0x07:  // HPFS/NTFS/exFAT
-                    case 0x0b:  // W95 FAT32 (LBA)
-                    case 0x0c:  // W95 FAT32 (LBA)
-                    case 0x0e:  // W95 FAT16 (LBA)
-                    case 0x83:  // Linux EXT4/F2FS/...
-                        createPublicVolume(partDevice);
-                        break;
-                }
-            } else if (table == Table::kGpt) {
-                if (++it == split.end()) continue;
-                auto typeGuid = *it;
-                if (++it == split.end()) continue;
-                auto partGuid = *it;
-
-                if (android::base::EqualsIgnoreCase(typeGuid, kGptBasicData)
-                        || android::base::EqualsIgnoreCase(typeGuid, kGptLinuxFilesystem)) {
+    for (const auto& part : table.partitions) {
+        if (part.number < 1 || part.number > maxMinors) {
+            LOG(WARNING) << "Invalid partition number " << part.number;
+            continue;
+        }
+        dev_t partDevice = makedev(major(mDevice), minor(mDevice) + part.number);
+
+        if (table.type == PartitionTable::Type::kMbr) {
+            switch (part.mbrType) {
+                case 0x06:  // FAT16
+                case 0x07:  // HPFS/NTFS/exFAT
+                case 0x0b:  // W95 FAT32 (LBA)
+                case 0x0c:  // W95 FAT32 (LBA)
+                case 0x0e:  // W95 FAT16 (LBA)
+                case 0x83:  // Linux EXT4/F2FS/...
                     createPublicVolume(partDevice);
-                } else if (android::base::EqualsIgnoreCase(typeGuid, kGptAndroidExpand)) {
-                    createPrivateVolume(partDevice, partGuid);
-                }
+                    break;
+            }
+        } else if (table.type == PartitionTable::Type::kGpt) {
+            if (android::base::EqualsIgnoreCase(part.typeGuid, kGptBasicData)
+                    || android::base::EqualsIgnoreCase(part.typeGuid, kGptLinuxFilesystem)) {
+                createPublicVolume(partDevice);
+            } else if (android::base::EqualsIgnoreCase(part.typeGuid, kGptAndroidExpand)) {
+                createPrivateVolume(partDevice, part.partGuid);
             }
         }
     }
 
     // Ugly last ditch effort, treat entire disk as partition
-    if (table == Table::kUnknown || !foundParts) {
+    if (table.type == PartitionTable::Type::kUnknown || table.partitions.empty()) {
         LOG(WARNING) << mId << " has unknown partition table; trying entire device";
 
-        std::string fsType;
-        std::string unused;
-        if (ReadMetadataUntrusted(mDevPath, &fsType, &unused, &unused) == OK) {
+        if (probe.wholeDiskFs) {
             createPublicVolume(mDevice);
         } else {
             LOG(WARNING) << mId << " failed to identify, giving up";
@@ -463,42 +453,15 @@ status_t Disk::partitionPublic() {
     destroyAllVolumes();
     mJustPartitioned = true;
 
-    // Determine if we're coming from MBR
-    std::vector<std::string> cmd;
-    cmd.push_back(kSgdiskPath);
-    cmd.push_back("--android-dump");
-    cmd.push_back(mDevPath);
-
-    std::vector<std::string> output;
-    res = ForkExecvp(cmd, &output);
-    Table table = Table::kUnknown;
-    // fails when there is no partition table, it's okay
-    if (res == OK) {
-        for (auto line : output) {
-            char* cline = (char*) line.c_str();
-            char* token = strtok(cline, kSgdiskToken);
-            if (token == nullptr) continue;
-
-            if (!strcmp(token, "DISK")) {
-                const char* type = strtok(nullptr, kSgdiskToken);
-                if (!strcmp(type, "mbr")) {
-                    table = Table::kMbr;
-                    break;
-                } else if (!strcmp(type, "gpt")) {
-                    table = Table::kGpt;
-                    break;
-                }
-            }
-        }
-    }
-
-    if (table == Table::kMbr) {
+    // Determine if we're coming from MBR; fails when there is no partition table, it's okay
+    PartitionTable table;
+    if (readPartitionTable(&table) == OK && table.type == PartitionTable::Type::kMbr) {
         LOG(INFO) << "skip first disk change event due to MBR -> GPT switch";
         mSkipChange = true;
     }
 
     // First nuke any existing partition table
-    cmd.clear();
+    std::vector<std::string> cmd;
     cmd.push_back(kSgdiskPath);
     cmd.push_back("--zap-all");
     cmd.push_back(mDevPath);
@@ -615,6 +578,28 @@ status_t Disk::partitionMixed(int8_t ratio) {
     return OK;
 }
 
+status_t Disk::readPartitionTable(PartitionTable* table) const {
+    unique_fd fd(TEMP_FAILURE_RETRY(open(mDevPath.c_str(), O_RDONLY | O_CLOEXEC)));
+    if (fd == -1) {
+        PLOG(WARNING) << "Failed to open " << mDevPath;
+    } else if (ReadPartitionTable(fd.get(), table)) {
+        return OK;
+    }
+
+    std::vector<std::string> cmd;
+    cmd.push_back(kSgdiskPath);
+    cmd.push_back("--android-dump");
+    cmd.push_back(mDevPath);
+
+    std::vector<std::string> output;
+    status_t res = ForkExecvp(cmd, &output);
+    if (res != OK) {
+        return res;
+    }
+    ParseSgdiskDump(output, table);
+    return OK;
+}
+
 int Disk::getMaxMinors() {
     // Figure out maximum partition devices supported
     unsigned int majorId = major(mDevice);
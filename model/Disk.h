@@ -17,12 +17,14 @@
 #ifndef ANDROID_VOLD_DISK_H
 #define ANDROID_VOLD_DISK_H
 
+#include "PartitionTable.h"
 #include "StubVolume.h"
 #include "Utils.h"
 #include "VolumeBase.h"
 
 #include <utils/Errors.h>
 
+#include <optional>
 #include <vector>
 
 namespace android {
@@ -71,6 +73,7 @@ class Disk {
     int getFlags() const { return mFlags; }
 
     bool isStub() const { return (mFlags & kStubInvisible) || (mFlags & kStubVisible); }
+    bool isCreated() const { return mCreated; }
 
     std::shared_ptr<VolumeBase> findVolume(const std::string& id);
 
@@ -78,11 +81,38 @@ class Disk {
 
     std::vector<std::shared_ptr<VolumeBase>> getVolumes() const;
 
+    /* What probe() found on the media, for the methods below to act on */
+    struct Probe {
+        status_t metadataResult = OK;
+        uint64_t size = -1;
+        std::string label;
+        status_t tableResult = OK;
+        PartitionTable table;
+        /* Whether the whole disk holds a filesystem, when it has no partition table */
+        bool wholeDiskFs = false;
+        /* The kernel's count of media changes, or 0 if it doesn't keep one */
+        uint64_t diskSeq = 0;
+    };
+
+    /*
+     * Reads the metadata and partition table without changing any state, so that it can run
+     * without holding the VolumeManager lock.
+     */
+    Probe probe() const;
+
     status_t create();
+    status_t create(const Probe& probe);
     status_t destroy();
 
-    status_t readMetadata();
-    status_t readPartitions();
+    /* Whether this change event is the one to skip after partitioning, which it consumes */
+    bool skipChange();
+    /*
+     * Whether probe found the same media and partition table that the volumes were last
+     * created from, so a change event can leave them be.
+     */
+    bool isUnchanged(const Probe& probe) const;
+    status_t readMetadata(const Probe& probe);
+    status_t readPartitions(const Probe& probe);
     void initializePartition(std::shared_ptr<StubVolume> vol);
 
     status_t unmountAll();
@@ -118,6 +148,8 @@ class Disk {
     bool mJustPartitioned;
     /* Flag that we need to skip first disk change events after partitioning*/
     bool mSkipChange;
+    /* The probe the current volumes were created from, if readPartitions() has run */
+    std::optional<Probe> mLastProbe;
 
     void createPublicVolume(dev_t device,
                     const std::string& fstype = "",
@@ -129,6 +161,10 @@ class Disk {
 
     int getMaxMinors();
 
+    status_t probeMetadata(Probe* probe) const;
+    /* Reads the partition table directly, or through sgdisk if it needs a closer look */
+    status_t readPartitionTable(PartitionTable* table) const;
+
     DISALLOW_COPY_AND_ASSIGN(Disk);
 };
 
@@ -139,24 +139,20 @@ status_t EmulatedVolume::mountFuseBindMounts() {
         androidSource = StringPrintf("/%s/%d/Android", mRawPath.c_str(), userId);
     }
 
-    status_t status = OK;
+    // All of this user's own bind mounts go up as one set
+    std::vector<std::pair<std::string, std::string>> mounts;
+
     // Zygote will unmount these dirs if app data isolation is enabled, so apps
     // cannot access these dirs directly.
     std::string androidDataSource = StringPrintf("%s/data", androidSource.c_str());
     std::string androidDataTarget(
             StringPrintf("/mnt/user/%d/%s/%d/Android/data", userId, label.c_str(), userId));
-    status = doFuseBindMount(androidDataSource, androidDataTarget, pathsToUnmount);
-    if (status != OK) {
-        return status;
-    }
+    mounts.emplace_back(androidDataSource, androidDataTarget);
 
     std::string androidObbSource = StringPrintf("%s/obb", androidSource.c_str());
     std::string androidObbTarget(
             StringPrintf("/mnt/user/%d/%s/%d/Android/obb", userId, label.c_str(), userId));
-    status = doFuseBindMount(androidObbSource, androidObbTarget, pathsToUnmount);
-    if (status != OK) {
-        return status;
-    }
+    mounts.emplace_back(androidObbSource, androidObbTarget);
 
     // Installers get the same view as all other apps, with the sole exception that the
     // OBB dirs (Android/obb) are writable to them. On sdcardfs devices, this requires
@@ -167,11 +163,12 @@ status_t EmulatedVolume::mountFuseBindMounts() {
                 label.c_str(), userId));
         std::string obbInstallerTarget(StringPrintf("/mnt/installer/%d/%s/%d/Android/obb",
                 userId, label.c_str(), userId));
+        mounts.emplace_back(obbSource, obbInstallerTarget);
+    }
 
-        status = doFuseBindMount(obbSource, obbInstallerTarget, pathsToUnmount);
-        if (status != OK) {
-            return status;
-        }
+    status_t status = BindMounts(mounts, &pathsToUnmount);
+    if (status != OK) {
+        return status;
     }
 
     // For users that share their volume with another user (eg a clone
@@ -452,8 +449,6 @@ status_t EmulatedVolume::doMount() {
             }
         }
 
-        ConfigureReadAheadForFuse(GetFuseMountPathForUser(user_id, label), 256u);
-
         // By default, FUSE has a max_dirty ratio of 1%. This means that out of
         // all dirty pages in the system, only 1% is allowed to belong to any
         // FUSE filesystem. The reason this is in place is that FUSE
@@ -471,9 +466,10 @@ status_t EmulatedVolume::doMount() {
         // memory pressure the write rate may dip as well, in which case FUSE
         // writes to a 1% max_ratio filesystem are throttled to an extreme amount.
         //
-        // To prevent this, just give FUSE 40% max_ratio, meaning it can take
-        // up to 40% of all dirty pages in the system.
-        ConfigureMaxDirtyRatioForFuse(GetFuseMountPathForUser(user_id, label), 40u);
+        // To prevent this, give FUSE a large max_ratio, meaning it can take
+        // up to 40% of all dirty pages in the system by default; see GetFuseTuning().
+        ConfigureFuse(GetFuseMountPathForUser(user_id, label),
+                      GetFuseTuning("emulated", getInternalPath()));
 
         // All mounts where successful, disable scope guards
         sdcardfs_guard.Disable();
@@ -483,6 +479,15 @@ status_t EmulatedVolume::doMount() {
     return OK;
 }
 
+status_t EmulatedVolume::doTuneFuse(int readAheadKb, int maxRatio) {
+    if (!mFuseMounted) {
+        return -ENOTSUP;
+    }
+    ConfigureFuse(GetFuseMountPathForUser(getMountUserId(), getLabel()),
+                  GetFuseTuning("emulated", getInternalPath()), readAheadKb, maxRatio);
+    return OK;
+}
+
 status_t EmulatedVolume::doUnmount() {
     int userId = getMountUserId();
 
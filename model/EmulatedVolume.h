@@ -46,6 +46,7 @@ class EmulatedVolume : public VolumeBase {
   protected:
     status_t doMount() override;
     status_t doUnmount() override;
+    status_t doTuneFuse(int readAheadKb, int maxRatio) override;
 
   private:
     status_t unmountSdcardFs();
@@ -20,8 +20,10 @@
 #include "VoldUtil.h"
 #include "fs/Vfat.h"
 
+#include <android-base/file.h>
 #include <android-base/logging.h>
 #include <android-base/stringprintf.h>
+#include <android-base/unique_fd.h>
 #include <cutils/fs.h>
 #include <private/android_filesystem_config.h>
 
@@ -38,6 +40,19 @@ using android::base::StringPrintf;
 namespace android {
 namespace vold {
 
+// Bytes per sector from the FAT boot sector of the image, or 0 if it doesn't look like FAT
+static uint32_t fatSectorSize(const std::string& path) {
+    android::base::unique_fd fd(open(path.c_str(), O_RDONLY | O_CLOEXEC));
+    uint8_t bpb[13];
+    if (fd == -1 || !android::base::ReadFullyAtOffset(fd, bpb, sizeof(bpb), 0)) {
+        return 0;
+    }
+    uint32_t size = bpb[11] | (bpb[12] << 8);
+    // Only powers of two from 512 to 4096 are valid
+    if (size < 512 || size > 4096 || (size & (size - 1)) != 0) return 0;
+    return size;
+}
+
 ObbVolume::ObbVolume(int id, const std::string& sourcePath, gid_t ownerGid)
     : VolumeBase(Type::kObb) {
     setId(StringPrintf("obb:%d", id));
@@ -48,7 +63,12 @@ ObbVolume::ObbVolume(int id, const std::string& sourcePath, gid_t ownerGid)
 ObbVolume::~ObbVolume() {}
 
 status_t ObbVolume::doCreate() {
-    if (Loop::create(mSourcePath, mLoopPath)) {
+    // Large games read their assets through here, so keep them out of the page cache of the
+    // image file. Direct I/O needs the loop device's blocks to be as large as the backing
+    // device's, and FAT won't mount on blocks larger than its own sectors.
+    uint32_t blockSize = Loop::directIoBlockSize(mSourcePath);
+    bool directIo = blockSize != 0 && blockSize <= fatSectorSize(mSourcePath);
+    if (Loop::create(mSourcePath, mLoopPath, directIo, directIo ? blockSize : 0)) {
         PLOG(ERROR) << getId() << " failed to create loop";
         return -1;
     }
@@ -16,6 +16,7 @@
 
 #include "PrivateVolume.h"
 #include "EmulatedVolume.h"
+#include "FsProbe.h"
 #include "Utils.h"
 #include "VolumeEncryption.h"
 #include "VolumeManager.h"
@@ -50,6 +51,27 @@ namespace vold {
 static const unsigned int kMajorBlockLoop = 7;
 static const unsigned int kMajorBlockMmc = 179;
 
+static status_t CheckFilesystem(const std::string& id, const std::string& devPath,
+                                const std::string& fsType, const std::string& path) {
+    if (fsType == "ext4") {
+        int res = ext4::Check(devPath, path, true);
+        if (res == 0 || res == 1) {
+            LOG(DEBUG) << id << " passed filesystem check";
+            return OK;
+        }
+    } else if (fsType == "f2fs") {
+        if (f2fs::Check(devPath, true) == 0) {
+            LOG(DEBUG) << id << " passed filesystem check";
+            return OK;
+        }
+    } else {
+        LOG(ERROR) << id << " unsupported filesystem " << fsType;
+        return -EIO;
+    }
+    PLOG(ERROR) << id << " failed filesystem check";
+    return -EIO;
+}
+
 PrivateVolume::PrivateVolume(dev_t device, const KeyBuffer& keyRaw)
     : VolumeBase(Type::kPrivate), mRawDevice(device), mKeyRaw(keyRaw) {
     setId(StringPrintf("private:%u,%u", major(device), minor(device)));
@@ -117,10 +139,44 @@ status_t PrivateVolume::doCreate() {
         }
     }
     close(fd);
+
+    startCheck();
     return OK;
 }
 
+void PrivateVolume::startCheck() {
+    // Volumes are created as their disks are scanned, but mounted one at a time under the
+    // VolumeManager lock, so checking here lets the checks of all adopted devices overlap
+    // while the mounts still happen in the order they're asked for.
+    mPendingCheck = std::async(std::launch::async, [id = getId(), devPath = mDmDevPath] {
+        CheckResult result = {-EIO, "", ""};
+        std::string fsLabel;
+        if (ReadMetadata(devPath, &result.fsType, &result.fsUuid, &fsLabel) ||
+            (result.fsType != "ext4" && result.fsType != "f2fs")) {
+            // Nothing to check yet, such as a device that is about to be formatted
+            return result;
+        }
+        std::string path = StringPrintf("/mnt/expand/%s", result.fsUuid.c_str());
+        if (PrepareDir(path, 0700, AID_ROOT, AID_ROOT)) {
+            PLOG(ERROR) << id << " failed to create mount point " << path;
+            result.fsType.clear();
+            return result;
+        }
+        result.status = CheckFilesystem(id, devPath, result.fsType, path);
+        return result;
+    });
+}
+
+void PrivateVolume::dropCheck() {
+    if (mPendingCheck.valid()) {
+        mPendingCheck.wait();
+        mPendingCheck = {};
+    }
+}
+
 status_t PrivateVolume::doDestroy() {
+    dropCheck();
+
     auto& dm = dm::DeviceMapper::Instance();
     // TODO(b/149396179) there appears to be a race somewhere in the system where trying
     // to delete the device fails with EBUSY; for now, work around this by retrying.
@@ -154,37 +210,30 @@ status_t PrivateVolume::doMount() {
         return -EIO;
     }
 
-    if (mFsType == "ext4") {
-        int res = ext4::Check(mDmDevPath, mPath, true);
-        if (res == 0 || res == 1) {
-            LOG(DEBUG) << getId() << " passed filesystem check";
-        } else {
-            PLOG(ERROR) << getId() << " failed filesystem check";
-            return -EIO;
+    bool checked = false;
+    if (mPendingCheck.valid()) {
+        CheckResult result = mPendingCheck.get();
+        mPendingCheck = {};
+        // Only trust the result if it was for the filesystem that is there now
+        if (result.fsType == mFsType && result.fsUuid == mFsUuid) {
+            if (result.status != OK) return -EIO;
+            checked = true;
         }
+    }
+    if (!checked && CheckFilesystem(getId(), mDmDevPath, mFsType, mPath)) {
+        return -EIO;
+    }
 
+    if (mFsType == "ext4") {
         if (ext4::Mount(mDmDevPath, mPath, false, false, true, "", true)) {
             PLOG(ERROR) << getId() << " failed to mount";
             return -EIO;
         }
-
     } else if (mFsType == "f2fs") {
-        int res = f2fs::Check(mDmDevPath, true);
-        if (res == 0) {
-            LOG(DEBUG) << getId() << " passed filesystem check";
-        } else {
-            PLOG(ERROR) << getId() << " failed filesystem check";
-            return -EIO;
-        }
-
         if (f2fs::Mount(mDmDevPath, mPath, "", true)) {
             PLOG(ERROR) << getId() << " failed to mount";
             return -EIO;
         }
-
-    } else {
-        LOG(ERROR) << getId() << " unsupported filesystem " << mFsType;
-        return -EIO;
     }
 
     RestoreconRecursive(mPath);
@@ -235,6 +284,9 @@ status_t PrivateVolume::doUnmount() {
 }
 
 status_t PrivateVolume::doFormat(const std::string& fsType) {
+    // fsck must not be left running on the device while it is formatted
+    dropCheck();
+
     std::string resolvedFsType = fsType;
     if (fsType == "auto") {
         // For now, assume that all MMC devices are flash-based SD cards, and
@@ -250,20 +302,36 @@ status_t PrivateVolume::doFormat(const std::string& fsType) {
         LOG(DEBUG) << "Resolved auto to " << resolvedFsType;
     }
 
+    struct stat st;
+    if (stat(mDmDevPath.c_str(), &st) == 0) {
+        InvalidateFsMetadata(st.st_rdev);
+    }
+
+    if (resolvedFsType != "ext4" && resolvedFsType != "f2fs") {
+        LOG(ERROR) << getId() << " unsupported filesystem " << fsType;
+        return -EINVAL;
+    }
+
+    // Discarding here can report progress and be aborted, unlike the discard mkfs would do
+    // itself, so mkfs only discards when this failed for some other reason than no support.
+    status_t res = wipeForFormat(mDmDevPath);
+    if (res == -ECANCELED) {
+        LOG(INFO) << getId() << " format aborted";
+        return res;
+    }
+    bool discard = res != OK && res != -EOPNOTSUPP;
+
     if (resolvedFsType == "ext4") {
         // TODO: change reported mountpoint once we have better selinux support
-        if (ext4::Format(mDmDevPath, 0, "/data")) {
+        if (ext4::Format(mDmDevPath, 0, "/data", true, discard)) {
             PLOG(ERROR) << getId() << " failed to format";
             return -EIO;
         }
-    } else if (resolvedFsType == "f2fs") {
-        if (f2fs::Format(mDmDevPath)) {
+    } else {
+        if (f2fs::Format(mDmDevPath, "", discard)) {
             PLOG(ERROR) << getId() << " failed to format";
             return -EIO;
         }
-    } else {
-        LOG(ERROR) << getId() << " unsupported filesystem " << fsType;
-        return -EINVAL;
     }
 
     return OK;
@@ -21,6 +21,8 @@
 
 #include <cutils/multiuser.h>
 
+#include <future>
+
 namespace android {
 namespace vold {
 
@@ -56,6 +58,18 @@ class PrivateVolume : public VolumeBase {
     status_t readMetadata();
 
   private:
+    /* Outcome of a filesystem check, and the filesystem it was run on */
+    struct CheckResult {
+        status_t status;
+        std::string fsType;
+        std::string fsUuid;
+    };
+
+    /* Checks the new device in the background, so checks of several volumes overlap */
+    void startCheck();
+    /* Waits for a background check, and forgets it */
+    void dropCheck();
+
     /* Kernel device of raw, encrypted partition */
     dev_t mRawDevice;
     /* Path to raw, encrypted block device */
@@ -75,6 +89,9 @@ class PrivateVolume : public VolumeBase {
     /* User-visible filesystem label */
     std::string mFsLabel;
 
+    /* Check started by doCreate(), until doMount() consumes it */
+    std::future<CheckResult> mPendingCheck;
+
     DISALLOW_COPY_AND_ASSIGN(PrivateVolume);
 };
 
@@ -17,6 +17,7 @@
 #include "PublicVolume.h"
 
 #include "AppFuseUtil.h"
+#include "FsProbe.h"
 #include "Utils.h"
 #include "VolumeManager.h"
 #include "fs/Exfat.h"
@@ -25,9 +26,12 @@
 #include "fs/Ntfs.h"
 #include "fs/Vfat.h"
 
+#include <android-base/file.h>
 #include <android-base/logging.h>
+#include <android-base/parseint.h>
 #include <android-base/properties.h>
 #include <android-base/stringprintf.h>
+#include <android-base/strings.h>
 #include <cutils/fs.h>
 #include <private/android_filesystem_config.h>
 #include <utils/Timers.h>
@@ -39,6 +43,9 @@
 #include <sys/sysmacros.h>
 #include <sys/types.h>
 #include <sys/wait.h>
+#include <time.h>
+
+#include <thread>
 
 using android::base::GetBoolProperty;
 using android::base::StringPrintf;
@@ -50,6 +57,22 @@ static const char* kSdcardFsPath = "/system/bin/sdcard";
 
 static const char* kAsecPath = "/mnt/secure/asec";
 
+// When each public filesystem last passed a full check, by fsUuid. A clean filesystem skips
+// fsck until its last full check is this old.
+static const char* kCheckRecordDir = "/data/misc/vold/public_fsck";
+static constexpr int64_t kFullCheckIntervalSecs = 30 * 24 * 60 * 60;
+
+// Mount FAT and exFAT volumes read-only straight away, and check them in the background
+static const char* kPropBackgroundCheck = "persist.sys.vold.public_background_fsck";
+
+static std::string checkRecordPath(const std::string& fsUuid) {
+    if (fsUuid.empty() ||
+        fsUuid.find_first_not_of("0123456789ABCDEFabcdef-") != std::string::npos) {
+        return "";
+    }
+    return StringPrintf("%s/%s", kCheckRecordDir, fsUuid.c_str());
+}
+
 PublicVolume::PublicVolume(dev_t device, const std::string& fstype /* = "" */,
         const std::string& mntopts /* = "" */)
         : VolumeBase(Type::kPublic), mDevice(device),
@@ -57,6 +80,9 @@ PublicVolume::PublicVolume(dev_t device, const std::string& fstype /* = "" */,
     setId(StringPrintf("public:%u,%u", major(device), minor(device)));
     mDevPath = StringPrintf("/dev/block/vold/%s", getId().c_str());
     mFuseMounted = false;
+    mCheckPending = false;
+    mNeedsRepair = false;
+    mMountSeq = 0;
     mUseSdcardFs = IsSdcardfsUsed();
 }
 
@@ -102,6 +128,86 @@ status_t PublicVolume::doDestroy() {
     return DestroyDeviceNode(mDevPath);
 }
 
+bool PublicVolume::canSkipCheck() {
+    // Only worth it where fsck reads the whole filesystem even when it's clean
+    bool clean;
+    if (mFsType == "exfat") {
+        clean = exfat::IsClean(mDevPath);
+    } else if (mFsType == "vfat") {
+        clean = vfat::IsClean(mDevPath);
+    } else {
+        return false;
+    }
+    if (!clean) return false;
+
+    auto record = checkRecordPath(mFsUuid);
+    std::string contents;
+    int64_t checked;
+    if (record.empty() || !android::base::ReadFileToString(record, &contents) ||
+        !android::base::ParseInt(android::base::Trim(contents), &checked)) {
+        return false;
+    }
+    int64_t now = time(nullptr);
+    return checked <= now && now - checked < kFullCheckIntervalSecs;
+}
+
+status_t PublicVolume::checkFilesystem() {
+    int ret = 0;
+    if (mFsType == "exfat") {
+        ret = exfat::Check(mDevPath);
+    } else if (mFsType == "ext4") {
+        ret = ext4::Check(mDevPath, mRawPath, false);
+    } else if (mFsType == "f2fs") {
+        ret = f2fs::Check(mDevPath, false);
+    } else if (mFsType == "ntfs") {
+        ret = ntfs::Check(mDevPath);
+    } else if (mFsType == "vfat") {
+        ret = vfat::Check(mDevPath);
+    } else {
+        LOG(WARNING) << getId() << " unsupported filesystem check, skipping";
+    }
+    recordCheck(ret);
+    return ret;
+}
+
+void PublicVolume::recordCheck(status_t res) {
+    auto record = checkRecordPath(mFsUuid);
+    if (record.empty()) return;
+    if (res) {
+        unlink(record.c_str());
+    } else if (fs_prepare_dir(kCheckRecordDir, 0700, AID_ROOT, AID_ROOT) == 0) {
+        writeStringToFile(std::to_string(time(nullptr)), record);
+    }
+}
+
+bool PublicVolume::canCheckInBackground() {
+    // Their checkers can look at a mounted filesystem without changing it
+    return (mFsType == "exfat" || mFsType == "vfat") && !mNeedsRepair &&
+           GetBoolProperty(kPropBackgroundCheck, false);
+}
+
+status_t PublicVolume::mountFilesystem(bool isVisible, bool ro, bool remount) {
+    int ret;
+    if (mFsType == "exfat") {
+        ret = exfat::Mount(mDevPath, mRawPath, AID_ROOT,
+                 (isVisible ? AID_MEDIA_RW : AID_EXTERNAL_STORAGE), 0007, ro, remount);
+    } else if (mFsType == "ext4") {
+        ret = ext4::Mount(mDevPath, mRawPath, false, false, true, mMntOpts,
+                false, true);
+    } else if (mFsType == "f2fs") {
+        ret = f2fs::Mount(mDevPath, mRawPath, mMntOpts, false, true);
+    } else if (mFsType == "ntfs") {
+        ret = ntfs::Mount(mDevPath, mRawPath, AID_ROOT,
+                 (isVisible ? AID_MEDIA_RW : AID_EXTERNAL_STORAGE), 0007);
+    } else if (mFsType == "vfat") {
+        ret = vfat::Mount(mDevPath, mRawPath, ro, remount, false, AID_ROOT,
+                (isVisible ? AID_MEDIA_RW : AID_EXTERNAL_STORAGE), 0007, !ro);
+    } else {
+        ret = ::mount(mDevPath.c_str(), mRawPath.c_str(), mFsType.c_str(), 0, NULL);
+    }
+    return ret;
+}
+
 status_t PublicVolume::doMount() {
     bool isVisible = isVisibleForWrite();
     readMetadata();
@@ -136,41 +242,28 @@ status_t PublicVolume::doMount() {
         return -errno;
     }
 
-    int ret = 0;
-    if (mFsType == "exfat") {
-        ret = exfat::Check(mDevPath);
-    } else if (mFsType == "ext4") {
-        ret = ext4::Check(mDevPath, mRawPath, false);
-    } else if (mFsType == "f2fs") {
-        ret = f2fs::Check(mDevPath, false);
-    } else if (mFsType == "ntfs") {
-        ret = ntfs::Check(mDevPath);
-    } else if (mFsType == "vfat") {
-        ret = vfat::Check(mDevPath);
-    } else {
-        LOG(WARNING) << getId() << " unsupported filesystem check, skipping";
-    }
-    if (ret) {
+    mMountSeq++;
+    bool skipCheck = canSkipCheck();
+    mCheckPending = !skipCheck && canCheckInBackground();
+    mNeedsRepair = false;
+    if (skipCheck) {
+        LOG(INFO) << getId() << " was unmounted cleanly, skipping filesystem check";
+    } else if (mCheckPending) {
+        LOG(INFO) << getId() << " mounting read-only until the filesystem check finishes";
+    } else if (checkFilesystem() != OK) {
         LOG(ERROR) << getId() << " failed filesystem check";
         return -EIO;
     }
 
-    if (mFsType == "exfat") {
-        ret = exfat::Mount(mDevPath, mRawPath, AID_ROOT,
-                 (isVisible ? AID_MEDIA_RW : AID_EXTERNAL_STORAGE), 0007);
-    } else if (mFsType == "ext4") {
-        ret = ext4::Mount(mDevPath, mRawPath, false, false, true, mMntOpts,
-                false, true);
-    } else if (mFsType == "f2fs") {
-        ret = f2fs::Mount(mDevPath, mRawPath, mMntOpts, false, true);
-    } else if (mFsType == "ntfs") {
-        ret = ntfs::Mount(mDevPath, mRawPath, AID_ROOT,
-                 (isVisible ? AID_MEDIA_RW : AID_EXTERNAL_STORAGE), 0007);
-    } else if (mFsType == "vfat") {
-        ret = vfat::Mount(mDevPath, mRawPath, false, false, false, AID_ROOT,
-                (isVisible ? AID_MEDIA_RW : AID_EXTERNAL_STORAGE), 0007, true);
-    } else {
-        ret = ::mount(mDevPath.c_str(), mRawPath.c_str(), mFsType.c_str(), 0, NULL);
+    int ret = mountFilesystem(isVisible, mCheckPending);
+    if (ret && (skipCheck || mCheckPending)) {
+        LOG(WARNING) << getId() << " failed to mount unchecked, checking it now";
+        mCheckPending = false;
+        if (checkFilesystem() != OK) {
+            LOG(ERROR) << getId() << " failed filesystem check";
+            return -EIO;
+        }
+        ret = mountFilesystem(isVisible, false);
     }
     if (ret) {
         PLOG(ERROR) << getId() << " failed to mount " << mDevPath;
@@ -275,14 +368,85 @@ status_t PublicVolume::doMount() {
         }
     }
 
-    ConfigureReadAheadForFuse(GetFuseMountPathForUser(user_id, stableName), 256u);
-
     // See comment in model/EmulatedVolume.cpp
-    ConfigureMaxDirtyRatioForFuse(GetFuseMountPathForUser(user_id, stableName), 40u);
+    ConfigureFuse(GetFuseMountPathForUser(user_id, stableName), GetFuseTuning("public", mRawPath));
 
     return OK;
 }
 
+status_t PublicVolume::doTuneFuse(int readAheadKb, int maxRatio) {
+    if (!mFuseMounted) {
+        return -ENOTSUP;
+    }
+    std::string stableName = getId();
+    if (!mFsUuid.empty()) {
+        stableName = mFsUuid;
+    }
+    ConfigureFuse(GetFuseMountPathForUser(getMountUserId(), stableName),
+                  GetFuseTuning("public", mRawPath), readAheadKb, maxRatio);
+    return OK;
+}
+
+void PublicVolume::doPostMount() {
+    if (!mCheckPending) return;
+
+    // Runs without the lock, and comes back to the volume by id, since it may be gone by then
+    auto id = getId();
+    auto devPath = mDevPath;
+    auto fsType = mFsType;
+    auto mountSeq = mMountSeq;
+    std::thread([id, devPath, fsType, mountSeq]() {
+        bool passed = (fsType == "exfat" ? exfat::Check(devPath, false)
+                                         : vfat::Check(devPath, false)) == OK;
+        auto vm = VolumeManager::Instance();
+        std::lock_guard<std::mutex> lock(vm->getLock());
+        auto vol = vm->findVolume(id);
+        if (vol == nullptr || vol->getType() != VolumeBase::Type::kPublic) return;
+        static_cast<PublicVolume*>(vol.get())->finishBackgroundCheck(mountSeq, passed);
+    }).detach();
+}
+
+bool PublicVolume::isMountedReadOnly() const {
+    // Reported as such until the background check lets it be remounted read-write
+    return mCheckPending;
+}
+
+void PublicVolume::finishBackgroundCheck(uint64_t mountSeq, bool passed) {
+    // Unmounted, or mounted again, while the check ran
+    if (mountSeq != mMountSeq || !mCheckPending || getState() != State::kMountedReadOnly) return;
+    mCheckPending = false;
+    recordCheck(passed ? OK : -EIO);
+
+    if (!passed) {
+        // Go through the usual repair before mounting it again
+        LOG(WARNING) << getId() << " failed background filesystem check, repairing";
+        mNeedsRepair = true;
+        unmount();
+        mount();
+        return;
+    }
+
+    if (mountFilesystem(isVisibleForWrite(), false, true) != OK) {
+        PLOG(ERROR) << getId() << " failed to remount read-write, staying read-only";
+        return;
+    }
+    // The FUSE daemon's bind mount inherited the read-only flag of the original mount
+    if (mFuseMounted && !mUseSdcardFs) {
+        std::string stableName = getId();
+        if (!mFsUuid.empty()) {
+            stableName = mFsUuid;
+        }
+        auto passThrough =
+                StringPrintf("/mnt/pass_through/%d/%s", getMountUserId(), stableName.c_str());
+        if (RemountBindWritable(passThrough) != OK) {
+            LOG(ERROR) << getId() << " failed to make " << passThrough << " writable";
+            return;
+        }
+    }
+    setMountedWritable();
+    LOG(INFO) << getId() << " passed background filesystem check, now read-write";
+}
+
 status_t PublicVolume::doUnmount() {
     // Unmount the storage before we kill the FUSE process. If we kill
     // the FUSE process first, most file system operations will return
@@ -366,7 +530,12 @@ status_t PublicVolume::doFormat(const std::string& fsType) {
         fsPick = EXFAT;
     }
 
-    if (WipeBlockDevice(mDevPath) != OK) {
+    InvalidateFsMetadata(mDevice);
+    res = wipeForFormat(mDevPath);
+    if (res == -ECANCELED) {
+        LOG(INFO) << getId() << " format aborted";
+        return res;
+    } else if (res != OK && res != -EOPNOTSUPP) {
         LOG(WARNING) << getId() << " failed to wipe";
     }
 
@@ -49,11 +49,21 @@ class PublicVolume : public VolumeBase {
     status_t doMount() override;
     status_t doUnmount() override;
     status_t doFormat(const std::string& fsType) override;
+    void doPostMount() override;
+    status_t doTuneFuse(int readAheadKb, int maxRatio) override;
+    bool isMountedReadOnly() const override;
 
     status_t readMetadata();
     status_t initAsecStage();
 
   private:
+    bool canSkipCheck();
+    bool canCheckInBackground();
+    status_t checkFilesystem();
+    void recordCheck(status_t res);
+    status_t mountFilesystem(bool isVisible, bool ro, bool remount = false);
+    void finishBackgroundCheck(uint64_t mountSeq, bool passed);
+
     /* Kernel device representing partition */
     dev_t mDevice;
     /* Block device path */
@@ -69,6 +79,13 @@ class PublicVolume : public VolumeBase {
     /* Whether we mounted FUSE for this volume */
     bool mFuseMounted;
 
+    /* Whether the filesystem is mounted read-only until its background check passes */
+    bool mCheckPending;
+    /* Whether the background check failed, so the next mount has to repair first */
+    bool mNeedsRepair;
+    /* Bumped on every mount, so a background check of an earlier mount is ignored */
+    uint64_t mMountSeq;
+
     /* Whether to use sdcardfs for this volume */
     bool mUseSdcardFs;
 
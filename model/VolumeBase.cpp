@@ -44,7 +44,14 @@ VolumeBase::~VolumeBase() {
     CHECK(!mCreated);
 }
 
+static bool isMountedState(VolumeBase::State state) {
+    return state == VolumeBase::State::kMounted || state == VolumeBase::State::kMountedReadOnly;
+}
+
 void VolumeBase::setState(State state) {
+    if (state != mState && (state == State::kMounted || mState == State::kMounted)) {
+        VolumeManager::Instance()->setAppDirVolume(this, state == State::kMounted);
+    }
     mState = state;
 
     auto listener = getListener();
@@ -201,7 +208,7 @@ status_t VolumeBase::doCreate() {
 status_t VolumeBase::destroy() {
     CHECK(mCreated);
 
-    if (mState == State::kMounted) {
+    if (isMountedState(mState)) {
         unmount();
         setState(State::kBadRemoval);
     } else {
@@ -230,9 +237,10 @@ status_t VolumeBase::mount() {
 
     setState(State::kChecking);
     status_t res = doMount();
-    setState(res == OK ? State::kMounted : State::kUnmountable);
-
-    if (res == OK) {
+    if (res != OK) {
+        setState(State::kUnmountable);
+    } else {
+        setState(isMountedReadOnly() ? State::kMountedReadOnly : State::kMounted);
         doPostMount();
     }
     return res;
@@ -240,8 +248,18 @@ status_t VolumeBase::mount() {
 
 void VolumeBase::doPostMount() {}
 
+bool VolumeBase::isMountedReadOnly() const {
+    return false;
+}
+
+void VolumeBase::setMountedWritable() {
+    if (mState == State::kMountedReadOnly) {
+        setState(State::kMounted);
+    }
+}
+
 status_t VolumeBase::unmount() {
-    if (mState != State::kMounted) {
+    if (!isMountedState(mState)) {
         LOG(WARNING) << getId() << " unmount requires state mounted";
         return -EBUSY;
     }
@@ -259,8 +277,9 @@ status_t VolumeBase::unmount() {
     return res;
 }
 
-status_t VolumeBase::format(const std::string& fsType) {
-    if (mState == State::kMounted) {
+status_t VolumeBase::format(const std::string& fsType,
+                            const android::sp<android::os::IVoldTaskListener>& listener) {
+    if (isMountedState(mState)) {
         unmount();
     }
 
@@ -270,7 +289,11 @@ status_t VolumeBase::format(const std::string& fsType) {
     }
 
     setState(State::kFormatting);
+    VolumeManager::Instance()->beginFormat(getId());
+    mFormatListener = listener;
     status_t res = doFormat(fsType);
+    mFormatListener = nullptr;
+    VolumeManager::Instance()->endFormat();
     setState(State::kUnmounted);
     return res;
 }
@@ -279,6 +302,31 @@ status_t VolumeBase::doFormat(const std::string& fsType) {
     return -ENOTSUP;
 }
 
+status_t VolumeBase::wipeForFormat(const std::string& devPath) {
+    int lastProgress = -1;
+    return WipeBlockDevice(devPath, [&](uint64_t done, uint64_t total) {
+        int progress = done * 100 / total;
+        if (mFormatListener && progress != lastProgress) {
+            android::os::PersistableBundle extras;
+            mFormatListener->onStatus(progress, extras);
+        }
+        lastProgress = progress;
+        return !VolumeManager::Instance()->isFormatAborted();
+    });
+}
+
+status_t VolumeBase::tuneFuse(int readAheadKb, int maxRatio) {
+    if (!isMountedState(mState)) {
+        LOG(WARNING) << getId() << " tuneFuse requires state mounted";
+        return -EBUSY;
+    }
+    return doTuneFuse(readAheadKb, maxRatio);
+}
+
+status_t VolumeBase::doTuneFuse(int readAheadKb, int maxRatio) {
+    return -ENOTSUP;
+}
+
 std::string VolumeBase::getRootPath() const {
     // Usually the same as the internal path, except for emulated volumes.
     return getInternalPath();
@@ -20,6 +20,7 @@
 #include "Utils.h"
 #include "android/os/IVoldListener.h"
 #include "android/os/IVoldMountCallback.h"
+#include "android/os/IVoldTaskListener.h"
 
 #include <cutils/multiuser.h>
 #include <utils/Errors.h>
@@ -117,7 +118,11 @@ class VolumeBase {
     status_t destroy();
     status_t mount();
     status_t unmount();
-    status_t format(const std::string& fsType);
+    /* Reports the progress of wiping the volume, if it does, to listener with onStatus() */
+    status_t format(const std::string& fsType,
+                    const android::sp<android::os::IVoldTaskListener>& listener = nullptr);
+    /* Retunes the FUSE filesystem of a mounted volume; negative values keep the default */
+    status_t tuneFuse(int readAheadKb, int maxRatio);
 
     virtual std::string getRootPath() const;
 
@@ -132,6 +137,12 @@ class VolumeBase {
     virtual void doPostMount();
     virtual status_t doUnmount() = 0;
     virtual status_t doFormat(const std::string& fsType);
+    virtual status_t doTuneFuse(int readAheadKb, int maxRatio);
+    /* Whether a successful doMount() left the volume read-only for now */
+    virtual bool isMountedReadOnly() const;
+
+    /* Moves a volume that was mounted read-only for now to kMounted */
+    void setMountedWritable();
 
     status_t setId(const std::string& id);
     status_t setPath(const std::string& path);
@@ -140,6 +151,12 @@ class VolumeBase {
     android::sp<android::os::IVoldListener> getListener() const;
     android::sp<android::os::IVoldMountCallback> getMountCallback() const;
 
+    /*
+     * Wipes devPath as part of a format, reporting progress to the format's listener and stopping
+     * with -ECANCELED if the format is aborted. See WipeBlockDevice().
+     */
+    status_t wipeForFormat(const std::string& devPath);
+
   private:
     /* ID that uniquely references volume while alive */
     std::string mId;
@@ -164,6 +181,8 @@ class VolumeBase {
     /* Flag indicating that volume should emit no events */
     bool mSilent;
     android::sp<android::os::IVoldMountCallback> mMountCallback;
+    /* Listener of the format in progress, if any */
+    android::sp<android::os::IVoldTaskListener> mFormatListener;
 
     /* Volumes stacked on top of this volume */
     std::list<std::shared_ptr<VolumeBase>> mVolumes;
@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -27,6 +29,7 @@
 #include <stdlib.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 
 #include <android-base/logging.h>
 #include <android-base/unique_fd.h>
@@ -40,12 +43,30 @@ struct Options {
     bool unlink{true};
 };
 
-constexpr uint32_t max_extents = 32;
+// A file being discarded, held open and pinned until it's done with
+struct Target {
+    std::string path;
+    android::base::unique_fd fd;
+};
+
+// Files left to discard through their block device, and all of their extents
+struct DeviceBatch {
+    std::string path;  // Any of the files, to look up the block device with
+    std::vector<Target*> targets;
+    std::vector<struct fiemap_extent> extents;
+};
+
+// Zero overwrites go out in pwritev() calls of kZeroIovecs copies of one aligned zero buffer
+constexpr size_t kZeroBufferSize = 1 << 20;
+constexpr int kZeroIovecs = 8;
 
 bool read_command_line(int argc, const char* const argv[], Options& options);
 void usage(const char* progname);
-bool secdiscard_path(const std::string& path);
-bool check_fiemap(const struct fiemap& fiemap, const std::string& path);
+bool read_extents(const std::string& path, std::vector<struct fiemap_extent>* extents);
+bool secdiscard_extents(const std::string& block_device,
+                        std::vector<struct fiemap_extent> extents);
+void finish_target(Target& target, const Options& options);
+bool check_extents(const std::vector<struct fiemap_extent>& extents, const std::string& path);
 bool overwrite_with_zeros(int fd, off64_t start, off64_t length);
 
 }  // namespace
@@ -79,7 +100,6 @@ int main(int argc, const char* const argv[]) {
         return -1;
     }
 
-    for (auto const& target : options.targets) {
 // F2FS-specific ioctl
 // It requires the below kernel commit merged in v4.16-rc1.
 //   1ad71a27124c ("f2fs: add an ioctl to disable GC for specific file")
@@ -93,16 +113,23 @@ int main(int argc, const char* const argv[]) {
 #define F2FS_IOC_SET_PIN_FILE _IOW(F2FS_IOCTL_MAGIC, 13, __u32)
 #define F2FS_IOC_GET_PIN_FILE _IOR(F2FS_IOCTL_MAGIC, 14, __u32)
 #endif
-        android::base::unique_fd fd(
-            TEMP_FAILURE_RETRY(open(target.c_str(), O_WRONLY | O_CLOEXEC, 0)));
-        if (fd == -1) {
-            LOG(ERROR) << "Secure discard open failed for: " << target;
+    std::vector<Target> targets(options.targets.size());
+    // Files that the filesystem couldn't trim itself, by device. A key's files all live on
+    // the same device, so this usually ends up as a single open and fsync of it.
+    std::map<dev_t, DeviceBatch> batches;
+    for (size_t i = 0; i < options.targets.size(); i++) {
+        auto& target = targets[i];
+        target.path = options.targets[i];
+        target.fd.reset(TEMP_FAILURE_RETRY(open(target.path.c_str(), O_WRONLY | O_CLOEXEC, 0)));
+        if (target.fd == -1) {
+            LOG(ERROR) << "Secure discard open failed for: " << target.path;
             continue;
         }
+        // Pinned until the discard is over, so F2FS GC doesn't move the blocks under us
         __u32 set = 1;
-        ioctl(fd, F2FS_IOC_SET_PIN_FILE, &set);
+        ioctl(target.fd, F2FS_IOC_SET_PIN_FILE, &set);
 
-        LOG(DEBUG) << "Securely discarding '" << target << "' unlink=" << options.unlink;
+        LOG(DEBUG) << "Securely discarding '" << target.path << "' unlink=" << options.unlink;
         struct f2fs_sectrim_range secRange;
         secRange.start = 0;
         secRange.len = -1;  // until end of file
@@ -113,29 +140,45 @@ int main(int argc, const char* const argv[]) {
          * 2. Otherwise, it sends discard command on the file.
          * 3. Lastly, it overwrites zero data on it.
          */
-        int ret = ioctl(fd, F2FS_IOC_SEC_TRIM_FILE, &secRange);
+        int ret = ioctl(target.fd, F2FS_IOC_SEC_TRIM_FILE, &secRange);
         if (ret != 0) {
             if (errno == EOPNOTSUPP) {
                 // If device doesn't support any type of discard, just overwrite zero data.
                 secRange.flags = F2FS_TRIM_FILE_ZEROOUT;
-                ret = ioctl(fd, F2FS_IOC_SEC_TRIM_FILE, &secRange);
+                ret = ioctl(target.fd, F2FS_IOC_SEC_TRIM_FILE, &secRange);
             }
             if (ret != 0 && errno != ENOTTY) {
-                PLOG(WARNING) << "F2FS_IOC_SEC_TRIM_FILE failed on " << target;
+                PLOG(WARNING) << "F2FS_IOC_SEC_TRIM_FILE failed on " << target.path;
             }
         }
-        if (ret != 0) {
-            if (!secdiscard_path(target)) {
-                LOG(ERROR) << "Secure discard failed for: " << target;
-            }
+        if (ret == 0) {
+            finish_target(target, options);
+            continue;
         }
-        if (options.unlink) {
-            if (unlink(target.c_str()) != 0 && errno != ENOENT) {
-                PLOG(ERROR) << "Unable to unlink: " << target;
+
+        std::vector<struct fiemap_extent> extents;
+        struct stat sb;
+        if (fstat(target.fd, &sb) != 0 || !read_extents(target.path, &extents)) {
+            LOG(ERROR) << "Secure discard failed for: " << target.path;
+            finish_target(target, options);
+            continue;
+        }
+        auto& batch = batches[sb.st_dev];
+        if (batch.path.empty()) batch.path = target.path;
+        batch.targets.push_back(&target);
+        batch.extents.insert(batch.extents.end(), extents.begin(), extents.end());
+    }
+
+    for (auto& [dev, batch] : batches) {
+        auto block_device = android::vold::BlockDeviceForPath(batch.path);
+        if (block_device.empty() || !secdiscard_extents(block_device, std::move(batch.extents))) {
+            for (auto target : batch.targets) {
+                LOG(ERROR) << "Secure discard failed for: " << target->path;
             }
         }
-        set = 0;
-        ioctl(fd, F2FS_IOC_SET_PIN_FILE, &set);
+        for (auto target : batch.targets) {
+            finish_target(*target, options);
+        }
     }
     return 0;
 }
@@ -163,47 +206,82 @@ void usage(const char* progname) {
     fprintf(stderr, "Usage: %s [--no-unlink] -- <absolute path> ...\n", progname);
 }
 
-// BLKSECDISCARD all content in "path", if it's small enough.
-bool secdiscard_path(const std::string& path) {
-    auto fiemap = android::vold::PathFiemap(path, max_extents);
-    if (!fiemap || !check_fiemap(*fiemap, path)) {
-        return false;
+void finish_target(Target& target, const Options& options) {
+    if (target.fd == -1) return;
+    if (options.unlink) {
+        if (unlink(target.path.c_str()) != 0 && errno != ENOENT) {
+            PLOG(ERROR) << "Unable to unlink: " << target.path;
+        }
     }
-    auto block_device = android::vold::BlockDeviceForPath(path);
-    if (block_device.empty()) {
-        return false;
+    __u32 set = 0;
+    ioctl(target.fd, F2FS_IOC_SET_PIN_FILE, &set);
+    target.fd.reset();
+}
+
+// Read the extents of "path", if they're all OK to discard
+bool read_extents(const std::string& path, std::vector<struct fiemap_extent>* extents) {
+    return android::vold::PathExtents(path, extents) && check_extents(*extents, path);
+}
+
+// BLKSECDISCARD all the given extents on the device, falling back to zeroing them out.
+// Physically adjacent extents, even of different files, go out as one range.
+bool secdiscard_extents(const std::string& block_device,
+                        std::vector<struct fiemap_extent> extents) {
+    std::sort(extents.begin(), extents.end(), [](const auto& a, const auto& b) {
+        return a.fe_physical < b.fe_physical;
+    });
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    for (const auto& extent : extents) {
+        if (!ranges.empty() && ranges.back().first + ranges.back().second == extent.fe_physical) {
+            ranges.back().second += extent.fe_length;
+        } else {
+            ranges.emplace_back(extent.fe_physical, extent.fe_length);
+        }
     }
+
     android::base::unique_fd fs_fd(
         TEMP_FAILURE_RETRY(open(block_device.c_str(), O_RDWR | O_LARGEFILE | O_CLOEXEC, 0)));
     if (fs_fd == -1) {
         PLOG(ERROR) << "Failed to open device " << block_device;
         return false;
     }
-    for (uint32_t i = 0; i < fiemap->fm_mapped_extents; i++) {
+    // Once the device has turned down an ioctl, don't ask again for every extent
+    bool success = true;
+    bool try_secdiscard = true;
+    bool try_zeroout = true;
+    for (const auto& [start, length] : ranges) {
         uint64_t range[2];
-        range[0] = fiemap->fm_extents[i].fe_physical;
-        range[1] = fiemap->fm_extents[i].fe_length;
-        if (ioctl(fs_fd.get(), BLKSECDISCARD, range) == -1) {
-            // Use zero overwrite as a fallback for BLKSECDISCARD
-            if (!overwrite_with_zeros(fs_fd.get(), range[0], range[1])) return false;
+        range[0] = start;
+        range[1] = length;
+        if (try_secdiscard) {
+            if (ioctl(fs_fd.get(), BLKSECDISCARD, range) == 0) continue;
+            try_secdiscard = false;
         }
+        // Use zero overwrite as a fallback for BLKSECDISCARD, offloaded to the device if it can
+        if (try_zeroout) {
+            if (ioctl(fs_fd.get(), BLKZEROOUT, range) == 0) continue;
+            PLOG(DEBUG) << "BLKZEROOUT failed on " << block_device << ", writing zeroes";
+            try_zeroout = false;
+        }
+        // A failed range still leaves the rest, possibly other files', to be wiped
+        if (!overwrite_with_zeros(fs_fd.get(), range[0], range[1])) success = false;
     }
     // Should wait for overwrites completion. Otherwise after unlink(),
     // filesystem can allocate these blocks and IO can be reordered, resulting
     // in making zero blocks to filesystem blocks.
     fsync(fs_fd.get());
-    return true;
+    return success;
 }
 
-// Ensure that the FIEMAP covers the file and is OK to discard
-bool check_fiemap(const struct fiemap& fiemap, const std::string& path) {
-    auto mapped = fiemap.fm_mapped_extents;
-    if (!(fiemap.fm_extents[mapped - 1].fe_flags & FIEMAP_EXTENT_LAST)) {
+// Ensure that the extents cover the file and are OK to discard
+bool check_extents(const std::vector<struct fiemap_extent>& extents, const std::string& path) {
+    auto mapped = extents.size();
+    if (!(extents[mapped - 1].fe_flags & FIEMAP_EXTENT_LAST)) {
         LOG(ERROR) << "Extent " << mapped - 1 << " was not the last in " << path;
         return false;
     }
-    for (uint32_t i = 0; i < mapped; i++) {
-        auto flags = fiemap.fm_extents[i].fe_flags;
+    for (size_t i = 0; i < mapped; i++) {
+        auto flags = extents[i].fe_flags;
         if (flags & (FIEMAP_EXTENT_UNKNOWN | FIEMAP_EXTENT_DELALLOC | FIEMAP_EXTENT_NOT_ALIGNED)) {
             LOG(ERROR) << "Extent " << i << " has unexpected flags " << flags << ": " << path;
             return false;
@@ -213,19 +291,26 @@ bool check_fiemap(const struct fiemap& fiemap, const std::string& path) {
 }
 
 bool overwrite_with_zeros(int fd, off64_t start, off64_t length) {
-    if (lseek64(fd, start, SEEK_SET) != start) {
-        PLOG(ERROR) << "Seek failed for zero overwrite";
-        return false;
-    }
-    char buf[BUFSIZ];
-    memset(buf, 0, sizeof(buf));
+    // Zero-initialized and never written, so every iovec can point at the same buffer.  Not
+    // const, which would put the whole buffer in .rodata instead of .bss.
+    alignas(4096) static char zeroes[kZeroBufferSize];
+    struct iovec iov[kZeroIovecs];
     while (length > 0) {
-        size_t wlen = static_cast<size_t>(std::min(static_cast<off64_t>(sizeof(buf)), length));
-        auto written = write(fd, buf, wlen);
+        int iovcnt = 0;
+        off64_t batch = 0;
+        while (iovcnt < kZeroIovecs && batch < length) {
+            auto len = std::min(static_cast<off64_t>(kZeroBufferSize), length - batch);
+            iov[iovcnt].iov_base = zeroes;
+            iov[iovcnt].iov_len = len;
+            batch += len;
+            iovcnt++;
+        }
+        auto written = TEMP_FAILURE_RETRY(pwritev64(fd, iov, iovcnt, start));
         if (written < 1) {
             PLOG(ERROR) << "Write of zeroes failed";
             return false;
         }
+        start += written;
         length -= written;
     }
     return true;
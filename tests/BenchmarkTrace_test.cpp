@@ -0,0 +1,170 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <android-base/file.h>
+#include <gtest/gtest.h>
+
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../BenchmarkTrace.h"
+
+namespace android {
+namespace vold {
+
+TEST(LatencyHistogramTest, Percentiles) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0u, histogram.percentile(0.5));
+
+    for (uint64_t i = 1; i <= 1000; i++) {
+        histogram.record(i * 1000);
+    }
+    EXPECT_EQ(1000u, histogram.count());
+    EXPECT_EQ(1000000u, histogram.max());
+
+    // Buckets are within 1/16th of the value they hold.
+    auto expectNear = [](uint64_t expected, uint64_t actual) {
+        EXPECT_GE(actual, expected);
+        EXPECT_LE(actual, expected + expected / 16);
+    };
+    expectNear(500000, histogram.percentile(0.5));
+    expectNear(900000, histogram.percentile(0.9));
+    expectNear(990000, histogram.percentile(0.99));
+    EXPECT_EQ(1000000u, histogram.percentile(1.0));
+
+    LatencyHistogram other;
+    other.record(7);
+    other.record(uint64_t(1) << 50);
+    histogram.merge(other);
+    EXPECT_EQ(1002u, histogram.count());
+    EXPECT_EQ(7u, histogram.percentile(0));
+    EXPECT_EQ(uint64_t(1) << 50, histogram.percentile(1.0));
+}
+
+class BenchmarkTraceTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        ASSERT_NE(nullptr, getcwd(orig_cwd_, sizeof(orig_cwd_)));
+        ASSERT_EQ(0, chdir(work_dir_.path));
+    }
+    void TearDown() override { ASSERT_EQ(0, chdir(orig_cwd_)); }
+
+    // Two threads: the first creates and writes file0, the second then reads it back.
+    std::string WriteTrace() {
+        std::vector<BenchmarkTrace::Op> ops = {
+                {BenchmarkTrace::kOpen, BenchmarkTrace::kReadWrite | BenchmarkTrace::kCreate, 0,
+                 0, 0600, 0, 0},
+                {BenchmarkTrace::kPwrite, 0, 0, 0, 4096, 0, 0},
+                {BenchmarkTrace::kFsync, 0, 0, 0, 0, 0, 0},
+                {BenchmarkTrace::kClose, 0, 0, 0, 0, 0, 0},
+                {BenchmarkTrace::kOpen, 0, 1, 1, 0, 0, 0},
+                {BenchmarkTrace::kPread, 0, 1, 1, 4096, 0, 0},
+                {BenchmarkTrace::kRead, 0, 1, 1, 100, 0, 0},
+                {BenchmarkTrace::kClose, 0, 1, 1, 0, 0, 0},
+        };
+        std::string name = "test";
+        BenchmarkTrace::Header header;
+        memcpy(header.magic, BenchmarkTrace::kMagic, sizeof(header.magic));
+        header.fileCount = 1;
+        header.handleCount = 2;
+        header.opCount = ops.size();
+        header.threadCount = 2;
+        header.nameLength = name.size();
+        uint64_t size = 8192;
+
+        std::string data(reinterpret_cast<const char*>(&header), sizeof(header));
+        data += name;
+        data.append(reinterpret_cast<const char*>(&size), sizeof(size));
+        data.append(reinterpret_cast<const char*>(ops.data()), ops.size() * sizeof(ops[0]));
+        std::string path = std::string(trace_dir_.path) + "/test.vbt";
+        EXPECT_TRUE(android::base::WriteStringToFile(data, path));
+        return path;
+    }
+
+    TemporaryDir work_dir_;
+    TemporaryDir trace_dir_;
+    char orig_cwd_[PATH_MAX];
+};
+
+TEST_F(BenchmarkTraceTest, Replay) {
+    auto trace = BenchmarkTrace::Load(WriteTrace());
+    ASSERT_NE(nullptr, trace);
+    EXPECT_EQ("test", trace->name());
+    EXPECT_EQ("r2:w1:s1", trace->ident());
+
+    for (auto mode : {BenchmarkTrace::kSerial, BenchmarkTrace::kConcurrent}) {
+        auto checkpoint = [](int) { return true; };
+        BenchmarkTrace::ReplayOptions options;
+        options.mode = mode;
+        ASSERT_EQ(OK, trace->create(checkpoint, options));
+        struct stat st;
+        ASSERT_EQ(0, stat("file0", &st));
+        EXPECT_EQ(8192, st.st_size);
+
+        ReplayStats stats;
+        ASSERT_EQ(OK, trace->run(checkpoint, options, &stats));
+        EXPECT_EQ(2u, stats.latency[ReplayStats::kOpens].count());
+        EXPECT_EQ(2u, stats.latency[ReplayStats::kReads].count());
+        EXPECT_EQ(4196u, stats.bytes[ReplayStats::kReads]);
+        EXPECT_EQ(4096u, stats.bytes[ReplayStats::kWrites]);
+        EXPECT_EQ(1u, stats.latency[ReplayStats::kSyncs].count());
+
+        ASSERT_EQ(OK, trace->destroy());
+        EXPECT_EQ(-1, stat("file0", &st));
+    }
+}
+
+TEST_F(BenchmarkTraceTest, ReplayScaled) {
+    auto trace = BenchmarkTrace::Load(WriteTrace());
+    ASSERT_NE(nullptr, trace);
+    auto checkpoint = [](int) { return true; };
+    BenchmarkTrace::ReplayOptions options;
+    options.scale = 2;
+
+    ASSERT_EQ(OK, trace->create(checkpoint, options));
+    struct stat st;
+    ASSERT_EQ(0, stat("file0", &st));
+    EXPECT_EQ(16384, st.st_size);
+
+    ReplayStats stats;
+    ASSERT_EQ(OK, trace->run(checkpoint, options, &stats));
+    EXPECT_EQ(8192u + 200, stats.bytes[ReplayStats::kReads]);
+    EXPECT_EQ(8192u, stats.bytes[ReplayStats::kWrites]);
+    ASSERT_EQ(OK, trace->destroy());
+}
+
+TEST_F(BenchmarkTraceTest, LoadRejectsBadTraces) {
+    std::string path = WriteTrace();
+    std::string data;
+    ASSERT_TRUE(android::base::ReadFileToString(path, &data));
+
+    ASSERT_TRUE(android::base::WriteStringToFile(data.substr(0, data.size() - 1), path));
+    EXPECT_EQ(nullptr, BenchmarkTrace::Load(path));
+
+    // The second thread reading from the first one's handle.
+    std::string shared = data;
+    auto* ops = reinterpret_cast<BenchmarkTrace::Op*>(&shared[shared.size() -
+                                                              8 * sizeof(BenchmarkTrace::Op)]);
+    ops[5].handle = 0;
+    ASSERT_TRUE(android::base::WriteStringToFile(shared, path));
+    EXPECT_EQ(nullptr, BenchmarkTrace::Load(path));
+
+    EXPECT_EQ(nullptr, BenchmarkTrace::Load(path + ".missing"));
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <android-base/file.h>
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "../CallStats.h"
+
+using namespace std::literals;
+
+namespace android {
+namespace vold {
+
+TEST(CallStatsTest, Records) {
+    CallStats* stats = CallStats::Get("CallStatsTest.Records");
+    EXPECT_EQ(stats, CallStats::Get("CallStatsTest.Records"));
+
+    for (int i = 1; i <= 100; i++) {
+        stats->recordCall(std::chrono::milliseconds(i));
+    }
+    stats->recordLockWait(3ms);
+    stats->recordLockWait(5ms);
+
+    auto s = stats->snapshot();
+    EXPECT_EQ(100u, s.calls);
+    EXPECT_EQ(5050000000u, s.totalNs);
+    EXPECT_GE(s.p50Ns, 50000000u);
+    EXPECT_LE(s.p50Ns, 50000000u + 50000000u / 16);
+    EXPECT_GE(s.p99Ns, 99000000u);
+    EXPECT_EQ(100000000u, s.maxNs);
+    EXPECT_EQ(2u, s.lockWaits);
+    EXPECT_EQ(8000000u, s.lockWaitNs);
+    EXPECT_EQ(5000000u, s.maxLockWaitNs);
+}
+
+TEST(CallStatsTest, Dump) {
+    CallStats::Get("CallStatsTest.DumpFast")->recordCall(1ms);
+    CallStats::Get("CallStatsTest.DumpSlow")->recordCall(1h);
+    {
+        ScopedCallStats scoped(CallStats::Get("CallStatsTest.DumpScoped"));
+    }
+    // Looked up but never called
+    CallStats::Get("CallStatsTest.DumpUnused");
+
+    TemporaryFile file;
+    CallStats::Dump(file.fd);
+    std::string dump;
+    ASSERT_TRUE(android::base::ReadFileToString(file.path, &dump));
+
+    auto slow = dump.find("CallStatsTest.DumpSlow: 1 calls in 3600000.0 ms");
+    auto fast = dump.find("CallStatsTest.DumpFast: 1 calls in 1.0 ms");
+    ASSERT_NE(std::string::npos, slow);
+    ASSERT_NE(std::string::npos, fast);
+    EXPECT_LT(slow, fast);
+    EXPECT_NE(std::string::npos, dump.find("CallStatsTest.DumpScoped: 1 calls"));
+    EXPECT_EQ(std::string::npos, dump.find("CallStatsTest.DumpUnused"));
+}
+
+}  // namespace vold
+}  // namespace android
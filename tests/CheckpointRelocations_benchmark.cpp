@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "../CheckpointRelocations.h"
+
+namespace android {
+namespace vold {
+
+namespace {
+
+struct LogEntry {
+    sector_t dest;
+    sector_t source;
+    int count;
+};
+
+// A dm-bow log: short, mostly 4K (8 sector) moves scattered over a 64GiB device.
+std::vector<LogEntry> makeLog(size_t entries) {
+    constexpr sector_t kDeviceSectors = sector_t(64) << 21;
+    std::mt19937_64 rng(entries);
+    std::vector<LogEntry> log(entries);
+    for (auto& entry : log) {
+        entry.count = 8 << (rng() % 4 == 0 ? rng() % 5 : 0);
+        entry.dest = rng() % (kDeviceSectors - entry.count);
+        entry.source = rng() % (kDeviceSectors - entry.count);
+    }
+    return log;
+}
+
+// Replays the log in reverse, looking up every relocated range like the validation pass of
+// cp_restoreCheckpoint() does.
+void BM_Relocate(benchmark::State& state) {
+    auto log = makeLog(state.range(0));
+    for (auto _ : state) {
+        Relocations relocations;
+        for (auto entry = log.rbegin(); entry != log.rend(); ++entry) {
+            benchmark::DoNotOptimize(relocations.Lookup(entry->dest));
+            relocations.Relocate(entry->dest, entry->source, entry->count);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * log.size());
+}
+
+// Checks and marks every destination, like the restore pass does.
+void BM_UsedSectors(benchmark::State& state) {
+    auto log = makeLog(state.range(0));
+    for (auto _ : state) {
+        UsedSectors used;
+        for (auto entry = log.rbegin(); entry != log.rend(); ++entry) {
+            benchmark::DoNotOptimize(used.Collides(entry->source, entry->source + entry->count));
+            used.MarkUsed(entry->dest, entry->dest + entry->count);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * log.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_Relocate)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK(BM_UsedSectors)->Arg(1000)->Arg(10000)->Arg(100000);
+
+}  // namespace vold
+}  // namespace android
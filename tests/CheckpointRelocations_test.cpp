@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+
+#include "../CheckpointRelocations.h"
+
+namespace android {
+namespace vold {
+
+namespace {
+
+// The plain std::map implementation that Relocations and UsedSectors
+// replaced, kept as the reference they must agree with.
+typedef std::map<sector_t, sector_t> RefRelocations;
+
+void refRelocate(RefRelocations& relocations, sector_t dest, sector_t source, int count) {
+    auto s = --relocations.upper_bound(source);
+    RefRelocations slice;
+    slice[dest] = source - s->first + s->second;
+    ++s;
+    for (; s != relocations.end() && s->first < source + count; ++s)
+        slice[dest - source + s->first] = s->second;
+    auto dest_end = --relocations.upper_bound(dest + count);
+    relocations[dest + count] = dest + count - dest_end->first + dest_end->second;
+    relocations.erase(relocations.lower_bound(dest), relocations.lower_bound(dest + count));
+    relocations.insert(slice.begin(), slice.end());
+}
+
+sector_t refLookup(const RefRelocations& relocations, sector_t sector) {
+    auto relocation = --relocations.upper_bound(sector);
+    return sector + relocation->second - relocation->first;
+}
+
+typedef std::map<sector_t, bool> RefUsedSectors;
+
+// The original decremented |second_overlap| itself, which made every check a
+// collision; this is the check it meant to do.
+bool refCheckCollision(RefUsedSectors& used_sectors, sector_t start, sector_t end) {
+    auto second_overlap = used_sectors.upper_bound(start);
+    auto first_overlap = std::prev(second_overlap);
+    if (first_overlap->second) return true;
+    return second_overlap != used_sectors.end() && second_overlap->first < end;
+}
+
+void refMarkUsed(RefUsedSectors& used_sectors, sector_t start, sector_t end) {
+    auto start_pos = used_sectors.insert_or_assign(start, true).first;
+    auto end_pos = used_sectors.insert_or_assign(end, false).first;
+    if (start_pos == used_sectors.begin() || !std::prev(start_pos)->second) start_pos++;
+    if (std::next(end_pos) != used_sectors.end() && !std::next(end_pos)->second) end_pos++;
+    if (start_pos->first < end_pos->first) used_sectors.erase(start_pos, end_pos);
+}
+
+// Small enough that ranges overlap a lot, and that every sector can be checked.
+constexpr sector_t kSectors = 512;
+
+}  // namespace
+
+class CheckpointRelocationsTest : public testing::Test {};
+
+TEST_F(CheckpointRelocationsTest, RelocationsMatchMap) {
+    std::mt19937 rng(1);
+    for (int run = 0; run < 50; run++) {
+        Relocations relocations;
+        RefRelocations ref;
+        ref[0] = 0;
+        for (int op = 0; op < 500; op++) {
+            int count = 1 + rng() % 32;
+            sector_t dest = rng() % (kSectors - count);
+            sector_t source = rng() % (kSectors - count);
+            relocations.Relocate(dest, source, count);
+            refRelocate(ref, dest, source, count);
+            for (sector_t sector = 0; sector < kSectors; sector++) {
+                ASSERT_EQ(refLookup(ref, sector), relocations.Lookup(sector))
+                        << "run " << run << " op " << op << " sector " << sector;
+            }
+        }
+    }
+}
+
+TEST_F(CheckpointRelocationsTest, UsedSectorsMatchMap) {
+    std::mt19937 rng(2);
+    for (int run = 0; run < 50; run++) {
+        UsedSectors used;
+        RefUsedSectors ref;
+        ref[0] = false;
+        for (int op = 0; op < 500; op++) {
+            sector_t start = rng() % kSectors;
+            sector_t end = start + 1 + rng() % 32;
+            switch (rng() % 8) {
+                case 0:
+                    used.Clear();
+                    ref.clear();
+                    ref[0] = false;
+                    break;
+                case 1:
+                case 2:
+                case 3:
+                    used.MarkUsed(start, end);
+                    refMarkUsed(ref, start, end);
+                    break;
+                default:
+                    ASSERT_EQ(refCheckCollision(ref, start, end), used.Collides(start, end))
+                            << "run " << run << " op " << op;
+            }
+        }
+        for (sector_t sector = 0; sector < kSectors; sector++) {
+            ASSERT_EQ(refCheckCollision(ref, sector, sector + 1), used.Collides(sector, sector + 1))
+                    << "run " << run << " sector " << sector;
+        }
+    }
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "../Crc32.h"
+
+namespace android {
+namespace vold {
+
+namespace {
+
+using Crc32Fn = void (*)(const void*, size_t, uint32_t*);
+
+void crc32_hw_only(const void* data, size_t n_bytes, uint32_t* crc) {
+    crc32_hw(data, n_bytes, crc);
+}
+
+// Checksums one dm-bow block at a time, like cp_restoreCheckpoint() does, and
+// checks that the result is bit-exact with the byte-at-a-time table.
+void BM_Crc32(benchmark::State& state, Crc32Fn fn) {
+    size_t block_size = state.range(0);
+    std::vector<uint8_t> buffer(block_size);
+    std::mt19937 rng(42);
+    for (auto& b : buffer) b = rng();
+
+    uint32_t expected = 0x1234;
+    uint32_t actual = expected;
+    crc32_bytewise(buffer.data(), block_size, &expected);
+    if (fn == crc32_hw_only && !crc32_hw(buffer.data(), 0, &actual)) {
+        state.SkipWithError("No CRC instructions on this CPU");
+        return;
+    }
+    fn(buffer.data(), block_size, &actual);
+    if (actual != expected) {
+        state.SkipWithError("Checksum differs from crc32_bytewise()");
+        return;
+    }
+
+    for (auto _ : state) {
+        uint32_t crc = 0;
+        fn(buffer.data(), block_size, &crc);
+        benchmark::DoNotOptimize(crc);
+    }
+    state.SetBytesProcessed(state.iterations() * block_size);
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_Crc32, bytewise, crc32_bytewise)->Arg(512)->Arg(4096);
+BENCHMARK_CAPTURE(BM_Crc32, slice8, crc32_slice8)->Arg(512)->Arg(4096);
+BENCHMARK_CAPTURE(BM_Crc32, hw, crc32_hw_only)->Arg(512)->Arg(4096);
+BENCHMARK_CAPTURE(BM_Crc32, dispatch, crc32)->Arg(512)->Arg(4096);
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+#include "../Crc32.h"
+
+namespace android {
+namespace vold {
+
+class Crc32Test : public testing::Test {};
+
+TEST_F(Crc32Test, CheckValue) {
+    // The standard CRC-32 check value, with the inversions that crc32() leaves
+    // to the caller.
+    const char kInput[] = "123456789";
+    uint32_t crc = ~0u;
+    crc32(kInput, sizeof(kInput) - 1, &crc);
+    ASSERT_EQ(0xCBF43926u, ~crc);
+
+    crc = ~0u;
+    crc32_slice8(kInput, sizeof(kInput) - 1, &crc);
+    ASSERT_EQ(0xCBF43926u, ~crc);
+}
+
+TEST_F(Crc32Test, MatchesBytewise) {
+    std::mt19937 rng(42);
+    std::vector<uint8_t> buffer(3 * 4096 + 64);
+    for (auto& b : buffer) b = rng();
+
+    for (int i = 0; i < 5000; i++) {
+        size_t offset = rng() % 64;
+        size_t len = rng() % (buffer.size() - offset);
+        if (i < 256) len = i;  // every short length, to cover all the tails
+        uint32_t expected = rng();
+        uint32_t slice8 = expected;
+        uint32_t hw = expected;
+
+        crc32_bytewise(&buffer[offset], len, &expected);
+        crc32_slice8(&buffer[offset], len, &slice8);
+        ASSERT_EQ(expected, slice8) << "offset " << offset << " len " << len;
+        if (crc32_hw(&buffer[offset], len, &hw)) {
+            ASSERT_EQ(expected, hw) << "offset " << offset << " len " << len;
+        }
+    }
+}
+
+}  // namespace vold
+}  // namespace android
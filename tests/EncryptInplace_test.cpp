@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <android-base/file.h>
+#include <android-base/stringprintf.h>
+#include <gtest/gtest.h>
+#include <openssl/sha.h>
+
+#include <inttypes.h>
+#include <unistd.h>
+
+#include <random>
+#include <string>
+
+#include "../EncryptInplace.h"
+#include "../Utils.h"
+
+namespace android {
+namespace vold {
+
+/*
+ * Stands two regular files in for the devices: "encrypting" a block copies its plaintext from
+ * the real device to the crypto device, which leaves ciphertext (here, junk) on the real one.
+ * Without a filesystem on it, the real device is encrypted in 512-byte blocks, in chunks of
+ * 32 KiB since a regular file has no queue limits.
+ */
+class EncryptInplaceTest : public testing::Test {
+  protected:
+    static constexpr size_t kBlockSize = 512;
+    static constexpr size_t kChunkSize = 32768;
+    static constexpr size_t kChunks = 8;
+    static constexpr size_t kSize = kChunks * kChunkSize;
+    static constexpr uint64_t kSectors = kSize / 512;
+
+    void SetUp() override {
+        std::mt19937 rng(1);
+        plaintext_.resize(kSize);
+        junk_.resize(kSize);
+        for (auto& c : plaintext_) c = rng();
+        for (auto& c : junk_) c = rng();
+        real_ = plaintext_;
+        crypto_ = junk_;
+        real_path_ = std::string(dir_.path) + "/real";
+        crypto_path_ = std::string(dir_.path) + "/crypto";
+        progress_path_ = std::string(dir_.path) + "/progress";
+    }
+
+    /* Marks the blocks [first, first + count) as encrypted before the interruption */
+    void Encrypted(size_t first, size_t count) {
+        for (size_t i = first * kBlockSize; i < (first + count) * kBlockSize; i++) {
+            crypto_[i] = plaintext_[i];
+            real_[i] = junk_[i];
+        }
+    }
+
+    /* Writes the devices, and a progress file that has every chunk in flight */
+    void Interrupt() {
+        std::string progress = android::base::StringPrintf("%s %" PRIu64 " - %zu\nmain 0\n",
+                                                           real_path_.c_str(),
+                                                           kSectors, kBlockSize);
+        for (size_t offset = 0; offset < kSize; offset += kChunkSize) {
+            std::string digests;
+            for (size_t pos = offset; pos < offset + kChunkSize; pos += kBlockSize) {
+                uint8_t digest[SHA256_DIGEST_LENGTH];
+                SHA256(reinterpret_cast<const uint8_t*>(&plaintext_[pos]), kBlockSize, digest);
+                digests.append(reinterpret_cast<const char*>(digest), 8);
+            }
+            std::string hashes;
+            StrToHex(digests, hashes);
+            progress += android::base::StringPrintf("%zu %zu %s\n", offset, kChunkSize,
+                                                    hashes.c_str());
+        }
+        ASSERT_TRUE(android::base::WriteStringToFile(real_, real_path_));
+        ASSERT_TRUE(android::base::WriteStringToFile(crypto_, crypto_path_));
+        ASSERT_TRUE(android::base::WriteStringToFile(progress, progress_path_));
+    }
+
+    bool Resume() { return encrypt_inplace(crypto_path_, real_path_, kSectors, progress_path_); }
+
+    std::string ReadCrypto() {
+        std::string contents;
+        EXPECT_TRUE(android::base::ReadFileToString(crypto_path_, &contents));
+        return contents;
+    }
+
+    TemporaryDir dir_;
+    std::string plaintext_, junk_, real_, crypto_;
+    std::string real_path_, crypto_path_, progress_path_;
+};
+
+TEST_F(EncryptInplaceTest, ResumesTornChunk) {
+    static constexpr size_t kBlocksPerChunk = kChunkSize / kBlockSize;
+    Encrypted(0, kBlocksPerChunk);
+    // The write of the second chunk was torn, and not just at a single point
+    Encrypted(kBlocksPerChunk, 20);
+    Encrypted(kBlocksPerChunk + 40, 3);
+    ASSERT_NO_FATAL_FAILURE(Interrupt());
+
+    ASSERT_TRUE(Resume());
+    // Blocks encrypted twice would hold junk here
+    EXPECT_TRUE(ReadCrypto() == plaintext_);
+    EXPECT_NE(0, access(progress_path_.c_str(), F_OK));
+}
+
+TEST_F(EncryptInplaceTest, RefusesUnknownData) {
+    Encrypted(0, 10);
+    ASSERT_NO_FATAL_FAILURE(Interrupt());
+    // A block that is neither the plaintext nor decrypts to it
+    real_[5 * kBlockSize] ^= 1;
+    crypto_[5 * kBlockSize] ^= 1;
+    ASSERT_TRUE(android::base::WriteStringToFile(real_, real_path_));
+    ASSERT_TRUE(android::base::WriteStringToFile(crypto_, crypto_path_));
+
+    EXPECT_FALSE(Resume());
+    EXPECT_TRUE(ReadCrypto() == crypto_);
+    EXPECT_EQ(0, access(progress_path_.c_str(), F_OK));
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <android-base/file.h>
+#include <benchmark/benchmark.h>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "../FileTree.h"
+
+namespace android {
+namespace vold {
+
+namespace {
+
+enum Shape {
+    // A chain of directories, each holding one file
+    kDeep,
+    // A single directory of files
+    kWide,
+    // Eight subdirectories per directory, three levels down, with sixteen files each
+    kBushy,
+};
+
+void makeFiles(const std::string& dir, int count) {
+    for (int i = 0; i < count; i++) {
+        std::string path = dir + "/file" + std::to_string(i);
+        close(open(path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC, 0600));
+    }
+}
+
+void makeBushy(const std::string& dir, int depth) {
+    makeFiles(dir, 16);
+    if (depth == 0) return;
+    for (int i = 0; i < 8; i++) {
+        std::string subdir = dir + "/dir" + std::to_string(i);
+        mkdir(subdir.c_str(), 0700);
+        makeBushy(subdir, depth - 1);
+    }
+}
+
+void makeTree(const std::string& root, Shape shape, int size) {
+    switch (shape) {
+        case kDeep: {
+            std::string dir = root;
+            for (int i = 0; i < size; i++) {
+                makeFiles(dir, 1);
+                dir += "/d";
+                mkdir(dir.c_str(), 0700);
+            }
+            break;
+        }
+        case kWide:
+            makeFiles(root, size);
+            break;
+        case kBushy:
+            makeBushy(root, 3);
+            break;
+    }
+}
+
+void BM_GetTreeAllocatedBytes(benchmark::State& state, Shape shape) {
+    TemporaryDir root;
+    makeTree(root.path, shape, state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(GetTreeAllocatedBytes(root.path));
+    }
+    RemoveTree(root.path, false);
+}
+
+void BM_GetTreeUsage(benchmark::State& state, Shape shape) {
+    TemporaryDir root;
+    makeTree(root.path, shape, state.range(0));
+    for (auto _ : state) {
+        TreeUsage usage;
+        if (GetTreeUsage(root.path, &usage) != OK) {
+            state.SkipWithError("GetTreeUsage() failed");
+            break;
+        }
+        benchmark::DoNotOptimize(usage.files);
+    }
+    RemoveTree(root.path, false);
+}
+
+void BM_RemoveTree(benchmark::State& state, Shape shape) {
+    TemporaryDir root;
+    for (auto _ : state) {
+        state.PauseTiming();
+        makeTree(root.path, shape, state.range(0));
+        state.ResumeTiming();
+        if (RemoveTree(root.path, false) != OK) {
+            state.SkipWithError("RemoveTree() failed");
+            break;
+        }
+    }
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_GetTreeAllocatedBytes, deep, kDeep)->Arg(64);
+BENCHMARK_CAPTURE(BM_GetTreeAllocatedBytes, wide, kWide)->Arg(4096);
+BENCHMARK_CAPTURE(BM_GetTreeAllocatedBytes, bushy, kBushy)->Arg(0);
+BENCHMARK_CAPTURE(BM_GetTreeUsage, deep, kDeep)->Arg(64);
+BENCHMARK_CAPTURE(BM_GetTreeUsage, wide, kWide)->Arg(4096);
+BENCHMARK_CAPTURE(BM_GetTreeUsage, bushy, kBushy)->Arg(0);
+BENCHMARK_CAPTURE(BM_RemoveTree, deep, kDeep)->Arg(64);
+BENCHMARK_CAPTURE(BM_RemoveTree, wide, kWide)->Arg(4096);
+BENCHMARK_CAPTURE(BM_RemoveTree, bushy, kBushy)->Arg(0);
+
+}  // namespace vold
+}  // namespace android
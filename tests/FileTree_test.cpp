@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <android-base/file.h>
+#include <gtest/gtest.h>
+
+#include <errno.h>
+#include <string.h>
+#include <sys/mount.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../FileTree.h"
+
+namespace android {
+namespace vold {
+
+class FileTreeTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        from_ = std::string(from_dir_.path);
+        to_ = std::string(to_dir_.path);
+    }
+
+    void MakeFile(const std::string& path, const std::string& contents, mode_t mode,
+                  time_t mtime) {
+        ASSERT_TRUE(android::base::WriteStringToFile(contents, path));
+        ASSERT_EQ(0, chmod(path.c_str(), mode));
+        const struct timespec times[2] = {{mtime, 0}, {mtime, 0}};
+        ASSERT_EQ(0, utimensat(AT_FDCWD, path.c_str(), times, 0));
+    }
+
+    TemporaryDir from_dir_;
+    TemporaryDir to_dir_;
+    std::string from_;
+    std::string to_;
+};
+
+TEST_F(FileTreeTest, CopyTreeContents) {
+    std::string big(3 * 1024 * 1024 + 17, 'x');
+    ASSERT_EQ(0, mkdir((from_ + "/a").c_str(), 0755));
+    ASSERT_EQ(0, mkdir((from_ + "/a/b").c_str(), 0700));
+    MakeFile(from_ + "/top", "hello", 0640, 1000);
+    MakeFile(from_ + "/a/b/big", big, 0600, 2000);
+    ASSERT_EQ(0, symlink("../top", (from_ + "/a/link").c_str()));
+    const struct timespec times[2] = {{3000, 0}, {3000, 0}};
+    ASSERT_EQ(0, utimensat(AT_FDCWD, (from_ + "/a").c_str(), times, 0));
+
+    uint64_t bytes = 0, files = 0;
+    ASSERT_EQ(OK, CopyTreeContents(from_, to_, [&](uint64_t b, uint64_t f) {
+                  EXPECT_GE(b, bytes);
+                  EXPECT_GE(f, files);
+                  bytes = b;
+                  files = f;
+              }));
+    EXPECT_EQ(5 + big.size(), bytes);
+    EXPECT_EQ(3u, files);
+
+    std::string contents;
+    ASSERT_TRUE(android::base::ReadFileToString(to_ + "/top", &contents));
+    EXPECT_EQ("hello", contents);
+    ASSERT_TRUE(android::base::ReadFileToString(to_ + "/a/b/big", &contents));
+    EXPECT_EQ(big, contents);
+
+    std::string target;
+    ASSERT_TRUE(android::base::Readlink(to_ + "/a/link", &target));
+    EXPECT_EQ("../top", target);
+
+    struct stat st;
+    ASSERT_EQ(0, stat((to_ + "/top").c_str(), &st));
+    EXPECT_EQ(0640u, st.st_mode & 07777);
+    EXPECT_EQ(1000, st.st_mtime);
+    ASSERT_EQ(0, stat((to_ + "/a/b").c_str(), &st));
+    EXPECT_EQ(0700u, st.st_mode & 07777);
+    ASSERT_EQ(0, stat((to_ + "/a").c_str(), &st));
+    EXPECT_EQ(0755u, st.st_mode & 07777);
+    EXPECT_EQ(3000, st.st_mtime);
+}
+
+TEST_F(FileTreeTest, CopyTreeContentsResumesFromManifest) {
+    TemporaryDir manifest_dir;
+    std::string manifest_path = std::string(manifest_dir.path) + "/manifest";
+    MakeFile(from_ + "/same", "aaaa", 0600, 1000);
+    MakeFile(from_ + "/changed", "bbbb", 0600, 1000);
+
+    {
+        CopyManifest manifest;
+        ASSERT_TRUE(manifest.Open(manifest_path, "move 1"));
+        EXPECT_FALSE(manifest.resumed());
+        ASSERT_EQ(OK, CopyTreeContents(from_, to_, nullptr, &manifest));
+    }
+
+    // Mark the target copies so we can tell which ones get copied again.
+    ASSERT_TRUE(android::base::WriteStringToFile("AAAA", to_ + "/same"));
+    ASSERT_TRUE(android::base::WriteStringToFile("BBBB", to_ + "/changed"));
+    MakeFile(from_ + "/changed", "cccc", 0600, 2000);
+
+    CopyManifest manifest;
+    ASSERT_TRUE(manifest.Open(manifest_path, "move 1"));
+    EXPECT_TRUE(manifest.resumed());
+    EXPECT_EQ(8u, manifest.copiedBytes());
+    uint64_t bytes = 0;
+    ASSERT_EQ(OK, CopyTreeContents(
+                          from_, to_, [&](uint64_t b, uint64_t) { bytes = b; }, &manifest));
+    EXPECT_EQ(8u, bytes);
+
+    std::string contents;
+    ASSERT_TRUE(android::base::ReadFileToString(to_ + "/same", &contents));
+    EXPECT_EQ("AAAA", contents);
+    ASSERT_TRUE(android::base::ReadFileToString(to_ + "/changed", &contents));
+    EXPECT_EQ("cccc", contents);
+
+    // A manifest written for another copy is discarded.
+    CopyManifest other;
+    ASSERT_TRUE(other.Open(manifest_path, "move 2"));
+    EXPECT_FALSE(other.resumed());
+    EXPECT_EQ(0u, other.copiedBytes());
+    EXPECT_FALSE(other.IsCopied("same", {4, 1000000000000LL, 0}));
+}
+
+TEST_F(FileTreeTest, CopyTreeContentsMissingSource) {
+    EXPECT_NE(OK, CopyTreeContents(from_ + "/missing", to_));
+}
+
+TEST_F(FileTreeTest, PruneTreeContents) {
+    ASSERT_EQ(0, mkdir((from_ + "/kept").c_str(), 0700));
+    ASSERT_EQ(0, mkdir((from_ + "/gone").c_str(), 0700));
+    MakeFile(from_ + "/kept/file", "a", 0600, 1000);
+    MakeFile(from_ + "/kept/deleted", "b", 0600, 1000);
+    MakeFile(from_ + "/gone/file", "c", 0600, 1000);
+    MakeFile(from_ + "/retyped", "d", 0600, 1000);
+    ASSERT_EQ(OK, CopyTreeContents(from_, to_));
+
+    // What happens to the source between an interrupted copy and its resumption
+    ASSERT_EQ(0, unlink((from_ + "/kept/deleted").c_str()));
+    ASSERT_EQ(OK, RemoveTree(from_ + "/gone", true));
+    ASSERT_EQ(0, unlink((from_ + "/retyped").c_str()));
+    ASSERT_EQ(0, mkdir((from_ + "/retyped").c_str(), 0700));
+
+    ASSERT_EQ(OK, PruneTreeContents(from_, to_));
+    EXPECT_EQ(0, access((to_ + "/kept/file").c_str(), F_OK));
+    EXPECT_NE(0, access((to_ + "/kept/deleted").c_str(), F_OK));
+    EXPECT_NE(0, access((to_ + "/gone").c_str(), F_OK));
+    EXPECT_NE(0, access((to_ + "/retyped").c_str(), F_OK));
+}
+
+TEST_F(FileTreeTest, GetTreeUsage) {
+    ASSERT_EQ(0, mkdir((from_ + "/a").c_str(), 0755));
+    ASSERT_EQ(0, mkdir((from_ + "/a/b").c_str(), 0755));
+    MakeFile(from_ + "/top", "hello", 0600, 1000);
+    MakeFile(from_ + "/a/b/file", std::string(10000, 'x'), 0600, 1000);
+    ASSERT_EQ(0, symlink("../../top", (from_ + "/a/b/link").c_str()));
+
+    TreeUsage usage;
+    ASSERT_EQ(OK, GetTreeUsage(from_, &usage));
+    EXPECT_EQ(10005u, usage.bytes);
+    EXPECT_EQ(3u, usage.files);
+    EXPECT_EQ(2u, usage.dirs);
+
+    // The reported totals are what a copy of the same tree reports as it goes.
+    uint64_t bytes = 0, files = 0;
+    ASSERT_EQ(OK, CopyTreeContents(from_, to_, [&](uint64_t b, uint64_t f) {
+                  bytes = b;
+                  files = f;
+              }));
+    EXPECT_EQ(usage.bytes, bytes);
+    EXPECT_EQ(usage.files, files);
+}
+
+TEST_F(FileTreeTest, GetTreeAllocatedBytes) {
+    ASSERT_EQ(0, mkdir((from_ + "/a").c_str(), 0755));
+    ASSERT_EQ(0, mkdir((from_ + "/a/b").c_str(), 0755));
+    MakeFile(from_ + "/a/b/file", std::string(100000, 'x'), 0600, 1000);
+
+    uint64_t bytes = GetTreeAllocatedBytes(from_);
+    EXPECT_GE(bytes, 100000u);
+
+    MakeFile(from_ + "/a/b/more", std::string(100000, 'y'), 0600, 1000);
+    EXPECT_GE(GetTreeAllocatedBytes(from_), bytes + 100000);
+
+    EXPECT_EQ((uint64_t)-1, GetTreeAllocatedBytes(from_ + "/missing"));
+}
+
+TEST_F(FileTreeTest, RemoveTree) {
+    std::string path = from_;
+    for (int i = 0; i < 20; i++) {
+        path += "/d" + std::to_string(i);
+        ASSERT_EQ(0, mkdir(path.c_str(), 0700));
+        MakeFile(path + "/f", "contents", 0600, 1000);
+        ASSERT_EQ(0, mkdir((path + "/empty").c_str(), 0700));
+    }
+    MakeFile(to_ + "/outside", "keep", 0600, 1000);
+    ASSERT_EQ(0, symlink(to_.c_str(), (from_ + "/d0/link").c_str()));
+    MakeFile(from_ + "/top", "contents", 0600, 1000);
+
+    uint64_t files = 0;
+    ASSERT_EQ(OK, RemoveTree(from_, false, [&](uint64_t, uint64_t f) { files = f; }));
+    // 20 levels of a file and two directories, plus the symlink and the top-level file.
+    EXPECT_EQ(20u * 3 + 2, files);
+
+    struct stat st;
+    EXPECT_EQ(0, stat(from_.c_str(), &st));
+    EXPECT_EQ(-1, stat((from_ + "/d0").c_str(), &st));
+    EXPECT_EQ(0, stat((to_ + "/outside").c_str(), &st));
+
+    ASSERT_EQ(OK, RemoveTree(from_, true));
+    EXPECT_EQ(-1, stat(from_.c_str(), &st));
+    EXPECT_EQ(OK, RemoveTree(from_, true));
+    ASSERT_EQ(0, mkdir(from_.c_str(), 0700));
+}
+
+TEST_F(FileTreeTest, RemoveTreeSkipsMountPoints) {
+    std::string mnt = from_ + "/a/mnt";
+    ASSERT_EQ(0, mkdir((from_ + "/a").c_str(), 0700));
+    ASSERT_EQ(0, mkdir(mnt.c_str(), 0700));
+    if (mount(to_.c_str(), mnt.c_str(), nullptr, MS_BIND, nullptr) != 0) {
+        GTEST_SKIP() << "Can't bind mount: " << strerror(errno);
+    }
+    MakeFile(to_ + "/mounted", "keep", 0600, 1000);
+    MakeFile(from_ + "/a/file", "contents", 0600, 1000);
+
+    EXPECT_NE(OK, RemoveTree(from_ + "/a", true));
+    struct stat st;
+    EXPECT_EQ(0, stat((to_ + "/mounted").c_str(), &st));
+    EXPECT_EQ(-1, stat((from_ + "/a/file").c_str(), &st));
+
+    ASSERT_EQ(0, umount(mnt.c_str()));
+    EXPECT_EQ(OK, RemoveTree(from_ + "/a", true));
+}
+
+}  // namespace vold
+}  // namespace android
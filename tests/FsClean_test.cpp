@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <android-base/file.h>
+#include <gtest/gtest.h>
+
+#include <string.h>
+
+#include <vector>
+
+#include "../fs/Exfat.h"
+#include "../fs/Vfat.h"
+
+namespace android {
+namespace vold {
+
+class FsCleanTest : public testing::Test {
+  protected:
+    void SetUp() override { image_.assign(64 * 1024, 0); }
+
+    void Put(size_t offset, const char* str) { memcpy(&image_[offset], str, strlen(str)); }
+    void Put8(size_t offset, uint8_t value) { image_[offset] = value; }
+    void Put16(size_t offset, uint16_t value) {
+        for (int i = 0; i < 2; i++) image_[offset + i] = value >> (i * 8);
+    }
+    void Put32(size_t offset, uint32_t value) {
+        for (int i = 0; i < 4; i++) image_[offset + i] = value >> (i * 8);
+    }
+
+    template <typename Fn>
+    bool IsClean(Fn fn) {
+        TemporaryFile file;
+        EXPECT_TRUE(android::base::WriteFully(file.fd, image_.data(), image_.size()));
+        return fn(file.path);
+    }
+    bool IsExfatClean() { return IsClean(exfat::IsClean); }
+    bool IsVfatClean() { return IsClean(vfat::IsClean); }
+
+    void PutExfat(uint16_t volumeFlags) {
+        Put(3, "EXFAT   ");
+        Put16(106, volumeFlags);
+        Put16(510, 0xaa55);
+    }
+
+    /* A FAT with 512-byte sectors, one reserved sector and one FAT; FAT[1] is at 512 + 4 */
+    void PutFat(uint32_t totalSectors, bool fat32, uint8_t state) {
+        Put16(11, 512);
+        Put8(13, 1);
+        Put16(14, 1);
+        Put8(16, 1);
+        Put32(32, totalSectors);
+        if (fat32) {
+            Put32(36, 1);
+            Put8(65, state);
+        } else {
+            Put16(17, 16);
+            Put16(22, 1);
+            Put8(37, state);
+        }
+        Put16(510, 0xaa55);
+    }
+
+    std::vector<uint8_t> image_;
+};
+
+TEST_F(FsCleanTest, Exfat) {
+    PutExfat(0);
+    EXPECT_TRUE(IsExfatClean());
+    PutExfat(0x0001);  // ActiveFat doesn't matter
+    EXPECT_TRUE(IsExfatClean());
+    PutExfat(0x0002);  // VolumeDirty
+    EXPECT_FALSE(IsExfatClean());
+    PutExfat(0x0004);  // MediaFailure
+    EXPECT_FALSE(IsExfatClean());
+}
+
+TEST_F(FsCleanTest, NotExfat) {
+    PutExfat(0);
+    Put(3, "NTFS    ");
+    EXPECT_FALSE(IsExfatClean());
+}
+
+TEST_F(FsCleanTest, Fat32) {
+    PutFat(100000, true, 0);
+    Put32(512 + 4, 0x0fffffff);
+    EXPECT_TRUE(IsVfatClean());
+
+    PutFat(100000, true, 0x01);  // Left mounted by Linux
+    EXPECT_FALSE(IsVfatClean());
+
+    PutFat(100000, true, 0);
+    Put32(512 + 4, 0x07ffffff);  // Left mounted by Windows
+    EXPECT_FALSE(IsVfatClean());
+    Put32(512 + 4, 0x0bffffff);  // Hard error
+    EXPECT_FALSE(IsVfatClean());
+}
+
+TEST_F(FsCleanTest, Fat16) {
+    PutFat(10000, false, 0);
+    Put16(512 + 2, 0xffff);
+    EXPECT_TRUE(IsVfatClean());
+    Put16(512 + 2, 0xbfff);  // Hard error
+    EXPECT_FALSE(IsVfatClean());
+}
+
+TEST_F(FsCleanTest, Fat12OnlyHasTheStateBit) {
+    // Too few clusters for FAT16, so FAT[1] holds no flags
+    PutFat(2000, false, 0);
+    EXPECT_TRUE(IsVfatClean());
+    PutFat(2000, false, 0x01);
+    EXPECT_FALSE(IsVfatClean());
+}
+
+TEST_F(FsCleanTest, NotFat) {
+    EXPECT_FALSE(IsVfatClean());
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,316 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <android-base/file.h>
+#include <gtest/gtest.h>
+
+#include <string.h>
+#include <sys/sysmacros.h>
+#include <unistd.h>
+
+#include <vector>
+
+#include "../FsProbe.h"
+
+namespace android {
+namespace vold {
+
+class FsProbeTest : public testing::Test {
+  protected:
+    void SetUp() override { image_.assign(1024 * 1024, 0); }
+
+    void Put(size_t offset, const void* data, size_t len) {
+        memcpy(&image_[offset], data, len);
+    }
+    void Put(size_t offset, const char* str) { Put(offset, str, strlen(str)); }
+    void Put8(size_t offset, uint8_t value) { image_[offset] = value; }
+    void Put16(size_t offset, uint16_t value) {
+        for (int i = 0; i < 2; i++) image_[offset + i] = value >> (i * 8);
+    }
+    void Put32(size_t offset, uint32_t value) {
+        for (int i = 0; i < 4; i++) image_[offset + i] = value >> (i * 8);
+    }
+    void Put64(size_t offset, uint64_t value) {
+        for (int i = 0; i < 8; i++) image_[offset + i] = value >> (i * 8);
+    }
+    void PutUtf16(size_t offset, const char* ascii) {
+        for (size_t i = 0; ascii[i]; i++) Put16(offset + i * 2, ascii[i]);
+    }
+
+    bool Probe(FsMetadata* metadata) {
+        TemporaryFile file;
+        EXPECT_TRUE(android::base::WriteFully(file.fd, image_.data(), image_.size()));
+        return ProbeFilesystem(file.fd, metadata);
+    }
+
+    void PutExt4() {
+        Put16(1024 + 0x38, 0xef53);
+        Put32(1024 + 0x5c, 0x4);   // has_journal
+        Put32(1024 + 0x60, 0x42);  // filetype, extent
+        const uint8_t uuid[16] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
+                                  0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10};
+        Put(1024 + 0x68, uuid, sizeof(uuid));
+        Put(1024 + 0x78, "android");
+    }
+
+    void PutFatBootSector() {
+        Put8(0, 0xeb);
+        Put8(1, 0x58);
+        Put8(2, 0x90);
+        Put(3, "MSWIN4.1");
+        Put16(0x0b, 512);
+        Put8(0x0d, 1);
+        Put8(0x10, 2);
+        Put8(0x15, 0xf8);
+        Put16(0x1fe, 0xaa55);
+    }
+
+    void PutFatLabel(size_t offset, const char* label) {
+        // A long name entry first, which isn't the label despite its attributes
+        Put8(offset, 0x41);
+        Put8(offset + 11, 0x0f);
+        Put(offset + 32, label);
+        Put8(offset + 32 + 11, 0x08);
+    }
+
+    // Puts an NTFS boot sector and the header of its $Volume record, and returns the offset of
+    // the record, whose attributes start at 0x38.
+    size_t PutNtfsVolumeRecord() {
+        Put8(0, 0xeb);
+        Put8(1, 0x52);
+        Put8(2, 0x90);
+        Put(3, "NTFS    ");
+        Put16(0x0b, 512);
+        Put8(0x0d, 8);
+        Put8(0x15, 0xf8);
+        Put64(0x28, 2047);
+        Put64(0x30, 4);
+        Put64(0x38, 128);
+        Put8(0x40, 0xf6);  // 1KiB records
+        Put64(0x48, 0x0123456789abcdefULL);
+        Put16(0x1fe, 0xaa55);
+
+        Put(4 * 4096, "FILE");
+        size_t rec = 4 * 4096 + 3 * 1024;
+        Put(rec, "FILE");
+        Put16(rec + 4, 0x30);
+        Put16(rec + 6, 3);
+        Put16(rec + 0x14, 0x38);
+        Put32(rec + 0x1c, 1024);
+        // The update sequence number was written over the end of both sectors
+        Put16(rec + 0x30, 0x0007);
+        Put16(rec + 0x32, 0x1111);
+        Put16(rec + 0x34, 0x2222);
+        Put16(rec + 510, 0x0007);
+        Put16(rec + 1022, 0x0007);
+        return rec;
+    }
+
+    std::vector<uint8_t> image_;
+};
+
+TEST_F(FsProbeTest, Ext) {
+    PutExt4();
+    FsMetadata metadata;
+    ASSERT_TRUE(Probe(&metadata));
+    EXPECT_EQ("ext4", metadata.type);
+    EXPECT_EQ("01234567-89ab-cdef-fedc-ba9876543210", metadata.uuid);
+    EXPECT_EQ("android", metadata.label);
+
+    Put32(1024 + 0x60, 0x2);
+    ASSERT_TRUE(Probe(&metadata));
+    EXPECT_EQ("ext3", metadata.type);
+    Put32(1024 + 0x5c, 0);
+    ASSERT_TRUE(Probe(&metadata));
+    EXPECT_EQ("ext2", metadata.type);
+}
+
+TEST_F(FsProbeTest, F2fs) {
+    Put32(1024, 0xf2f52010);
+    Put16(1024 + 4, 1);
+    Put16(1024 + 6, 15);
+    const uint8_t uuid[16] = {0xde, 0xad, 0xbe, 0xef, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
+    Put(1024 + 108, uuid, sizeof(uuid));
+    PutUtf16(1024 + 124, "data");
+
+    FsMetadata metadata;
+    ASSERT_TRUE(Probe(&metadata));
+    EXPECT_EQ("f2fs", metadata.type);
+    EXPECT_EQ("deadbeef-0000-0000-0000-000000000001", metadata.uuid);
+    EXPECT_EQ("data", metadata.label);
+}
+
+TEST_F(FsProbeTest, Fat16) {
+    PutFatBootSector();
+    Put16(0x0e, 1);
+    Put16(0x11, 512);
+    Put16(0x13, 2000);
+    Put16(0x16, 8);
+    Put8(0x26, 0x29);
+    Put32(0x27, 0x1234abcd);
+    Put(0x2b, "BOOT       FAT16   ");
+    PutFatLabel((1 + 2 * 8) * 512, "SDCARD     ");
+
+    FsMetadata metadata;
+    ASSERT_TRUE(Probe(&metadata));
+    EXPECT_EQ("vfat", metadata.type);
+    EXPECT_EQ("1234-ABCD", metadata.uuid);
+    EXPECT_EQ("SDCARD", metadata.label);
+}
+
+TEST_F(FsProbeTest, Fat32) {
+    PutFatBootSector();
+    Put16(0x0e, 32);
+    Put32(0x20, 2048);
+    Put32(0x24, 16);
+    Put32(0x2c, 3);
+    Put8(0x42, 0x29);
+    Put32(0x43, 0x0000beef);
+    Put(0x47, "NO NAME    FAT32   ");
+    FsMetadata metadata;
+    ASSERT_TRUE(Probe(&metadata));
+    EXPECT_EQ("vfat", metadata.type);
+    EXPECT_EQ("0000-BEEF", metadata.uuid);
+    // Only the label in the root directory counts, not the one in the boot sector
+    EXPECT_EQ("", metadata.label);
+
+    PutFatLabel((32 + 2 * 16 + 1) * 512, "USB DRIVE  ");
+    ASSERT_TRUE(Probe(&metadata));
+    EXPECT_EQ("USB DRIVE", metadata.label);
+}
+
+TEST_F(FsProbeTest, Exfat) {
+    Put8(0, 0xeb);
+    Put8(1, 0x76);
+    Put8(2, 0x90);
+    Put(3, "EXFAT   ");
+    Put64(72, 2048);
+    Put32(80, 24);
+    Put32(84, 8);
+    Put32(88, 32);
+    Put32(92, 1000);
+    Put32(96, 4);
+    Put32(100, 0x5a5aa5a5);
+    Put16(104, 0x100);
+    Put8(108, 9);
+    Put8(109, 0);
+    Put8(110, 1);
+    Put16(0x1fe, 0xaa55);
+    uint32_t sum = 0;
+    for (size_t i = 0; i < 11 * 512; i++) {
+        if (i == 106 || i == 107 || i == 112) continue;
+        sum = ((sum & 1) ? 0x80000000 : 0) + (sum >> 1) + image_[i];
+    }
+    for (size_t i = 11 * 512; i < 12 * 512; i += 4) Put32(i, sum);
+
+    size_t root = (32 + 2) * 512;
+    Put8(root, 0x81);  // allocation bitmap
+    Put8(root + 32, 0x83);
+    Put8(root + 33, 5);
+    PutUtf16(root + 34, "Photo");
+
+    FsMetadata metadata;
+    ASSERT_TRUE(Probe(&metadata));
+    EXPECT_EQ("exfat", metadata.type);
+    EXPECT_EQ("5A5A-A5A5", metadata.uuid);
+    EXPECT_EQ("Photo", metadata.label);
+
+    // Changing volume flags doesn't break the checksum, anything else does
+    Put16(106, 0x2);
+    ASSERT_TRUE(Probe(&metadata));
+    Put32(100, 0x5a5aa5a6);
+    EXPECT_FALSE(Probe(&metadata));
+}
+
+TEST_F(FsProbeTest, Ntfs) {
+    size_t rec = PutNtfsVolumeRecord();
+    size_t attr = rec + 0x38;
+    Put32(attr, 0x30);  // $FILE_NAME, skipped
+    Put32(attr + 4, 0x18);
+    attr += 0x18;
+    Put32(attr, 0x60);
+    Put32(attr + 4, 0x28);
+    Put32(attr + 0x10, 12);
+    Put16(attr + 0x14, 0x18);
+    PutUtf16(attr + 0x18, "Backup");
+    Put32(attr + 0x28, 0xffffffff);
+
+    FsMetadata metadata;
+    ASSERT_TRUE(Probe(&metadata));
+    EXPECT_EQ("ntfs", metadata.type);
+    EXPECT_EQ("0123456789ABCDEF", metadata.uuid);
+    EXPECT_EQ("Backup", metadata.label);
+
+    // A torn record sector
+    Put16(rec + 1022, 0x0008);
+    EXPECT_FALSE(Probe(&metadata));
+}
+
+TEST_F(FsProbeTest, NtfsTruncatedAttribute) {
+    size_t rec = PutNtfsVolumeRecord();
+    // The end of the second sector is restored to zeroes
+    Put16(rec + 0x34, 0);
+
+    size_t attr = rec + 0x38;
+    Put32(attr, 0x30);  // $FILE_NAME, up to the last 8 bytes of the record
+    Put32(attr + 4, 1024 - 8 - 0x38);
+    // A $VOLUME_NAME too short for its value fields, right at the end of the record
+    attr = rec + 1024 - 8;
+    Put32(attr, 0x60);
+    Put16(attr + 4, 8);
+
+    FsMetadata metadata;
+    ASSERT_TRUE(Probe(&metadata));
+    EXPECT_EQ("ntfs", metadata.type);
+    EXPECT_EQ("", metadata.label);
+}
+
+TEST_F(FsProbeTest, UnknownOrAmbiguous) {
+    FsMetadata metadata;
+    EXPECT_FALSE(Probe(&metadata));
+
+    // Left to blkid, which knows which of the two signatures to believe
+    PutExt4();
+    PutFatBootSector();
+    Put16(0x0e, 32);
+    Put32(0x20, 2048);
+    Put32(0x24, 16);
+    Put32(0x2c, 2);
+    EXPECT_FALSE(Probe(&metadata));
+
+    // ... unless the other one fails the sanity checks anyway, here by having no sectors
+    Put32(0x20, 0);
+    ASSERT_TRUE(Probe(&metadata));
+    EXPECT_EQ("ext4", metadata.type);
+}
+
+TEST_F(FsProbeTest, Cache) {
+    FsMetadata metadata{"vfat", "1234-ABCD", "SDCARD"};
+    dev_t device = makedev(179, 1);
+    CacheFsMetadata(device, 7, metadata);
+
+    FsMetadata cached;
+    ASSERT_TRUE(GetCachedFsMetadata(device, 7, &cached));
+    EXPECT_EQ("1234-ABCD", cached.uuid);
+    // The media changed since then
+    EXPECT_FALSE(GetCachedFsMetadata(device, 8, &cached));
+
+    InvalidateFsMetadata(device);
+    EXPECT_FALSE(GetCachedFsMetadata(device, 7, &cached));
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../KeyBuffer.h"
+
+namespace android {
+namespace vold {
+
+namespace {
+
+std::string ToString(const KeyBuffer& buf) {
+    return std::string(buf.begin(), buf.end());
+}
+
+}  // namespace
+
+TEST(KeyBufferTest, Concatenate) {
+    KeyBuffer key(4, 'k');
+    KeyBuffer suffix(3, 's');
+    key += suffix;
+    key += "xy";
+    EXPECT_EQ("kkkksssxy", ToString(key));
+
+    KeyBuffer joined = KeyBuffer(2, 'a') + suffix + "z";
+    EXPECT_EQ("aasssz", ToString(joined));
+}
+
+TEST(KeyBufferTest, FreedMemoryIsZeroedAndReused) {
+    char* first;
+    {
+        KeyBuffer key(48, 'k');
+        first = key.data();
+    }
+    KeyBuffer key;
+    key.reserve(40);
+    // Same size class, so the block just freed comes back, wiped
+    ASSERT_EQ(first, key.data());
+    for (size_t i = 0; i < 40; i++) {
+        EXPECT_EQ(0, key.data()[i]) << i;
+    }
+}
+
+TEST(KeyBufferTest, ManyAndLargeBuffers) {
+    std::vector<KeyBuffer> keys;
+    for (size_t i = 0; i < 4096; i++) {
+        keys.emplace_back(1 + i % 200, static_cast<char>(i));
+    }
+    for (size_t i = 0; i < keys.size(); i++) {
+        ASSERT_EQ(1 + i % 200, keys[i].size());
+        EXPECT_EQ(static_cast<char>(i), keys[i].back());
+    }
+
+    KeyBuffer large(100000, 'l');
+    large += "end";
+    EXPECT_EQ(100003u, large.size());
+    EXPECT_EQ('l', large[99999]);
+    EXPECT_EQ('d', large.back());
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <android-base/file.h>
+#include <gtest/gtest.h>
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../KeyDirWriter.h"
+#include "../KeyStorage.h"
+
+namespace android {
+namespace vold {
+
+namespace {
+
+const std::vector<std::pair<const char*, std::string>> kFiles = {
+        {"version", "1"},
+        {"secdiscardable", std::string(1 << 14, 's')},
+        {"keymaster_key_blob", "blob"},
+        {"encrypted_key", "key"},
+};
+
+// The steps of storing a key with a secret, in the names passed to the KeyDirWriter fault hook
+const std::vector<const char*> kStoreSteps = {"version", "encrypted_key", "sync"};
+
+bool Exists(const std::string& path) {
+    struct stat sb;
+    return stat(path.c_str(), &sb) == 0;
+}
+
+}  // namespace
+
+TEST(KeyDirWriterTest, WritesFiles) {
+    TemporaryDir dir;
+    auto key_path = std::string(dir.path) + "/key";
+    KeyDirWriter writer;
+    ASSERT_TRUE(writer.create(key_path));
+    for (const auto& [name, contents] : kFiles) {
+        ASSERT_TRUE(writer.writeFile(name, contents));
+    }
+    // Readable before the sync, since the Keystore key is used while the rest is still written
+    std::string contents;
+    ASSERT_TRUE(android::base::ReadFileToString(key_path + "/keymaster_key_blob", &contents));
+    EXPECT_EQ("blob", contents);
+    ASSERT_TRUE(writer.sync());
+
+    for (const auto& [name, expected] : kFiles) {
+        ASSERT_TRUE(android::base::ReadFileToString(key_path + "/" + name, &contents));
+        EXPECT_EQ(expected, contents) << name;
+    }
+    EXPECT_FALSE(writer.writeFile("version", "2"));
+}
+
+TEST(KeyDirWriterTest, CreateFailsIfExists) {
+    TemporaryDir dir;
+    KeyDirWriter writer;
+    EXPECT_FALSE(writer.create(dir.path));
+}
+
+TEST(KeyDirWriterTest, CrashLeavesNoPartialKey) {
+    const KeyAuthentication auth("secret");
+    const KeyBuffer key(32, 'k');
+    for (const char* crash_at : kStoreSteps) {
+        TemporaryDir dir;
+        auto tmp_path = std::string(dir.path) + "/key.tmp";
+        auto key_path = std::string(dir.path) + "/key";
+
+        // Dies without any cleanup just before crash_at
+        pid_t pid = fork();
+        ASSERT_NE(-1, pid);
+        if (pid == 0) {
+            SetKeyDirWriterFaultHook([crash_at](const char* step) {
+                if (strcmp(step, crash_at) == 0) _exit(0);
+                return true;
+            });
+            storeKeyAtomically(key_path, tmp_path, auth, key);
+            _exit(1);
+        }
+        int status;
+        ASSERT_EQ(pid, TEMP_FAILURE_RETRY(waitpid(pid, &status, 0)));
+        ASSERT_TRUE(WIFEXITED(status));
+        ASSERT_EQ(0, WEXITSTATUS(status)) << "crash_at " << crash_at;
+        EXPECT_FALSE(Exists(key_path)) << "crash_at " << crash_at;
+
+        // The next store replaces whatever the crash left under tmp_path
+        ASSERT_TRUE(storeKeyAtomically(key_path, tmp_path, auth, key)) << "crash_at " << crash_at;
+        EXPECT_FALSE(Exists(tmp_path)) << "crash_at " << crash_at;
+        KeyBuffer retrieved;
+        ASSERT_TRUE(retrieveKey(key_path, auth, &retrieved)) << "crash_at " << crash_at;
+        EXPECT_EQ(key, retrieved) << "crash_at " << crash_at;
+    }
+}
+
+TEST(KeyDirWriterTest, FailedStoreLeavesNoKey) {
+    const KeyAuthentication auth("secret");
+    const KeyBuffer key(32, 'k');
+    for (const char* fail_at : kStoreSteps) {
+        TemporaryDir dir;
+        auto tmp_path = std::string(dir.path) + "/key.tmp";
+        auto key_path = std::string(dir.path) + "/key";
+
+        SetKeyDirWriterFaultHook(
+                [fail_at](const char* step) { return strcmp(step, fail_at) != 0; });
+        EXPECT_FALSE(storeKeyAtomically(key_path, tmp_path, auth, key)) << "fail_at " << fail_at;
+        SetKeyDirWriterFaultHook(nullptr);
+        EXPECT_FALSE(Exists(key_path)) << "fail_at " << fail_at;
+    }
+}
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,243 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <android-base/file.h>
+#include <gtest/gtest.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include "../Crc32.h"
+#include "../PartitionTable.h"
+
+namespace android {
+namespace vold {
+
+static const char* kBasicData = "EBD0A0A2-B9E5-4433-87C0-68B6B72699C7";
+static const char* kAndroidExpand = "193D1EA4-B3CA-11E4-B075-10604B889DCF";
+static const char* kPartGuid = "0A1B2C3D-4E5F-6071-8293-A4B5C6D7E8F9";
+
+class PartitionTableTest : public testing::Test {
+  protected:
+    // A 32MiB disk with 512 byte sectors
+    void SetUp() override { image_.assign(32 * 1024 * 1024, 0); }
+
+    void Put16(size_t offset, uint16_t value) {
+        for (int i = 0; i < 2; i++) image_[offset + i] = value >> (i * 8);
+    }
+    void Put32(size_t offset, uint32_t value) {
+        for (int i = 0; i < 4; i++) image_[offset + i] = value >> (i * 8);
+    }
+    void Put64(size_t offset, uint64_t value) {
+        for (int i = 0; i < 8; i++) image_[offset + i] = value >> (i * 8);
+    }
+    void PutGuid(size_t offset, const std::string& guid) {
+        std::string hex;
+        for (char c : guid) {
+            if (c != '-') hex += c;
+        }
+        uint8_t bytes[16];
+        for (int i = 0; i < 16; i++) {
+            bytes[i] = strtoul(hex.substr(i * 2, 2).c_str(), nullptr, 16);
+        }
+        const int kOrder[16] = {3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15};
+        for (int i = 0; i < 16; i++) image_[offset + i] = bytes[kOrder[i]];
+    }
+    uint32_t Crc(size_t offset, size_t len) {
+        uint32_t crc = ~0u;
+        crc32(&image_[offset], len, &crc);
+        return ~crc;
+    }
+
+    void PutMbrEntry(int index, uint8_t status, uint8_t type, uint32_t start, uint32_t length) {
+        size_t entry = 446 + index * 16;
+        image_[entry] = status;
+        image_[entry + 4] = type;
+        Put32(entry + 8, start);
+        Put32(entry + 12, length);
+        Put16(510, 0xaa55);
+    }
+
+    void PutGpt() {
+        PutMbrEntry(0, 0, 0xee, 1, image_.size() / 512 - 1);
+        size_t entries = 2 * 512;
+        PutGuid(entries, kBasicData);
+        PutGuid(entries + 16, "11111111-2222-3333-4444-555555555555");
+        Put64(entries + 32, 2048);
+        Put64(entries + 40, 4095);
+        PutGuid(entries + 2 * 128, kAndroidExpand);
+        PutGuid(entries + 2 * 128 + 16, kPartGuid);
+        Put64(entries + 2 * 128 + 32, 4096);
+        Put64(entries + 2 * 128 + 40, 8191);
+
+        size_t header = 512;
+        memcpy(&image_[header], "EFI PART", 8);
+        Put32(header + 8, 0x10000);
+        Put32(header + 12, 92);
+        Put64(header + 24, 1);
+        Put64(header + 32, image_.size() / 512 - 1);
+        Put64(header + 40, 34);
+        Put64(header + 48, image_.size() / 512 - 34);
+        Put64(header + 72, 2);
+        Put32(header + 80, 128);
+        Put32(header + 84, 128);
+        Put32(header + 88, Crc(entries, 128 * 128));
+        UpdateGptHeaderCrc();
+    }
+    void UpdateGptHeaderCrc() {
+        Put32(512 + 16, 0);
+        Put32(512 + 16, Crc(512, 92));
+    }
+
+    bool Read(PartitionTable* table) {
+        TemporaryFile file;
+        EXPECT_TRUE(android::base::WriteFully(file.fd, image_.data(), image_.size()));
+        return ReadPartitionTable(file.fd, table);
+    }
+
+    std::vector<uint8_t> image_;
+};
+
+TEST_F(PartitionTableTest, Mbr) {
+    PutMbrEntry(0, 0x80, 0x0c, 2048, 4096);
+    PutMbrEntry(2, 0, 0x83, 8192, 8192);
+    PartitionTable table;
+    ASSERT_TRUE(Read(&table));
+    EXPECT_EQ(PartitionTable::Type::kMbr, table.type);
+    ASSERT_EQ(2u, table.partitions.size());
+    EXPECT_EQ(1, table.partitions[0].number);
+    EXPECT_EQ(0x0c, table.partitions[0].mbrType);
+    EXPECT_EQ(3, table.partitions[1].number);
+    EXPECT_EQ(0x83, table.partitions[1].mbrType);
+
+    // The same thing, as sgdisk would have described it
+    PartitionTable dump;
+    ParseSgdiskDump({"DISK mbr", "PART 1 0c", "PART 3 83"}, &dump);
+    EXPECT_EQ(PartitionTable::Type::kMbr, dump.type);
+    ASSERT_EQ(2u, dump.partitions.size());
+    EXPECT_EQ(3, dump.partitions[1].number);
+    EXPECT_EQ(0x83, dump.partitions[1].mbrType);
+}
+
+TEST_F(PartitionTableTest, Gpt) {
+    PutGpt();
+    PartitionTable table;
+    ASSERT_TRUE(Read(&table));
+    EXPECT_EQ(PartitionTable::Type::kGpt, table.type);
+    ASSERT_EQ(2u, table.partitions.size());
+    EXPECT_EQ(1, table.partitions[0].number);
+    EXPECT_EQ(kBasicData, table.partitions[0].typeGuid);
+    EXPECT_EQ("11111111-2222-3333-4444-555555555555", table.partitions[0].partGuid);
+    EXPECT_EQ(3, table.partitions[1].number);
+    EXPECT_EQ(kAndroidExpand, table.partitions[1].typeGuid);
+    EXPECT_EQ(kPartGuid, table.partitions[1].partGuid);
+
+    PartitionTable dump;
+    ParseSgdiskDump({"DISK gpt 01234567-89AB-CDEF-0123-456789ABCDEF",
+                     std::string("PART 3 ") + kAndroidExpand + " " + kPartGuid + " android_expand"},
+                    &dump);
+    EXPECT_EQ(PartitionTable::Type::kGpt, dump.type);
+    ASSERT_EQ(1u, dump.partitions.size());
+    EXPECT_EQ(kAndroidExpand, dump.partitions[0].typeGuid);
+    EXPECT_EQ(kPartGuid, dump.partitions[0].partGuid);
+}
+
+TEST_F(PartitionTableTest, ChecksumTellsTablesApart) {
+    PutMbrEntry(0, 0, 0x0c, 2048, 4096);
+    PartitionTable first;
+    ASSERT_TRUE(Read(&first));
+    EXPECT_NE(0u, first.checksum);
+    PartitionTable again;
+    ASSERT_TRUE(Read(&again));
+    EXPECT_EQ(first.checksum, again.checksum);
+
+    // Same partitions, but another disk signature, as on a different card
+    Put32(440, 0x12345678);
+    PartitionTable other;
+    ASSERT_TRUE(Read(&other));
+    EXPECT_NE(first.checksum, other.checksum);
+
+    PutGpt();
+    PartitionTable gpt;
+    ASSERT_TRUE(Read(&gpt));
+    // The header's own CRC field
+    EXPECT_EQ(image_[528] | image_[529] << 8 | image_[530] << 16 | uint32_t(image_[531]) << 24,
+              gpt.checksum);
+    PutGuid(2 * 512 + 16, kPartGuid);
+    Put32(512 + 88, Crc(2 * 512, 128 * 128));
+    UpdateGptHeaderCrc();
+    PartitionTable changed;
+    ASSERT_TRUE(Read(&changed));
+    EXPECT_NE(gpt.checksum, changed.checksum);
+
+    PartitionTable dump;
+    ParseSgdiskDump({"DISK mbr", "PART 1 0c"}, &dump);
+    EXPECT_EQ(0u, dump.checksum);
+}
+
+TEST_F(PartitionTableTest, CorruptGptLeftToSgdisk) {
+    PutGpt();
+    image_[2 * 512 + 40] ^= 1;
+    PartitionTable table;
+    EXPECT_FALSE(Read(&table));
+
+    PutGpt();
+    Put32(512 + 80, 64);
+    EXPECT_FALSE(Read(&table));
+    UpdateGptHeaderCrc();
+    EXPECT_FALSE(Read(&table));
+}
+
+TEST_F(PartitionTableTest, NoTable) {
+    PartitionTable table;
+    ASSERT_TRUE(Read(&table));
+    EXPECT_EQ(PartitionTable::Type::kUnknown, table.type);
+    EXPECT_TRUE(table.partitions.empty());
+}
+
+TEST_F(PartitionTableTest, UnusualMbrLeftToSgdisk) {
+    PartitionTable table;
+    PutMbrEntry(0, 0x80, 0x0c, 2048, 4096);
+    PutMbrEntry(1, 0, 0x0f, 8192, 8192);
+    EXPECT_FALSE(Read(&table));
+
+    // Beyond the end of the disk
+    PutMbrEntry(1, 0, 0x83, 8192, image_.size());
+    EXPECT_FALSE(Read(&table));
+
+    // Boot code of a filesystem that takes up the whole disk
+    PutMbrEntry(1, 0x4f, 0x20, 0x20202020, 0x20202020);
+    EXPECT_FALSE(Read(&table));
+}
+
+TEST_F(PartitionTableTest, MalformedSgdiskDump) {
+    PartitionTable dump;
+    ParseSgdiskDump({"DISK mbr", "PART", "PART x 0c", "PART 2 zz", "PART 3 0b"}, &dump);
+    EXPECT_EQ(PartitionTable::Type::kMbr, dump.type);
+    // Malformed entries still count, since they show the disk is partitioned
+    ASSERT_EQ(4u, dump.partitions.size());
+    EXPECT_EQ(0, dump.partitions[0].number);
+    EXPECT_EQ(0, dump.partitions[1].number);
+    EXPECT_EQ(2, dump.partitions[2].number);
+    EXPECT_EQ(0, dump.partitions[2].mbrType);
+    EXPECT_EQ(0x0b, dump.partitions[3].mbrType);
+}
+
+}  // namespace vold
+}  // namespace android
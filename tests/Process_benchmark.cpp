@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <android-base/file.h>
+#include <benchmark/benchmark.h>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <string>
+
+#include "../FileTree.h"
+#include "../Process.h"
+
+namespace android {
+namespace vold {
+
+namespace {
+
+// A /proc with the given number of processes, each mapping 64 libraries, holding 32 fds and
+// seeing 24 mounts, none of them under the prefix that is scanned for.
+class FakeProc {
+  public:
+    explicit FakeProc(int processes) {
+        std::string maps;
+        for (int i = 0; i < 64; i++) {
+            maps += "7f0000000000-7f0000001000 r-xp 00000000 fd:00 1234 /system/lib64/lib" +
+                    std::to_string(i) + ".so\n";
+        }
+        std::string mounts;
+        for (int i = 0; i < 24; i++) {
+            mounts += std::to_string(100 + i) + " 1 253:" + std::to_string(i) + " / /mnt/vendor/" +
+                      std::to_string(i) + " ro,relatime shared:1 - ext4 /dev/block/dm-" +
+                      std::to_string(i) + " ro,seclabel\n";
+        }
+
+        for (int pid = 1; pid <= processes; pid++) {
+            std::string dir = std::string(mDir.path) + "/" + std::to_string(pid);
+            mkdir(dir.c_str(), 0700);
+            mkdir((dir + "/ns").c_str(), 0700);
+            mkdir((dir + "/fd").c_str(), 0700);
+            android::base::WriteStringToFile("", dir + "/ns/mnt");
+            android::base::WriteStringToFile(maps, dir + "/maps");
+            android::base::WriteStringToFile(mounts, dir + "/mountinfo");
+            symlink("/", (dir + "/cwd").c_str());
+            symlink("/", (dir + "/root").c_str());
+            symlink("/system/bin/app_process64", (dir + "/exe").c_str());
+            for (int fd = 0; fd < 32; fd++) {
+                symlink(("/data/app/base" + std::to_string(fd) + ".apk").c_str(),
+                        (dir + "/fd/" + std::to_string(fd)).c_str());
+            }
+        }
+    }
+    ~FakeProc() { RemoveTree(mDir.path, false); }
+
+    const char* path() const { return mDir.path; }
+
+  private:
+    TemporaryDir mDir;
+};
+
+void BM_ScanProcesses(benchmark::State& state, uint32_t refs) {
+    FakeProc proc(state.range(0));
+    ProcessScan scan;
+    scan.prefix = "/mnt/pass_through/0/emulated";
+    scan.refs = refs;
+    scan.procRoot = proc.path();
+
+    for (auto _ : state) {
+        int found = 0;
+        if (!ScanProcesses(scan, [&](const ProcessInfo& info) { found += info.refs != 0; })) {
+            state.SkipWithError("ScanProcesses() failed");
+            break;
+        }
+        benchmark::DoNotOptimize(found);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(BM_ScanProcesses, links, kRefCwdRootExe)->Arg(100)->Arg(1000);
+BENCHMARK_CAPTURE(BM_ScanProcesses, tmpfs, kRefTmpfsMount)->Arg(100)->Arg(1000);
+BENCHMARK_CAPTURE(BM_ScanProcesses, maps_fds, kRefMaps | kRefFds)->Arg(100)->Arg(1000);
+BENCHMARK_CAPTURE(BM_ScanProcesses, all, kRefMaps | kRefFds | kRefCwdRootExe | kRefTmpfsMount)
+        ->Arg(100)
+        ->Arg(1000);
+
+}  // namespace vold
+}  // namespace android
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <android-base/file.h>
+#include <gtest/gtest.h>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <set>
+#include <string>
+
+#include "../FileTree.h"
+#include "../Process.h"
+
+namespace android {
+namespace vold {
+
+namespace {
+
+// Process info is cached by pid across scans, so each test uses pids of its own.
+class FakeProc {
+  public:
+    ~FakeProc() { RemoveTree(mDir.path, false); }
+
+    // Adds a process with the given mountinfo, in the mount namespace of sharedWith if that
+    // isn't 0, and in a namespace of its own otherwise.
+    void add(pid_t pid, const std::string& mountInfo, pid_t sharedWith = 0) {
+        auto dir = pidDir(pid);
+        mkdir(dir.c_str(), 0700);
+        mkdir((dir + "/ns").c_str(), 0700);
+        if (sharedWith != 0) {
+            // A hard link has the same inode, as the namespace link of such a process would.
+            ASSERT_EQ(0, link((pidDir(sharedWith) + "/ns/mnt").c_str(), (dir + "/ns/mnt").c_str()));
+        } else {
+            ASSERT_TRUE(android::base::WriteStringToFile("", dir + "/ns/mnt"));
+        }
+        ASSERT_TRUE(android::base::WriteStringToFile(mountInfo, dir + "/mountinfo"));
+    }
+
+    // Replaces a process with a new one that got the same pid. The new /proc/<pid> directory is
+    // made before the old one goes away, so that it gets a new inode just like in /proc.
+    void reuse(pid_t pid, const std::string& mountInfo) {
+        auto dir = pidDir(pid);
+        auto old = dir + ".old";
+        ASSERT_EQ(0, rename(dir.c_str(), old.c_str()));
+        add(pid, mountInfo);
+        ASSERT_EQ(OK, RemoveTree(old, true));
+    }
+
+    std::set<pid_t> scanTmpfs(const std::string& prefix) {
+        ProcessScan scan;
+        scan.prefix = prefix;
+        scan.refs = kRefTmpfsMount;
+        scan.procRoot = mDir.path;
+        std::set<pid_t> found;
+        EXPECT_TRUE(ScanProcesses(scan, [&](const ProcessInfo& info) {
+            if (info.refs & kRefTmpfsMount) found.insert(info.pid);
+        }));
+        return found;
+    }
+
+  private:
+    std::string pidDir(pid_t pid) const {
+        return std::string(mDir.path) + "/" + std::to_string(pid);
+    }
+
+    TemporaryDir mDir;
+};
+
+constexpr char kRootMounts[] =
+        "1 0 253:0 / / ro,relatime shared:1 - ext4 /dev/block/dm-0 ro,seclabel\n"
+        "2 1 0:20 / /mnt rw,nosuid,nodev shared:2 - tmpfs tmpfs rw,seclabel,mode=755\n";
+
+}  // namespace
+
+TEST(ProcessTest, FindsTmpfsMountsUnderPrefix) {
+    FakeProc proc;
+    proc.add(10, std::string(kRootMounts) +
+                         "3 2 0:30 / /mnt/user/0/pkg rw shared:3 - tmpfs tmpfs rw,seclabel\n");
+    proc.add(11, std::string(kRootMounts) +
+                         "3 2 253:5 /media /mnt/user/0/pkg rw - ext4 /dev/block/dm-5 rw\n");
+    proc.add(12, kRootMounts);
+
+    EXPECT_EQ(std::set<pid_t>({10}), proc.scanTmpfs("/mnt/user/0/"));
+}
+
+TEST(ProcessTest, UnescapesMountPoints) {
+    FakeProc proc;
+    proc.add(20, std::string(kRootMounts) +
+                         "3 2 0:30 / /mnt/data\\040dir/obb rw - tmpfs tmpfs rw,seclabel\n");
+
+    EXPECT_EQ(std::set<pid_t>({20}), proc.scanTmpfs("/mnt/data dir/"));
+    EXPECT_TRUE(proc.scanTmpfs("/mnt/data\\040dir/").empty());
+}
+
+TEST(ProcessTest, ReadsEachNamespaceOnce) {
+    FakeProc proc;
+    proc.add(30, std::string(kRootMounts) +
+                         "3 2 0:30 / /mnt/user/0/pkg rw shared:3 - tmpfs tmpfs rw,seclabel\n");
+    // The tables of processes sharing a namespace can't differ, so that of whichever of these is
+    // scanned first is taken for both.
+    proc.add(31, kRootMounts, 30);
+    proc.add(32, kRootMounts);
+
+    auto found = proc.scanTmpfs("/mnt/user/0/");
+    EXPECT_EQ(found.count(30), found.count(31));
+    EXPECT_EQ(0u, found.count(32));
+}
+
+TEST(ProcessTest, ForgetsNamespaceOfDeadProcess) {
+    FakeProc proc;
+    proc.add(40, kRootMounts);
+    proc.add(41, kRootMounts, 40);
+    EXPECT_TRUE(proc.scanTmpfs("/mnt/user/0/").empty());
+
+    // Were the namespace of the dead process still cached, the new one would be taken to share
+    // the namespace of 41.
+    proc.reuse(40, std::string(kRootMounts) +
+                           "3 2 0:30 / /mnt/user/0/pkg rw shared:3 - tmpfs tmpfs rw,seclabel\n");
+    EXPECT_EQ(std::set<pid_t>({40}), proc.scanTmpfs("/mnt/user/0/"));
+}
+
+}  // namespace vold
+}  // namespace android
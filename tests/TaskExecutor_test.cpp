@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include <errno.h>
+
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../TaskExecutor.h"
+#include "android/os/BnVoldTaskListener.h"
+
+using android::os::IVoldTaskListener;
+using android::os::PersistableBundle;
+using namespace std::literals;
+
+namespace android {
+namespace vold {
+
+namespace {
+
+class FinishListener : public android::os::BnVoldTaskListener {
+  public:
+    binder::Status onStatus(int, const PersistableBundle&) override {
+        return binder::Status::ok();
+    }
+    binder::Status onFinished(int status, const PersistableBundle&) override {
+        mFinished.set_value(status);
+        return binder::Status::ok();
+    }
+
+    int wait() {
+        auto finished = mFinished.get_future();
+        return finished.wait_for(10s) == std::future_status::ready ? finished.get() : -ETIMEDOUT;
+    }
+
+  private:
+    std::promise<int> mFinished;
+};
+
+/* Holds up a lane until released, so the tasks posted after it stay queued */
+struct Blocker {
+    std::promise<void> started;
+    std::promise<void> release;
+
+    TaskExecutor::Fn fn() {
+        return [this](const android::sp<IVoldTaskListener>&) {
+            started.set_value();
+            release.get_future().wait();
+        };
+    }
+};
+
+TaskExecutor::Fn Finish(int status, std::mutex* lock = nullptr, std::vector<int>* order = nullptr) {
+    return [=](const android::sp<IVoldTaskListener>& listener) {
+        if (order) {
+            std::lock_guard<std::mutex> guard(*lock);
+            order->push_back(status);
+        }
+        if (listener) listener->onFinished(status, PersistableBundle());
+    };
+}
+
+}  // namespace
+
+// Executors are never destroyed, like the real one, since their lane threads are detached
+TEST(TaskExecutorTest, RunsInOrderAndMergesDuplicates) {
+    auto executor = new TaskExecutor();
+    Blocker blocker;
+    executor->post(TaskExecutor::kMaintenance, "blocker", nullptr, blocker.fn());
+    blocker.started.get_future().wait();
+
+    std::mutex lock;
+    std::vector<int> order;
+    android::sp<FinishListener> first = new FinishListener();
+    android::sp<FinishListener> joined = new FinishListener();
+    android::sp<FinishListener> second = new FinishListener();
+    executor->post(TaskExecutor::kMaintenance, "first", first, Finish(1, &lock, &order));
+    executor->post(TaskExecutor::kMaintenance, "first", joined, Finish(2, &lock, &order));
+    executor->post(TaskExecutor::kMaintenance, "second", second, Finish(3, &lock, &order));
+    blocker.release.set_value();
+
+    EXPECT_EQ(1, first->wait());
+    EXPECT_EQ(1, joined->wait());
+    EXPECT_EQ(3, second->wait());
+    std::lock_guard<std::mutex> guard(lock);
+    EXPECT_EQ((std::vector<int>{1, 3}), order);
+}
+
+TEST(TaskExecutorTest, CancelsQueuedTasks) {
+    auto executor = new TaskExecutor();
+    Blocker blocker;
+    executor->post(TaskExecutor::kMaintenance, "blocker", nullptr, blocker.fn());
+    blocker.started.get_future().wait();
+
+    android::sp<FinishListener> cancelled = new FinishListener();
+    android::sp<FinishListener> kept = new FinishListener();
+    executor->post(TaskExecutor::kMaintenance, "cancelled", cancelled, Finish(0));
+    executor->post(TaskExecutor::kMaintenance, "kept", kept, Finish(0));
+
+    EXPECT_EQ(1, executor->cancel("cancelled"));
+    EXPECT_EQ(-ECANCELED, cancelled->wait());
+    // The running task isn't queued anymore
+    EXPECT_EQ(0, executor->cancel("blocker"));
+
+    blocker.release.set_value();
+    EXPECT_EQ(0, kept->wait());
+}
+
+TEST(TaskExecutorTest, LanesRunIndependently) {
+    auto executor = new TaskExecutor();
+    Blocker blocker;
+    executor->post(TaskExecutor::kMaintenance, "blocker", nullptr, blocker.fn());
+    blocker.started.get_future().wait();
+
+    android::sp<FinishListener> control = new FinishListener();
+    executor->post(TaskExecutor::kControl, "control", control, Finish(0));
+    EXPECT_EQ(0, control->wait());
+
+    blocker.release.set_value();
+}
+
+}  // namespace vold
+}  // namespace android
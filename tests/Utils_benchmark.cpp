@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2026 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+
+#include "../KeyBuffer.h"
+#include "../Utils.h"
+
+namespace android {
+namespace vold {
+
+namespace {
+
+// Key sizes go from a 16 byte descriptor to a 64 byte raw key, up to a wrapped key blob.
+template <typename T>
+void BM_StrToHex(benchmark::State& state) {
+    std::mt19937 rng(42);
+    T str(state.range(0), 0);
+    for (auto& c : str) c = rng();
+
+    T hex;
+    for (auto _ : state) {
+        StrToHex(str, hex);
+        benchmark::DoNotOptimize(hex.data());
+    }
+    state.SetBytesProcessed(state.iterations() * str.size());
+}
+
+void BM_HexToStr(benchmark::State& state) {
+    std::mt19937 rng(42);
+    std::string str(state.range(0), 0);
+    for (auto& c : str) c = rng();
+    std::string hex;
+    StrToHex(str, hex);
+
+    for (auto _ : state) {
+        HexToStr(hex, str);
+        benchmark::DoNotOptimize(str.data());
+    }
+    state.SetBytesProcessed(state.iterations() * str.size());
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_StrToHex, std::string)->Arg(16)->Arg(64)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_StrToHex, KeyBuffer)->Arg(16)->Arg(64)->Arg(4096);
+BENCHMARK(BM_HexToStr)->Arg(16)->Arg(64)->Arg(4096);
+
+}  // namespace vold
+}  // namespace android
@@ -17,6 +17,9 @@
 #include <android-base/file.h>
 #include <gtest/gtest.h>
 
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "../Utils.h"
 
 namespace android {
@@ -62,5 +65,18 @@ TEST_F(UtilsTest, MkdirsSyncTest) {
     ASSERT_FALSE(MkdirsSync("foo", 0700));
 }
 
+TEST_F(UtilsTest, PrepareDirExistingTest) {
+    TemporaryDir temp_dir;
+    std::string path = std::string(temp_dir.path) + "/dir";
+    ASSERT_EQ(0, mkdir(path.c_str(), 0700));
+    ASSERT_EQ(0, chmod(path.c_str(), 02771));
+
+    // A directory that is already right is left alone, without a label lookup
+    ASSERT_EQ(OK, PrepareDir(path, 02771, getuid(), getgid(), 0));
+    struct stat sb;
+    ASSERT_EQ(0, lstat(path.c_str(), &sb));
+    EXPECT_EQ(02771u, sb.st_mode & 07777);
+}
+
 }  // namespace vold
 }  // namespace android
@@ -29,16 +29,27 @@
 #include <sys/un.h>
 
 #include "Utils.h"
+#include "android/os/BnVoldTaskListener.h"
 #include "android/os/IVold.h"
 
 #include <android-base/logging.h>
 #include <android-base/parsebool.h>
+#include <android-base/parsedouble.h>
 #include <android-base/parseint.h>
 #include <android-base/stringprintf.h>
 #include <android-base/strings.h>
 #include <binder/IServiceManager.h>
+#include <binder/ProcessState.h>
 #include <binder/Status.h>
 #include <utils/Errors.h>
+#include <utils/String8.h>
+
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <future>
+#include <map>
+#include <thread>
 
 #include <private/android_filesystem_config.h>
 
@@ -86,6 +97,201 @@ static void bindkeys(std::vector<std::string>& args, const android::sp<android::
     checkStatus(args, vold->setStorageBindingSeed(seed));
 }
 
+static std::string jsonString(const std::string& str) {
+    std::string out = "\"";
+    for (unsigned char c : str) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (c < 0x20) {
+            out += android::base::StringPrintf("\\u%04x", c);
+        } else {
+            out += c;
+        }
+    }
+    return out + "\"";
+}
+
+static std::string jsonString(const android::String16& str) {
+    return jsonString(std::string(android::String8(str).c_str()));
+}
+
+static std::string jsonDouble(double value) {
+    return std::isfinite(value) ? android::base::StringPrintf("%g", value) : "null";
+}
+
+template <typename T>
+static std::string jsonArray(const std::vector<T>& values,
+                             const std::function<std::string(const T&)>& toJson) {
+    std::vector<std::string> items;
+    for (const auto& value : values) items.push_back(toJson(value));
+    return "[" + android::base::Join(items, ",") + "]";
+}
+
+// Every value of the bundle as a JSON object, with the keys sorted
+static std::string jsonBundle(const android::os::PersistableBundle& bundle) {
+    std::map<std::string, std::string> fields;
+    auto add = [&](const android::String16& key, std::string value) {
+        fields[android::String8(key).c_str()] = std::move(value);
+    };
+    for (const auto& key : bundle.getBooleanKeys()) {
+        bool value;
+        if (bundle.getBoolean(key, &value)) add(key, value ? "true" : "false");
+    }
+    for (const auto& key : bundle.getIntKeys()) {
+        int32_t value;
+        if (bundle.getInt(key, &value)) add(key, std::to_string(value));
+    }
+    for (const auto& key : bundle.getLongKeys()) {
+        int64_t value;
+        if (bundle.getLong(key, &value)) add(key, std::to_string(value));
+    }
+    for (const auto& key : bundle.getDoubleKeys()) {
+        double value;
+        if (bundle.getDouble(key, &value)) add(key, jsonDouble(value));
+    }
+    for (const auto& key : bundle.getStringKeys()) {
+        android::String16 value;
+        if (bundle.getString(key, &value)) add(key, jsonString(value));
+    }
+    for (const auto& key : bundle.getLongVectorKeys()) {
+        std::vector<int64_t> value;
+        if (!bundle.getLongVector(key, &value)) continue;
+        add(key, jsonArray<int64_t>(value, [](const int64_t& v) { return std::to_string(v); }));
+    }
+    for (const auto& key : bundle.getStringVectorKeys()) {
+        std::vector<android::String16> value;
+        if (!bundle.getStringVector(key, &value)) continue;
+        add(key, jsonArray<android::String16>(
+                         value, [](const android::String16& v) { return jsonString(v); }));
+    }
+
+    std::vector<std::string> items;
+    for (const auto& [key, value] : fields) items.push_back(jsonString(key) + ":" + value);
+    return "{" + android::base::Join(items, ",") + "}";
+}
+
+// Prints every callback of one run of a task as a line of JSON on stdout, as it comes in.
+class TaskPrinter : public android::os::BnVoldTaskListener {
+  public:
+    TaskPrinter(const std::string& task, int run)
+        : mTask(task), mRun(run), mStart(std::chrono::steady_clock::now()) {}
+
+    android::binder::Status onStatus(int status,
+                                     const android::os::PersistableBundle& extras) override {
+        print("status", status, extras);
+        return android::binder::Status::ok();
+    }
+
+    android::binder::Status onFinished(int status,
+                                       const android::os::PersistableBundle& extras) override {
+        print("finished", status, extras);
+        mFinished.set_value(status);
+        return android::binder::Status::ok();
+    }
+
+    int wait() { return mFinished.get_future().get(); }
+
+  private:
+    void print(const char* event, int status, const android::os::PersistableBundle& extras) {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - mStart);
+        auto line = android::base::StringPrintf(
+                "{\"task\":%s,\"run\":%d,\"event\":\"%s\",\"status\":%d,\"elapsed_ms\":%lld,"
+                "\"extras\":%s}\n",
+                jsonString(mTask).c_str(), mRun, event, status,
+                static_cast<long long>(elapsed.count()), jsonBundle(extras).c_str());
+        fputs(line.c_str(), stdout);
+        fflush(stdout);
+    }
+
+    const std::string mTask;
+    const int mRun;
+    const std::chrono::steady_clock::time_point mStart;
+    std::promise<int> mFinished;
+};
+
+// Runs one of the tasks that report through an IVoldTaskListener, as many times as asked, and
+// exits with the status of the last run that failed, or 0.
+//
+//   task benchmark <volId> [--scale=<x>] [--time-budget-ms=<ms>] [--direct-io] [--raw-block]
+//   task fstrim [--deep]
+//   task idleMaint [--gc]
+//
+// each taking [--repeat=<n>] [--interval-ms=<ms>] too.
+static int runTask(std::vector<std::string>& args, const android::sp<android::os::IVold>& vold) {
+    const std::string& task = args[1];
+    std::vector<std::string> positional;
+    int repeat = 1, intervalMs = 0;
+    int64_t timeBudgetMs = 20000;
+    double scale = 1.0;
+    bool directIo = false, rawBlock = false, deep = false, gc = false;
+    for (size_t i = 2; i < args.size(); i++) {
+        const auto& arg = args[i];
+        auto value = [&](const char* flag) -> const char* {
+            return android::base::StartsWith(arg, flag) ? arg.c_str() + strlen(flag) : nullptr;
+        };
+        bool ok = true;
+        if (auto v = value("--repeat=")) {
+            ok = android::base::ParseInt(v, &repeat, 1);
+        } else if (auto v = value("--interval-ms=")) {
+            ok = android::base::ParseInt(v, &intervalMs, 0);
+        } else if (auto v = value("--scale=")) {
+            ok = android::base::ParseDouble(v, &scale);
+        } else if (auto v = value("--time-budget-ms=")) {
+            ok = android::base::ParseInt(v, &timeBudgetMs, int64_t(1));
+        } else if (arg == "--direct-io") {
+            directIo = true;
+        } else if (arg == "--raw-block") {
+            rawBlock = true;
+        } else if (arg == "--deep") {
+            deep = true;
+        } else if (arg == "--gc") {
+            gc = true;
+        } else if (android::base::StartsWith(arg, "--")) {
+            ok = false;
+        } else {
+            positional.push_back(arg);
+        }
+        if (!ok) {
+            LOG(ERROR) << "Bad task argument " << arg;
+            exit(EINVAL);
+        }
+    }
+
+    std::function<android::binder::Status(const android::sp<TaskPrinter>&)> start;
+    if (task == "benchmark" && positional.size() == 1) {
+        start = [&](const android::sp<TaskPrinter>& listener) {
+            return vold->benchmarkWithOptions(positional[0], scale, timeBudgetMs, directIo,
+                                              rawBlock, listener);
+        };
+    } else if (task == "fstrim" && positional.empty()) {
+        int flags = deep ? android::os::IVold::FSTRIM_FLAG_DEEP_TRIM : 0;
+        start = [&](const android::sp<TaskPrinter>& listener) {
+            return vold->fstrim(flags, listener);
+        };
+    } else if (task == "idleMaint" && positional.empty()) {
+        start = [&](const android::sp<TaskPrinter>& listener) {
+            return vold->runIdleMaint(gc, listener);
+        };
+    } else {
+        LOG(ERROR) << "Unknown task " << android::base::Join(args, " ");
+        exit(EINVAL);
+    }
+
+    // The callbacks come in on binder threads.
+    android::ProcessState::self()->startThreadPool();
+    int result = 0;
+    for (int run = 0; run < repeat; run++) {
+        if (run > 0) std::this_thread::sleep_for(std::chrono::milliseconds(intervalMs));
+        android::sp<TaskPrinter> listener = new TaskPrinter(task, run);
+        checkStatus(args, start(listener));
+        int status = listener->wait();
+        if (status != 0) result = status < 0 ? -status : status;
+    }
+    return result;
+}
+
 int main(int argc, char** argv) {
     setenv("ANDROID_LOG_TAGS", "*:v", 1);
     if (getppid() == 1) {
@@ -181,6 +387,8 @@ int main(int argc, char** argv) {
         checkStatus(args, vold->resetCheckpoint());
     } else if (args[0] == "keymaster" && args[1] == "earlyBootEnded") {
         checkStatus(args, vold->earlyBootEnded());
+    } else if (args[0] == "task") {
+        return runTask(args, vold);
     } else {
         LOG(ERROR) << "Raw commands are no longer supported";
         exit(EINVAL);
@@ -190,4 +398,6 @@ int main(int argc, char** argv) {
 
 static void usage(char* progname) {
     LOG(INFO) << "Usage: " << progname << " [--wait] <system> <subcommand> [args...]";
+    LOG(INFO) << "       " << progname << " task <benchmark|fstrim|idleMaint> [args...]"
+              << " [--repeat=<n>] [--interval-ms=<ms>]";
 }
@@ -24,25 +24,34 @@
 #include <vector>
 
 #include <dirent.h>
+#include <poll.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <unistd.h>
 
+#include <android-base/file.h>
 #include <android-base/logging.h>
 #include <android-base/scopeguard.h>
+#include <android-base/strings.h>
 
 #include <cutils/fs.h>
 #include <selinux/android.h>
 
+#include "FileTree.h"
 #include "Utils.h"
 #include "android/os/IVold.h"
 
 #include <private/android_filesystem_config.h>
 
+// How long "serve" waits for the next request before exiting
+static constexpr int kServeIdleTimeoutMs = 30 * 1000;
+
 static void usage(const char* progname) {
     std::cerr << "Usage: " << progname << " [ prepare | destroy ] <volume_uuid> <user_id> <flags>"
-              << std::endl;
+              << std::endl
+              << "       " << progname << " serve" << std::endl;
     exit(-1);
 }
 
@@ -111,34 +120,10 @@ static bool prepare_dir(struct selabel_handle* sehandle, mode_t mode, uid_t uid,
     return prepare_dir_for_user(sehandle, mode, uid, gid, path, (uid_t)-1);
 }
 
+// Symlinks below path are removed rather than followed, and path itself must be a real
+// directory. RemoveTree() already logged any error.
 static bool rmrf_contents(const std::string& path) {
-    auto dirp = std::unique_ptr<DIR, int (*)(DIR*)>(opendir(path.c_str()), closedir);
-    if (!dirp) {
-        if (errno == ENOENT) {
-            return true;
-        }
-        PLOG(ERROR) << "Unable to open directory: " << path;
-        return false;
-    }
-    bool res = true;
-    for (;;) {
-        errno = 0;
-        auto const entry = readdir(dirp.get());
-        if (!entry) {
-            if (errno) {
-                PLOG(ERROR) << "readdir failed on: " << path;
-                return false;
-            }
-            return res;
-        }
-        if (entry->d_name[0] == '.') continue;
-        auto subdir = path + "/" + entry->d_name;
-        if (0 !=
-            android::vold::ForkExecvp(std::vector<std::string>{"/system/bin/rm", "-rf", subdir})) {
-            LOG(ERROR) << "rm -rf failed on " << subdir;
-            res = false;
-        }
-    }
+    return android::vold::RemoveTree(path, false) == android::OK;
 }
 
 static bool prepare_apex_subdirs(struct selabel_handle* sehandle, const std::string& path) {
@@ -167,7 +152,8 @@ static bool prepare_apex_subdirs(struct selabel_handle* sehandle, const std::str
 }
 
 static bool prepare_subdirs(const std::string& volume_uuid, int user_id, int flags) {
-    struct selabel_handle* sehandle = selinux_android_file_context_handle();
+    // Loaded once, since "serve" prepares subdirs for many users and volumes
+    static struct selabel_handle* sehandle = selinux_android_file_context_handle();
     if (!sehandle) {
         LOG(ERROR) << "Failed to get SELinux file contexts handle";
         return false;
@@ -285,25 +271,63 @@ static bool destroy_subdirs(const std::string& volume_uuid, int user_id, int fla
     return res;
 }
 
-int main(int argc, const char* const argv[]) {
-    android::base::InitLogging(const_cast<char**>(argv));
-    std::vector<std::string> args(argv + 1, argv + argc);
-
-    if (args.size() != 4 || !valid_uuid(args[1]) || !small_int(args[2]) || !small_int(args[3])) {
-        usage(argv[0]);
-        return -1;
-    }
+static bool valid_args(const std::vector<std::string>& args) {
+    return args.size() == 4 && valid_uuid(args[1]) && small_int(args[2]) && small_int(args[3]);
+}
 
+static bool run(const std::vector<std::string>& args) {
     auto volume_uuid = args[1];
     int user_id = stoi(args[2]);
     int flags = stoi(args[3]);
-    if (args[0] == "prepare") {
-        if (!prepare_subdirs(volume_uuid, user_id, flags)) return -1;
-    } else if (args[0] == "destroy") {
-        if (!destroy_subdirs(volume_uuid, user_id, flags)) return -1;
-    } else {
+    if (args[0] == "prepare") return prepare_subdirs(volume_uuid, user_id, flags);
+    if (args[0] == "destroy") return destroy_subdirs(volume_uuid, user_id, flags);
+    LOG(ERROR) << "Unknown action " << args[0];
+    return false;
+}
+
+// Reads a request line from stdin, or returns false at EOF or after being idle for too long.
+static bool read_request(std::string* line) {
+    line->clear();
+    for (;;) {
+        struct pollfd pfd = {.fd = STDIN_FILENO, .events = POLLIN};
+        int n = TEMP_FAILURE_RETRY(poll(&pfd, 1, kServeIdleTimeoutMs));
+        if (n <= 0) return false;
+        char c;
+        if (TEMP_FAILURE_RETRY(read(STDIN_FILENO, &c, 1)) != 1) return false;
+        if (c == '\n') return true;
+        line->push_back(c);
+    }
+}
+
+// Serves "<action> <user_id> <flags> <volume_uuid>" requests from vold, one per line, answering
+// each with a line holding 0 or -1.  The uuid goes last since it may be empty.
+static int serve() {
+    std::string line;
+    while (read_request(&line)) {
+        auto fields = android::base::Split(line, " ");
+        bool ok = false;
+        if (fields.size() == 4) {
+            std::vector<std::string> args = {fields[0], fields[3], fields[1], fields[2]};
+            ok = valid_args(args) && run(args);
+        } else {
+            LOG(ERROR) << "Malformed request: " << line;
+        }
+        if (!android::base::WriteStringToFd(ok ? "0\n" : "-1\n", STDOUT_FILENO)) {
+            PLOG(ERROR) << "Failed to reply to vold";
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int main(int argc, const char* const argv[]) {
+    android::base::InitLogging(const_cast<char**>(argv));
+    std::vector<std::string> args(argv + 1, argv + argc);
+
+    if (args.size() == 1 && args[0] == "serve") return serve();
+    if (!valid_args(args) || (args[0] != "prepare" && args[0] != "destroy")) {
         usage(argv[0]);
         return -1;
     }
-    return 0;
+    return run(args) ? 0 : -1;
 }